@@ -135,6 +135,250 @@
 #endif
 
 
+/*
+ *  To let production builds keep what __Check, __nCheck, __Check_String and
+ *  __nCheck_String assert as optimizer hints, #define DEBUG_ASSERT_ASSUME to 1
+ *  before including this file.  The assertion is then handed to the compiler as
+ *  an assumption (clang's __builtin_assume, gcc's assume attribute, C++23
+ *  [[assume]], or "if ( !(assertion) ) __builtin_unreachable()" elsewhere), so
+ *  facts such as non-null pointers, bounded indices or aligned sizes can remove
+ *  later tests and remainder loops.  Nothing is reported; a false assumption is
+ *  undefined behavior.
+ *
+ *  Only use this with assertions that are free of side effects.  The first three
+ *  forms never evaluate the expression, but the __builtin_unreachable fallback
+ *  does, and it only becomes a pure hint when the compiler can see that the
+ *  expression has no side effects (no calls to functions it cannot inline).
+ *
+ *  Non-production builds are not affected.  DEBUG_ASSERT_ASSUME_CONDITION(assertion)
+ *  may be defined to supply a different assumption statement.
+ */
+#ifndef DEBUG_ASSERT_ASSUME
+   #define DEBUG_ASSERT_ASSUME 0
+#endif
+
+#ifndef DEBUG_ASSERT_ASSUME_CONDITION
+   #if defined(__clang__)
+      #define DEBUG_ASSERT_ASSUME_CONDITION(assertion)                                  \
+                                  do { __builtin_assume(!!(assertion)); } while ( 0 )
+   #elif defined(__GNUC__) && __GNUC__ >= 13
+      #define DEBUG_ASSERT_ASSUME_CONDITION(assertion)                                  \
+                                  do { __attribute__((__assume__(assertion))); } while ( 0 )
+   #elif defined(__cplusplus) && __cplusplus >= 202302L
+      #define DEBUG_ASSERT_ASSUME_CONDITION(assertion)                                  \
+                                  do { [[assume(assertion)]]; } while ( 0 )
+   #else
+      #define DEBUG_ASSERT_ASSUME_CONDITION(assertion)                                  \
+                                  do { if ( !(assertion) ) __builtin_unreachable(); } while ( 0 )
+   #endif
+#endif
+
+
+/*
+ *  To capture a stack backtrace the first time each assertion site fails,
+ *  #define DEBUG_ASSERT_BACKTRACE to 1 before including this file, compile with
+ *  frame pointers and link libCarbonHeaders.  Repeated stacks are only counted;
+ *  see AssertMacrosBacktrace.h for how to dump them.
+ *
+ *  If DEBUG_ASSERT_BACKTRACE_SAMPLE_INTERVAL is non-zero, every Nth failure of a
+ *  site is captured as well, instead of only the first one.
+ *
+ *  The default DEBUG_ASSERT_MESSAGE records the backtrace itself.  A custom
+ *  DEBUG_ASSERT_MESSAGE can invoke DEBUG_ASSERT_RECORD_BACKTRACE(file, line) to do
+ *  the same; it expands to nothing when DEBUG_ASSERT_BACKTRACE is 0.
+ */
+#ifndef DEBUG_ASSERT_BACKTRACE
+   #define DEBUG_ASSERT_BACKTRACE 0
+#endif
+
+#ifndef DEBUG_ASSERT_BACKTRACE_SAMPLE_INTERVAL
+   #define DEBUG_ASSERT_BACKTRACE_SAMPLE_INTERVAL 0
+#endif
+
+#ifndef DEBUG_ASSERT_RECORD_BACKTRACE
+   #if DEBUG_ASSERT_BACKTRACE && !defined(KERNEL)
+      #include <AssertMacrosBacktrace.h>
+      #define DEBUG_ASSERT_RECORD_BACKTRACE(file, line)                              \
+                                  do {                                               \
+                                      static DebugAssertBacktraceSite site;          \
+                                      DebugAssertRecordBacktrace(&site,              \
+                                          DEBUG_ASSERT_BACKTRACE_SAMPLE_INTERVAL, file, line); \
+                                  } while ( 0 )
+   #else
+      #define DEBUG_ASSERT_RECORD_BACKTRACE(file, line)  do {} while ( 0 )
+   #endif
+#endif
+
+
+/*
+ *  To switch assertion reporting on and off per component while the program runs,
+ *  #define DEBUG_ASSERT_COMPONENT_MASKS to 1 before including this file and link
+ *  libCarbonHeaders.  Reporting is then controlled by the DEBUG_ASSERT_COMPONENTS
+ *  environment variable and by DebugAssertSetComponentEnabled(); see
+ *  AssertMacrosComponents.h.  The check costs one relaxed load, and only when an
+ *  assertion fails.
+ *
+ *  The default DEBUG_ASSERT_MESSAGE performs the check itself.  A custom
+ *  DEBUG_ASSERT_MESSAGE can test DEBUG_ASSERT_COMPONENT_ENABLED(), which is true
+ *  when reporting is on for this file's DEBUG_ASSERT_COMPONENT_NAME_STRING (and
+ *  always true when DEBUG_ASSERT_COMPONENT_MASKS is 0).
+ */
+#ifndef DEBUG_ASSERT_COMPONENT_MASKS
+   #define DEBUG_ASSERT_COMPONENT_MASKS 0
+#endif
+
+#ifndef DEBUG_ASSERT_COMPONENT_ENABLED
+   #if DEBUG_ASSERT_COMPONENT_MASKS && !defined(KERNEL)
+      #include <AssertMacrosComponents.h>
+      static DebugAssertComponent gDebugAssertComponent __attribute__((unused)) =
+                                  { DEBUG_ASSERT_COMPONENT_NAME_STRING, kDebugAssertComponentUnresolved, 0 };
+      #define DEBUG_ASSERT_COMPONENT_ENABLED()  DebugAssertComponentIsEnabled(&gDebugAssertComponent)
+   #else
+      #define DEBUG_ASSERT_COMPONENT_ENABLED()  1
+   #endif
+#endif
+
+
+/*
+ *  Every macro below tests for failure with DEBUG_ASSERT_EXPECT_FAILURE(failed), which
+ *  tells the compiler to expect DEBUG_ASSERT_FAILURE_EXPECTED: 0 (failure is rare)
+ *  unless you define it otherwise.  The hint is read where each macro is expanded, so
+ *  it can be changed for one translation unit or, with push_macro/pop_macro, for a
+ *  single site which is expected to fail.
+ *
+ *  To find the sites whose hint is wrong, #define DEBUG_ASSERT_BRANCH_PROFILE to 1
+ *  before including this file and link libCarbonHeaders.  Each site then counts its
+ *  passes and failures, and DebugAssertBranchProfileReport() lists the sites whose
+ *  failure rate contradicts their hint; see AssertMacrosBranchProfile.h.
+ */
+#ifndef DEBUG_ASSERT_FAILURE_EXPECTED
+   #define DEBUG_ASSERT_FAILURE_EXPECTED 0
+#endif
+
+#ifndef DEBUG_ASSERT_BRANCH_PROFILE
+   #define DEBUG_ASSERT_BRANCH_PROFILE 0
+#endif
+
+#ifndef DEBUG_ASSERT_EXPECT_FAILURE
+   #if DEBUG_ASSERT_BRANCH_PROFILE && !defined(KERNEL)
+      #include <AssertMacrosBranchProfile.h>
+      #define DEBUG_ASSERT_EXPECT_FAILURE(failed)                                        \
+                                  __builtin_expect(({                                \
+                                      static DebugAssertBranchSite site =            \
+                                          { __FILE__, __LINE__, #failed,             \
+                                            DEBUG_ASSERT_FAILURE_EXPECTED, 0, 0, 0, 0 }; \
+                                      DebugAssertCountBranch(&site, (failed) != 0);  \
+                                  }), DEBUG_ASSERT_FAILURE_EXPECTED)
+   #else
+      #define DEBUG_ASSERT_EXPECT_FAILURE(failed)                                        \
+                                  __builtin_expect((failed), DEBUG_ASSERT_FAILURE_EXPECTED)
+   #endif
+#endif
+
+
+/*
+ *  To let tracers (bpftrace, perf, SystemTap) attach to assertion failures in a live
+ *  process, #define DEBUG_ASSERT_PROBES to 1 before including this file.  Every failure
+ *  path then fires DEBUG_ASSERT_FAILURE_PROBE(errorCode), a carbonheaders:assert_failure
+ *  SDT probe carrying the component, file, line and error code; it works in production
+ *  builds too and never writes to stderr.  See AssertMacrosProbes.h.
+ *
+ *  DEBUG_ASSERT_PROBE_ERROR_CODE(errorCode) evaluates errorCode once, fires the probe if
+ *  it is not 0, and yields it; it is used where a failure path has no block of its own.
+ */
+#ifndef DEBUG_ASSERT_PROBES
+   #define DEBUG_ASSERT_PROBES 0
+#endif
+
+#ifndef DEBUG_ASSERT_FAILURE_PROBE
+   #if DEBUG_ASSERT_PROBES && !defined(KERNEL)
+      #include <AssertMacrosProbes.h>
+      #define DEBUG_ASSERT_FAILURE_PROBE(errorCode)                                      \
+                                  DEBUG_ASSERT_SDT_PROBE(DEBUG_ASSERT_COMPONENT_NAME_STRING, \
+                                      __FILE__, __LINE__, errorCode)
+   #else
+      #define DEBUG_ASSERT_FAILURE_PROBE(errorCode)  do {} while ( 0 )
+   #endif
+#endif
+
+#ifndef DEBUG_ASSERT_PROBE_ERROR_CODE
+   #if DEBUG_ASSERT_PROBES && !defined(KERNEL)
+      #define DEBUG_ASSERT_PROBE_ERROR_CODE(errorCode)                                   \
+                                  ({                                                 \
+                                      long evalOnceErrorCode = (errorCode);          \
+                                      if ( 0 != evalOnceErrorCode )                  \
+                                          DEBUG_ASSERT_FAILURE_PROBE(evalOnceErrorCode); \
+                                      evalOnceErrorCode;                             \
+                                  })
+   #else
+      #define DEBUG_ASSERT_PROBE_ERROR_CODE(errorCode)  (errorCode)
+   #endif
+#endif
+
+
+/*
+ *  To count which error codes __Require_noErr and its variants fail with, #define
+ *  DEBUG_ASSERT_ERROR_HISTOGRAM to 1 before including this file and link
+ *  libCarbonHeaders.  Every one of their failure paths then passes its errorCode to
+ *  MacErrorsHistogramRecord(), in production builds too; see MacErrorsHistogram.h.
+ *  Define DEBUG_ASSERT_RECORD_ERROR(errorCode) yourself to count them another way.
+ */
+#ifndef DEBUG_ASSERT_ERROR_HISTOGRAM
+   #define DEBUG_ASSERT_ERROR_HISTOGRAM 0
+#endif
+
+#ifndef DEBUG_ASSERT_RECORD_ERROR
+   #if DEBUG_ASSERT_ERROR_HISTOGRAM && !defined(KERNEL)
+      #include <MacErrorsHistogram.h>
+      #define DEBUG_ASSERT_RECORD_ERROR(errorCode)  MacErrorsHistogramRecord((int32_t)(errorCode))
+   #else
+      #define DEBUG_ASSERT_RECORD_ERROR(errorCode)  do {} while ( 0 )
+   #endif
+#endif
+
+
+/*
+ *  To time regions against latency budgets with __Within_Start and __Check_Within,
+ *  __Verify_Within or __Require_Within, #define DEBUG_ASSERT_WITHIN to 1 before
+ *  including this file and link libCarbonHeaders.  Otherwise, and always in production
+ *  builds, those macros produce no code.
+ *
+ *  If DEBUG_ASSERT_WITHIN_SAMPLE_INTERVAL is greater than 1, each site only times every
+ *  Nth pass through its region (and the first one), which keeps the cost of reading
+ *  the tick counter out of most requests.
+ */
+#ifndef DEBUG_ASSERT_WITHIN
+   #define DEBUG_ASSERT_WITHIN 0
+#endif
+
+#ifndef DEBUG_ASSERT_WITHIN_SAMPLE_INTERVAL
+   #define DEBUG_ASSERT_WITHIN_SAMPLE_INTERVAL 1
+#endif
+
+#if DEBUG_ASSERT_WITHIN && !DEBUG_ASSERT_PRODUCTION_CODE && !defined(KERNEL)
+   #include <AssertMacrosWithin.h>
+   #define __ASSERT_MACROS_TIME_REGIONS 1
+#else
+   #define __ASSERT_MACROS_TIME_REGIONS 0
+#endif
+
+
+/*
+ *  To have the default DEBUG_ASSERT_MESSAGE print a non-zero errorCode along with the
+ *  name MacErrors.h gives it ("value: -43 (fnfErr)"), #define DEBUG_ASSERT_ERROR_NAMES
+ *  to 1 before including this file and link libCarbonHeaders.  Any value that fits in
+ *  an OSStatus is looked up, so one which is not an error code (the elapsed time that
+ *  __Check_Within reports, for instance) can occasionally be given a name as well.
+ */
+#ifndef DEBUG_ASSERT_ERROR_NAMES
+   #define DEBUG_ASSERT_ERROR_NAMES 0
+#endif
+
+#if DEBUG_ASSERT_ERROR_NAMES && !defined(KERNEL)
+   #include <MacErrorsLookup.h>
+#endif
+
+
 /*
  *  DEBUG_ASSERT_MESSAGE(component, assertion, label, error, file, line, errorCode)
  *
@@ -216,8 +460,34 @@
                                   printf( "AssertMacros: %s, %s file: %s, line: %d\n", assertion, (message!=0) ? message : "", file, line);
    #else
       #include <stdio.h>
-      #define DEBUG_ASSERT_MESSAGE(name, assertion, label, message, file, line, value) \
-                                  fprintf(stderr, "AssertMacros: %s, %s file: %s, line: %d\n", assertion, (message!=0) ? message : "", file, line);
+      #if DEBUG_ASSERT_ERROR_NAMES
+         #define __DEBUG_ASSERT_PRINT_MESSAGE(assertion, message, file, line, value) \
+                                  do {                                               \
+                                      long evalOnceValue = (long)(value);            \
+                                      const char *evalOnceValueName = ( evalOnceValue != 0 && evalOnceValue == (int32_t)evalOnceValue ) ? \
+                                          GetMacErrorName((int32_t)evalOnceValue) : 0; \
+                                      if ( evalOnceValue == 0 )                      \
+                                          fprintf(stderr, "AssertMacros: %s, %s file: %s, line: %d\n", assertion, (message!=0) ? message : "", file, line); \
+                                      else                                           \
+                                          fprintf(stderr, "AssertMacros: %s, %s file: %s, line: %d, value: %ld%s%s%s\n", assertion, (message!=0) ? message : "", file, line, \
+                                              evalOnceValue, (evalOnceValueName!=0) ? " (" : "", (evalOnceValueName!=0) ? evalOnceValueName : "", (evalOnceValueName!=0) ? ")" : ""); \
+                                  } while ( 0 )
+      #else
+         #define __DEBUG_ASSERT_PRINT_MESSAGE(assertion, message, file, line, value) \
+                                  fprintf(stderr, "AssertMacros: %s, %s file: %s, line: %d\n", assertion, (message!=0) ? message : "", file, line)
+      #endif
+      #if DEBUG_ASSERT_BACKTRACE || DEBUG_ASSERT_COMPONENT_MASKS
+         #define DEBUG_ASSERT_MESSAGE(name, assertion, label, message, file, line, value) \
+                                  do {                                               \
+                                      if ( DEBUG_ASSERT_COMPONENT_ENABLED() ) {      \
+                                          DEBUG_ASSERT_RECORD_BACKTRACE(file, line); \
+                                          __DEBUG_ASSERT_PRINT_MESSAGE(assertion, message, file, line, value); \
+                                      }                                              \
+                                  } while ( 0 )
+      #else
+         #define DEBUG_ASSERT_MESSAGE(name, assertion, label, message, file, line, value) \
+                                  __DEBUG_ASSERT_PRINT_MESSAGE(assertion, message, file, line, value);
+      #endif
    #endif
 #endif
 
@@ -262,7 +532,8 @@
  *  __Check(assertion)
  *
  *  Summary:
- *    Production builds: does nothing and produces no code.
+ *    Production builds: does nothing and produces no code.  With DEBUG_ASSERT_ASSUME,
+ *    the assertion is passed to the optimizer as an assumption instead.
  *
  *    Non-production builds: if the assertion expression evaluates to false,
  *    call DEBUG_ASSERT_MESSAGE.
@@ -273,14 +544,17 @@
  *      The assertion expression.
  */
 #ifndef __Check
-	#if DEBUG_ASSERT_PRODUCTION_CODE
+	#if DEBUG_ASSERT_PRODUCTION_CODE && DEBUG_ASSERT_ASSUME
+	   #define __Check(assertion)  DEBUG_ASSERT_ASSUME_CONDITION(assertion)
+	#elif DEBUG_ASSERT_PRODUCTION_CODE
 	   #define __Check(assertion)
 	#else
 	   #define __Check(assertion)                                                 \
 		  do                                                                      \
 		  {                                                                       \
-			  if ( __builtin_expect(!(assertion), 0) )                            \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(!(assertion)) )                    \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(0);                                  \
 				  DEBUG_ASSERT_MESSAGE(                                           \
 					  DEBUG_ASSERT_COMPONENT_NAME_STRING,                         \
 					  #assertion, 0, 0, __FILE__, __LINE__, 0 );                  \
@@ -297,7 +571,8 @@
  *  __Check_String(assertion, message)
  *
  *  Summary:
- *    Production builds: does nothing and produces no code.
+ *    Production builds: does nothing and produces no code.  With DEBUG_ASSERT_ASSUME,
+ *    the assertion is passed to the optimizer as an assumption instead.
  *
  *    Non-production builds: if the assertion expression evaluates to false,
  *    call DEBUG_ASSERT_MESSAGE.
@@ -311,14 +586,17 @@
  *      The C string to display.
  */
 #ifndef __Check_String
-	#if DEBUG_ASSERT_PRODUCTION_CODE
+	#if DEBUG_ASSERT_PRODUCTION_CODE && DEBUG_ASSERT_ASSUME
+	   #define __Check_String(assertion, message)  DEBUG_ASSERT_ASSUME_CONDITION(assertion)
+	#elif DEBUG_ASSERT_PRODUCTION_CODE
 	   #define __Check_String(assertion, message)
 	#else
 	   #define __Check_String(assertion, message)                                 \
 		  do                                                                      \
 		  {                                                                       \
-			  if ( __builtin_expect(!(assertion), 0) )                            \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(!(assertion)) )                    \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(0);                                  \
 				  DEBUG_ASSERT_MESSAGE(                                           \
 					  DEBUG_ASSERT_COMPONENT_NAME_STRING,                         \
 					  #assertion, 0, message, __FILE__, __LINE__, 0 );            \
@@ -353,8 +631,9 @@
 		  do                                                                      \
 		  {                                                                       \
 			  long evalOnceErrorCode = (errorCode);                               \
-			  if ( __builtin_expect(0 != evalOnceErrorCode, 0) )                  \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(0 != evalOnceErrorCode) )          \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(evalOnceErrorCode);                  \
 				  DEBUG_ASSERT_MESSAGE(                                           \
 					  DEBUG_ASSERT_COMPONENT_NAME_STRING,                         \
 					  #errorCode " == 0 ", 0, 0, __FILE__, __LINE__, evalOnceErrorCode ); \
@@ -389,8 +668,9 @@
 		  do                                                                      \
 		  {                                                                       \
 			  long evalOnceErrorCode = (errorCode);                               \
-			  if ( __builtin_expect(0 != evalOnceErrorCode, 0) )                  \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(0 != evalOnceErrorCode) )          \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(evalOnceErrorCode);                  \
 				  DEBUG_ASSERT_MESSAGE(                                           \
 					  DEBUG_ASSERT_COMPONENT_NAME_STRING,                         \
 					  #errorCode " == 0 ", 0, message, __FILE__, __LINE__, evalOnceErrorCode ); \
@@ -421,14 +701,16 @@
 		  {                                                                       \
 			  if ( !(assertion) )                                                 \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(0);                                  \
 			  }                                                                   \
 		  } while ( 0 )
 	#else
 	   #define __Verify(assertion)                                                \
 		  do                                                                      \
 		  {                                                                       \
-			  if ( __builtin_expect(!(assertion), 0) )                            \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(!(assertion)) )                    \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(0);                                  \
 				  DEBUG_ASSERT_MESSAGE(                                           \
 					  DEBUG_ASSERT_COMPONENT_NAME_STRING,                         \
 					  #assertion, 0, 0, __FILE__, __LINE__, 0 );                  \
@@ -466,14 +748,16 @@
 		  {                                                                       \
 			  if ( !(assertion) )                                                 \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(0);                                  \
 			  }                                                                   \
 		  } while ( 0 )
 	#else
 	   #define __Verify_String(assertion, message)                                \
 		  do                                                                      \
 		  {                                                                       \
-			  if ( __builtin_expect(!(assertion), 0) )                            \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(!(assertion)) )                    \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(0);                                  \
 				  DEBUG_ASSERT_MESSAGE(                                           \
 					  DEBUG_ASSERT_COMPONENT_NAME_STRING,                         \
 					  #assertion, 0, message, __FILE__, __LINE__, 0 );            \
@@ -506,8 +790,10 @@
 	   #define __Verify_noErr(errorCode)                                          \
 		  do                                                                      \
 		  {                                                                       \
-			  if ( 0 != (errorCode) )                                             \
+			  long evalOnceErrorCode = (errorCode);                               \
+			  if ( 0 != evalOnceErrorCode )                                       \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(evalOnceErrorCode);                  \
 			  }                                                                   \
 		  } while ( 0 )
 	#else
@@ -515,8 +801,9 @@
 		  do                                                                      \
 		  {                                                                       \
 			  long evalOnceErrorCode = (errorCode);                               \
-			  if ( __builtin_expect(0 != evalOnceErrorCode, 0) )                  \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(0 != evalOnceErrorCode) )          \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(evalOnceErrorCode);                  \
 				  DEBUG_ASSERT_MESSAGE(                                           \
 					  DEBUG_ASSERT_COMPONENT_NAME_STRING,                         \
 					  #errorCode " == 0 ", 0, 0, __FILE__, __LINE__, evalOnceErrorCode ); \
@@ -548,8 +835,10 @@
 	   #define __Verify_noErr_String(errorCode, message)                          \
 		  do                                                                      \
 		  {                                                                       \
-			  if ( 0 != (errorCode) )                                             \
+			  long evalOnceErrorCode = (errorCode);                               \
+			  if ( 0 != evalOnceErrorCode )                                       \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(evalOnceErrorCode);                  \
 			  }                                                                   \
 		  } while ( 0 )
 	#else
@@ -557,8 +846,9 @@
 		  do                                                                      \
 		  {                                                                       \
 			  long evalOnceErrorCode = (errorCode);                               \
-			  if ( __builtin_expect(0 != evalOnceErrorCode, 0) )                  \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(0 != evalOnceErrorCode) )          \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(evalOnceErrorCode);                  \
 				  DEBUG_ASSERT_MESSAGE(                                           \
 					  DEBUG_ASSERT_COMPONENT_NAME_STRING,                         \
 					  #errorCode " == 0 ", 0, message, __FILE__, __LINE__, evalOnceErrorCode ); \
@@ -589,7 +879,7 @@
 #ifndef __Verify_noErr_Action
 	#if DEBUG_ASSERT_PRODUCTION_CODE
 	   #define __Verify_noErr_Action(errorCode, action)                          \
-		  if ( 0 != (errorCode) ) {                                              \
+		  if ( 0 != DEBUG_ASSERT_PROBE_ERROR_CODE(errorCode) ) {                 \
 			  action;                                                            \
 		  }                                                                      \
 		  else do {} while (0)
@@ -597,7 +887,8 @@
 	   #define __Verify_noErr_Action(errorCode, action)                          \
                do {                                                                   \
 		  long evalOnceErrorCode = (errorCode);                                  \
-		  if ( __builtin_expect(0 != evalOnceErrorCode, 0) ) {                   \
+		  if ( DEBUG_ASSERT_EXPECT_FAILURE(0 != evalOnceErrorCode) ) {           \
+			  DEBUG_ASSERT_FAILURE_PROBE(evalOnceErrorCode);                     \
 			  DEBUG_ASSERT_MESSAGE(                                              \
 				  DEBUG_ASSERT_COMPONENT_NAME_STRING,                            \
 				  #errorCode " == 0 ", 0, 0, __FILE__, __LINE__, evalOnceErrorCode );            \
@@ -629,13 +920,15 @@
 #ifndef __Verify_Action
 	#if DEBUG_ASSERT_PRODUCTION_CODE
 	   #define __Verify_Action(assertion, action)                                \
-		  if ( __builtin_expect(!(assertion), 0) ) {                             \
+		  if ( DEBUG_ASSERT_EXPECT_FAILURE(!(assertion)) ) {                     \
+			DEBUG_ASSERT_FAILURE_PROBE(0);                                       \
 			action;                                                              \
 		  }                                                                      \
 		  else do {} while (0)
 	#else
 	   #define __Verify_Action(assertion, action)                                \
-		  if ( __builtin_expect(!(assertion), 0) ) {                             \
+		  if ( DEBUG_ASSERT_EXPECT_FAILURE(!(assertion)) ) {                     \
+			  DEBUG_ASSERT_FAILURE_PROBE(0);                                     \
 			  DEBUG_ASSERT_MESSAGE(                                              \
 					  DEBUG_ASSERT_COMPONENT_NAME_STRING,                        \
 					  #assertion, 0, 0, __FILE__, __LINE__, 0 );                 \
@@ -668,8 +961,9 @@
 	   #define __Require(assertion, exceptionLabel)                               \
 		  do                                                                      \
 		  {                                                                       \
-			  if ( __builtin_expect(!(assertion), 0) )                            \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(!(assertion)) )                    \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(0);                                  \
 				  goto exceptionLabel;                                            \
 			  }                                                                   \
 		  } while ( 0 )
@@ -677,7 +971,8 @@
 	   #define __Require(assertion, exceptionLabel)                               \
 		  do                                                                      \
 		  {                                                                       \
-			  if ( __builtin_expect(!(assertion), 0) ) {                          \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(!(assertion)) ) {                  \
+				  DEBUG_ASSERT_FAILURE_PROBE(0);                                  \
 				  DEBUG_ASSERT_MESSAGE(                                           \
 					  DEBUG_ASSERT_COMPONENT_NAME_STRING,                         \
 					  #assertion, #exceptionLabel, 0, __FILE__, __LINE__,  0);    \
@@ -719,8 +1014,9 @@
 	   #define __Require_Action(assertion, exceptionLabel, action)                \
 		  do                                                                      \
 		  {                                                                       \
-			  if ( __builtin_expect(!(assertion), 0) )                            \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(!(assertion)) )                    \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(0);                                  \
 				  {                                                               \
 					  action;                                                     \
 				  }                                                               \
@@ -731,8 +1027,9 @@
 	   #define __Require_Action(assertion, exceptionLabel, action)                \
 		  do                                                                      \
 		  {                                                                       \
-			  if ( __builtin_expect(!(assertion), 0) )                            \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(!(assertion)) )                    \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(0);                                  \
 				  DEBUG_ASSERT_MESSAGE(                                           \
 					  DEBUG_ASSERT_COMPONENT_NAME_STRING,                         \
 					  #assertion, #exceptionLabel, 0,   __FILE__, __LINE__, 0);   \
@@ -768,8 +1065,9 @@
 	#define __Require_Quiet(assertion, exceptionLabel)                            \
 	  do                                                                          \
 	  {                                                                           \
-		  if ( __builtin_expect(!(assertion), 0) )                                \
+		  if ( DEBUG_ASSERT_EXPECT_FAILURE(!(assertion)) )                        \
 		  {                                                                       \
+			  DEBUG_ASSERT_FAILURE_PROBE(0);                                      \
 			  goto exceptionLabel;                                                \
 		  }                                                                       \
 	  } while ( 0 )
@@ -801,8 +1099,9 @@
 	#define __Require_Action_Quiet(assertion, exceptionLabel, action)             \
 	  do                                                                          \
 	  {                                                                           \
-		  if ( __builtin_expect(!(assertion), 0) )                                \
+		  if ( DEBUG_ASSERT_EXPECT_FAILURE(!(assertion)) )                        \
 		  {                                                                       \
+			  DEBUG_ASSERT_FAILURE_PROBE(0);                                      \
 			  {                                                                   \
 				  action;                                                         \
 			  }                                                                   \
@@ -842,8 +1141,9 @@
 	   #define __Require_String(assertion, exceptionLabel, message)               \
 		  do                                                                      \
 		  {                                                                       \
-			  if ( __builtin_expect(!(assertion), 0) )                            \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(!(assertion)) )                    \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(0);                                  \
 				  goto exceptionLabel;                                            \
 			  }                                                                   \
 		  } while ( 0 )
@@ -851,8 +1151,9 @@
 	   #define __Require_String(assertion, exceptionLabel, message)               \
 		  do                                                                      \
 		  {                                                                       \
-			  if ( __builtin_expect(!(assertion), 0) )                            \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(!(assertion)) )                    \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(0);                                  \
 				  DEBUG_ASSERT_MESSAGE(                                           \
 					  DEBUG_ASSERT_COMPONENT_NAME_STRING,                         \
 					  #assertion, #exceptionLabel,  message,  __FILE__, __LINE__, 0); \
@@ -898,8 +1199,9 @@
 	   #define __Require_Action_String(assertion, exceptionLabel, action, message)  \
 		  do                                                                      \
 		  {                                                                       \
-			  if ( __builtin_expect(!(assertion), 0) )                            \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(!(assertion)) )                    \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(0);                                  \
 				  {                                                               \
 					  action;                                                     \
 				  }                                                               \
@@ -910,8 +1212,9 @@
 	   #define __Require_Action_String(assertion, exceptionLabel, action, message)  \
 		  do                                                                      \
 		  {                                                                       \
-			  if ( __builtin_expect(!(assertion), 0) )                            \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(!(assertion)) )                    \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(0);                                  \
 				  DEBUG_ASSERT_MESSAGE(                                           \
 					  DEBUG_ASSERT_COMPONENT_NAME_STRING,                         \
 					  #assertion, #exceptionLabel,  message,  __FILE__,  __LINE__, 0); \
@@ -952,8 +1255,11 @@
 	   #define __Require_noErr(errorCode, exceptionLabel)                         \
 		  do                                                                      \
 		  {                                                                       \
-			  if ( __builtin_expect(0 != (errorCode), 0) )                        \
+			  long evalOnceErrorCode = (errorCode);                               \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(0 != evalOnceErrorCode) )          \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(evalOnceErrorCode);                  \
+				  DEBUG_ASSERT_RECORD_ERROR(evalOnceErrorCode);                   \
 				  goto exceptionLabel;                                            \
 			  }                                                                   \
 		  } while ( 0 )
@@ -962,8 +1268,10 @@
 		  do                                                                      \
 		  {                                                                       \
 			  long evalOnceErrorCode = (errorCode);                               \
-			  if ( __builtin_expect(0 != evalOnceErrorCode, 0) )                  \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(0 != evalOnceErrorCode) )          \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(evalOnceErrorCode);                  \
+				  DEBUG_ASSERT_RECORD_ERROR(evalOnceErrorCode);                   \
 				  DEBUG_ASSERT_MESSAGE(                                           \
 					  DEBUG_ASSERT_COMPONENT_NAME_STRING,                         \
 					  #errorCode " == 0 ",  #exceptionLabel,  0,  __FILE__, __LINE__, evalOnceErrorCode); \
@@ -1001,8 +1309,11 @@
 	   #define __Require_noErr_Action(errorCode, exceptionLabel, action)          \
 		  do                                                                      \
 		  {                                                                       \
-			  if ( __builtin_expect(0 != (errorCode), 0) )                        \
+			  long evalOnceErrorCode = (errorCode);                               \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(0 != evalOnceErrorCode) )          \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(evalOnceErrorCode);                  \
+				  DEBUG_ASSERT_RECORD_ERROR(evalOnceErrorCode);                   \
 				  {                                                               \
 					  action;                                                     \
 				  }                                                               \
@@ -1014,8 +1325,10 @@
 		  do                                                                      \
 		  {                                                                       \
 			  long evalOnceErrorCode = (errorCode);                               \
-			  if ( __builtin_expect(0 != evalOnceErrorCode, 0) )                  \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(0 != evalOnceErrorCode) )          \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(evalOnceErrorCode);                  \
+				  DEBUG_ASSERT_RECORD_ERROR(evalOnceErrorCode);                   \
 				  DEBUG_ASSERT_MESSAGE(                                           \
 					  DEBUG_ASSERT_COMPONENT_NAME_STRING,                         \
 					  #errorCode " == 0 ", #exceptionLabel,  0,  __FILE__, __LINE__,  evalOnceErrorCode); \
@@ -1047,8 +1360,11 @@
 	#define __Require_noErr_Quiet(errorCode, exceptionLabel)                      \
 	  do                                                                          \
 	  {                                                                           \
-		  if ( __builtin_expect(0 != (errorCode), 0) )                            \
+		  long evalOnceErrorCode = (errorCode);                                   \
+		  if ( DEBUG_ASSERT_EXPECT_FAILURE(0 != evalOnceErrorCode) )              \
 		  {                                                                       \
+			  DEBUG_ASSERT_FAILURE_PROBE(evalOnceErrorCode);                      \
+			  DEBUG_ASSERT_RECORD_ERROR(evalOnceErrorCode);                       \
 			  goto exceptionLabel;                                                \
 		  }                                                                       \
 	  } while ( 0 )
@@ -1077,8 +1393,11 @@
 	#define __Require_noErr_Action_Quiet(errorCode, exceptionLabel, action)       \
 	  do                                                                          \
 	  {                                                                           \
-		  if ( __builtin_expect(0 != (errorCode), 0) )                            \
+		  long evalOnceErrorCode = (errorCode);                                   \
+		  if ( DEBUG_ASSERT_EXPECT_FAILURE(0 != evalOnceErrorCode) )              \
 		  {                                                                       \
+			  DEBUG_ASSERT_FAILURE_PROBE(evalOnceErrorCode);                      \
+			  DEBUG_ASSERT_RECORD_ERROR(evalOnceErrorCode);                       \
 			  {                                                                   \
 				  action;                                                         \
 			  }                                                                   \
@@ -1113,8 +1432,11 @@
 	   #define __Require_noErr_String(errorCode, exceptionLabel, message)         \
 		  do                                                                      \
 		  {                                                                       \
-			  if ( __builtin_expect(0 != (errorCode), 0) )                        \
+			  long evalOnceErrorCode = (errorCode);                               \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(0 != evalOnceErrorCode) )          \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(evalOnceErrorCode);                  \
+				  DEBUG_ASSERT_RECORD_ERROR(evalOnceErrorCode);                   \
 				  goto exceptionLabel;                                            \
 			  }                                                                   \
 		  } while ( 0 )
@@ -1123,8 +1445,10 @@
 		  do                                                                      \
 		  {                                                                       \
 			  long evalOnceErrorCode = (errorCode);                               \
-			  if ( __builtin_expect(0 != evalOnceErrorCode, 0) )                  \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(0 != evalOnceErrorCode) )          \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(evalOnceErrorCode);                  \
+				  DEBUG_ASSERT_RECORD_ERROR(evalOnceErrorCode);                   \
 				  DEBUG_ASSERT_MESSAGE(                                           \
 					  DEBUG_ASSERT_COMPONENT_NAME_STRING,                         \
 					  #errorCode " == 0 ",  #exceptionLabel, message, __FILE__,  __LINE__,  evalOnceErrorCode); \
@@ -1165,8 +1489,11 @@
 	   #define __Require_noErr_Action_String(errorCode, exceptionLabel, action, message) \
 		  do                                                                      \
 		  {                                                                       \
-			  if ( __builtin_expect(0 != (errorCode), 0) )                        \
+			  long evalOnceErrorCode = (errorCode);                               \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(0 != evalOnceErrorCode) )          \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(evalOnceErrorCode);                  \
+				  DEBUG_ASSERT_RECORD_ERROR(evalOnceErrorCode);                   \
 				  {                                                               \
 					  action;                                                     \
 				  }                                                               \
@@ -1178,8 +1505,10 @@
 		  do                                                                      \
 		  {                                                                       \
 			  long evalOnceErrorCode = (errorCode);                               \
-			  if ( __builtin_expect(0 != evalOnceErrorCode, 0) )                  \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(0 != evalOnceErrorCode) )          \
 			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(evalOnceErrorCode);                  \
+				  DEBUG_ASSERT_RECORD_ERROR(evalOnceErrorCode);                   \
 				  DEBUG_ASSERT_MESSAGE(                                           \
 					  DEBUG_ASSERT_COMPONENT_NAME_STRING,                         \
 					  #errorCode " == 0 ", #exceptionLabel, message, __FILE__, __LINE__, evalOnceErrorCode); \
@@ -1192,6 +1521,153 @@
 	#endif
 #endif
 
+/*
+ *  __Within_Start(region)
+ *
+ *  Summary:
+ *    Production builds, or DEBUG_ASSERT_WITHIN not set: does nothing and produces no code.
+ *
+ *    Non-production builds with DEBUG_ASSERT_WITHIN: declares the variable region and
+ *    stores the current tick count in it (or 0 if this pass is not sampled), starting a
+ *    region which __Check_Within, __Verify_Within or __Require_Within ends.
+ *
+ *  Parameters:
+ *
+ *    region:
+ *      The name of the region; it must be unique in its scope.
+ *
+ *  Examples:
+ *     __Within_Start(handleRequest);
+ *     err = HandleRequest(request);
+ *     __Require_Within(handleRequest, 2000000, slowRequest);
+ */
+#ifndef __Within_Start
+	#if __ASSERT_MACROS_TIME_REGIONS
+	   #define __Within_Start(region)                                             \
+		  uint64_t region = ({                                                    \
+			  static uint32_t evalOnceSampleCounter;                              \
+			  DebugAssertWithinSampled(&evalOnceSampleCounter,                    \
+				  DEBUG_ASSERT_WITHIN_SAMPLE_INTERVAL) ? DebugAssertWithinStart() : 0; \
+		  })
+	#else
+	   #define __Within_Start(region)
+	#endif
+#endif
+
+/*
+ *  __Check_Within(region, budgetNanoseconds)
+ *
+ *  Summary:
+ *    Production builds, or DEBUG_ASSERT_WITHIN not set: does nothing and produces no code.
+ *
+ *    Non-production builds with DEBUG_ASSERT_WITHIN: if more than budgetNanoseconds
+ *    have passed since __Within_Start(region), call DEBUG_ASSERT_MESSAGE with the
+ *    elapsed nanoseconds as the error code.
+ *
+ *  Parameters:
+ *
+ *    region:
+ *      The region started by __Within_Start.
+ *
+ *    budgetNanoseconds:
+ *      The time the region may take, in nanoseconds.
+ */
+#ifndef __Check_Within
+	#if __ASSERT_MACROS_TIME_REGIONS
+	   #define __Check_Within(region, budgetNanoseconds)                          \
+		  do                                                                      \
+		  {                                                                       \
+			  if ( region != 0 )                                                  \
+			  {                                                                   \
+				  uint64_t evalOnceElapsed =                                      \
+					  DebugAssertTicksToNanoseconds(DebugAssertReadTicks() - region); \
+				  if ( DEBUG_ASSERT_EXPECT_FAILURE(evalOnceElapsed > (uint64_t)(budgetNanoseconds)) ) \
+				  {                                                               \
+					  DEBUG_ASSERT_FAILURE_PROBE(evalOnceElapsed);                \
+					  DEBUG_ASSERT_MESSAGE(                                       \
+						  DEBUG_ASSERT_COMPONENT_NAME_STRING,                     \
+						  #region " within " #budgetNanoseconds " ns", 0, 0,      \
+						  __FILE__, __LINE__, (long)evalOnceElapsed );            \
+				  }                                                               \
+			  }                                                                   \
+		  } while ( 0 )
+	#else
+	   #define __Check_Within(region, budgetNanoseconds)
+	#endif
+#endif
+
+/*
+ *  __Verify_Within(region, budgetNanoseconds)
+ *
+ *  Summary:
+ *    The same as __Check_Within; provided so that regions timed in place of a __Verify
+ *    read naturally.  Neither evaluates anything in production builds, since the
+ *    region itself always runs.
+ *
+ *  Parameters:
+ *
+ *    region:
+ *      The region started by __Within_Start.
+ *
+ *    budgetNanoseconds:
+ *      The time the region may take, in nanoseconds.
+ */
+#ifndef __Verify_Within
+	#define __Verify_Within(region, budgetNanoseconds)  __Check_Within(region, budgetNanoseconds)
+#endif
+
+/*
+ *  __Require_Within(region, budgetNanoseconds, exceptionLabel)
+ *
+ *  Summary:
+ *    Production builds, or DEBUG_ASSERT_WITHIN not set: does nothing and produces no code
+ *    (exceptionLabel is still referenced, so it does not become an unused label).
+ *
+ *    Non-production builds with DEBUG_ASSERT_WITHIN: if more than budgetNanoseconds
+ *    have passed since __Within_Start(region), call DEBUG_ASSERT_MESSAGE with the
+ *    elapsed nanoseconds as the error code and then goto exceptionLabel.
+ *
+ *  Parameters:
+ *
+ *    region:
+ *      The region started by __Within_Start.
+ *
+ *    budgetNanoseconds:
+ *      The time the region may take, in nanoseconds.
+ *
+ *    exceptionLabel:
+ *      The label.
+ */
+#ifndef __Require_Within
+	#if __ASSERT_MACROS_TIME_REGIONS
+	   #define __Require_Within(region, budgetNanoseconds, exceptionLabel)        \
+		  do                                                                      \
+		  {                                                                       \
+			  if ( region != 0 )                                                  \
+			  {                                                                   \
+				  uint64_t evalOnceElapsed =                                      \
+					  DebugAssertTicksToNanoseconds(DebugAssertReadTicks() - region); \
+				  if ( DEBUG_ASSERT_EXPECT_FAILURE(evalOnceElapsed > (uint64_t)(budgetNanoseconds)) ) \
+				  {                                                               \
+					  DEBUG_ASSERT_FAILURE_PROBE(evalOnceElapsed);                \
+					  DEBUG_ASSERT_MESSAGE(                                       \
+						  DEBUG_ASSERT_COMPONENT_NAME_STRING,                     \
+						  #region " within " #budgetNanoseconds " ns",            \
+						  #exceptionLabel, 0, __FILE__, __LINE__, (long)evalOnceElapsed ); \
+					  goto exceptionLabel;                                        \
+				  }                                                               \
+			  }                                                                   \
+		  } while ( 0 )
+	#else
+	   #define __Require_Within(region, budgetNanoseconds, exceptionLabel)        \
+		  do                                                                      \
+		  {                                                                       \
+			  if ( 0 )                                                            \
+				  goto exceptionLabel;                                            \
+		  } while ( 0 )
+	#endif
+#endif
+
 /*
  *  __Check_Compile_Time(expr)
  *
@@ -1278,6 +1754,12 @@
       replace "check_compile_time(<b args>)" with "__Check_Compile_Time(<args>)" \
       replace "debug_string(<b args>)" with "__Debug_String(<args>)"
  *
+ *  Where tops is not available, "make tools" builds AssertMacrosUpdate, which applies the same table
+ *  (AssertMacrosUpdate.tops) but skips comments and string literals and uses every core.  It prints a
+ *  diff by default; -w rewrites the files in place.
+ *
+ *    AssertMacrosUpdate -w .
+ *
  */
 
 #ifndef __ASSERT_MACROS_DEFINE_VERSIONS_WITHOUT_UNDERSCORES
@@ -1422,7 +1904,23 @@
 	#ifndef debug_string
 		#define debug_string(message)  __Debug_String(message)
 	#endif
-	
+
+	#ifndef within_start
+		#define within_start(region)  __Within_Start(region)
+	#endif
+
+	#ifndef check_within
+		#define check_within(region, budgetNanoseconds)  __Check_Within(region, budgetNanoseconds)
+	#endif
+
+	#ifndef verify_within
+		#define verify_within(region, budgetNanoseconds)  __Verify_Within(region, budgetNanoseconds)
+	#endif
+
+	#ifndef require_within
+		#define require_within(region, budgetNanoseconds, exceptionLabel)  __Require_Within(region, budgetNanoseconds, exceptionLabel)
+	#endif
+
 #endif	/* ASSERT_MACROS_DEFINE_VERSIONS_WITHOUT_UNDERSCORES */
 
 
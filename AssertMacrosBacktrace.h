@@ -0,0 +1,122 @@
+/*
+     File:       AssertMacrosBacktrace.h
+
+     Contains:   Lazy, deduplicated backtrace capture for AssertMacros.h failure paths.
+
+                 When DEBUG_ASSERT_BACKTRACE is defined to 1 before AssertMacros.h is
+                 included, every assertion site gets a small static record.  The first
+                 time a site fails (or every DEBUG_ASSERT_BACKTRACE_SAMPLE_INTERVAL failures,
+                 if that is non-zero) the stack is walked through the frame-pointer chain,
+                 the return addresses are hashed, and the trace is stored in a fixed-size,
+                 lock-free table.  A stack which is already in the table only increments its
+                 counter.  Nothing is symbolized at capture time; DebugAssertBacktraceDump()
+                 prints raw addresses with their image path and load address, suitable for
+                 atos(1) or addr2line(1).
+
+                 Code using this must be compiled with frame pointers
+                 (-fno-omit-frame-pointer) and linked with libCarbonHeaders.
+
+*/
+#ifndef __ASSERTMACROSBACKTRACE__
+#define __ASSERTMACROSBACKTRACE__
+
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ *  Maximum number of return addresses kept per trace.
+ */
+#define kDebugAssertBacktraceMaxFrames      32
+
+/*
+ *  DebugAssertBacktraceSite
+ *
+ *  Summary:
+ *    Per call site state.  One of these is declared static by DEBUG_ASSERT_RECORD_BACKTRACE
+ *    at every assertion site; it must be zero-initialized.
+ */
+struct DebugAssertBacktraceSite {
+	uint32_t                failures;           /* number of times the site has failed */
+};
+typedef struct DebugAssertBacktraceSite     DebugAssertBacktraceSite;
+
+/*
+ *  DebugAssertBacktraceRecord
+ *
+ *  Summary:
+ *    A unique stack, as handed to DebugAssertBacktraceForEach().
+ */
+struct DebugAssertBacktraceRecord {
+	uint64_t                hash;               /* hash of frames[0..frameCount) */
+	uint32_t                count;              /* captures which produced this stack */
+	uint32_t                frameCount;
+	const char *            file;               /* site which first produced this stack */
+	long                    line;
+	void *                  frames[kDebugAssertBacktraceMaxFrames];
+};
+typedef struct DebugAssertBacktraceRecord   DebugAssertBacktraceRecord;
+
+typedef void (*DebugAssertBacktraceProcPtr)(const DebugAssertBacktraceRecord *record, void *refCon);
+
+/*
+ *  DebugAssertRecordBacktrace()
+ *
+ *  Summary:
+ *    Counts a failure of the given site and, if it is the first failure or falls on the
+ *    sampling interval, captures and records the caller's backtrace.  Called by
+ *    DEBUG_ASSERT_RECORD_BACKTRACE; custom DEBUG_ASSERT_MESSAGE implementations may use
+ *    that macro too.
+ *
+ *  Parameters:
+ *
+ *    site:
+ *      The static, zero-initialized state of the failing site.
+ *
+ *    sampleInterval:
+ *      0 to capture only the first failure of the site, otherwise capture every
+ *      sampleInterval-th failure as well.
+ *
+ *    file, line:
+ *      The location of the site, kept with the first trace it produces.
+ */
+extern void
+DebugAssertRecordBacktrace(DebugAssertBacktraceSite *site, uint32_t sampleInterval, const char *file, long line);
+
+/*
+ *  DebugAssertBacktraceForEach()
+ *
+ *  Summary:
+ *    Calls proc once for every unique stack recorded so far.  Safe to call while other
+ *    threads are recording; traces still being filled in are skipped.
+ */
+extern void
+DebugAssertBacktraceForEach(DebugAssertBacktraceProcPtr proc, void *refCon);
+
+/*
+ *  DebugAssertBacktraceDump()
+ *
+ *  Summary:
+ *    Writes every unique stack to the given stream as unsymbolized addresses, each
+ *    annotated with the containing image path and its load address.
+ */
+extern void
+DebugAssertBacktraceDump(FILE *stream);
+
+/*
+ *  DebugAssertBacktraceDropped()
+ *
+ *  Summary:
+ *    Returns the number of captures which were discarded because the table was full.
+ */
+extern uint32_t
+DebugAssertBacktraceDropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ASSERTMACROSBACKTRACE__ */
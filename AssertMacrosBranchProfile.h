@@ -0,0 +1,122 @@
+/*
+     File:       AssertMacrosBranchProfile.h
+
+     Contains:   Per-site pass/fail counting for the branch hints in AssertMacros.h.
+
+                 Every AssertMacros.h test is compiled as __builtin_expect(failed,
+                 DEBUG_ASSERT_FAILURE_EXPECTED), which is 0 unless overridden: failure is
+                 assumed to be rare.  Sites which fail often by design, such as probes for
+                 optional resources, pay for that with mispredicts and cold block layout.
+
+                 When DEBUG_ASSERT_BRANCH_PROFILE is defined to 1 before AssertMacros.h is
+                 included, every test also counts its passes and failures in a static
+                 DebugAssertBranchSite, which registers itself with libCarbonHeaders the
+                 first time it runs.  DebugAssertBranchProfileReport() lists the sites whose
+                 observed failure rate contradicts their hint; if the
+                 DEBUG_ASSERT_BRANCH_PROFILE_REPORT environment variable names a file (or
+                 "-" for stderr), that report is also written at exit.
+
+                 A contradicted site is fixed by changing its hint.  Because the hint is read
+                 where each macro expands, it can be overridden for a single site:
+
+                     #pragma push_macro("DEBUG_ASSERT_FAILURE_EXPECTED")
+                     #undef DEBUG_ASSERT_FAILURE_EXPECTED
+                     #define DEBUG_ASSERT_FAILURE_EXPECTED 1
+                         __Require_noErr_Quiet(OpenOptionalResource(&ref), noResource);
+                     #pragma pop_macro("DEBUG_ASSERT_FAILURE_EXPECTED")
+
+                 or for a whole translation unit with -DDEBUG_ASSERT_FAILURE_EXPECTED=1.
+
+*/
+#ifndef __ASSERTMACROSBRANCHPROFILE__
+#define __ASSERTMACROSBRANCHPROFILE__
+
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ *  DebugAssertBranchSite
+ *
+ *  Summary:
+ *    Counters of one macro expansion.  Declared static by DEBUG_ASSERT_EXPECT_FAILURE;
+ *    only passes and failures are touched once the site is registered.
+ */
+struct DebugAssertBranchSite {
+	const char *                    file;
+	long                            line;
+	const char *                    condition;      /* the failure test, as written */
+	int                             expected;       /* the hint: 0 = expect pass */
+	uint32_t                        registered;
+	uint64_t                        passes;
+	uint64_t                        failures;
+	struct DebugAssertBranchSite *  next;
+};
+typedef struct DebugAssertBranchSite    DebugAssertBranchSite;
+
+typedef void (*DebugAssertBranchProfileProcPtr)(const DebugAssertBranchSite *site, void *refCon);
+
+/*
+ *  DebugAssertRegisterBranchSite()
+ *
+ *  Summary:
+ *    Adds a site to the profile.  Called the first time a site runs; there is no need
+ *    to call it directly.
+ */
+extern void
+DebugAssertRegisterBranchSite(DebugAssertBranchSite *site);
+
+/*
+ *  DebugAssertBranchProfileForEach()
+ *
+ *  Summary:
+ *    Calls proc for every site which has run so far.  The counters are read without
+ *    stopping other threads, so they may be slightly behind.
+ */
+extern void
+DebugAssertBranchProfileForEach(DebugAssertBranchProfileProcPtr proc, void *refCon);
+
+/*
+ *  DebugAssertBranchProfileReport()
+ *
+ *  Summary:
+ *    Writes one line per site whose hint is contradicted by its counts, giving the
+ *    failure rate and the hint it should have.
+ *
+ *  Parameters:
+ *
+ *    stream:
+ *      Where to write the report.
+ *
+ *    minimumSamples:
+ *      Sites which ran fewer times than this are not judged.
+ *
+ *    allSites:
+ *      Non-zero to list every site, marking the contradicted ones.
+ */
+extern void
+DebugAssertBranchProfileReport(FILE *stream, uint64_t minimumSamples, int allSites);
+
+/*
+ *  DebugAssertCountBranch()
+ *
+ *  Summary:
+ *    The instrumented test: counts the outcome and returns failed unchanged.
+ */
+static inline long
+DebugAssertCountBranch(DebugAssertBranchSite *site, long failed)
+{
+	if ( __builtin_expect(!__atomic_load_n(&site->registered, __ATOMIC_RELAXED), 0) )
+		DebugAssertRegisterBranchSite(site);
+	__atomic_fetch_add(failed ? &site->failures : &site->passes, 1, __ATOMIC_RELAXED);
+	return failed;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ASSERTMACROSBRANCHPROFILE__ */
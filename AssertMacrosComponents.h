@@ -0,0 +1,119 @@
+/*
+     File:       AssertMacrosComponents.h
+
+     Contains:   Runtime enable masks for AssertMacros.h reporting, per component.
+
+                 When DEBUG_ASSERT_COMPONENT_MASKS is defined to 1 before AssertMacros.h is
+                 included, each translation unit gets a private DebugAssertComponent record
+                 named by its DEBUG_ASSERT_COMPONENT_NAME_STRING.  A failing assertion checks
+                 that record with a single relaxed atomic load before reporting; passing
+                 assertions are not affected at all.
+
+                 The first failure in a translation unit registers its record with
+                 libCarbonHeaders, which resolves it against the current rules.  Rules come
+                 from the DEBUG_ASSERT_COMPONENTS environment variable, read once, and from
+                 DebugAssertSetComponentEnabled() / DebugAssertApplyComponentRules() at any
+                 time afterwards.
+
+                 Rules are a comma separated list of component names, each optionally
+                 prefixed with '-' (silence) or '+' (report).  "*" names every component.
+                 Later rules win, and components are reported unless a rule says otherwise:
+
+                     DEBUG_ASSERT_COMPONENTS="-*,+Networking"    only Networking reports
+                     DEBUG_ASSERT_COMPONENTS="-SpotlightIndexer" everything but the indexer
+
+*/
+#ifndef __ASSERTMACROSCOMPONENTS__
+#define __ASSERTMACROSCOMPONENTS__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+	kDebugAssertComponentUnresolved     = 0,
+	kDebugAssertComponentEnabled        = 1,
+	kDebugAssertComponentDisabled       = 2
+};
+
+/*
+ *  Longest component name a rule can hold; longer rules are truncated.
+ */
+#define kDebugAssertComponentNameMax        64
+
+/*
+ *  DebugAssertComponent
+ *
+ *  Summary:
+ *    Reporting state of one translation unit's component.  Only the state field is
+ *    read on the failure path; the rest belongs to libCarbonHeaders.
+ */
+struct DebugAssertComponent {
+	const char *                    name;
+	uint32_t                        state;
+	struct DebugAssertComponent *   next;
+};
+typedef struct DebugAssertComponent     DebugAssertComponent;
+
+/*
+ *  DebugAssertResolveComponent()
+ *
+ *  Summary:
+ *    Registers an unresolved component and returns its new state.  Called the first
+ *    time a component is checked; there is no need to call it directly.
+ */
+extern uint32_t
+DebugAssertResolveComponent(DebugAssertComponent *component);
+
+/*
+ *  DebugAssertSetComponentEnabled()
+ *
+ *  Summary:
+ *    Turns reporting for the named component on or off, in every translation unit
+ *    using that name, now and for translation units which register later.  Passing "*"
+ *    discards all earlier rules and applies to every component.
+ */
+extern void
+DebugAssertSetComponentEnabled(const char *componentName, int enabled);
+
+/*
+ *  DebugAssertApplyComponentRules()
+ *
+ *  Summary:
+ *    Applies a rule list in the DEBUG_ASSERT_COMPONENTS syntax, in order.
+ */
+extern void
+DebugAssertApplyComponentRules(const char *rules);
+
+/*
+ *  DebugAssertIsComponentEnabled()
+ *
+ *  Summary:
+ *    Returns non-zero if assertions of the named component are currently reported.
+ */
+extern int
+DebugAssertIsComponentEnabled(const char *componentName);
+
+/*
+ *  DebugAssertComponentIsEnabled()
+ *
+ *  Summary:
+ *    The failure path check: one relaxed load once the component is resolved.
+ */
+static inline int
+DebugAssertComponentIsEnabled(DebugAssertComponent *component)
+{
+	uint32_t state = __atomic_load_n(&component->state, __ATOMIC_RELAXED);
+
+	if ( __builtin_expect(state == kDebugAssertComponentUnresolved, 0) )
+		state = DebugAssertResolveComponent(component);
+	return state == kDebugAssertComponentEnabled;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ASSERTMACROSCOMPONENTS__ */
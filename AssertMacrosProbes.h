@@ -0,0 +1,79 @@
+/*
+     File:       AssertMacrosProbes.h
+
+     Contains:   Statically defined tracepoints for AssertMacros.h failure paths.
+
+                 When DEBUG_ASSERT_PROBES is defined to 1 before AssertMacros.h is included,
+                 the failure path of every macro which has one carries a probe in the
+                 SystemTap SDT format (a nop plus an .note.stapsdt entry), so tracers can
+                 attach to assertion failures in a running process without a rebuild:
+
+                     bpftrace -e 'usdt:./server:carbonheaders:assert_failure
+                         { printf("%s %s:%d %d\n", str(arg0), str(arg1), arg2, arg3); }'
+
+                     perf buildid-cache --add ./server
+                     perf probe -x ./server sdt_carbonheaders:assert_failure
+
+                 The probe's arguments are the component name, the file name, the line and
+                 the error code (0 for assertions which are not about an error code).
+                 Passing assertions run no extra code at all; a failure pays for one nop and
+                 for having its arguments in registers.  Nothing is written to stderr.
+
+                 Production __Check and __Check_noErr have no failure path, so they never
+                 fire.  Probes are only emitted for ELF targets; elsewhere
+                 DEBUG_ASSERT_SDT_PROBE expands to nothing.  No library is needed.
+
+*/
+#ifndef __ASSERTMACROSPROBES__
+#define __ASSERTMACROSPROBES__
+
+#define kDebugAssertProbeProvider           "carbonheaders"
+#define kDebugAssertProbeFailure            "assert_failure"
+
+#if defined(__ELF__) && (defined(__x86_64__) || defined(__i386__) || defined(__aarch64__) || defined(__arm__))
+	#if defined(__LP64__)
+		#define __DEBUG_ASSERT_SDT_ADDR         ".8byte"
+		#define __DEBUG_ASSERT_SDT_ARGS         "8@%0 8@%1 -8@%2 -8@%3"
+	#else
+		#define __DEBUG_ASSERT_SDT_ADDR         ".4byte"
+		#define __DEBUG_ASSERT_SDT_ARGS         "4@%0 4@%1 -4@%2 -4@%3"
+	#endif
+
+	/*
+	 *  DEBUG_ASSERT_SDT_PROBE(component, file, line, errorCode)
+	 *
+	 *  Summary:
+	 *    Emits one carbonheaders:assert_failure probe.  The note layout (version 3)
+	 *    and the _.stapsdt.base anchor follow <sys/sdt.h>, which is not required.
+	 */
+	#define DEBUG_ASSERT_SDT_PROBE(component, file, line, errorCode)                      \
+		__asm__ __volatile__ (                                                             \
+			"990:	nop\n"                                                                 \
+			"	.pushsection .note.stapsdt,\"?\",\"note\"\n"                                \
+			"	.balign 4\n"                                                               \
+			"	.4byte 992f-991f, 994f-993f, 3\n"                                          \
+			"991:	.asciz \"stapsdt\"\n"                                                  \
+			"992:	.balign 4\n"                                                           \
+			"993:	" __DEBUG_ASSERT_SDT_ADDR " 990b\n"                                    \
+			"	" __DEBUG_ASSERT_SDT_ADDR " _.stapsdt.base\n"                              \
+			"	" __DEBUG_ASSERT_SDT_ADDR " 0\n"                                           \
+			"	.asciz \"" kDebugAssertProbeProvider "\"\n"                                \
+			"	.asciz \"" kDebugAssertProbeFailure "\"\n"                                 \
+			"	.asciz \"" __DEBUG_ASSERT_SDT_ARGS "\"\n"                                  \
+			"994:	.balign 4\n"                                                           \
+			"	.popsection\n"                                                             \
+			"	.ifndef _.stapsdt.base\n"                                                  \
+			"	.pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n"     \
+			"	.weak _.stapsdt.base\n"                                                    \
+			"	.hidden _.stapsdt.base\n"                                                  \
+			"_.stapsdt.base:	.space 1\n"                                                \
+			"	.size _.stapsdt.base, 1\n"                                                 \
+			"	.popsection\n"                                                             \
+			"	.endif\n"                                                                  \
+			:: "r" ((const char *)(component)), "r" ((const char *)(file)),                \
+			   "r" ((long)(line)), "r" ((long)(errorCode)))
+#else
+	#define DEBUG_ASSERT_SDT_PROBE(component, file, line, errorCode)  do {} while ( 0 )
+#endif
+
+#endif /* __ASSERTMACROSPROBES__ */
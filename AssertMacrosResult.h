@@ -0,0 +1,468 @@
+/*
+     File:       AssertMacrosResult.h
+
+     Contains:   Value-returning error propagation for C++ built on AssertMacros.h.
+
+                 The __Require_noErr family reports through DEBUG_ASSERT_MESSAGE and then
+                 transfers control with "goto exceptionLabel", which requires a label-based
+                 function layout and cannot be used to leave a scope that owns RAII objects
+                 early.  This header provides AssertMacros::Result<T>, a small value-or-OSStatus
+                 type, and a set of __Require_OK / __Require_noErr_Return macros which report
+                 exactly like their AssertMacros.h counterparts but propagate the error with
+                 "return" instead.
+
+                 Result<T> is trivially copyable whenever T is, so a Result<void> is returned in
+                 a single register and a Result<T> with a small T in a register pair; error
+                 propagation therefore costs the same compare and predicted-not-taken branch as
+                 __Require_noErr.  The Step_ kernels of bench/AssertMacrosBench.c, built as
+                 C++ by make bench_assert_macros, compare them: in production builds gcc -O2
+                 gives __Require_OK, __Require_noErr_Return and __Require_noErr with a goto
+                 the same instructions.  In non-production builds __Require_OK is a few
+                 bytes larger, only from register allocation around the failure report.
+
+                 Requires C++17 and a compiler which supports GNU statement expressions
+                 (gcc or clang).  Including this header from C does nothing.
+
+*/
+#ifndef __ASSERTMACROSRESULT__
+#define __ASSERTMACROSRESULT__
+
+#if defined(__cplusplus) && (__cplusplus >= 201703L)
+
+#ifndef __MACTYPES__
+#include <MacTypes.h>
+#endif
+
+#ifndef __ASSERTMACROS__
+#include <AssertMacros.h>
+#endif
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace AssertMacros {
+
+/*
+ *  Failure
+ *
+ *  Summary:
+ *    Carries a non-zero OSStatus out of a function.  A Failure converts to any
+ *    Result<T> and to a plain OSStatus, so the __Require_OK macros work in functions
+ *    returning either.
+ */
+struct Failure
+{
+	OSStatus    status;
+
+	constexpr explicit Failure(OSStatus inStatus) noexcept : status(inStatus) {}
+	constexpr operator OSStatus() const noexcept { return status; }
+};
+
+namespace Private {
+
+	/* Trivially copyable payloads keep Result<T> trivially copyable, so it stays in registers. */
+	template <typename T, bool = std::is_trivially_copyable<T>::value>
+	struct ResultStorage
+	{
+		union { char fNone; T fValue; };
+		OSStatus    fStatus;
+
+		constexpr explicit ResultStorage(OSStatus inStatus) noexcept : fNone(0), fStatus(inStatus) {}
+
+		template <typename... Args>
+		constexpr explicit ResultStorage(std::in_place_t, Args &&... args)
+			: fValue(std::forward<Args>(args)...), fStatus(noErr) {}
+	};
+
+	template <typename T>
+	struct ResultStorage<T, false>
+	{
+		union { char fNone; T fValue; };
+		OSStatus    fStatus;
+
+		explicit ResultStorage(OSStatus inStatus) noexcept : fNone(0), fStatus(inStatus) {}
+
+		template <typename... Args>
+		explicit ResultStorage(std::in_place_t, Args &&... args)
+			: fValue(std::forward<Args>(args)...), fStatus(noErr) {}
+
+		ResultStorage(const ResultStorage &other) : fNone(0), fStatus(other.fStatus)
+		{
+			if ( fStatus == noErr )
+				::new (static_cast<void *>(&fValue)) T(other.fValue);
+		}
+
+		ResultStorage(ResultStorage &&other) noexcept(std::is_nothrow_move_constructible<T>::value)
+			: fNone(0), fStatus(other.fStatus)
+		{
+			if ( fStatus == noErr )
+				::new (static_cast<void *>(&fValue)) T(std::move(other.fValue));
+		}
+
+		/* Not exception safe: if copying the new value throws, *this holds the old status and no value. */
+		ResultStorage &operator=(const ResultStorage &other)
+		{
+			if ( this != &other )
+			{
+				Destroy();
+				if ( other.fStatus == noErr )
+					::new (static_cast<void *>(&fValue)) T(other.fValue);
+				fStatus = other.fStatus;
+			}
+			return *this;
+		}
+
+		ResultStorage &operator=(ResultStorage &&other) noexcept(std::is_nothrow_move_constructible<T>::value)
+		{
+			if ( this != &other )
+			{
+				Destroy();
+				if ( other.fStatus == noErr )
+					::new (static_cast<void *>(&fValue)) T(std::move(other.fValue));
+				fStatus = other.fStatus;
+			}
+			return *this;
+		}
+
+		~ResultStorage() { Destroy(); }
+
+	private:
+		void Destroy() noexcept
+		{
+			if ( fStatus == noErr )
+			{
+				fValue.~T();
+				fStatus = kNoValueStatus;
+			}
+		}
+
+		/*
+		 *  Marks storage whose value has been destroyed.  It is left there, and status()
+		 *  returns it, when the copy or move of T in an assignment throws.
+		 */
+		static constexpr OSStatus kNoValueStatus = -1;
+	};
+
+} /* namespace Private */
+
+/*
+ *  Result<T>
+ *
+ *  Summary:
+ *    Either a T (status() == noErr) or a non-zero OSStatus.
+ *
+ *  Discussion:
+ *    Construct a successful Result from a T, and a failed one from Failure(status).
+ *    A Failure must never carry noErr; non-production builds __Check this.
+ *    Calling value() on a failed Result is __Check'ed in non-production builds and
+ *    undefined in production builds.
+ *
+ *    Assignment gives the basic exception guarantee only: if copying or moving the
+ *    new T throws, the old value is already gone, and the Result is left failed with
+ *    status -1 (qErr).
+ */
+template <typename T>
+class Result : private Private::ResultStorage<T>
+{
+	typedef Private::ResultStorage<T>   Storage;
+
+public:
+	typedef T   value_type;
+
+	constexpr Result(const T &inValue) : Storage(std::in_place, inValue) {}
+	constexpr Result(T &&inValue) : Storage(std::in_place, std::move(inValue)) {}
+
+	template <typename... Args>
+	constexpr explicit Result(std::in_place_t, Args &&... args) : Storage(std::in_place, std::forward<Args>(args)...) {}
+
+	Result(Failure inFailure) noexcept : Storage(inFailure.status)
+	{
+		__Check(inFailure.status != noErr);
+	}
+
+	constexpr bool      ok() const noexcept             { return this->fStatus == noErr; }
+	constexpr explicit  operator bool() const noexcept  { return ok(); }
+	constexpr OSStatus  status() const noexcept         { return this->fStatus; }
+
+	T &         value() &           { __Check(ok()); return this->fValue; }
+	const T &   value() const &     { __Check(ok()); return this->fValue; }
+	T &&        value() &&          { __Check(ok()); return std::move(this->fValue); }
+
+	T &         operator*() &       { return value(); }
+	const T &   operator*() const & { return value(); }
+	T &&        operator*() &&      { return std::move(*this).value(); }
+	T *         operator->()        { return &value(); }
+	const T *   operator->() const  { return &value(); }
+
+	template <typename U>
+	T value_or(U &&inDefault) const &
+	{
+		return ok() ? this->fValue : static_cast<T>(std::forward<U>(inDefault));
+	}
+};
+
+/*
+ *  Result<void>
+ *
+ *  Summary:
+ *    An OSStatus with the Result interface; exactly the size of an OSStatus.
+ */
+template <>
+class Result<void>
+{
+public:
+	typedef void    value_type;
+
+	constexpr Result() noexcept : fStatus(noErr) {}
+
+	Result(Failure inFailure) noexcept : fStatus(inFailure.status)
+	{
+		__Check(inFailure.status != noErr);
+	}
+
+	constexpr bool      ok() const noexcept             { return fStatus == noErr; }
+	constexpr explicit  operator bool() const noexcept  { return ok(); }
+	constexpr OSStatus  status() const noexcept         { return fStatus; }
+
+	void value() const noexcept { __Check(ok()); }
+
+private:
+	OSStatus    fStatus;
+};
+
+} /* namespace AssertMacros */
+
+
+/*
+ *  __Require_OK(result)
+ *
+ *  Summary:
+ *    Production builds: if the Result expression is not ok, return its status from the
+ *    enclosing function as an AssertMacros::Failure.
+ *
+ *    Non-production builds: if the Result expression is not ok, call DEBUG_ASSERT_MESSAGE
+ *    and then return its status from the enclosing function as an AssertMacros::Failure.
+ *
+ *    In both cases the macro is an expression which yields the value of a successful
+ *    Result, so it can be used as an initializer:
+ *
+ *        AssertMacros::Result<Widget> MakeWidget();
+ *
+ *        AssertMacros::Result<void> UseWidget()
+ *        {
+ *            Widget widget = __Require_OK(MakeWidget());
+ *            ...
+ *        }
+ *
+ *    The enclosing function must return an AssertMacros::Result<U> (for any U) or an OSStatus.
+ *
+ *  Parameters:
+ *
+ *    result:
+ *      An expression of type AssertMacros::Result<T>; it is evaluated once.
+ */
+#ifndef __Require_OK
+	#if DEBUG_ASSERT_PRODUCTION_CODE
+	   #define __Require_OK(result)                                                \
+		  ({                                                                      \
+			  auto &&evalOnceResult = (result);                                   \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(!evalOnceResult.ok()) )            \
+			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(evalOnceResult.status());            \
+				  return AssertMacros::Failure(evalOnceResult.status());          \
+			  }                                                                   \
+			  static_cast<decltype(evalOnceResult) &&>(evalOnceResult).value();   \
+		  })
+	#else
+	   #define __Require_OK(result)                                                \
+		  ({                                                                      \
+			  auto &&evalOnceResult = (result);                                   \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(!evalOnceResult.ok()) )            \
+			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(evalOnceResult.status());            \
+				  DEBUG_ASSERT_MESSAGE(                                           \
+					  DEBUG_ASSERT_COMPONENT_NAME_STRING,                         \
+					  #result " is OK", 0, 0, __FILE__, __LINE__, evalOnceResult.status()); \
+				  return AssertMacros::Failure(evalOnceResult.status());          \
+			  }                                                                   \
+			  static_cast<decltype(evalOnceResult) &&>(evalOnceResult).value();   \
+		  })
+	#endif
+#endif
+
+/*
+ *  __Require_OK_String(result, message)
+ *
+ *  Summary:
+ *    Same as __Require_OK, but passes message to DEBUG_ASSERT_MESSAGE in
+ *    non-production builds.
+ *
+ *  Parameters:
+ *
+ *    result:
+ *      An expression of type AssertMacros::Result<T>; it is evaluated once.
+ *
+ *    message:
+ *      The C string to display.
+ */
+#ifndef __Require_OK_String
+	#if DEBUG_ASSERT_PRODUCTION_CODE
+	   #define __Require_OK_String(result, message)  __Require_OK(result)
+	#else
+	   #define __Require_OK_String(result, message)                                \
+		  ({                                                                      \
+			  auto &&evalOnceResult = (result);                                   \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(!evalOnceResult.ok()) )            \
+			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(evalOnceResult.status());            \
+				  DEBUG_ASSERT_MESSAGE(                                           \
+					  DEBUG_ASSERT_COMPONENT_NAME_STRING,                         \
+					  #result " is OK", 0, message, __FILE__, __LINE__, evalOnceResult.status()); \
+				  return AssertMacros::Failure(evalOnceResult.status());          \
+			  }                                                                   \
+			  static_cast<decltype(evalOnceResult) &&>(evalOnceResult).value();   \
+		  })
+	#endif
+#endif
+
+/*
+ *  __Require_OK_Quiet(result)
+ *
+ *  Summary:
+ *    If the Result expression is not ok, return its status from the enclosing
+ *    function as an AssertMacros::Failure.  Yields the value of a successful Result.
+ *
+ *  Parameters:
+ *
+ *    result:
+ *      An expression of type AssertMacros::Result<T>; it is evaluated once.
+ */
+#ifndef __Require_OK_Quiet
+	#define __Require_OK_Quiet(result)                                            \
+	  ({                                                                          \
+		  auto &&evalOnceResult = (result);                                       \
+		  if ( DEBUG_ASSERT_EXPECT_FAILURE(!evalOnceResult.ok()) )                \
+		  {                                                                       \
+			  DEBUG_ASSERT_FAILURE_PROBE(evalOnceResult.status());                \
+			  return AssertMacros::Failure(evalOnceResult.status());              \
+		  }                                                                       \
+		  static_cast<decltype(evalOnceResult) &&>(evalOnceResult).value();       \
+	  })
+#endif
+
+/*
+ *  __Require_noErr_Return(errorCode)
+ *
+ *  Summary:
+ *    Production builds: if the errorCode expression does not equal 0 (noErr),
+ *    return it from the enclosing function as an AssertMacros::Failure.
+ *
+ *    Non-production builds: if the errorCode expression does not equal 0 (noErr),
+ *    call DEBUG_ASSERT_MESSAGE and then return it from the enclosing function as an
+ *    AssertMacros::Failure.
+ *
+ *    This is __Require_noErr for functions returning a Result<U> (or an OSStatus)
+ *    which cannot, or do not want to, use an exception label.
+ *
+ *  Parameters:
+ *
+ *    errorCode:
+ *      The expression to compare to 0.
+ */
+#ifndef __Require_noErr_Return
+	#if DEBUG_ASSERT_PRODUCTION_CODE
+	   #define __Require_noErr_Return(errorCode)                                   \
+		  do                                                                      \
+		  {                                                                       \
+			  OSStatus evalOnceErrorCode = (errorCode);                           \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(0 != evalOnceErrorCode) )          \
+			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(evalOnceErrorCode);                  \
+				  DEBUG_ASSERT_RECORD_ERROR(evalOnceErrorCode);                   \
+				  return AssertMacros::Failure(evalOnceErrorCode);                \
+			  }                                                                   \
+		  } while ( 0 )
+	#else
+	   #define __Require_noErr_Return(errorCode)                                   \
+		  do                                                                      \
+		  {                                                                       \
+			  OSStatus evalOnceErrorCode = (errorCode);                           \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(0 != evalOnceErrorCode) )          \
+			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(evalOnceErrorCode);                  \
+				  DEBUG_ASSERT_RECORD_ERROR(evalOnceErrorCode);                   \
+				  DEBUG_ASSERT_MESSAGE(                                           \
+					  DEBUG_ASSERT_COMPONENT_NAME_STRING,                         \
+					  #errorCode " == 0 ", 0, 0, __FILE__, __LINE__, evalOnceErrorCode); \
+				  return AssertMacros::Failure(evalOnceErrorCode);                \
+			  }                                                                   \
+		  } while ( 0 )
+	#endif
+#endif
+
+/*
+ *  __Require_noErr_Return_String(errorCode, message)
+ *
+ *  Summary:
+ *    Same as __Require_noErr_Return, but passes message to DEBUG_ASSERT_MESSAGE in
+ *    non-production builds.
+ *
+ *  Parameters:
+ *
+ *    errorCode:
+ *      The expression to compare to 0.
+ *
+ *    message:
+ *      The C string to display.
+ */
+#ifndef __Require_noErr_Return_String
+	#if DEBUG_ASSERT_PRODUCTION_CODE
+	   #define __Require_noErr_Return_String(errorCode, message)  __Require_noErr_Return(errorCode)
+	#else
+	   #define __Require_noErr_Return_String(errorCode, message)                   \
+		  do                                                                      \
+		  {                                                                       \
+			  OSStatus evalOnceErrorCode = (errorCode);                           \
+			  if ( DEBUG_ASSERT_EXPECT_FAILURE(0 != evalOnceErrorCode) )          \
+			  {                                                                   \
+				  DEBUG_ASSERT_FAILURE_PROBE(evalOnceErrorCode);                  \
+				  DEBUG_ASSERT_RECORD_ERROR(evalOnceErrorCode);                   \
+				  DEBUG_ASSERT_MESSAGE(                                           \
+					  DEBUG_ASSERT_COMPONENT_NAME_STRING,                         \
+					  #errorCode " == 0 ", 0, message, __FILE__, __LINE__, evalOnceErrorCode); \
+				  return AssertMacros::Failure(evalOnceErrorCode);                \
+			  }                                                                   \
+		  } while ( 0 )
+	#endif
+#endif
+
+/*
+ *  __Require_noErr_Return_Quiet(errorCode)
+ *
+ *  Summary:
+ *    If the errorCode expression does not equal 0 (noErr), return it from the
+ *    enclosing function as an AssertMacros::Failure.
+ *
+ *  Parameters:
+ *
+ *    errorCode:
+ *      The expression to compare to 0.
+ */
+#ifndef __Require_noErr_Return_Quiet
+	#define __Require_noErr_Return_Quiet(errorCode)                               \
+	  do                                                                          \
+	  {                                                                           \
+		  OSStatus evalOnceErrorCode = (errorCode);                               \
+		  if ( DEBUG_ASSERT_EXPECT_FAILURE(0 != evalOnceErrorCode) )              \
+		  {                                                                       \
+			  DEBUG_ASSERT_FAILURE_PROBE(evalOnceErrorCode);                      \
+			  DEBUG_ASSERT_RECORD_ERROR(evalOnceErrorCode);                       \
+			  return AssertMacros::Failure(evalOnceErrorCode);                    \
+		  }                                                                       \
+	  } while ( 0 )
+#endif
+
+#endif /* __cplusplus >= 201703L */
+
+#endif /* __ASSERTMACROSRESULT__ */
@@ -0,0 +1,133 @@
+/*
+     File:       AssertMacrosWithin.h
+
+     Contains:   Tick counter and conversion support for the AssertMacros.h latency
+                 budget macros (__Within_Start, __Check_Within, __Verify_Within and
+                 __Require_Within).
+
+                 Regions are timed with the cheapest monotonic counter the processor has:
+                 the time stamp counter on x86, the virtual counter on arm64, and
+                 mach_absolute_time() on Darwin.  Elsewhere CLOCK_MONOTONIC is used.  Ticks
+                 are converted to nanoseconds only when a region ends, with a 32.32 fixed
+                 point factor calibrated once, as the library is loaded.  On x86 it is
+                 read from CPUID leaf 0x15 where the processor reports it; otherwise
+                 measuring it takes about DEBUG_ASSERT_WITHIN_CALIBRATION_MS milliseconds.
+
+                 The x86 time stamp counter must be invariant, as it is on every x86-64
+                 processor of the last decade; regions which migrate between processors
+                 are only as accurate as the counters are synchronized.
+
+                 Code using the timed forms must be linked with libCarbonHeaders.
+
+*/
+#ifndef __ASSERTMACROSWITHIN__
+#define __ASSERTMACROSWITHIN__
+
+#include <stdint.h>
+
+#if defined(__APPLE__)
+	#include <mach/mach_time.h>
+#elif !defined(__x86_64__) && !defined(__i386__) && !defined(__aarch64__)
+	#include <time.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Nanoseconds per tick in 32.32 fixed point; 0 until calibrated. */
+extern uint64_t gDebugAssertNanosecondsPerTick;
+
+/*
+ *  DebugAssertCalibrateTicks()
+ *
+ *  Summary:
+ *    Returns the nanoseconds per tick in 32.32 fixed point, measuring the tick rate
+ *    first if that has not been done.  The library does so as it is loaded, and
+ *    concurrent callers wait for a single measurement, so there is no need to call it
+ *    directly.
+ */
+extern uint64_t
+DebugAssertCalibrateTicks(void);
+
+/*
+ *  DebugAssertReadTicks()
+ *
+ *  Summary:
+ *    Reads the tick counter.  Never returns 0, which marks a region that is not timed.
+ */
+static inline uint64_t
+DebugAssertReadTicks(void)
+{
+	uint64_t ticks;
+
+#if defined(__APPLE__)
+	ticks = mach_absolute_time();
+#elif defined(__x86_64__) || defined(__i386__)
+	ticks = __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+	__asm__ __volatile__ ("isb\n\tmrs %0, cntvct_el0" : "=r" (ticks) :: "memory");
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	ticks = (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#endif
+	return ticks | (ticks == 0);
+}
+
+/*
+ *  DebugAssertTicksToNanoseconds()
+ *
+ *  Summary:
+ *    Converts a tick interval to nanoseconds.
+ */
+static inline uint64_t
+DebugAssertTicksToNanoseconds(uint64_t ticks)
+{
+	uint64_t scale = __atomic_load_n(&gDebugAssertNanosecondsPerTick, __ATOMIC_RELAXED);
+
+	if ( __builtin_expect(scale == 0, 0) )
+		scale = DebugAssertCalibrateTicks();
+#if defined(__SIZEOF_INT128__)
+	return (uint64_t)(((unsigned __int128)ticks * scale) >> 32);
+#else
+	return (ticks >> 32) * scale + (((ticks & 0xFFFFFFFFu) * scale) >> 32);
+#endif
+}
+
+/*
+ *  DebugAssertWithinStart()
+ *
+ *  Summary:
+ *    Reads the tick counter at the start of a region, calibrating first if needed so
+ *    that the calibration is never counted against a region.
+ */
+static inline uint64_t
+DebugAssertWithinStart(void)
+{
+	if ( __builtin_expect(__atomic_load_n(&gDebugAssertNanosecondsPerTick, __ATOMIC_RELAXED) == 0, 0) )
+		DebugAssertCalibrateTicks();
+	return DebugAssertReadTicks();
+}
+
+/*
+ *  DebugAssertWithinSampled()
+ *
+ *  Summary:
+ *    Returns non-zero on every interval-th call for the given site counter, and on the
+ *    first; an interval of 0 or 1 samples every call.
+ */
+static inline int
+DebugAssertWithinSampled(uint32_t *counter, uint32_t interval)
+{
+	if ( interval <= 1 )
+		return 1;
+	return __atomic_fetch_add(counter, 1, __ATOMIC_RELAXED) % interval == 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ASSERTMACROSWITHIN__ */
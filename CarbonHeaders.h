@@ -0,0 +1,38 @@
+/*
+     File:       CarbonHeaders.h
+
+     Contains:   TargetConditionals.h, ConditionalMacros.h, MacTypes.h, Endian.h,
+                 MacErrors.h and AssertMacros.h, in one header to precompile.
+
+                 "make precompiled" compiles this header for C and for C++ into
+                 CarbonHeaders.h.gch, a directory GCC searches whenever CarbonHeaders.h is
+                 included, and install_precompiled_headers installs it beside this
+                 header.  A file that includes CarbonHeaders.h before anything else then
+                 loads the compiled form instead of parsing the six headers again.  Other
+                 compilers, and files that include something else first, parse them as
+                 usual; so do files compiled with options the precompiled header was not
+                 built with (PCH_CFLAGS).
+
+                 AssertMacros.h is configured by the macros defined before it is included
+                 (DEBUG, DEBUG_ASSERT_PRODUCTION_CODE, DEBUG_ASSERT_MESSAGE...).  GCC
+                 records the ones it tested and will not use the precompiled header in a
+                 file that defines any of them differently, so such a file is correct but
+                 not faster; build a second precompiled header with the same definitions
+                 in PCH_CFLAGS for it.  The same goes for the ConditionalMacros.h
+                 settings (OLDROUTINENAMES, TARGET_API_MAC_CARBON...).  "make
+                 check_precompiled" checks both cases.
+
+                 With clang, use CarbonHeaders.modulemap instead.
+
+*/
+#ifndef __CARBONHEADERS__
+#define __CARBONHEADERS__
+
+#include <TargetConditionals.h>
+#include <ConditionalMacros.h>
+#include <MacTypes.h>
+#include <Endian.h>
+#include <MacErrors.h>
+#include <AssertMacros.h>
+
+#endif /* __CARBONHEADERS__ */
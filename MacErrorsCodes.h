@@ -0,0 +1,1331 @@
+/*
+     File:       MacErrorsCodes.h
+
+     Contains:   The values of the names defined in MacErrors.h, looked up by name.
+
+                 Generated by tools/MacErrorsTable.py --codes from MacErrors.h; do not
+                 edit.  Run "make generated_headers" after changing MacErrors.h.
+
+                 MacErrors::ErrorCodeOf("fnfErr") is -43, and an alias yields the value it
+                 stands for, so ErrorCodeOf("iIOAbortErr") is abortErr.  A name that is
+                 not defined yields std::nullopt.  Every name hashes to the only slot it
+                 can be in, so a lookup is one hash of the name, 8 bytes at a time, and
+                 one comparison, 16 bytes at a time with SSE2 or NEON where available.
+                 Nothing is allocated, nothing past the end of the name is read (it need
+                 not be terminated), and the same function works in constant expressions:
+
+                     static_assert(*MacErrors::ErrorCodeOf("fnfErr") == -43, "");
+
+                 Values are taken as OSStatus, as in MacErrorsNames.h.
+
+                 Requires C++17.  Including this header from C does nothing.
+
+                 2224 names.
+
+*/
+#ifndef __MACERRORSCODES__
+#define __MACERRORSCODES__
+
+#if defined(__cplusplus) && (__cplusplus >= 201703L)
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <optional>
+#include <string_view>
+
+/* Outside constant expressions, names are read with word and vector loads. */
+#if defined(__clang__) || (defined(__GNUC__) && (__GNUC__ >= 9))
+	#define __MACERRORSCODES_LOADS__ 1
+	#if defined(__SSE2__)
+		#include <emmintrin.h>
+		#define __MACERRORSCODES_SSE2__ 1
+	#elif defined(__ARM_NEON) && defined(__aarch64__)
+		#include <arm_neon.h>
+		#define __MACERRORSCODES_NEON__ 1
+	#endif
+#endif
+
+namespace MacErrors {
+
+namespace Private {
+
+	struct NameKey {
+		uint16_t    offset;             /* into kNamePool */
+		uint8_t     length;
+		int32_t     status;
+	};
+
+	inline constexpr size_t kNameCount = 2224;
+	inline constexpr size_t kNameBucketCount = 556;
+	inline constexpr size_t kNameLengthMax = 44;
+
+	/* Every name, unterminated, in slot order. */
+	inline constexpr char kNamePool[] =
+		"kLocalesDefaultDisplayStatuserrKCDataNotAvailablememPurErrOSAInconsistentDeclarations"
+		"numberFormattingDelimiterMissingErrOSAUndefinedHandlerinvalidSampleTable"
+		"errOSACantOpenComponentkATSUNoFontCmapAvailableErrnetworkErrkEOPNOTSUPPErrinvalidRect"
+		"menuUsesSystemDefErrkInUseErrlaEnvironmentExistErrunicodeContextualErr"
+		"kNSpOTVersionTooOldErrafpIDNotFoundsmNoBoardSRsrcnrTransactionAbortedkernelExceptionErr"
+		"cmNoCurrentProfileerrWindowsAlreadyInitializedkTECUsedFallbacksStatus"
+		"kTECNoConversionPathErrkInvalidDeviceNumberfragLastErrCodedsMacOSROMVersionTooOld"
+		"kFBCindexCreationFailedafpFileBusykFBCbadIndexFilecfragDupRegistrationErr"
+		"telNotEnoughdspBWcmIndexRangeErrpropertyNotSupportedByNodeErrqtsTooMuchDataErr"
+		"cfragStdFolderErrkENOSTRErrkQDCursorNotRegisteredkNSLNoElementsInListmidiVConnectRmvd"
+		"kQDNoPaletteinvalidFolderTypeErrinvalidTrackfragAppNotFoundnoVideoTrackInMovieErr"
+		"extFSErrkALMModuleCommunicationErrunknownFormatErrbadBuffNumdcmBadFeatureErr"
+		"cmInvalidDstMapkOTPortHasDiedErrdsReinsertkPOSIXErrorEDEADLKnumberFormattingBadFormatErr"
+		"kEBADMSGErrcfragNoClientMemErrfragObjectInitSeqErrkNSpAddressInUseErr"
+		"errKCDuplicateCallbackfragContextNotFoundaspTooManythemeBadCursorIndexErrerrAELocalOnly"
+		"nbpNotFoundhrMiscellaneousExceptionErrkPOSIXErrorETIME"
+		"kProcessorTempRoutineRequiresMPLib2kUSBDevicePowerProblemnoTypeErrkUSBRes1ErrdsIOCoreErr"
+		"couldNotUseAnExistingSampleerrOffsetNotOnElementBoundaykENOBUFSErrsiBadDeviceName"
+		"dcmBadKeyErrvLckdErrnoDefaultDataReferrCouldntSetFocusurlDataHFTPServerErr"
+		"controllerHasFixedHeightcomponentNotThreadSafeErrerrAENegativeCounttelBadLevelErr"
+		"dsFinderErrerrWindowDoesNotHaveProxymemPCErrafpPwdTooShortErrerrFSMissingCatInfo"
+		"invalidSpriteIDErrerrCppout_of_rangekPOSIXErrorECONNREFUSEDlockPortBitsBadPortErr"
+		"invalidTimeerrCppdomain_errorthemeBadTextColorErrkUSBBufUnderRunErrkATSULowLevelErr"
+		"kUSBUnknownInterfaceErrkUSBInternalReserved6kDMCantBlockcmProfileError"
+		"kALMNoSuchModuleErrkNoMoreTimerClientsErrerrAETimeouttelBadHandErrkTXNInvalidRunIndex"
+		"fsRnErrkNoMoreInterruptSlotsErrerrOSACorruptDatakALMGroupNotFoundErrkPOSIXErrorENOTTY"
+		"illegalNoteChannelOSErrerrKCNoSuchClassnotExactMatrixErrcontrolErrkPOSIXErrorE2BIG"
+		"telBadIntercomIDkPOSIXErrorESHUTDOWNinvalidMediafsmFFSNotFoundErrtwoSideErrvolOffLinErr"
+		"hmHelpDisabledunsupportedOSErrqtParamErrerrUserWantsToDragWindow"
+		"controlPropertyNotFoundErrsmDisDrvrNamErrunicodeFallbacksErrclkRdErrbadDragItemErr"
+		"sktClosedErrafpDirNotEmptynbpConfDifftelBadPageIDfontNotOutlineErrresAttrErr"
+		"kHIDNotEnoughMemoryErrlastDskErrmenuNotFoundErrsameFileErrnoMoreFolderDescErr"
+		"kPOSIXErrorENOBUFSwackForkNotFoundErrdsMixedModeFailurelockPortBitsSurfaceLostErr"
+		"kHIDNullPointerErrtelGenericErrorcomponentDllLoadErrcodecBadDataErrkTECMissingTableErr"
+		"errCppruntime_errorkFBCdeletionFaileddcmBadDictionaryErrqfcbNotCreatedErr"
+		"deviceCantMeetRequestkURLInvalidCallErrords32BitModekURLPropertyNotYetKnownError"
+		"limitReachedErrAAPNotFoundErrmidiTooManyPortsErrcomponentDllEntryNotFoundErrmemAdrErr"
+		"vmNoVectorErrkUSBPipeStalledErrorkDSpInvalidAttributesErrerrCppoverflow_errorafpParmErr"
+		"invalidIconRefErrinvalidChunkNumkPOSIXErrorENOTBLKkATSUInvalidAttributeTagErr"
+		"vmInvalidBackingFileIDErrkFNSBadReferenceVersionErrvmOffErrnoSendRespdigiUnimpErr"
+		"portClosedErrnotLoggedInErrnbpNISErrkECANCELErrdsBadPatchHeaderunicodeChecksumErr"
+		"cfragNoApplicationErrerrKCNoDefaultKeychainkMPProcessCreatedErrkSSpVersionErr"
+		"kMPIterationEndErraspBadVersNumkATSUOutputBufferTooSmallErrkNSLBadNetConnection"
+		"cfragNoRegistrationErrkUSBNotSent1ErrfragCorruptErrkURLInvalidURLReferenceErrorrfNumErr"
+		"telCBErrprWrErrkFNSInvalidProfileErrkDSpStereoContextErrthreadProtocolErr"
+		"kernelAsyncReceiveLimitErrerrFSNameTooLongkUSBDataToggleErrsdmSRTInitErr"
+		"tsmTextServiceNotFoundErrdebuggingInvalidOptionErrinternalComponentErr"
+		"errOSADataFormatObsoletekDTPHoldJobErrnotEnoughBufferSpaceunknownInsertModeErr"
+		"kPOSIXErrorEPROTOcodecAbortErrkUSBInternalReserved1editionMgrInitErrtelBadDNErr"
+		"dsGreetingdataAlreadyCloseddInstErruserRejectErrkOTNoDataErrkEBUSYErrkEMSGSIZEErr"
+		"duplicateScrapFlavorErrmidiNameLenErrtrackIDNotFoundkNoCardSevicesSocketsErrposErr"
+		"kOTNoAddressErrerrIANoMoreItemskTECPartialCharErrerrKCCreateChainFailedkernelInUseErr"
+		"afpCantMountMoreSrvrebadTrackIndexkESHUTDOWNErrkUCTSNoKeysAddedToObjectErr"
+		"cantOpenHandlerkFBCvalidationFailedauxiliaryExportDataUnavailabledsSystemRequiresPowerPC"
+		"nonDragOriginatorErrtsmComponentNoErrdsNoPackErrbadFileFormaterrWindowDoesNotFitOnscreen"
+		"noDataHandlerbadFidErrwackBadMetaDataErrkPOSIXErrorEISCONNfragInitLoop"
+		"kUCTokenizerIterationFinishedafpCallNotSupportedinvalidIndexErrtsmNoOpenTSErr"
+		"kTXNCannotTurnTSMOffWhenUsingUnicodeErrerrASIllegalFormalParametercfragFirstErrCode"
+		"dataVerErrtsmCantChangeForcedClassStateErrnoBridgeErrmemSCErrtelBadTermErr"
+		"errAEReplyNotArrivednrPathNotFounderrAEInTransactionerrOSADataBlockTooLargeatpLenErr"
+		"kUSBNotFoundtelBadAPattErrkPOSIXErrorEPFNOSUPPORTlapProtErrkHIDInvertedPhysicalRangeErr"
+		"smInitTblVErrtsmComponentAlreadyOpenErrkUSBUnderRunErrkernelAttributeErr"
+		"kCollateBufferTooSmallkEACCESErrkDSpNotInitializedErrretryComponentRegistrationErr"
+		"iIOAbortCDEFNFndkNSLNoPluginsFoundkHIDBadLogicalMinimumErrkNSLNotInitialized"
+		"wfFileNotFounderrKCReadOnlyAttrcfragFragmentUsageErrerrFwdResettextParserBadParamErr"
+		"resProblemmatrixErrkOTClientNotInittedErrkHIDValueOutOfRangeErrmidiWriteErr"
+		"kReadFailureErrkFMInvalidFontErrsynthNotReadykBadOffsetErrkOTBadAddressErr"
+		"kRAConnectionCanceledkPOSIXErrorESHLIBVERSerrAEIndexTooLargenoErrerrAENotAppleEvent"
+		"kPOSIXErrorENOTDIRsmNosInfoArraykRAPortBusykernelDeletePermissionErrbadFolderDescErr"
+		"openErrOSAParameterMismatchurlDataHFTPBadNameListErrnotEnoughDiskSpaceToGrab"
+		"errInvalidWindowRefkENOTCONNErrerrInvalidWindowPropertycodecDroppedFrameErr"
+		"cmInvalidColorSpacekMPTimeoutErrdirNFErrkNavInvalidCustomControlMessageErr"
+		"kUSBAbortedErrorerrAENotAnObjSpeckPOSIXErrorECANCELEDkPOSIXErrorEPROTONOSUPPORT"
+		"kNavWrongDialogStateErrdsFPErrcodecOpenErrafpBadDirIDTypekMPTaskCreatedErrqtsTimeoutErr"
+		"envNotPresentbadImageErrkUSBInternalReserved8errAEUnknownAddressTypekPOSIXErrorEBUSY"
+		"errAENoSuchLogicalnrNotSlotDeviceErrurlDataHHTTPProtocolErrerrAECoercionFailbadCksmErr"
+		"cmErrIncompatibleProfilecantReceiveFromSynthesizerOSErrverErrseqGrabInfoNotAvailable"
+		"smCkStatusErrduplicateAtomTypeAndIDErrkWriteProtectedErrkAlreadySavedStateErr"
+		"kUSBQueueAbortedkUSBUnknownRequestErrnoMovieFounderrOSACorruptTerminologySlpTypeErr"
+		"laTextOverFlowErrerrASCantConsiderAndIgnoreerrASInconsistentNameskernelUnsupportedErr"
+		"kNSpCreateGroupFailedErrwindowAppModalStateAlreadyExistsErrcfragCFragRsrcErrprotocolErr"
+		"cmInvalidProfileCommentkNoCompatibleNameErrkPOSIXErrorEREMOTEkUSBInternalReserved10"
+		"dataAlreadyOpenForWritetextParserNoSuchTokenFoundErrkFBCillegalSessionChange"
+		"telBadProcErrfragLibNotFoundvmFileViewAccessErrwrgVolTypErrpictureDataErr"
+		"cfragUnresolvedErrcodecImageBufErrkUnsupportedFunctionErrerrAEEmptyListContainer"
+		"dcmProtectedErrsmGetDrvrNamErrnoSoundTrackInMovieErrkPostCardEventErrbtNoSpace"
+		"timeNotInTrackkHIDReportCountZeroErrdsBadStartupDiskerrOffsetIsOutsideOfViewrgnTooBigErr"
+		"dcmBadPropertyErrbadDataRefIndexcfragNoLibraryErrkBusyErrunicodeCharErrtsmTSNotOpenErr"
+		"kHIDUnmatchedUsageRangeErrdsMemFullErrurlDataHFTPServerDisconnectedErrkECONNABORTEDErr"
+		"desktopDamagedErrkTXNSomeOrAllTagsInvalidForRunErrkPOSIXErrorEROFSkPOSIXErrorEINPROGRESS"
+		"kCollateMissingUnicodeTableErrkHIDInvalidReportTypeErrnumberFortmattingNotADigitErr"
+		"codecNeedAccessKeyErrkPOSIXErrorEPWROFFddpLenErrkPOSIXErrorEBADEXECcmInvalidProfile"
+		"aspSizeErrsmReservedErrtelUnknownErrdsGibblyMovedToDisabledFolderinterruptsMaskedErr"
+		"unsupportedProcessorErrafpRangeNotLockederrNotInImagingModesiNoSoundInHardware"
+		"kWriteFailureErraspNoServerskNSpTimeoutErrerrIAEndOfTextRunkEWOULDBLOCKErr"
+		"errAENoSuchTransactionkURLUnsupportedSchemeErrorafpCantRenamehmHelpManagerNotInited"
+		"kNSpConnectFailedErrsiNoBufferSpecifiedkISpElementInListErrdataNotOpenForWrite"
+		"badBtSlpErrafpServerGoingDowninvalidComponentIDhmSkippedBalloondRemovErrcfragFileSizeErr"
+		"afpNoMoreLockskHIDBaseErrorkHIDReportSizeZeroErrcfragRsrcForkErraspParamErr"
+		"fsmBadFSDLenErrlaEnvironmentNotFoundErrkNSpNotAdvertisingErr"
+		"tsmComponentPropertyNotFoundErrkPOSIXErrorENOEXECafpCatalogChangednameTypeErr"
+		"kPOSIXErrorENOSTRafpAuthContinuekURLFileEmptyErrorkNSLNoContextAvailable"
+		"kFBCsummarizationCanceleduserBreaklockPortBitsWindowMovedErrkENOPROTOOPTErr"
+		"needClearScrapErrkOTBadQLenErrgfpErrkBadTypeErrwrPermErrkUSBDeviceSuspended"
+		"lockPortBitsBadSurfaceErrkBadWindowErrkHIDBadParameterErrinvalidSpritePropertyErr"
+		"unicodeTextEncodingDataErrvmAddressNotInFileViewErrkRADuplicateIPAddr"
+		"errKCInvalidSearchReferrCppGeneralbadCallOrderErrtelVTypeNotSuppbadServiceMethodErr"
+		"dsNoPk7kDMMirroringBlockeddsVMDeferredFuncTableFulllaFailAnalysisErrsourceNotFoundErr"
+		"vmNoMoreBackingFilesErrmidiVConnectMadeerrFSRefsDifferentkPOSIXErrorEHOSTDOWN"
+		"kUSBDeviceDisconnectedkATSUNoStyleRunsAssignedErrcodecParameterDialogConfirm"
+		"invalidAtomContainerErrkUSBCRCErrtsmComponentPropertyUnsupportedErrdsShutDownOrResume"
+		"smOffsetErrkESRCHErrkernelCanceledErrkNSLSomePluginsFailedToLoadkALMInternalErr"
+		"kUSBCompletionErrortelNoOpenErrkEHOSTUNREACHErrkNavWrongDialogClassErrdsForcedQuit"
+		"nrPowerSwitchAbortErrkPOSIXErrorEOPNOTSUPPfragSectionNotFounddsNoPk5invalidMovie"
+		"rcDBNoHandlernumberFormattingBadNumberFormattingObjectErr"
+		"dsWriteToSupervisorStackGuardPagekBadSpeedErrnoScrapPromiseKeeperErrkFBCcommitFailed"
+		"couldNotResolveDataReftsmNoStemerrFSBadSearchParamsbadDCksumerrAENotASingleObject"
+		"kALMDuplicateModuleErrthemeMonitorDepthNotSupportedErrkNSpAddPlayerFailedErr"
+		"kURLDestinationExistsErrorkernelExecutePermissionErrsmNoMoresRsrcs"
+		"kATSUUnsupportedStreamFormatErrkTXNIllegalToCrossDataBoundariesErrnotARemountErrdsFSErr"
+		"dsHD20InstalledtsmUnknownErrkPassCallToChainErrcmNamedColorNotFoundfsmBusyFFSErr"
+		"kRAOutOfMemoryerrStateinvalidPickerTypekRARemoteAccessNotReadybadInputText"
+		"kTXNBadDefaultFileTypeWarningtelAutoAnsNotOndupFNErrbadDepthErrkPOSIXErrorEDESTADDRREQ"
+		"noResponseErrsmInitStatVErrdsParityErrkHIDDeviceNotReadynoOutstandingHLE"
+		"kPOSIXErrorEINVALcmUnsupportedDataTypenoteChannelNotAllocatedOSErrgestaltLocationErr"
+		"gestaltUndefSelectorErrtsmUnsupportedTypeErrkNSpMessageTooBigErrcorErr"
+		"kRAPPPUserDisconnectedtelBadFeatureIDtrackNotInMoviekNSpInvalidProtocolRefErr"
+		"noUserRefErrsmRevisionErrnoHelpForItemkUnsupportedCardErrnumberFormattingBadOptionsErr"
+		"badEditionFileErrnoPathMappingErrkUSBTooManyPipesErrdsNoPatchcollectionItemLockedErr"
+		"unitTblFullErrhmNoBalloonUpkPOSIXErrorETIMEDOUTerrAEWrongNumberArgsuserCanceledErr"
+		"updPixMemErrsmNilsBlockErrnmTypErrevtNotEnbOSAIllegalRangekENETUNREACHErrkUSBDeviceBusy"
+		"errOSAScriptErrorkUSBInternalReserved3afpInsideSharedErrkNSpNoPlayersErrkUSBBufOvrRunErr"
+		"kUSBInternalReserved4kTXNCannotAddFrameErrcantCreatePickerWindow"
+		"vmInvalidOwningProcessErrmemROZErrorkHIDInvalidRangePageErrkNSpNameRequiredErr"
+		"kUSBRes2ErrsmBLFieldBadafpObjectTypeErrdsMiscErrcmCantDeleteProfile"
+		"kATSUInvalidAttributeSizeErrillegalScrapFlavorSizeErrhmBalloonAbortedkFBCindexNotFound"
+		"kNotReadyErrnsvErrkUSBIncorrectTypeErrrecordDataTooBigErrdskFulErr"
+		"kATSUInvalidTextRangeErrcontrolHandleInvalidErrlaEnvironmentBusyErrbadDictFormat"
+		"smBadRefIddsMBExternFlpySysErrornoRecordOfAppwindowGroupInvalidErrtelBadParkID"
+		"buf2SmallErrkOTResAddressErrafpDiffVolErrmidiVConnectErrkFBCcompactionFailedsmPriInitErr"
+		"vmBusyBackingFileErrurlDataHHTTPURLErrsiBadSoundInDevicecfragImportTooOldErr"
+		"invalidDataRefContainernoHardwarekModemScriptMissingnotEnoughDataErrnrNameErr"
+		"handlerNotFoundErrerrAEReceiveEscapeCurrentcodecSizeErrAAPNotCreatedErr"
+		"cfragAbortClosureErrafpTooManyFilesOpendsNoPk3rmvRefFailederrAEWriteDenied"
+		"kNSLBadClientInfoPtrbufTooSmallillegalPartOSErrkMPInsufficientResourcesErrbadDBtSlp"
+		"kHIDVersionIncompatibleErrwindowNoAppModalStateErrkDTPTryAgainErrkPOSIXErrorENODATA"
+		"rcDBBadTypedsAddressErrqtsBadStateErrkUSBFlagsErroriIOAbortErrvideoOutputInUseErr"
+		"kCollateUnicodeConvertFailedErrexcessCollsnstelNoCommFolderenvVersTooBig"
+		"illegalScrapFlavorTypeErrcantFindHandlernoMPPErrkUTCOverflowErrerrAEUnknownObjectType"
+		"kBadSocketErraspServerBusynoToolboxNameErrdcmDupRecordErrfragDupRegLibNameafpEofError"
+		"kTXNATSUIIsNotInstalledErrteScrapSizeErrkNSpInvalidParameterErrconnectionInvalid"
+		"OSASyntaxTypeErrorOSADuplicatePropertykPOSIXErrorEIDRMurlDataHFTPFilenameErrerrAttention"
+		"kDMDriverNotDisplayMgrAwareErrkUCTokenNotFoundbadEditIndexcatChangedErr"
+		"kHIDBadLogPhysValuesErrsmNoBoardIdtelBadHTypeErrkOTNoStructureTypeErrmemAZErr"
+		"menuPropertyInvalidErrnotOpenErrstrUserBreakkUTCUnderflowErrkFBCanalysisNotAvailable"
+		"addResFailedhMenuFindErrqtXMLParseErrkNSLBadDataTypeErrnumberFormattingSpuriousCharErr"
+		"kENOENTErrkPOSIXErrorEHOSTUNREACHerrCppbad_allocerrOSACantAssignnrDataTruncatedErr"
+		"telBadIndexerrAENoUserInteractionkNSpInitializationFailedErrkNSpAlreadyAdvertisingErr"
+		"telValidateFailedafpSameObjectErrlockPortBitsWindowClippedErrkMPProcessTerminatedErr"
+		"qtActionNotHandledErrdsCoreErrcfragNoSectionErrkUSBNotRespondingErrresNotFound"
+		"errAENotAnElementtelBadPickupGroupIDnoUserNameErrkHIDUnmatchedStringRangeErr"
+		"kPOSIXErrorENOPROTOOPTinvalidSampleNumdsPCCardATASysErrorkPOSIXErrorBase"
+		"urlDataHFTPBadPasswordErrerrAEReadDeniedkUCTokenizerUnknownLangkNoCardEnablersFoundErr"
+		"badImageRgnErrkURLAuthenticationErrorkUSBPBLengthErrorkHIDBufferTooSmallErr"
+		"routingNotFoundErrsettingNotSupportedByNodeErrkFNSInvalidReferenceErrtelStillNeeded"
+		"badReqErrdsOldSystemkECONNREFUSEDErrkPOSIXErrorENETRESEToffLinErrkPOSIXErrorEAGAIN"
+		"kUnsupportedModeErrinvalidHotSpotIDErrkPOSIXErrorEPROGUNAVAILkCollatePatternNotFoundErr"
+		"errAENotModifiablekHIDInvertedLogicalRangeErrkEPIPEErrkRAPPPPeerDisconnected"
+		"badImageDescriptionbadTranslationSpecErrwindowWrongStateErrOSAIllegalAccess"
+		"kPOSIXErrorEMSGSIZEkUSBNotHandledkCantReportProcessorTemperatureErr"
+		"kBridgeSoftwareRunningCantSleepkDMGenErrunresolvedComponentDLLErrkOTNoUDErrErr"
+		"kDMWrongNumberOfDisplaysqtsConnectionFailedErrlaNoMoreMorphemeErrbadATPSkt"
+		"fragConnectionIDNotFoundafpRangeOverlapbadComponentInstanceqfcbNotFoundErrfmt1Err"
+		"kTECTableFormatErrafpSameNodeErrafpInsideTrashErrkPOSIXErrorEADDRNOTAVAIL"
+		"noMemoryNodeFailedInitializekRANCPRejectedbyPeerkPOSIXErrorENOTSOCK"
+		"kTECIncompleteElementErrbtRecNotFnderrMarginWilllNotFitkPOSIXErrorECONNRESET"
+		"kRAPortSetupFailedvmKernelMMUInitErrkBadTupleDataErrdsNoExtsMacsBugkRAIncompatiblePrefs"
+		"kISpSystemActiveErrbadPortNameErrerrAECantSupplyTypekPOSIXErrorEBADFkDMFoundErr"
+		"kHIDNullStateErrunicodeNoTableErrerrOSAInvalidIDkNSpFreeQExhaustedErrkPOSIXErrorENFILE"
+		"telTransferRejdsNotEnoughRAMToBootdsLoadErrpixMapTooDeepErrerrAEWrongDataType"
+		"invalidViewStateErrkRANotPrimaryInterfacekUSBTooManyTransactionsErrkETIMEDOUTErr"
+		"tsmTSMDocBusyErrerrEmptyScraperrKCNoSuchAttrfsDataTooBigErrtelFeatNotSub"
+		"kCollateInvalidOptionsdsNoPk6kATSUInvalidTextLayoutErrdsZeroDivErrerrAEReceiveTerminate"
+		"volVMBusyErrkernelIDErrdcmNotDictionaryErrslotNumErrnrNotCreatedErrunicodeTableFormatErr"
+		"cantLoadPackagekHIDInvalidReportLengthErrlaPropertyErrbadComponentSelectorrcDBBadSessID"
+		"tsmInvalidContexttextParserParamErrlaPropertyNotFoundErrsmGetPRErrerrDataNotSupported"
+		"badMDBErrcmMethodErrorkPowerHandlerNotFoundForDeviceErrdsDisassemblerInstalled"
+		"invalidChunkCachefnOpnErrkBadSizeErrdirFulErrerrOSACantLaunch"
+		"kTXNAttributeTagInvalidForRunErrkUSBNoErrdsStknHeapkOTBufferOverflowErrkEIOErr"
+		"kEDESTADDRREQErrdataNoDataRefcProtectErrcmProfileNotFoundexUserBreaknrOverrunErr"
+		"kOTNoDisconnectErrappMemFullErrlaPropertyIsReadOnlyErrfontDecErrorkPOSIXErrorENOLINK"
+		"mmInternalErrorhardwareConfigErrkPOSIXErrorENOLCKerrFSForkExistskPOSIXErrorETOOMANYREFS"
+		"errReadOnlyTextcontrollerBoundsNotExactkPOSIXErrorEMULTIHOPnoAdrMkErrtunePlayerFullOSErr"
+		"kPowerHandlerNotFoundForProcErrdsOvflowErrtelBadProcIDkNSpInvalidProtocolListErrpermErr"
+		"fragNoMemdsLineFErrerrWindowRegionCodeInvalidscrapFlavorSizeMismatchErrreadErr"
+		"kEDEADLKErrtelBadCAErrkCollateInvalidCharerrOpeningerrAEReplyNotValidlaPropertyValueErr"
+		"qtNetworkAlreadyAllocatedErrkFBCaddDocFailedkUSBEndpointStallErrkPOSIXErrorENETUNREACH"
+		"notAFileErrurlDataHHTTPRedirectErrkBadHandleErrerrKCBufferTooSmallnoScrapErr"
+		"pictInfoVerbErrerrFSIteratorNotSupportedbadControllerHeightmemFragErr"
+		"kNSLNullNeighborhoodPtrqtsUnsupportedDataTypeErrkTECTableChecksumErr"
+		"debuggingExecutionContextErrrcDBWrongVersioninvalidAtomErrfragNoContextIDs"
+		"badPublicMovieAtomafpSessClosedvTypErrsmBadsPtrErrspdAdjErrkFBCsomeFilesNotIndexed"
+		"fragMgrInitErrerrTaskNotFoundnoPortErrfragInvalidFragmentUsagelaDictionaryNotOpenedErr"
+		"kTooManyIOWindowsErrcodecConditionErrurlDataHFTPProtocolErrunitEmptyErrfragNoAddrSpace"
+		"kRAInvalidParameterwindowAttributesConflictErrkATSUInvalidCallInsideCallbackErrfmt2Err"
+		"noDataAreakPOSIXErrorEPROTOTYPEk16BitCardErrkPOSIXErrorEALREADYinternalScrapErr"
+		"unsupportedAuxiliaryImportDatakNSLBadServiceTypeErrkRAInternalErrorerrEndOfBody"
+		"errCannotUndovmMemLckdErrerrFSBadItemCounterrOSANumericOverflowkPOSIXErrorEUSERS"
+		"portNotPwrnotAllowedToSaveMovieErrkUSBLinkErrcoreFoundationUnknownErrkernelOptionsErr"
+		"afpFlatVolkNSpInvalidDefinitionErrmemBCErrkModemOutOfMemoryerrFSBadForkRef"
+		"errAlreadyInImagingModeduplicateRoutingErrclkWrErrdestPortErrfragImportTooOld"
+		"kSSpInternalErrnrIterationDoneunicodeVariantErrkURLAccessNotAvailableError"
+		"kIllegalClockValueErrkQTSSUnknownErrnotInitErrkDMMirroringOnAlready"
+		"themeScriptFontNotFoundErrkFBCbadSearchSessionOSADuplicateHandlertelBadIntExt"
+		"kRAUserInteractionRequiredkENOSRErrOSAIllegalIndexcodecNeedToFlushChainErr"
+		"badDragFlavorErrtmfoErrkFBCindexDiskIOFaileddcmPermissionErrtextParserBadTokenValueErr"
+		"errOSACantAccesskNoCardBusCISErrcfragLastErrCodesmFHBlkDispErrtsmInputMethodNotFoundErr"
+		"samplesAlreadyInMediaErrfirstDskErrscrapFlavorNotFoundErrkNoIOWindowRequestedErr"
+		"nrTypeMismatchErrbufferIsSmallhmSameAsLastBallooncontrolPropertyInvalid"
+		"menuItemNotFoundErrkOTProviderMismatchErrcmElementTagNotFoundkMPTaskBlockedErr"
+		"kOutOfResourceErrkBadLinkErrkOTIndOutErrOSAIllegalAssignkATSUFontsMatchedfnfErr"
+		"kTECUnmappableElementErrkNSpFeatureNotImplementedErrwrUnderrunkURLExtensionFailureError"
+		"errKCKeySizeNotAllowedkUSBInternalReserved2kTXNNoMatchErrkFBCnoSuchHitcolorsRequestedErr"
+		"kOTQFullErrtsmNoHandlerkMPNanokernelNeedsMemoryErrkFBCmergingFailedcantLoadPickMethodErr"
+		"badLocNameErrnumberFormattingUnOrdredCurrencyRangeErrdceExtErrkPOSIXErrorESRCHnoRelErr"
+		"numberFormattingBadCurrencyPositionErrkTECOutputBufferFullStatushmCloseViewActive"
+		"dsNeedToWriteBootBlockskPOSIXErrorEPROGMISMATCHdsNoExtsDisassemblercfragContainerIDErr"
+		"kUSBWrongPIDErrcmProfilesIdenticalCantDecompresswindowAttributeImmutableErr"
+		"siInvalidSampleSizekECONNRESETErrkTECItemUnavailableErrafpAlreadyLoggedInErr"
+		"errCantEmbedIntoSelfkRANotConnectedthemeProcessNotRegisteredErrkSSpCantInstallErr"
+		"codecOffscreenFailedPleaseRetryErrkBadVppErrafpPwdExpiredErrsmDisabledSlot"
+		"kBadAttributeErrhrHTMLRenderingLibNotInstalledErrpmReplyTOErr"
+		"textParserBadTextLanguageErrkEBADFErrerrKCNoStorageModulefontSubErrsessTableErr"
+		"invalidDataRefsmEmptySlotaspSessClosedurlDataHFTPURLErrdcmNoRecordErrkMPInvalidIDErr"
+		"kPOSIXErrorECONNABORTEDdsSystemFileErrASDBadHeaderErrkNSLBadReferenceErrvmBadDriver"
+		"dcmBufferOverflowErrcfragFragmentCorruptErrkALMRebootFlagsLevelErrkEPROTONOSUPPORTErr"
+		"kDTPAbortJobErrkFBCallocFaileddcmNoAccessMethodErrsmSDMInitErrerrOffsetInvalid"
+		"tsmTSHasNoMenuErrkEINTRErrbuffersTooSmallcfragInitOrderErr"
+		"kHIDUnmatchedDesignatorRangeErrerrOSAStackOverflowkATSUFontsNotMatchederrNoRootControl"
+		"telCANotAcceptablekRAInvalidPassworddsChkErrlaTooSmallBufferErrtuneParseOSErr"
+		"unicodeNotFoundErrkFBCindexingFailedkPOSIXErrorESPIPEnotBTreekNSLInsufficientSysVer"
+		"kRAUserPwdChangeRequirederrCantEmbedRooterrAEDuplicateHandlererrFSBadIteratorFlags"
+		"kOTBadFlagErrshutDownAlertdataNotOpenForReaddsMBSysErrordsHMenuFindErrqtmlDllLoadErr"
+		"errOSASystemErrorcfragFragmentFormatErrkPOSIXErrorEFBIGthreadTooManyReqsErrdsBadSlotInt"
+		"telIntExtNotSuppkLocalesTableFormatErrfileBoundsErrdcmTooManyKeyErrfragFormatUnknown"
+		"kBadBaseErrcontrolInvalidDataVersionErrerrOpenDeniedtelBadBearerType"
+		"dcmIterationCompleteErrnumberFormattingEmptyFormatErrpmRecvStartErr"
+		"invalidSampleDescIndexkNSLInvalidPluginSpeckURL68kNotSupportedErrorkEPROTOTYPEErr"
+		"gestaltDupSelectorErrkSSpScaleToZeroErrerrAERecordingIsAlreadyOnkTECCorruptConverterErr"
+		"urlDataHFTPPermissionsErrerrCpprange_errorkNoEnablerForCardErrkPOSIXErrorEPIPE"
+		"ASDEntryNotFoundErrdsSwitchOffOrRestartcfragClosureIDErrerrCppLastUserDefinedError"
+		"kFNSNameNotFoundErrdsIrqErrnbpDuplicatecfragNoPrivateMemErrafpContainsSharedErr"
+		"kernelAlreadyFreeErrnoNybErrkDMDisplayNotFoundErrfragHadUnresolvedskHIDUsageNotFoundErr"
+		"volGoneErrsmFHBlockRdErrnumberFormattingUnOrderedCurrencyRangeErrcmCantConcatenateError"
+		"errItemNotControlrmvResFailedkPOSIXErrorENOTCONNerrAENoUserSelection"
+		"laDictionaryTooManyErrkNSLUILibraryNotAvailableerrAEHandlerNotFoundkMPPrivilegedErr"
+		"kOTBadSyncErrnoMoreKeyColorsErrkEPERMErrfsmBadFSDVersionErrdsVMBadBackingStoreeofErr"
+		"kFMIterationScopeModifiedErrafpUserNotAutherrAEBufferTooSmallkHIDEndOfDescriptorErr"
+		"invalidNodeIDErrkRACallBackFailedinvalidHandlersmNewPErrnoThumbnailFoundErr"
+		"timeNotInViewErrckSumErrbadDragRefErrkernelReadPermissionErrkPOSIXErrorEFTYPE"
+		"kPOSIXErrorENAMETOOLONGnsStackErrpmSendEndErrkPOSIXErrorENOENTkUSBUnknownPipeErr"
+		"pictInfoIDErrerrFSNotAFoldervolOnLinErrsynthOpenFailedkRAUnknownUserdsRAMDiskTooBig"
+		"kOTSysErrorErrkNSpTopologyNotSupportedErrcfragContextIDErrextractErr"
+		"directXObjectAlreadyExistskFNSMismatchErrkMPBlueBlockingErrthreadBadAppContextErr"
+		"nrPathBufferTooSmallkernelObjectExistsErrtelIndexNotSupperrFSBadPosModekPOSIXErrorENOSPC"
+		"nbpNoConfirmtelBadCodeResourcedsSCSIWarnkFBCvTwinExceptionErrkNSLBadURLSyntax"
+		"kRATCPIPInactivekPOSIXErrorESTALEkUSBNoDelaytelAlreadyOpenkFMFontContainerAccessErr"
+		"kPOSIXErrorEMLINKdsDirtyDiskrcDBBadSessNumnsDrvErrdcmDictionaryBusyErrsmCRCFail"
+		"badRoutingSizeErreMultiErratpBadRspkNSLBufferTooSmallForDatatsmDocPropertyNotFoundErr"
+		"errOSATypeErrorkPOSIXErrorESOCKTNOSUPPORTcmNoGDevicesErrordsLineAErrkPOSIXErrorECHILD"
+		"kTXNOutsideOfFrameErrkInvalidCSClientErrerrEngineNotFounderrKCReadOnlycodecCantQueueErr"
+		"grabTimeCompletecfragFirstReservedCodeinvalidTranslationPathErrerrInvalidWindowPtr"
+		"kNSLSchedulerErrorkPOSIXErrorEXDEVpmSendStartErrafpDenyConflictkISpBufferToSmallErr"
+		"codecWouldOffscreenErrtelFeatActiveOSAMessageNotUnderstooddsCantHoldSystemHeapkEINVALErr"
+		"cmCantDeleteElementtelBadFunctionnoIconDataAvailableErrkUSBInternalReserved5"
+		"cfragCFMStartupErrnonMatchingEditStatergnOverflowErrtelNoMemErrkNSpInvalidGroupIDErr"
+		"kTXNInvalidFrameIDErrinvalidSpriteIndexErrmidiInvalidCmdErrafpItemNotFound"
+		"kRAPPPProtocolRejectedtsmInvalidDocIDErrerrAETypeErrorkURLUnsettablePropertyError"
+		"kNSpMemAllocationErrclosErrsmRecNotFndkEINPROGRESSErrfragConstErrkDSpInvalidContextErr"
+		"urlDataHFTPNoPasswordErrinvalidNodeFormatErrerrAENotAnEnumMember"
+		"codecExtensionNotFoundErrnilScrapFlavorDataErrnumberFormattingNotADigitErrkENODATAErr"
+		"dcmParamErrkTECBufferBelowMinimumSizeErrtsmDocumentOpenErrcbNotFounderrTopOfBody"
+		"errCpplength_errorerrFSBadForkNamekBadDeviceErrvmNoMoreFileViewsErrkOTCanceledErr"
+		"errOSADivideByZeroOSAUndefinedVariablemovieTextNotFoundErrerrKCInteractionNotAllowed"
+		"kBadCustomIFIDErrerrKCDataNotModifiablelockPortBitsWrongGDeviceErrtelDetAlreadyOn"
+		"queueFullpathTooLongErrkFBCnoSearchSessionkURLPropertyBufferTooSmallErrorcfragNoIDsErr"
+		"cfragReservedCode_1writErrerrFSOperationNotSupportedtelBadStateErr"
+		"numberFormattingLiteralMissingErrafpPwdNeedsChangeErrthemeProcessRegisteredErr"
+		"kBadArgLengthErrkernelPrivilegeErriMemFullErrkCantConfigureCardErrnotEnoughHardware"
+		"dsMBATASysErrorsmsGetDrvrErrkOTBadOptionErrerrDataSizeMismatchkNSpCantBlockErr"
+		"kFBCindexFileDestroyedkNSpRemovePlayerFailedErrtelCANotRejectablercDBExec"
+		"cfragInitAtBootErrnrPowerErrcmInvalidSearchnoExportProcAvailableErrkENOMEMErrwPrErr"
+		"hmWrongVersionkFNSInsufficientDataErrkNSLRequestBufferAlreadyInListillegalKnobOSErr"
+		"errASCantCompareMoreThan32kkRANotEnabledtelConfLimitExceedednotEnoughMemoryErr"
+		"kNSpJoinFailedErrOSATokenTooLongtsmUnsupScriptLanguageErrkENETRESETErrmemROZWarn"
+		"smSlotOOBErrtelStateNotSuppnoSynthFoundthemeHasNoAccentsErrerrKCWrongKCVersion"
+		"kUSBNotSent2ErrwrongApplicationPlatformerrEndOfDocumentbadSectionErrdsIllInstErr"
+		"noInformErrvmInvalidFileViewIDErrerrControlsAlreadyExistbadEditListprocNotFound"
+		"kOTAddressBusyErrkPOSIXErrorEILSEQnbpBuffOvrtextParserObjectNotFoundErrnrNotFoundErr"
+		"errOSABadSelectorbtKeyAttrErrurlDataHFTPBadUserErrkPOSIXErrorENOATTRerrFSForkNotFound"
+		"codecOffscreenFailedErrmaxSizeToGrowTooSmallOSASyntaxErrorerrKCInvalidKeychain"
+		"cfragConnectionIDErrsessClosedErrtelBadSampleRatepmRecvEndErrerrOSADataFormatTooNew"
+		"noDMAErrkATSULastErrafpIconTypeErrorcomponentDontRegistererrFSQuotaExceededcantStepErr"
+		"errKCNoPolicyModulekEADDRINUSEErrstaleEditStateerrUnknownAttributeTag"
+		"kTXNAlreadyInitializedErrerrAEBadListItemerrCoreEndianDataDoesNotMatchFormatenvBadVers"
+		"statusErrinternalQuickTimeErrorcfragOutputLengthErrrcDBBadAsyncPBcfragReservedCode_2"
+		"afpAccessDeniedrcDBNullcolorSyncNotInstalledkPOSIXErrorENODEVkTXNDataTypeNotAllowedErr"
+		"kNotZVCapableErrkTextUnsupportedEncodingErrsdmPRAMInitErrselectorNotSupportedByNodeErr"
+		"midiTooManyConsErrfragLibConnErrkPOSIXErrorEADDRINUSEkNSpGameTerminatedErr"
+		"driverHardwareGoneErrkISpDeviceActiveErrkUSBInternalErrtelDeviceNotFounderrAEParamMissed"
+		"rcvrErrkernelExecutionLevelErrreadQErrtsmUseInputWindowErrkOTBadConfigurationErr"
+		"errAEUnknownSendModefileOffsetTooBigErrlaInvalidPathErrkENOTTYErrkOTOutOfMemoryErr"
+		"badFCBErrmidiNoConErrkETOOMANYREFSErrkOTBadDataErrtsmInputMethodIsOldErr"
+		"errCoreEndianDataTooShortForFormatbadExtResourcedcmBlockFullErrkURLUnknownPropertyError"
+		"kTXNCopyNotAllowedInEchoModeErrchannelBusykDMNoDeviceTableclothErrdialogNoTimeoutErr"
+		"kNoSuchPowerSourceerrUnrecognizedWindowClasskPOSIXErrorERPCMISMATCHbtKeyLenErrbadMovErr"
+		"dsLostConnectionToNetworkDiskkPowerMgtMessageNotHandledmBarNFndfsmDuplicateFSIDErr"
+		"errOSACantGetTerminologyerrIAAllocationErrcfragNoPositionErrkNSLNotImplementedYet"
+		"dsMBarNFnderrKCNoSuchKeychainkRAATalkInactivetelNoToolsnoSuchIconErr"
+		"errAENotASpecialFunctioncmInvalidSrcMaprcDBErrorsmCodeRevErrcannotDeferErr"
+		"errAEDescIsNullkOTNoReleaseErrfBsyErrkOTFlowErrkFMFontTableAccessErrbadUnitErr"
+		"cmRangeOverFlowaspNoAckerrWindowNotFoundkATSUNoCorrespondingFontErrrcDBBreak"
+		"kFBCaccessCanceledhrURLNotHandledErrcRangeErrOSAMissingParameterkUSBDeviceNotSuspended"
+		"telCAUnavailbtDupRecErrsmReservedSlotkALMInstallationErrqtsUnsupportedFeatureErr"
+		"kUSBBadDispatchTablekCollateAttributesNotFoundErrkATSUInvalidStyleErraddRefFailed"
+		"unicodeDirectionErrkENODEVErrcantPutPublicMovieAtomtooManyReqslaDictionaryUnknownErr"
+		"collectionItemNotFoundErrtelFeatNotSuppkESOCKTNOSUPPORTErrerrFSAttributeNotFound"
+		"kFMInvalidFontFamilyErrdcmBadFieldTypeErrnotRegisteredSectionErrlaPropertyUnknownErr"
+		"afpObjectExistsscrapPromiseNotKeptErrtsmInputModeChangeFailedErrkPOSIXErrorEBADMACHO"
+		"nilHandleErrafpVolLockeddsNoFPUkUCTSSearchListErrkENOTSOCKErrsmBusErrTO"
+		"numberFormattingNotANumberErrdsBadLibraryerrFSBadAllocFlagsbadFormat"
+		"errAECantPutThatThereparamErrkEPROTOErrsmsPointerNilkURLProgressAlreadyDisplayedError"
+		"kFBCnoIndexesFoundkPOSIXErrorENOSRnoUserInteractionAllowedkUSBQueueFulldsBusError"
+		"notAQTVRMovieErrcDevErrkPOSIXErrorEBADMSGsiHardDriveTooSlownoHardwareErrwritingPastEnd"
+		"errControlIsNotEmbeddercannotFindAtomErrerrIATextExtractionErrerrKCDuplicateItem"
+		"errFSBadBufferbadCodecCharacterizationErrerrASParameterNotForEventurlDataHFTPShutdownErr"
+		"kEEXISTErrtsmAlreadyRegisteredErrtelTransferErrerrAEBadTestKeyerrDSPQueueSize"
+		"threadNotFoundErrkNSpProtocolNotAvailableErrsiInitSDTblErrsmSRTInitErrerrAENewerVersion"
+		"kUSBPipeIdleErrorkATSULineBreakInWordnoMoreRealTimecantDoThatInCurrentMode"
+		"nrCallNotSupportedtelBadFwdTypekFMIterationCompletedkHIDIncompatibleReportErr"
+		"kFBCbadIndexFileVersionerrAEBuildSyntaxErrorstreamingNodeNotReadyErrkCardPowerOffErr"
+		"kFBCbadParamerrAEBadKeyFormerrFSNotEnoughSpaceForOperationcollectionIndexRangeErr"
+		"kPOSIXErrorENOMEMerrKCDuplicateKeychainnrPropertyAlreadyExistskNSpNoHostVolunteersErr"
+		"fLckdErrkQDNoColorHWCursorSupporterrCoreEndianDataTooLongForFormat"
+		"callNotSupportedByNodeErrkNSLNoPluginsForSearcherrKCInvalidItemRefkNSLNullListPtr"
+		"errOSAComponentMismatchconstraintReachedErrkOTResQLenErrkUSBRqErrkISpInternalErr"
+		"kFBCflushFailederrRootAlreadyExistserrIACancelederrControlDoesntSupportFocus"
+		"kOTPortWasEjectedErrdebuggingNoMatchErrkNSLErrNullPtrErrorresFNotFound"
+		"kATSUQuickDrawTextErrkOTConfigurationChangedErrrequiredFlagsDontMatchfragImportTooNew"
+		"errAECantHandleClasskDSpSystemSWTooOldErrmemWZErrkPOSIXErrorEPERMkUnsupportedVsErr"
+		"kNSLBadProtocolTypeErrdsBadSANEOpcodemovieToolboxUninitializedinvalidEditStatekEAGAINErr"
+		"errKCInteractionRequiredmissingRequiredParameterErrnotExactSizeErrkOTLookErrkUSBTimedOut"
+		"kDTPStopQueueErrbdNamErrcfragReservedCode_3kISpListBusyErr"
+		"errFloatingWindowsNotInitializedsmNoJmpTblillegalInstrumentOSErrqtsBadSelectorErr"
+		"hmOperationUnsupportedsiInitVBLQsErrsmNoDirqtmlDllEntryNotFoundErrkGeneralFailureErr"
+		"gWorldsNotSameDepthAndSizeErrcfragArchitectureErrqtvrUninitializedafpBadUAM"
+		"kTXNCannotSetAutoIndentErrtelConfRejkUSBUnknownNotificationkPOSIXErrorEOVERFLOW"
+		"kTECNeedFlushStatusnrNotEnoughMemoryErrkNSpInvalidGameRefErrkDSpFrameRateNotReadyErr"
+		"kTextMalformedInputErrbreakRecdcfragImportTooNewErrkNSpInvalidAddressErr"
+		"errFSBadInfoBitmapkNSLPluginLoadFailedkFBCfileNotIndexederrIAInvalidDocument"
+		"notThePublisherWrnlockPortBitsWindowResizedErrsiDeviceBusyErrsvDisabledtelNoSuchTool"
+		"debuggingInvalidSignatureErrnrInvalidEntryIterationOpkERANGEErrkPOSIXErrorEAFNOSUPPORT"
+		"textParserBadTextEncodingErrerrFSNoMoreItemskTECDirectionErrkUSBOutOfMemoryErr"
+		"couldntGetRequiredComponentkHIDInvertedUsageRangeErrkATSUInvalidAttributeValueErr"
+		"kCardBusCardErrkPOSIXErrorEFAULTkTXNOutsideOfLineErrkNavCustomControlMessageFailedErr"
+		"kDSpConfirmSwitchWarningduplicateFolderDescErrcodecScreenBufErrinvalidImageIndexErr"
+		"dsNotThe1cmCantGamutCheckErrortelBadDNTypekEALREADYErrkPOSIXErrorEMFILE"
+		"OSADuplicateParametercodecUnimpErrerrAECorruptDatakRAInvalidPortafpIDExists"
+		"kRANotSupporteddsUnBootableSystemkAttemptDupCardEntryErrerrUnknownElement"
+		"telDNDTypeNotSuppkHIDSuccessduplicateFlavorErrcTempMemErrnoDefaultUserErr"
+		"atomsNotOfSameTypeErrerrOSANoSuchDialectkISpSystemInactiveErrkATSUNoFontNameErr"
+		"fidNotFoundtsmNotAnAppErrtelNoCallbackRefkOTBadNameErrmemFullErrbadSGChannel"
+		"kOTStateChangeErrkHIDBadLogicalMaximumErrkATSUNoFontScalerAvailableErrtooManySkts"
+		"kernelTimeoutErrtsmDocNotActiveErrinitIWMErrprogressProcAbortedtextParserNoMoreTextErr"
+		"kNSLInsufficientOTVererrCppios_base_failurekNSLInitializationFailed"
+		"kISpElementNotInListErrnoSessionErraspNoMoreSessnrNotModifiedErrcantCreateSingleForkFile"
+		"sdmJTInitErrtelAPattNotSupptelInitFailedfragArchErrornoDeviceForChannelkOTNoError"
+		"dcmBadFindMethodErrtextParserBadParserObjectErrerrFSIteratorNotFoundkATSUInvalidFontErr"
+		"kBadVccErrqtsUnsupportedRateErrqtXMLApplicationErrunimpErrsiInitSPTblErrcantEnableTrack"
+		"fragSymbolNotFoundnumberFormattingBadTokenErrkRATCPIPNotConfiguredcodecNothingToBlitErr"
+		"svTempDisablekEFAULTErrkRAExtAuthenticationFailederrAEAccessorNotFound"
+		"kTXNUserCanceledOperationErrfragInitRtnUsageErrbadScrapRefErrafpDirNotFound"
+		"kNSLCannotContinueLookupprInitErrtelCANotDeflectablecollectionVersionErrcmCantXYZ"
+		"firstPickerErrorhmUnknownHelpTypeportInUsekRAUserPwdEntryRequireddiffVolErr"
+		"codecNoMemoryPleaseWaitErrkUSBPBVersionErrorcodecErrnotLeafAtomErrtelConfErr"
+		"gestaltUnknownErrkPOSIXErrorELOOPtelBadDisplayModetelPBErrkBadArgsErrsmUnExBusErr"
+		"themeInvalidBrushErrtelBadSWErrkATSUInvalidCacheErrmenuPropertyNotFoundErrkFBCmoveFailed"
+		"rcDBBadDDEVnoSuitableDisplaysErrkQDCorruptPICTDataErropWrErrWDEFNFnd"
+		"kRAPPPAuthenticationFailedcfragInitFunctionErrkRAInvalidSerialProtocoltelBadRate"
+		"vmMorePhysicalThanVirtualErrkFNSDuplicateReferenceErrkMPTaskStoppedErr"
+		"kHIDReportIDZeroErrkUSBNoBandwidthErrorkDMMirroringNotOnkOTBadSequenceErr"
+		"debuggingDuplicateSignatureErrkPOSIXErrorEEXISTmediaTypesDontMatch"
+		"kNSLSearchAlreadyInProgresserrOSAInternalTableOverflowdsRemoveDiskkUSBAlreadyOpenErr"
+		"errOSABadStorageTypebadChannelkFBCindexNotAvailablekOTDuplicateFoundErrcodecDisabledErr"
+		"kDMMainDisplayCannotMoveErrpickerResourceErrorkPowerMgtRequestDenied"
+		"kFBCtokenizationFaileddsWDEFNotFoundbadProfileErrormidiNoPortErrkPOSIXErrorEDOM"
+		"synthesizerOSErrnoSourceTreeFoundErrkOTNotSupportedErrtelNoErrerrCppbad_typeidreqFailed"
+		"textParserNoMoreTokensErrkDMNotFoundErrinvalidDurationsmBadBoardId"
+		"cmCantCopyModifiedV1ProfilekHIDInvalidPreparsedDataErrcfragInitLoopErrsdmInitErr"
+		"errIAParamErrnrLockedErrkFBCaccessorStoreFailederrAEImpossibleRangeerrAEIllegalIndex"
+		"kEADDRNOTAVAILErrfontNotDeclaredkRAPeerNotRespondingerrIANoErrnotImplementedMusicOSErr"
+		"errASNoResultReturnedinsufficientStackErrkRAInstallationDamagedkDSpInternalErr"
+		"kUSBBitstufErrurlDataHFTPNoNetDriverErrmidiDupIDErrappVersionTooOldduplicateHandlerErr"
+		"kPOSIXErrorEAUTHerrKCNoCertificateModuleerrOSAAppNotHighLevelEventAwareerrAEDescNotFound"
+		"cannotMakeContiguousErrmenuPropertyInvalidillegalVoiceAllocationOSErr"
+		"containerNotFoundWrnkPOSIXErrorEDQUOTnoTranslationPathErrkConfigurationLockedErr"
+		"windowManagerInternalErrvoiceNotFoundkRAInvalidPortStateendOfDataReachedafpBitmapErr"
+		"kPOSIXErrorENEEDAUTHdsCDEFNotFoundioErraspBufTooSmalllocalOnlyErrkBadIRQErr"
+		"errFSMissingNameresourceInMemorykDMSWNotInitializedErrkUSBPIDCheckErrsmFormatErr"
+		"afpCantMovereqAbortedguestNotAllowedErrtsmDocPropertyBufferTooSmallErrerrCpplogic_error"
+		"themeNoAppropriateBrushErrillegalKnobValueOSErremptyPathErrafpCallNotAllowed"
+		"urlDataHHTTPNoNetDriverErrnotEnoughHardwareErrdragNotAcceptedErrhwParamErrkEISCONNErr"
+		"noMacDskErrkTECArrayFullErrcomponentNotCapturedurlDataHFTPNoDirectoryErrmemLockedErr"
+		"kNSpAlreadyInitializedErrkQDCursorAlreadyRegisteredkISpDeviceInactiveErr"
+		"kRAUnknownPortStateerrAENoSuchObjectkRAStartupFailedtsmCantOpenComponentErrunicodeBufErr"
+		"kENETDOWNErrafpPwdPolicyErrnumberFormattingOverflowInDestinationErrerrFSUnknownCall"
+		"telTermNotOpensmDisposePErrdebuggingInvalidNameErrerrNonContiuousAttributecResErr"
+		"dsMustUseFCBAccessorskENORSRCErrtmwdoErrerrRefNumsmResrvErrdsShutDownOrRestart"
+		"dcmNecessaryFieldErrqtsUnknownValueErrkTECBadTextRunErrkOTNotFoundErrnoMediaHandler"
+		"kMPDeletedErrunicodePartConvertErrerrMessageNotSupportedfragUserInitProcErr"
+		"vmMappingPrivilegesErrkUSBInternalReserved7noCodecErrkernelReturnValueErr"
+		"synthesizerNotRespondingOSErrdcmBadFieldInfoErrtsmScriptHasNoIMErrkRAMissingResources"
+		"portNameExistsErrerrAEWaitCanceleddsExtensionsDisabledkOTPortLostConnection"
+		"errAEEventFilterederrIABufferTooSmallkETIMEErrerrAEPrivilegeErrorkBadEDCErrkUSBPending"
+		"kOTBadReferenceErrkFNSBadProfileVersionErrkPOSIXErrorEDEVERRcantSendToSynthesizerOSErr"
+		"kNSpPipeFullErrerrKCDataTooLargekATSUCoordinateOverflowErrkFNSBadFlattenedSizeErreLenErr"
+		"kBadAdapterErrdsMBATAPISysErrorerrOSASourceNotAvailableASDBadForkErrtk0BadErr"
+		"invalidAtomTypeErrlaEngineNotFoundErrerrOSACantCoercedcmDictionaryNotOpenErr"
+		"cfragLibConnErrkTextUndefinedElementErrafpMiscErrkENXIOErrerrAEStreamAlreadyConverted"
+		"kernelIncompleteErrkURLInvalidConfigurationErrordsMBFlpySysErrorkernelAsyncSendLimitErr"
+		"smSelOOBErrnrInvalidNodeErrkALMDeferSwitchErrkPOSIXErrorENXIOnoDtaMkErrkATSUNotSetErr"
+		"telHTypeNotSuppkEHOSTDOWNErrdsTraceErrkPOSIXErrorENOMSGnoMMUErrkUSBNoDeviceErr"
+		"telDisplayModeNotSuppkMPTaskAbortedErrnoMachineNameErrkNSLNoCarbonLib"
+		"kLocalesBufferTooSmallErrkFBCindexingCanceledbadComponentTypekPOSIXErrorETXTBSY"
+		"kNSpSendFailedErrrecNotFnddsNoPk1qErrnegZcbFreeErrkUSBOverRunErr"
+		"invalidSpriteWorldPropertyErrcMatchErrsectNFErrappModeErrcodecCantWhenErrdsPrivErr"
+		"memROZErrcfragCFMInternalErrafpObjectNotFounddcmBadDataSizeErrkBadPageErr"
+		"pictInfoVersionErrsiUnknownInfoTypegcrOnMFMErrkNavInvalidSystemConfigErr"
+		"illegalChannelOSErrkUSBDeviceErrkDSpContextNotReservedErrqtvrLibraryLoadErr"
+		"qtsAddressBusyErrportNotCferrKCInvalidCallbacknoDriveErrkRAInitOpenTransportFailed"
+		"noMaskFoundErrcDepthErrappIsDaemontelBadSelectkISpSystemListErrnotAppropriateForClassic"
+		"kTXNRunIndexOutofBoundsErrfsDSIntErrkHIDNotValueArrayErrerrKCNotAvailable"
+		"kATSUInvalidFontFallbacksErrcannotSetWidthOfAttachedControllernoPrefAppErr"
+		"fsmBadFFSNameErrdsNoPk2dsBufPtrTooLowuserDataItemNotFoundkernelWritePermissionErr"
+		"siInputDeviceErrtelConfNoLimiterrCppbad_casterrKCAuthFailedscTypeNotFoundErr"
+		"kATSUBusyObjectErrafpPwdSameErrafpDiskFulltsmNeverRegisteredErrerrUnknownControl"
+		"fsmNoAlternateStackErrinvalidSampleDescriptionkNSpHostFailedErrincompatibleVoice"
+		"kernelUnrecoverableErrerrInvalidRangeerrAEPropertiesClashtimeNotInMediasmBadsList"
+		"kNavMissingKindStringErrkPOSIXErrorEINTRwackBadFileErrcantGetFlavorErrdsBadPatchmFulErr"
+		"fidExistsurlDataHFTPQuotaErrtelConfLimitErrkUSBInvalidBuffernotLockedErr"
+		"kPOSIXErrorENETDOWNafpBadVersNumkOTOutStateErrnoMemForPictPlaybackErrkPOSIXErrorERANGE"
+		"editingNotAllowedcontainerAlreadyOpenWrnerrFSPropertyNotValid"
+		"cannotMoveAttachedControllertelBadDNDTypeerrCppbad_exceptionerrCppinvalid_argument"
+		"debuggingNoCallbackErrkModemPreferencesMissingpickerCantLiveerrAEEventNotHandled"
+		"cmMethodNotFoundkNSLNoSupportForServicetsmDefaultIsNotInputMethodErrerrAbortedddpSktErr"
+		"smNoGoodOpenskUSBNoTranfeatureUnsupportedkNSpNoGroupsErrkPOSIXErrorEPROCUNAVAILseekErr"
+		"errWindowDoesntSupportFocusrgnTooBigErrorkPOSIXErrorENOSYSdsNoPk4kTXNEndIterationErr"
+		"siVBRCompressionNotSupportedabortErrkURLInvalidURLErrorerrAEEventFailed"
+		"cmInvalidProfileLocationauthFailErrafpObjectLockedmenuPrgErrcouldNotParseSourceFileErr"
+		"codecDataVersErrsiInvalidSampleRateerrAEStreamBadNestingkURLServerBusyErrornoGlobalsErr"
+		"multiplePublisherWrncmSearchErrortsmNoMoreTokenserrFSBadFSReferrCppunderflow_error"
+		"kOTProtocolErrcantLoadPickerkInvalidRegEntryErrkUSBUnknownDeviceErr"
+		"kTECGlobalsUnavailableErrurlDataHFTPNeedPasswordErrkFBCsearchFailed"
+		"midiManagerAbsentOSErrerrNoHiliteTextsmSRTOvrFlErrkATSUBadStreamErrafpAlreadyMounted"
+		"dsSysErrmidiNoClientErrkPowerHandlerExistsForDeviceErrdebuggingDuplicateOptionErr"
+		"kUCOutputBufferTooSmallkNoMoreItemsErrerrOSAGeneralErrorkUSBPortDisabled"
+		"OSAControlFlowErrorkPOSIXErrorENOTEMPTYkNoCardErrhrUnableToResizeHandleErrdsBadLaunch"
+		"telDNTypeNotSuppunicodeElementErrtelFeatNotAvailkDSpContextNotFoundErrpathNotVerifiedErr"
+		"kSSpParallelUpVectorErrerrASTerminologyNestingTooDeep"
+		"errUnsupportedWindowAttributesForClasssiBadRefNumkPOSIXErrorEACCESafpLockErr"
+		"errAECantUndoqtsBadDataErrkNoClientTableErrseNoDBkENOMSGErrillegalScrapFlavorFlagsErr"
+		"kNSpOTNotPresentErrerrOSACantCreateerrAENotAEDesckPOSIXErrorEBADARCH"
+		"errControlHiddenOrDisabledkUCTextBreakLocatorMissingTypekRAConfigurationDBInitErr"
+		"errTopOfDocumentvalidInstancesExistcmFatalProfileErrerrKCItemNotFoundcodecSpoolErr"
+		"errInvalidPartCodeafpBadIDErrkRAPPPNegotiationFailedkDMDisplayAlreadyInstalledErr"
+		"kRAUserLoginDisabledillegalControllerOSErrkALMLocationNotFoundErrnrResultCodeBase"
+		"menuInvalidErrbadSubPartErrkOTUserRequestedErrkNSL68kContextNotSupported"
+		"kPOSIXErrorEISDIRkBadCISErrrcDBValuesmBlkMoveErrprinterStatusOpCodeNotSupportedErr"
+		"kSysSWTooOldsdmPriInitErrtelBadVTypeErrkPOSIXErrorENOTSUPfsmUnknownFSMMessageErr"
+		"cfragMapFileErrkClientRequestDeniedkPOSIXErrorEIOdsMacsBugInstalledkernelTerminatedErr"
+		"pmBusyErrmapReadErrerrCppLastSystemDefinedErrorchannelNotBusysmByteLanesErr"
+		"cfragNotClosureErrsiUnknownQualitykDSpContextAlreadyReservedErrsmPRAMInitErr"
+		"cfragNoSymbolErrkUSBInternalReserved9noUserRecErrkOTAccessErrerrIteratorReachedEnd"
+		"afpNoServercannotBeLeafAtomErrerrOSARecordingIsAlreadyOnnotEnoughMemoryToGrab"
+		"qtmlUninitializedscrapFlavorFlagsMismatchErratomIndexInvalidErrunsupportedForPlatformErr"
+		"telFwdTypeNotSuppnrExitedIteratorScopercDBPackNotInitedkHIDUsagePageZeroErr"
+		"urlDataHFTPDataConnectionErrdsMDEFNotFounderrWindowPropertyNotFound"
+		"kCollateInvalidCollationRefkPOSIXErrorEPROCLIMinputOutOfBoundssiInvalidCompression"
+		"errIAUnknownErrkNSpInvalidPlayerIDErrcNoMemErrsmCPUErrrcDBAsyncNotSuppnotHeldErr"
+		"kPOSIXErrorEBADRPCsoundSupportNotAvailableErrprocessStateIncorrectErrcfragExecFileRefErr"
+		"dcmNoFieldErrerrCorruptWindowDescription";
+
+	inline constexpr NameKey kNameKeys[kNameCount] = {
+		{     0, 28,      -30029 }, {    28, 21,      -25316 }, {    49,  9,        -112 }, {    58, 27,       -2754 },
+		{    85, 35,       -5205 }, {   120, 19,       -1717 }, {   139, 18,       -2011 }, {   157, 23,       -1762 },
+		{   180, 27,       -8805 }, {   207, 10,        -925 }, {   217, 14,       -3244 }, {   231, 11,       -2036 },
+		{   242, 20,       -5621 }, {   262,  9,       -9077 }, {   271, 21,       -6987 }, {   292, 20,       -8758 },
+		{   312, 22,      -30371 }, {   334, 13,       -5034 }, {   347, 14,        -313 }, {   361, 20,       -2556 },
+		{   381, 18,       -2418 }, {   399, 18,        -182 }, {   417, 28,       -5608 }, {   445, 23,       -8783 },
+		{   468, 23,       -8749 }, {   491, 20,       -9089 }, {   511, 15,       -2899 }, {   526, 23,         120 },
+		{   549, 23,      -30514 }, {   572, 11,       -5010 }, {   583, 16,      -30505 }, {   599, 23,       -2805 },
+		{   622, 17,      -10116 }, {   639, 15,       -4201 }, {   654, 29,      -30547 }, {   683, 17,       -5406 },
+		{   700, 17,       -2855 }, {   717, 10,       -3274 }, {   727, 22,       -3953 }, {   749, 20,       -4196 },
+		{   769, 16,        -256 }, {   785, 12,       -3950 }, {   797, 20,       -4273 }, {   817, 12,       -2009 },
+		{   829, 15,       -2822 }, {   844, 22,       -2054 }, {   866,  8,         -58 }, {   874, 26,      -30046 },
+		{   900, 16,       -2114 }, {   916, 10,       -1100 }, {   926, 16,       -7124 }, {   942, 15,       -4211 },
+		{   957, 17,       -3280 }, {   974, 10,          30 }, {   984, 18,      100011 }, {  1002, 28,       -5207 },
+		{  1030, 11,       -3272 }, {  1041, 19,       -2810 }, {  1060, 20,       -2812 }, {  1080, 19,      -30380 },
+		{  1099, 22,      -25297 }, {  1121, 19,       -2800 }, {  1140, 10,       -1074 }, {  1150, 22,      -30565 },
+		{  1172, 14,      -10016 }, {  1186, 11,       -1028 }, {  1197, 27,       -5361 }, {  1224, 16,      100101 },
+		{  1240, 35,      -13014 }, {  1275, 22,       -6976 }, {  1297,  9,        -102 }, {  1306, 11,       -6906 },
+		{  1317, 11,          14 }, {  1328, 27,       -2052 }, {  1355, 28,       -5247 }, {  1383, 11,       -3254 },
+		{  1394, 15,        -228 }, {  1409, 12,       -7115 }, {  1421,  8,         -46 }, {  1429, 16,       -2051 },
+		{  1445, 18,      -30585 }, {  1463, 20,       -2137 }, {  1483, 24,       -9998 }, {  1507, 25,       -2098 },
+		{  1532, 18,       -1729 }, {  1550, 14,      -10012 }, {  1564, 11,          41 }, {  1575, 25,       -5602 },
+		{  1600,  8,        -114 }, {  1608, 17,       -5041 }, {  1625, 19,       -1406 }, {  1644, 18,       -2069 },
+		{  1662, 18,      -32009 }, {  1680, 23,      100061 }, {  1703, 22,       -8984 }, {  1725, 11,       -2015 },
+		{  1736, 18,      -32006 }, {  1754, 20,      -30563 }, {  1774, 18,       -6903 }, {  1792, 16,       -8804 },
+		{  1808, 23,       -6978 }, {  1831, 21,       -6955 }, {  1852, 12,       -6224 }, {  1864, 14,        -170 },
+		{  1878, 19,      -30047 }, {  1897, 22,       -9095 }, {  1919, 12,       -1712 }, {  1931, 13,      -10004 },
+		{  1944, 19,      -22011 }, {  1963,  7,         -59 }, {  1970, 24,       -9096 }, {  1994, 17,       -1702 },
+		{  2011, 20,      -30048 }, {  2031, 17,      100025 }, {  2048, 23,       -2084 }, {  2071, 16,      -25306 },
+		{  2087, 17,       -2204 }, {  2104, 10,         -17 }, {  2114, 16,      100007 }, {  2130, 16,      -10052 },
+		{  2146, 20,      100058 }, {  2166, 12,       -2008 }, {  2178, 17,        -431 }, {  2195, 10,         -78 },
+		{  2205, 12,         -53 }, {  2217, 14,        -850 }, {  2231, 16,       -2096 }, {  2247, 10,       -2202 },
+		{  2257, 24,       -5607 }, {  2281, 26,       -5604 }, {  2307, 15,        -343 }, {  2322, 19,       -8766 },
+		{  2341,  8,         -85 }, {  2349, 14,       -1851 }, {  2363, 12,       -3109 }, {  2375, 14,       -5007 },
+		{  2389, 11,       -1026 }, {  2400, 12,      -10051 }, {  2412, 17,      -32615 }, {  2429, 10,        -198 },
+		{  2439, 22,      -13937 }, {  2461, 10,         -64 }, {  2471, 15,       -5620 }, {  2486, 11,       -1306 },
+		{  2497, 19,       -4272 }, {  2516, 18,      100055 }, {  2534, 19,       -2116 }, {  2553, 18,        1011 },
+		{  2571, 26,       -8985 }, {  2597, 18,      -13939 }, {  2615, 15,          -1 }, {  2630, 19,       -2091 },
+		{  2649, 15,       -8969 }, {  2664, 19,       -8745 }, {  2683, 19,      -32010 }, {  2702, 18,      -30510 },
+		{  2720, 19,       -7102 }, {  2739, 17,       -2119 }, {  2756, 21,       -9408 }, {  2777, 20,      -30781 },
+		{  2797, 11,         103 }, {  2808, 28,      -30777 }, {  2836, 15,      -30549 }, {  2851, 14,       -2121 },
+		{  2865, 19,        -252 }, {  2884, 28,       -2092 }, {  2912,  9,        -110 }, {  2921, 13,        -633 },
+		{  2934, 20,       -6979 }, {  2954, 24,      -30443 }, {  2978, 20,      -32011 }, {  2998, 10,       -5019 },
+		{  3008, 17,       -2580 }, {  3025, 15,       -2038 }, {  3040, 18,      100015 }, {  3058, 27,       -8799 },
+		{  3085, 25,        -640 }, {  3110, 26,      -29581 }, {  3136,  8,        -630 }, {  3144, 10,       -1103 },
+		{  3154, 12,       -2201 }, {  3166, 13,        -916 }, {  3179, 14,        -923 }, {  3193,  9,       -1029 },
+		{  3202, 11,       -3273 }, {  3213, 16,          83 }, {  3229, 18,       -8769 }, {  3247, 21,       -2822 },
+		{  3268, 22,      -25307 }, {  3290, 20,      -29288 }, {  3310, 14,      -30341 }, {  3324, 18,      -29275 },
+		{  3342, 13,       -1066 }, {  3355, 28,       -8903 }, {  3383, 20,       -4192 }, {  3403, 22,       -2827 },
+		{  3425, 15,       -6902 }, {  3440, 14,       -2820 }, {  3454, 28,      -30770 }, {  3482,  8,         -51 },
+		{  3490,  8,      -10046 }, {  3498,  7,         -87 }, {  3505, 21,      -29582 }, {  3526, 20,      -30450 },
+		{  3546, 17,        -619 }, {  3563, 26,       -2414 }, {  3589, 16,       -1410 }, {  3605, 17,       -6913 },
+		{  3622, 13,          12 }, {  3635, 25,       -2510 }, {  3660, 25,      -13884 }, {  3685, 20,       -2070 },
+		{  3705, 24,       -1758 }, {  3729, 14,       -4200 }, {  3743, 20,        -207 }, {  3763, 20,      -20000 },
+		{  3783, 17,      100100 }, {  3800, 13,       -8967 }, {  3813, 21,       -6960 }, {  3834, 17,        -450 },
+		{  3851, 11,      -10002 }, {  3862, 10,          40 }, {  3872, 17,       -2045 }, {  3889,  8,         -26 },
+		{  3897, 13,        -912 }, {  3910, 12,       -3162 }, {  3922,  9,       -3215 }, {  3931, 12,       -3239 },
+		{  3943, 23,       -4989 }, {  3966, 14,        -259 }, {  3980, 15,       -2029 }, {  3995, 24,       -9080 },
+		{  4019,  6,         -40 }, {  4025, 15,       -3154 }, {  4040, 16,       -5383 }, {  4056, 18,       -8753 },
+		{  4074, 22,      -25318 }, {  4096, 14,       -2416 }, {  4110, 21,       -5061 }, {  4131, 13,       -2028 },
+		{  4144, 13,       -3257 }, {  4157, 27,      -25342 }, {  4184, 15,       -2004 }, {  4199, 20,      -30507 },
+		{  4219, 30,       -2058 }, {  4249, 23,         116 }, {  4272, 20,       -1862 }, {  4292, 17,           0 },
+		{  4309, 11,          17 }, {  4320, 13,        -208 }, {  4333, 27,       -5611 }, {  4360, 13,       -2007 },
+		{  4373,  9,       -1307 }, {  4382, 18,       -2117 }, {  4400, 18,      100056 }, {  4418, 12,       -2815 },
+		{  4430, 29,      -25344 }, {  4459, 19,       -5024 }, {  4478, 15,      -20002 }, {  4493, 14,       -2508 },
+		{  4507, 39,      -22013 }, {  4546, 27,       -2761 }, {  4573, 17,       -2800 }, {  4590, 10,         -68 },
+		{  4600, 32,       -2530 }, {  4632, 11,         -93 }, {  4643,  8,        -116 }, {  4651, 13,      -10001 },
+		{  4664, 20,       -1718 }, {  4684, 14,       -2550 }, {  4698, 18,      -10011 }, {  4716, 23,       -2708 },
+		{  4739,  9,       -3106 }, {  4748, 12,       -6987 }, {  4760, 14,      -10015 }, {  4774, 23,      100046 },
+		{  4797, 10,         -94 }, {  4807, 28,      -13931 }, {  4835, 13,        -317 }, {  4848, 26,       -2515 },
+		{  4874, 15,       -6907 }, {  4889, 18,       -2412 }, {  4907, 22,      -29506 }, {  4929, 10,       -3212 },
+		{  4939, 21,      -30440 }, {  4960, 29,       -3005 }, {  4989,  8,         -27 }, {  4997,  8,          88 },
+		{  5005, 18,       -4181 }, {  5023, 24,      -13934 }, {  5047, 18,       -4199 }, {  5065, 14,       -2021 },
+		{  5079, 17,      -25309 }, {  5096, 21,       -2824 }, {  5117, 11,       -1275 }, {  5128, 21,       -5220 },
+		{  5149, 10,        -204 }, {  5159,  9,       -2203 }, {  5168, 22,       -3279 }, {  5190, 22,      -13947 },
+		{  5212, 12,        -258 }, {  5224, 15,       -9068 }, {  5239, 17,        -982 }, {  5256, 13,        -242 },
+		{  5269, 13,       -9055 }, {  5282, 16,       -3150 }, {  5298, 21,       -7109 }, {  5319, 21,      100087 },
+		{  5340, 18,      -10007 }, {  5358,  5,           0 }, {  5363, 18,       -1707 }, {  5381, 18,      100020 },
+		{  5399, 14,        -306 }, {  5413, 11,       -7114 }, {  5424, 25,       -2410 }, {  5449, 16,       -4270 },
+		{  5465,  7,         -23 }, {  5472, 20,       -1721 }, {  5492, 25,       -2144 }, {  5517, 24,       -9404 },
+		{  5541, 19,       -5600 }, {  5560, 12,       -3256 }, {  5572, 24,       -5603 }, {  5596, 20,       -8989 },
+		{  5616, 19,       -4209 }, {  5635, 13,      -29296 }, {  5648,  8,        -120 }, {  5656, 34,       -5698 },
+		{  5690, 16,       -6982 }, {  5706, 17,       -1727 }, {  5723, 20,      100089 }, {  5743, 26,      100043 },
+		{  5769, 23,       -5694 }, {  5792,  7,          16 }, {  5799, 12,       -8973 }, {  5811, 15,       -5060 },
+		{  5826, 17,      -29290 }, {  5843, 13,       -5408 }, {  5856, 13,       -5500 }, {  5869, 11,       -1861 },
+		{  5880, 21,       -6953 }, {  5901, 23,       -1716 }, {  5924, 16,      100016 }, {  5940, 18,       -1725 },
+		{  5958, 18,       -2542 }, {  5976, 23,       -2129 }, {  5999, 17,       -1700 }, {  6016, 10,         -69 },
+		{  6026, 24,       -4208 }, {  6050, 31,       -2073 }, {  6081,  6,         -84 }, {  6087, 23,       -9407 },
+		{  6110, 13,        -341 }, {  6123, 25,       -2105 }, {  6148, 18,       -9075 }, {  6166, 21,       -9105 },
+		{  6187, 16,       -6970 }, {  6203, 21,       -6993 }, {  6224, 12,       -2048 }, {  6236, 24,       -2705 },
+		{  6260, 10,          -5 }, {  6270, 17,       -6991 }, {  6287, 26,       -2720 }, {  6313, 22,       -2780 },
+		{  6335, 20,       -2405 }, {  6355, 24,      -30388 }, {  6379, 35,       -5617 }, {  6414, 17,       -2857 },
+		{  6431, 11,        -603 }, {  6442, 23,       -4213 }, {  6465, 20,       -9101 }, {  6485, 18,      100071 },
+		{  6503, 22,       -6951 }, {  6525, 23,       -2044 }, {  6548, 29,       -5228 }, {  6577, 24,      -30526 },
+		{  6601, 13,      -10005 }, {  6614, 15,       -2804 }, {  6629, 19,        -645 }, {  6648, 12,        -123 },
+		{  6660, 14,      -11005 }, {  6674, 18,       -2807 }, {  6692, 16,       -8965 }, {  6708, 23,       -9072 },
+		{  6731, 23,       -1730 }, {  6754, 15,       -7121 }, {  6769, 15,        -342 }, {  6784, 22,       -2055 },
+		{  6806, 17,       -9088 }, {  6823,  9,        -413 }, {  6832, 14,       -2031 }, {  6846, 22,      -13925 },
+		{  6868, 16,          42 }, {  6884, 24,       -1801 }, {  6908, 12,        -500 }, {  6920, 17,       -7119 },
+		{  6937, 15,       -2050 }, {  6952, 17,       -2804 }, {  6969,  8,       -9074 }, {  6977, 14,       -8763 },
+		{  6991, 15,       -2514 }, {  7006, 26,      -13930 }, {  7032, 12,          25 }, {  7044, 32,       -2147 },
+		{  7076, 16,       -3252 }, {  7092, 17,       -1305 }, {  7109, 33,      -22010 }, {  7142, 16,      100030 },
+		{  7158, 22,      100036 }, {  7180, 30,      -29502 }, {  7210, 24,      -13941 }, {  7234, 29,       -5212 },
+		{  7263, 21,       -8987 }, {  7284, 18,      100082 }, {  7302,  9,         -92 }, {  7311, 19,      100085 },
+		{  7330, 16,       -4204 }, {  7346, 10,       -1073 }, {  7356, 13,        -332 }, {  7369, 13,      -10103 },
+		{  7382, 29,         117 }, {  7411, 19,        -624 }, {  7430, 23,       -2097 }, {  7453, 17,       -5020 },
+		{  7470, 19,       -5242 }, {  7489, 19,        -220 }, {  7508, 16,       -9069 }, {  7524, 12,       -1069 },
+		{  7536, 14,      -30393 }, {  7550, 17,       -5388 }, {  7567, 15,       -3234 }, {  7582, 22,      -10012 },
+		{  7604, 26,      -30774 }, {  7630, 13,       -5028 }, {  7643, 22,        -855 }, {  7665, 20,      -30395 },
+		{  7685, 19,        -222 }, {  7704, 20,      -30423 }, {  7724, 19,       -2043 }, {  7743, 11,         -70 },
+		{  7754, 18,       -5027 }, {  7772, 18,       -3000 }, {  7790, 16,        -857 }, {  7806,  9,         -25 },
+		{  7815, 16,       -2825 }, {  7831, 14,       -5015 }, {  7845, 13,      -13950 }, {  7858, 21,      -13926 },
+		{  7879, 16,       -2856 }, {  7895, 11,       -1070 }, {  7906, 15,        -434 }, {  7921, 24,       -6986 },
+		{  7945, 21,      -30376 }, {  7966, 31,       -2532 }, {  7997, 18,      100008 }, {  8015, 17,       -5037 },
+		{  8032, 11,        -902 }, {  8043, 17,      100099 }, {  8060, 15,       -5001 }, {  8075, 18,      -30783 },
+		{  8093, 22,       -4188 }, {  8115, 25,      -30529 }, {  8140,  9,        -490 }, {  8149, 26,       -8981 },
+		{  8175, 15,       -3241 }, {  8190, 17,        -100 }, {  8207, 13,       -3171 }, {  8220,  6,         -52 },
+		{  8226, 11,       -9059 }, {  8237,  9,         -61 }, {  8246, 19,       -6974 }, {  8265, 25,       -8980 },
+		{  8290, 13,       -9062 }, {  8303, 19,      -13938 }, {  8322, 24,       -2065 }, {  8346, 26,       -8757 },
+		{  8372, 25,        -647 }, {  8397, 18,       -7137 }, {  8415, 21,      -25305 }, {  8436, 13,      -32000 },
+		{  8449, 15,       -2209 }, {  8464, 15,      -10014 }, {  8479, 19,        -930 }, {  8498,  7,          24 },
+		{  8505, 19,       -6223 }, {  8524, 25,         112 }, {  8549, 17,       -6990 }, {  8566, 17,       -2061 },
+		{  8583, 23,        -643 }, {  8606, 16,        -255 }, {  8622, 18,       -1420 }, {  8640, 20,      100064 },
+		{  8660, 22,       -6972 }, {  8682, 27,       -8802 }, {  8709, 27,       -8986 }, {  8736, 23,       -2107 },
+		{  8759, 10,       -6915 }, {  8769, 34,       -2531 }, {  8803, 18,       20109 }, {  8821, 11,        -348 },
+		{  8832,  9,       -3277 }, {  8841, 17,       -2402 }, {  8858, 27,       -4177 }, {  8885, 15,      -30049 },
+		{  8900, 19,       -6984 }, {  8919, 12,      -10008 }, {  8931, 16,       -3264 }, {  8947, 23,       -5695 },
+		{  8970, 12,       20002 }, {  8982, 21,       -2545 }, {  9003, 21,      100102 }, {  9024, 19,       -2803 },
+		{  9043,  7,          22 }, {  9050, 12,       -2010 }, {  9062, 13,        -811 }, {  9075, 44,       -5202 },
+		{  9119, 33,         128 }, {  9152, 12,       -9067 }, {  9164, 23,       -4993 }, {  9187, 16,      -30509 },
+		{  9203, 22,       -2000 }, {  9225,  9,       -2523 }, {  9234, 20,       -1419 }, {  9254,  9,         -72 },
+		{  9263, 21,      -10014 }, {  9284, 22,      -30045 }, {  9306, 32,      -30567 }, {  9338, 22,      -30389 },
+		{  9360, 26,      -30772 }, {  9386, 26,       -2409 }, {  9412, 14,        -344 }, {  9426, 31,       -8901 },
+		{  9457, 35,      -22003 }, {  9492, 14,       -1308 }, {  9506,  7,          27 }, {  9513, 15,         -12 },
+		{  9528, 13,       -2519 }, {  9541, 19,       -9086 }, {  9560, 20,       -4216 }, {  9580, 13,        -432 },
+		{  9593, 14,       -7104 }, {  9607,  8,       -1278 }, {  9615, 17,       -4000 }, {  9632, 23,       -7123 },
+		{  9655, 12,        -247 }, {  9667, 29,      -22005 }, {  9696, 15,      -10112 }, {  9711,  8,         -48 },
+		{  9719, 11,       -2207 }, {  9730, 23,      100039 }, {  9753, 13,        -915 }, {  9766, 14,        -316 },
+		{  9780, 11,         101 }, {  9791, 18,      -13910 }, {  9809, 16,        -608 }, {  9825, 17,      100022 },
+		{  9842, 21,        -181 }, {  9863, 28,       -2085 }, {  9891, 18,       -5553 }, {  9909, 23,       -5551 },
+		{  9932, 21,       -2518 }, {  9953, 20,      -30397 }, {  9973,  6,          -3 }, {  9979, 22,       -7131 },
+		{ 10001, 15,      -10053 }, { 10016, 15,       -2030 }, { 10031, 25,      -30391 }, { 10056, 12,        -924 },
+		{ 10068, 13,        -303 }, { 10081, 13,       -4009 }, { 10094, 19,       -9098 }, { 10113, 29,       -5208 },
+		{ 10142, 17,        -453 }, { 10159, 16,       -2112 }, { 10175, 19,       -6996 }, { 10194,  9,          98 },
+		{ 10203, 23,       -5750 }, { 10226, 14,         -29 }, { 10240, 13,        -862 }, { 10253, 20,      100060 },
+		{ 10273, 20,       -1721 }, { 10293, 15,        -128 }, { 10308, 12,        -125 }, { 10320, 14,        -336 },
+		{ 10334,  8,        -299 }, { 10342,  9,           1 }, { 10351, 15,       -1720 }, { 10366, 15,       -3250 },
+		{ 10381, 14,       -6977 }, { 10395, 17,       -1753 }, { 10412, 21,       -6958 }, { 10433, 18,       -5043 },
+		{ 10451, 16,      -30385 }, { 10467, 16,       -6904 }, { 10483, 21,       -6957 }, { 10504, 21,      -22001 },
+		{ 10525, 22,       -4004 }, { 10547, 25,        -648 }, { 10572, 11,         -99 }, { 10583, 23,      -13923 },
+		{ 10606, 19,      -30382 }, { 10625, 11,       -6905 }, { 10636, 12,        -309 }, { 10648, 16,       -5025 },
+		{ 10664,  9,          11 }, { 10673, 19,        -180 }, { 10692, 28,       -8798 }, { 10720, 25,       -4999 },
+		{ 10745, 16,        -853 }, { 10761, 17,      -30518 }, { 10778, 12,       -9103 }, { 10790,  6,         -35 },
+		{ 10796, 20,       -6995 }, { 10816, 19,      -20001 }, { 10835,  9,         -34 }, { 10844, 24,       -8792 },
+		{ 10868, 23,      -30599 }, { 10891, 20,       -6985 }, { 10911, 13,        -246 }, { 10924, 10,        -330 },
+		{ 10934, 22,       29204 }, { 10956, 13,       -2020 }, { 10969, 21,       -5616 }, { 10990, 12,      -10056 },
+		{ 11002, 12,       -3101 }, { 11014, 16,       -3176 }, { 11030, 13,       -5036 }, { 11043, 15,        -254 },
+		{ 11058, 20,      -30506 }, { 11078, 12,        -293 }, { 11090, 20,        -642 }, { 11110, 18,       -2131 },
+		{ 11128, 18,        -221 }, { 11146, 20,       -2813 }, { 11166, 23,       -2049 }, { 11189, 10,        -200 },
+		{ 11199, 19,      -14002 }, { 11218, 16,       -2149 }, { 11234,  9,       -2541 }, { 11243, 18,       -1856 },
+		{ 11261, 25,       -1734 }, { 11286, 12,       -8963 }, { 11298, 16,       -2120 }, { 11314, 20,       -2830 },
+		{ 11334, 19,       -5026 }, { 11353,  7,          20 }, { 11360, 12,        -197 }, { 11372, 16,      -10006 },
+		{ 11388, 20,       -4185 }, { 11408, 11,        -243 }, { 11419, 16,       -2075 }, { 11435, 27,      -29298 },
+		{ 11462,  9,         -73 }, { 11471, 26,      -13909 }, { 11497, 24,       -5618 }, { 11521, 15,       -4202 },
+		{ 11536, 18,      100096 }, { 11554, 11,        -803 }, { 11565, 12,           2 }, { 11577, 14,       -5401 },
+		{ 11591, 14,       -6983 }, { 11605, 11,         -27 }, { 11616, 19,       -2090 }, { 11635, 31,      -29503 },
+		{ 11666, 13,         -95 }, { 11679, 15,      -10106 }, { 11694, 13,       -5502 }, { 11707, 25,       -4998 },
+		{ 11732, 15,       -2003 }, { 11747,  8,       -3102 }, { 11755, 15,       -8851 }, { 11770, 22,       -1731 },
+		{ 11792, 13,       -9058 }, { 11805, 13,       -1071 }, { 11818, 16,        -914 }, { 11834, 15,       -7109 },
+		{ 11849, 17,       -2805 }, { 11866, 11,       -5009 }, { 11877, 26,      -22016 }, { 11903, 14,        -501 },
+		{ 11917, 23,      -30369 }, { 11940, 17,        -609 }, { 11957, 18,       -2741 }, { 11975, 20,       -2751 },
+		{ 11995, 16,      100090 }, { 12011, 22,       -2142 }, { 12033, 12,       -1276 }, { 12045, 30,       -6228 },
+		{ 12075, 16,      -25346 }, { 12091, 12,       -2033 }, { 12103, 13,       -1304 }, { 12116, 23,      -13942 },
+		{ 12139, 11,        -315 }, { 12150, 14,      -10010 }, { 12164, 21,       -3169 }, { 12185,  8,        -113 },
+		{ 12193, 22,       -5603 }, { 12215, 10,         -28 }, { 12225, 12,        -491 }, { 12237, 16,       -8850 },
+		{ 12253, 24,      -30527 }, { 12277, 12,        -194 }, { 12289, 12,        -127 }, { 12301, 13,       -2158 },
+		{ 12314, 18,       -4193 }, { 12332, 31,       -5203 }, { 12363, 10,       -3201 }, { 12373, 23,      100065 },
+		{ 12396, 15,      -32001 }, { 12411, 16,      -10006 }, { 12427, 18,       -2543 }, { 12445, 11,      -10017 },
+		{ 12456, 22,       -1713 }, { 12478, 27,      -30360 }, { 12505, 25,      -30374 }, { 12530, 17,      -10111 },
+		{ 12547, 16,       -5038 }, { 12563, 28,       -8983 }, { 12591, 23,      -29289 }, { 12614, 21,       -2157 },
+		{ 12635,  9,          12 }, { 12644, 17,       -2803 }, { 12661, 20,       -6911 }, { 12681, 11,        -192 },
+		{ 12692, 17,      -10008 }, { 12709, 19,      -10055 }, { 12728, 13,        -911 }, { 12741, 27,      -13928 },
+		{ 12768, 22,      100042 }, { 12790, 16,       -2037 }, { 12806, 19,       29205 }, { 12825, 15,      100000 },
+		{ 12840, 25,       -2136 }, { 12865, 15,      -10005 }, { 12880, 23,      -25345 }, { 12903, 23,       -9099 },
+		{ 12926, 14,       -1860 }, { 12940, 23,      -30776 }, { 12963, 17,       -6985 }, { 12980, 21,      -13948 },
+		{ 13001, 18,       -4275 }, { 13019, 28,      -30548 }, { 13047, 23,      -29580 }, { 13070, 14,      -10071 },
+		{ 13084,  9,        -909 }, { 13093, 11,         102 }, { 13104, 16,       -3260 }, { 13120, 20,      100052 },
+		{ 13140,  9,         -65 }, { 13149, 17,      100035 }, { 13166, 19,       -9073 }, { 13185, 19,      -30551 },
+		{ 13204, 23,      100074 }, { 13227, 26,      -29504 }, { 13253, 18,      -10003 }, { 13271, 27,      -13932 },
+		{ 13298,  9,       -3231 }, { 13307, 22,       -7132 }, { 13329, 19,       -2001 }, { 13348, 21,       -3031 },
+		{ 13369, 19,       -5615 }, { 13388, 16,       -1723 }, { 13404, 19,      100040 }, { 13423, 14,       -6987 },
+		{ 13437, 34,      -13013 }, { 13471, 31,      -13038 }, { 13502,  9,       -6220 }, { 13511, 25,       -3004 },
+		{ 13536, 13,       -3164 }, { 13549, 24,       -6222 }, { 13573, 22,       -5420 }, { 13595, 19,       -6989 },
+		{ 13614,  9,       -1099 }, { 13623, 24,       -2801 }, { 13647, 15,       -5021 }, { 13662, 20, -2147450879 },
+		{ 13682, 15,       -2118 }, { 13697,  7,         -82 }, { 13704, 18,       -8747 }, { 13722, 14,       -5063 },
+		{ 13736, 17,       -5044 }, { 13753, 24,      100049 }, { 13777, 28,      -30552 }, { 13805, 20,       -7136 },
+		{ 13825, 19,      100038 }, { 13844, 24,       -8755 }, { 13868, 11,        -415 }, { 13879, 20,       -5241 },
+		{ 13899, 21,      100054 }, { 13920, 18,       -7103 }, { 13938, 18,        -629 }, { 13956, 16,       -9092 },
+		{ 13972, 15,          -1 }, { 13987, 20,       -7107 }, { 14007, 19,      -30427 }, { 14026, 14,        -919 },
+		{ 14040, 19,      -10009 }, { 14059, 16,      100009 }, { 14075, 11,       -6232 }, { 14086, 16,      -13949 },
+		{ 14102, 17,       -8768 }, { 14119, 15,       -1751 }, { 14134, 21,      -30378 }, { 14155, 17,      100023 },
+		{ 14172, 14,      -10045 }, { 14186, 20,         105 }, { 14206,  9,          15 }, { 14215, 16,        -148 },
+		{ 14231, 18,       -1703 }, { 14249, 19,      -30545 }, { 14268, 22,       -7126 }, { 14290, 26,       -6992 },
+		{ 14316, 13,       -3259 }, { 14329, 16,       -2506 }, { 14345, 13,       -5249 }, { 14358, 15,      -25303 },
+		{ 14373, 15,       -1310 }, { 14388, 13,      -10030 }, { 14401, 22,      -29501 }, { 14423,  7,          23 },
+		{ 14430, 25,       -8790 }, { 14455, 12,           4 }, { 14467, 21,       -1733 }, { 14488, 12,       -1311 },
+		{ 14500, 11,       -2419 }, { 14511, 19,       -7101 }, { 14530, 10,        -360 }, { 14540, 15,       -2540 },
+		{ 14555, 21,       -8760 }, { 14576, 15,       -4005 }, { 14591, 26,      -13940 }, { 14617, 13,       -6999 },
+		{ 14630, 20, -2147450878 }, { 14650, 13,        -806 }, { 14663, 17,       -2520 }, { 14680, 18,       -5224 },
+		{ 14698, 21,       -6998 }, { 14719, 10,        -314 }, { 14729, 19,      -30581 }, { 14748,  9,         -60 },
+		{ 14757, 13,        -171 }, { 14770, 33,      -13007 }, { 14803, 23,         -11 }, { 14826, 17,       -2040 },
+		{ 14843,  8,         -38 }, { 14851, 11,       -9057 }, { 14862,  9,         -33 }, { 14871, 16,       -2703 },
+		{ 14887, 32,      -22009 }, { 14919,  9,           0 }, { 14928, 10,          28 }, { 14938, 20,       -3160 },
+		{ 14958,  7,       -3204 }, { 14965, 16,       -3238 }, { 14981, 13,       -2047 }, { 14994, 11,        -154 },
+		{ 15005, 17,        -176 }, { 15022, 11,        -492 }, { 15033, 12,       -2548 }, { 15045, 18,       -3163 },
+		{ 15063, 13,        -605 }, { 15076, 23,       -6997 }, { 15099, 12,         -64 }, { 15111, 18,      100097 },
+		{ 15129, 15,       -2526 }, { 15144, 17,        -604 }, { 15161, 17,      100077 }, { 15178, 15,       -1421 },
+		{ 15193, 23,      100059 }, { 15216, 15,       -5250 }, { 15231, 24,       -9996 }, { 15255, 20,      100095 },
+		{ 15275, 10,         -67 }, { 15285, 19,       -2086 }, { 15304, 31,      -13008 }, { 15335, 11,           6 },
+		{ 15346, 12,      -10110 }, { 15358, 26,      -30392 }, { 15384,  7,         -54 }, { 15391,  9,       -2809 },
+		{ 15400, 10,          10 }, { 15410, 26,      -30593 }, { 15436, 26,       -4996 }, { 15462,  7,         -19 },
+		{ 15469, 11,       -3234 }, { 15480, 11,      -10003 }, { 15491, 19,      -29505 }, { 15510, 10,       -1277 },
+		{ 15520, 18,       -1709 }, { 15538, 18,       -6995 }, { 15556, 28,       -2127 }, { 15584, 16,      -30516 },
+		{ 15600, 20,       -6912 }, { 15620, 22,      100051 }, { 15642, 11,       -1302 }, { 15653, 23,       -2132 },
+		{ 15676, 13,       -9065 }, { 15689, 19,      -25301 }, { 15708, 10,        -100 }, { 15718, 15,      -11002 },
+		{ 15733, 25,       -1424 }, { 15758, 19,       -9994 }, { 15777, 10,        -601 }, { 15787, 23,       -4178 },
+		{ 15810, 25,       -5403 }, { 15835, 20,       -8746 }, { 15855, 28,      -13880 }, { 15883, 16,        -812 },
+		{ 15899, 14,       -2106 }, { 15913, 16,       -2811 }, { 15929, 18,       -2002 }, { 15947, 13,       -5022 },
+		{ 15960,  7,          -2 }, { 15967, 12,        -346 }, { 15979,  9,         -79 }, { 15988, 23,      -30525 },
+		{ 16011, 14,       -2818 }, { 16025, 15,      -10780 }, { 16040,  9,        -903 }, { 16049, 24,       -2824 },
+		{ 16073, 24,       -6992 }, { 16097, 20,       -9104 }, { 16117, 17,       -8972 }, { 16134, 22,       -2133 },
+		{ 16156, 12,         -22 }, { 16168, 15,       -2810 }, { 16183, 19,       -7100 }, { 16202, 27,       -5613 },
+		{ 16229, 33,       -8904 }, { 16262,  7,         -83 }, { 16269, 10,       -1104 }, { 16279, 21,      100041 },
+		{ 16300, 13,       -9084 }, { 16313, 19,      100037 }, { 16332, 16,       -4988 }, { 16348, 30,       -2057 },
+		{ 16378, 21,       -4194 }, { 16399, 16,       -7112 }, { 16415, 12,       -1813 }, { 16427, 13,       -5253 },
+		{ 16440, 12,        -631 }, { 16452, 17,       -1418 }, { 16469, 21,       -2702 }, { 16490, 17,      100068 },
+		{ 16507, 10,         -96 }, { 16517, 24,       -2126 }, { 16541, 11,       -6916 }, { 16552, 24,       -4960 },
+		{ 16576, 16,       -2403 }, { 16592, 10,       -5011 }, { 16602, 24,      -30390 }, { 16626,  8,        -115 },
+		{ 16634, 17,      -14000 }, { 16651, 15,       -1404 }, { 16666, 23,       -5243 }, { 16689, 19,       -4274 },
+		{ 16708,  8,         -86 }, { 16716, 11,        -906 }, { 16727, 16,       -2813 }, { 16743, 15,      -30340 },
+		{ 16758, 15,       -2554 }, { 16773, 17,       -8767 }, { 16790, 27,      -30787 }, { 16817, 21,       -8852 },
+		{ 16838, 15,       -6150 }, { 16853, 10,        -900 }, { 16863, 21,       -6221 }, { 16884, 26,      -30566 },
+		{ 16910, 20,      -30531 }, { 16930, 19,       -2752 }, { 16949, 12,      -10021 }, { 16961, 26,       -7121 },
+		{ 16987,  9,       -3271 }, { 16996, 15,       -1719 }, { 17011, 24,       -8979 }, { 17035, 16,       -1852 },
+		{ 17051,  7,         -42 }, { 17058, 21,      -30530 }, { 17079, 16,       -7103 }, { 17095, 26,       -5222 },
+		{ 17121, 16,       -1728 }, { 17137, 16,       -9109 }, { 17153, 16,       -2899 }, { 17169, 14,        -311 },
+		{ 17183, 25,       -2501 }, { 17208, 24,       -2059 }, { 17232, 11,         -84 }, { 17243, 22,        -102 },
+		{ 17265, 23,       -9094 }, { 17288, 17,       -2546 }, { 17305, 13,        -607 }, { 17318, 19,        -854 },
+		{ 17337, 22,       -5603 }, { 17359, 19,       -5622 }, { 17378, 22,       -3174 }, { 17400, 20,       -4200 },
+		{ 17420, 17,      -29291 }, { 17437, 17,       -9079 }, { 17454, 11,       -9082 }, { 17465, 12,       -3173 },
+		{ 17477, 16,      -10003 }, { 17493, 17,       -8793 }, { 17510,  6,         -43 }, { 17516, 24,       -8754 },
+		{ 17540, 28,      -30381 }, { 17568, 10,         -74 }, { 17578, 25,      -30785 }, { 17603, 22,      -25311 },
+		{ 17625, 21,       -6959 }, { 17646, 14,      -22008 }, { 17660, 13,      -30532 }, { 17673, 18,      -11004 },
+		{ 17691, 11,       -3177 }, { 17702, 12,       -2521 }, { 17714, 27,      -29294 }, { 17741, 17,      -30513 },
+		{ 17758, 21,      -11003 }, { 17779, 13,        -931 }, { 17792, 40,       -5210 }, { 17832,  9,         -30 },
+		{ 17841, 16,      100003 }, { 17857,  8,       -1101 }, { 17865, 38,       -5211 }, { 17903, 26,       -8785 },
+		{ 17929, 17,        -863 }, { 17946, 23,         104 }, { 17969, 24,      100075 }, { 17993, 20,          -2 },
+		{ 18013, 19,       -2828 }, { 18032, 15,       -6909 }, { 18047, 19,        -177 }, { 18066, 14,        -186 },
+		{ 18080, 27,       -5612 }, { 18107, 19,        -226 }, { 18126, 14,       -3253 }, { 18140, 22,       -8771 },
+		{ 18162, 21,       -5047 }, { 18183, 20,      -30594 }, { 18203, 15,       -7108 }, { 18218, 28,      -30562 },
+		{ 18246, 18,      -30342 }, { 18264, 34,       -8992 }, { 18298, 10,       -9061 }, { 18308, 16,       -5042 },
+		{ 18324, 14,        -305 }, { 18338, 16,       -9051 }, { 18354, 33,       -5360 }, { 18387, 12,      -13001 },
+		{ 18399, 28,       -5226 }, { 18427,  9,       -3208 }, { 18436, 20,      -25312 }, { 18456, 10,         -66 },
+		{ 18466, 12,        -907 }, { 18478, 14,       -2012 }, { 18492, 11,        -300 }, { 18503, 13,       -1072 },
+		{ 18516, 17,       -2148 }, { 18533, 14,       -7108 }, { 18547, 15,      -29299 }, { 18562, 23,      100053 },
+		{ 18585, 15,          43 }, { 18600, 15,       -2122 }, { 18615, 19,       -4195 }, { 18634, 11,        -632 },
+		{ 18645, 20,       -7127 }, { 18665, 23,       -2820 }, { 18688, 23,      -30042 }, { 18711, 19,       -3242 },
+		{ 18730, 15,         128 }, { 18745, 15,      -30502 }, { 18760, 20,       -7122 }, { 18780, 12,        -290 },
+		{ 18792, 16,       -1800 }, { 18808, 17,       -2513 }, { 18825,  9,       -3203 }, { 18834, 15,        -210 },
+		{ 18849, 17,       -2812 }, { 18866, 31,      -13927 }, { 18897, 19,       -2706 }, { 18916, 20,       -8794 },
+		{ 18936, 16,      -30586 }, { 18952, 18,      -10080 }, { 18970, 18,       -7111 }, { 18988,  8,           5 },
+		{ 18996, 19,       -6984 }, { 19015, 14,       -2087 }, { 19029, 18,       -8761 }, { 19047, 18,      -30508 },
+		{ 19065, 17,      100029 }, { 19082,  8,        -410 }, { 19090, 22,       -4198 }, { 19112, 24,       -7119 },
+		{ 19136, 16,      -30595 }, { 19152, 21,       -1736 }, { 19173, 21,       -1422 }, { 19194, 13,       -3165 },
+		{ 19207, 13,          42 }, { 19220, 18,       -2042 }, { 19238, 12,       29200 }, { 19250, 14,          86 },
+		{ 19264, 14,       -2093 }, { 19278, 17,       -1750 }, { 19295, 22,       -2806 }, { 19317, 16,      100027 },
+		{ 19333, 20,        -617 }, { 19353, 12,          51 }, { 19365, 16,      -10022 }, { 19381, 22,      -30002 },
+		{ 19403, 13,       -1309 }, { 19416, 16,       -7116 }, { 19432, 17,       -2806 }, { 19449, 11,       -9052 },
+		{ 19460, 28,      -30597 }, { 19488, 13,       -1273 }, { 19501, 16,      -10058 }, { 19517, 23,       -7126 },
+		{ 19540, 30,       -5206 }, { 19570, 14,      -13004 }, { 19584, 22,       -2039 }, { 19606, 21,       -4190 },
+		{ 19627, 24,      -30788 }, { 19651, 14,       -3240 }, { 19665, 21,       -5552 }, { 19686, 18,      -30344 },
+		{ 19704, 25,       -1732 }, { 19729, 23,       -8748 }, { 19752, 25,       -2141 }, { 19777, 17,      -32012 },
+		{ 19794, 20,       -9100 }, { 19814, 16,      100032 }, { 19830, 19,       -2124 }, { 19849, 20,       20001 },
+		{ 19869, 17,       -2829 }, { 19886, 26,      -32049 }, { 19912, 19,      -29589 }, { 19931,  8,          13 },
+		{ 19939, 12,       -1027 }, { 19951, 20,       -2809 }, { 19971, 20,       -5033 }, { 19991, 20,       -2421 },
+		{ 20011,  8,         -66 }, { 20019, 21,       -6229 }, { 20040, 18,       -2807 }, { 20058, 20,      -13946 },
+		{ 20078, 10,        -124 }, { 20088, 14,        -310 }, { 20102, 41,       -5210 }, { 20143, 22,        -178 },
+		{ 20165, 17,      -30596 }, { 20182, 12,        -196 }, { 20194, 19,      100057 }, { 20213, 20,      -10013 },
+		{ 20233, 22,       -6994 }, { 20255, 25,       -4174 }, { 20280, 20,       -1717 }, { 20300, 16,      -29276 },
+		{ 20316, 13,       -3179 }, { 20329, 18,       -2205 }, { 20347,  9,       -3200 }, { 20356, 19,        -436 },
+		{ 20375, 19,         113 }, { 20394,  6,         -39 }, { 20400, 28,        -983 }, { 20428, 14,       -5023 },
+		{ 20442, 19,       -1741 }, { 20461, 22,      -13936 }, { 20483, 16,      -30544 }, { 20499, 17,       -7138 },
+		{ 20516, 14,       -2013 }, { 20530,  9,        -339 }, { 20539, 19,       -8994 }, { 20558, 16,      -30546 },
+		{ 20574,  8,       -3103 }, { 20582, 13,       -1850 }, { 20595, 23,       -2408 }, { 20618, 17,      100079 },
+		{ 20635, 23,      100063 }, { 20658, 10,        -149 }, { 20668, 12,      -13003 }, { 20680, 17,      100002 },
+		{ 20697, 18,       -6997 }, { 20715, 13,      -11001 }, { 20728, 15,       -1407 }, { 20743, 11,         -55 },
+		{ 20754, 15,        -241 }, { 20769, 14,       -7110 }, { 20783, 15,         122 }, { 20798, 14,       -3157 },
+		{ 20812, 27,      -30362 }, { 20839, 17,       -2800 }, { 20856, 10,       -3104 }, { 20866, 26,       -8990 },
+		{ 20892, 15,      -29585 }, { 20907, 18,      -29293 }, { 20925, 22,        -616 }, { 20947, 20,       -2551 },
+		{ 20967, 21,       -2406 }, { 20988, 15,      -10018 }, { 21003, 15,       -1412 }, { 21018, 17,      100028 },
+		{ 21035, 12,       -1025 }, { 21047, 18,      -10108 }, { 21065, 10,       20010 }, { 21075, 21,      -30500 },
+		{ 21096, 16,       -4172 }, { 21112, 16,       -7124 }, { 21128, 17,      100070 }, { 21145, 11,           0 },
+		{ 21156, 14,      -10070 }, { 21170, 25,        -985 }, { 21195, 17,      100031 }, { 21212, 11,       20004 },
+		{ 21223, 14,        -807 }, { 21237,  8,         -56 }, { 21245, 20,       -7105 }, { 21265,  9,        -301 },
+		{ 21274, 17,       -4276 }, { 21291,  9,         -91 }, { 21300,  9,       -3107 }, { 21309, 25,       -4187 },
+		{ 21334, 25,       -2528 }, { 21359, 15,       -1703 }, { 21374, 26,      100044 }, { 21400, 17,       -4212 },
+		{ 21417, 10,           9 }, { 21427, 17,      100010 }, { 21444, 21,      -22018 }, { 21465, 19,       -9091 },
+		{ 21484, 17,       -5244 }, { 21501, 13,      -25292 }, { 21514, 17,       -8975 }, { 21531, 16,       -9401 },
+		{ 21547, 22,       -2897 }, { 21569, 25,       -3025 }, { 21594, 19,       -5600 }, { 21613, 18,       -4171 },
+		{ 21631, 16,      100018 }, { 21647, 14,      -13002 }, { 21661, 15,       -5006 }, { 21676, 20,      -30422 },
+		{ 21696, 22,       -8968 }, { 21718, 13,      -10032 }, { 21731, 23,       -1708 }, { 21754, 20,         114 },
+		{ 21774, 10,       -3221 }, { 21784, 19,       -4202 }, { 21803, 14,      -10091 }, { 21817, 22,       -2582 },
+		{ 21839, 21,       -6956 }, { 21860, 18,       -2818 }, { 21878, 20,       -2024 }, { 21898, 14,        -147 },
+		{ 21912, 11,      -10007 }, { 21923, 21,      -30384 }, { 21944, 21,      -22002 }, { 21965, 21,       -2067 },
+		{ 21986, 17,        -261 }, { 22003, 15,       -5012 }, { 22018, 22,       -7128 }, { 22040, 18,       -2505 },
+		{ 22058, 14,      -10001 }, { 22072, 27,      -30780 }, { 22099, 20,      -30373 }, { 22119,  7,         -24 },
+		{ 22126, 11,        -351 }, { 22137, 15,       -3276 }, { 22152, 12,       -2819 }, { 22164, 21,      -30442 },
+		{ 22185, 24,       -2146 }, { 22209, 20,      -30550 }, { 22229, 20,      -10023 }, { 22249, 25,       -8971 },
+		{ 22274, 21,       -4994 }, { 22295, 28,       -5212 }, { 22323, 11,       -3275 }, { 22334, 11,       -7100 },
+		{ 22345, 29,       -8750 }, { 22374, 18,       -2511 }, { 22392, 10,       -1102 }, { 22402, 12,       -1811 },
+		{ 22414, 18,      -32008 }, { 22432, 16,       -1402 }, { 22448, 13,       -9083 }, { 22461, 20,        -646 },
+		{ 22481, 14,       -3180 }, { 22495, 18,       -2701 }, { 22513, 20,       -2753 }, { 22533, 20,       -2062 },
+		{ 22553, 26,      -25308 }, { 22579, 17,       -9093 }, { 22596, 22,      -25317 }, { 22618, 27,       -8991 },
+		{ 22645, 15,      -10113 }, { 22660,  9,        -203 }, { 22669, 14,       -2110 }, { 22683, 19,      -30519 },
+		{ 22702, 31,      -30779 }, { 22733, 13,       -2811 }, { 22746, 19,       -2899 }, { 22765,  7,         -20 },
+		{ 22772, 26,       -1426 }, { 22798, 14,      -10019 }, { 22812, 33,       -5204 }, { 22845, 20,       -5045 },
+		{ 22865, 25,      -30561 }, { 22890, 16,       -9063 }, { 22906, 18,       -2404 }, { 22924, 11,        -108 },
+		{ 22935, 21,       -9087 }, { 22956, 17,        -201 }, { 22973, 15,       29202 }, { 22988, 13,        -345 },
+		{ 23001, 15,       -3151 }, { 23016, 19,      -30591 }, { 23035, 16,      -30398 }, { 23051, 22,      -30522 },
+		{ 23073, 25,      -30379 }, { 23098, 18,      -10081 }, { 23116,  8,        -805 }, { 23124, 18,       -2816 },
+		{ 23142, 10,       -2544 }, { 23152, 15,       -4206 }, { 23167, 24,       -2089 }, { 23191, 10,       -3211 },
+		{ 23201,  6,         -44 }, { 23207, 14,        -858 }, { 23221, 23,      -29586 }, { 23244, 30,       -4189 },
+		{ 23274, 16,       -2077 }, { 23290, 27,       -2721 }, { 23317, 13,       -7139 }, { 23330, 20,      -10047 },
+		{ 23350, 18,        -620 }, { 23368, 17,      -30399 }, { 23385, 15,       -2742 }, { 23400, 25,       -2500 },
+		{ 23425, 13,       -3251 }, { 23438, 10,         -99 }, { 23448, 12,        -337 }, { 23460, 15,      -10020 },
+		{ 23475, 12,        -240 }, { 23487, 20,      -30564 }, { 23507, 19,      -25310 }, { 23526, 15,       -6901 },
+		{ 23541, 24,        -875 }, { 23565, 16,       -1812 }, { 23581, 13,        -451 }, { 23594, 12,           3 },
+		{ 23606, 11,        -926 }, { 23617, 22,        -644 }, { 23639, 23,      -30589 }, { 23662, 11,       -2017 },
+		{ 23673, 12,        -600 }, { 23685, 17,       -3172 }, { 23702, 17,      100092 }, { 23719, 10,       -1024 },
+		{ 23729, 27,       -5221 }, { 23756, 13,       -2539 }, { 23769, 17,       -1754 }, { 23786, 12,        -417 },
+		{ 23798, 21,       -2135 }, { 23819, 18,      100093 }, { 23837, 17,       -1409 }, { 23854, 23,       -8988 },
+		{ 23877, 21,       -2027 }, { 23898, 14,       -2740 }, { 23912, 20,      -25295 }, { 23932, 20,       -2801 },
+		{ 23952, 13,        -917 }, { 23965, 16,      -10115 }, { 23981, 12,      -13005 }, { 23993, 22,       -1759 },
+		{ 24015,  8,       -2208 }, { 24023, 12,       -8959 }, { 24035, 16,       -5030 }, { 24051, 21,       -3003 },
+		{ 24072, 18,       -1425 }, { 24090, 11,         -75 }, { 24101, 19,      -25314 }, { 24120, 14,       -3247 },
+		{ 24134, 14,       -2025 }, { 24148, 22,       -5240 }, { 24170, 25,      -22012 }, { 24195, 16,       -1705 },
+		{ 24211, 35,       -4942 }, { 24246, 10,       -5501 }, { 24256,  9,         -18 }, { 24265, 22,       -2034 },
+		{ 24287, 20,       -2831 }, { 24307, 14,        -810 }, { 24321, 19,       -2898 }, { 24340, 15,       -5000 },
+		{ 24355,  8,        -800 }, { 24363, 21,       -4007 }, { 24384, 17,      100019 }, { 24401, 25,      -22015 },
+		{ 24426, 16,       -9108 }, { 24442, 27,       -8738 }, { 24469, 14,          13 }, { 24483, 29,      -30543 },
+		{ 24512, 18,        -253 }, { 24530, 14,       -2817 }, { 24544, 21,      100048 }, { 24565, 21,      -30394 },
+		{ 24586, 21,        -503 }, { 24607, 19,      -30428 }, { 24626, 15,       -6999 }, { 24641, 17,      -10109 },
+		{ 24658, 16,       -1715 }, { 24674,  7,         -89 }, { 24681, 23,       -2411 }, { 24704,  8,       -3105 },
+		{ 24712, 20,       -2512 }, { 24732, 22,       -3282 }, { 24754, 20,       -1710 }, { 24774, 19,       -2125 },
+		{ 24793, 16,       -6988 }, { 24809, 10,       -3224 }, { 24819, 17,       -3211 }, { 24836,  9,       -1327 },
+		{ 24845, 12,        -257 }, { 24857, 16,       -3258 }, { 24873, 13,       -3159 }, { 24886, 22,       -2516 },
+		{ 24908, 34,       -4940 }, { 24942, 14,        -185 }, { 24956, 15,       -7107 }, { 24971, 24,      -30778 },
+		{ 24995, 31,      -22014 }, { 25026, 11,        -209 }, { 25037, 24,       -6231 }, { 25061, 18,       -5640 },
+		{ 25079, 18,      -13020 }, { 25097, 26,       -5605 }, { 25123, 23,      100073 }, { 25146, 11,        -416 },
+		{ 25157,  9,        -122 }, { 25166, 29,         121 }, { 25195, 26,      -13009 }, { 25221,  8,        -126 },
+		{ 25229, 19,        -435 }, { 25248, 24,       -2709 }, { 25272, 18,       -5381 }, { 25290, 18,       -2808 },
+		{ 25308, 21,       -4175 }, { 25329, 10,          85 }, { 25339, 19,      -25294 }, { 25358, 16,       -7134 },
+		{ 25374, 10,           8 }, { 25384, 13,       -2581 }, { 25397, 24,       -1714 }, { 25421, 15,       -4210 },
+		{ 25436,  9,        -802 }, { 25445, 12,        -333 }, { 25457, 14,        -625 }, { 25471, 15,       -1739 },
+		{ 25486, 15,       -3166 }, { 25501,  7,         -47 }, { 25508, 10,       -3161 }, { 25518, 21,        -984 },
+		{ 25539, 10,         -21 }, { 25549, 15,       -4214 }, { 25564,  8,       -1075 }, { 25572, 17,       -5610 },
+		{ 25589, 27,       -8795 }, { 25616,  9,        -804 }, { 25625, 18,      -30521 }, { 25643, 18,       -5363 },
+		{ 25661,  9,        -153 }, { 25670, 19,       -1701 }, { 25689, 22,       -6973 }, { 25711, 12,      -10006 },
+		{ 25723, 11,        -414 }, { 25734, 14,        -318 }, { 25748, 19,      -30044 }, { 25767, 24,       -5405 },
+		{ 25791, 20,       -6950 }, { 25811, 29,      -29500 }, { 25840, 20,       -8791 }, { 25860, 12,        -195 },
+		{ 25872, 19,       -8759 }, { 25891, 10,       -3218 }, { 25901, 22,       -2016 }, { 25923, 11,       -1097 },
+		{ 25934, 22,       -6993 }, { 25956, 25,       -5751 }, { 25981, 14,      -10033 }, { 25995, 19,       -3243 },
+		{ 26014, 22,       -1427 }, { 26036, 23,        -981 }, { 26059, 18,       -7112 }, { 26077, 23,        -452 },
+		{ 26100, 20,       -6996 }, { 26120, 15,       -5017 }, { 26135, 22,       -4992 }, { 26157, 27,       -2533 },
+		{ 26184, 20,      100088 }, { 26204, 12,        -109 }, { 26216, 12,       -5031 }, { 26228,  7,          90 },
+		{ 26235, 18,      -25343 }, { 26253, 12,       -3237 }, { 26265, 10,        -320 }, { 26275, 29,       -5200 },
+		{ 26304, 12,        1010 }, { 26316, 18,       -1413 }, { 26334,  9,        -206 }, { 26343, 21,      -10024 },
+		{ 26364,  8,         -50 }, { 26372, 10,       -3269 }, { 26382, 13,        -335 }, { 26395, 33,      -30771 },
+		{ 26428, 18,      -30501 }, { 26446, 16,      100098 }, { 26462, 24,        -610 }, { 26486, 13,       -6948 },
+		{ 26499, 10,           1 }, { 26509, 16,      -30540 }, { 26525,  7,        -155 }, { 26532, 18,      100094 },
+		{ 26550, 18,        -224 }, { 26568, 13,        -200 }, { 26581, 14,        -189 }, { 26595, 23,      -30590 },
+		{ 26618, 17,       -2101 }, { 26635, 22,       -5387 }, { 26657, 18,      -25299 }, { 26675, 14,       -1403 },
+		{ 26689, 27,       -8993 }, { 26716, 25,       -2762 }, { 26741, 22,       -2134 }, { 26763, 10,       -3216 },
+		{ 26773, 23,       -2503 }, { 26796, 14,      -10044 }, { 26810, 15,       -1726 }, { 26825, 15,       -1274 },
+		{ 26840, 17,        -618 }, { 26857, 27,      -30366 }, { 26884, 14,           1 }, { 26898, 12,        -291 },
+		{ 26910, 17,       -1706 }, { 26927, 17,       -6980 }, { 26944, 20,       -8808 }, { 26964, 14,        -212 },
+		{ 26978, 23,       -9402 }, { 27001, 18,       -2557 }, { 27019, 13,      -10054 }, { 27032, 21,        -980 },
+		{ 27053, 25,      -13943 }, { 27078, 23,      -30528 }, { 27101, 21,       -1740 }, { 27122, 24,      -30553 },
+		{ 27146, 16,       -9107 }, { 27162, 12,      -30503 }, { 27174, 15,      -10002 }, { 27189, 31,       -1429 },
+		{ 27220, 23,       -5752 }, { 27243, 17,      100012 }, { 27260, 22,      -25296 }, { 27282, 23,       -2553 },
+		{ 27305, 23,      -30387 }, { 27328,  8,         -45 }, { 27336, 25,       -3951 }, { 27361, 33,       -4941 },
+		{ 27394, 25,      -30542 }, { 27419, 22,       -4179 }, { 27441, 19,      -25304 }, { 27460, 15,       -4184 },
+		{ 27475, 23,       -1761 }, { 27498, 20,      -30541 }, { 27518, 13,       -3175 }, { 27531,  9,       -6994 },
+		{ 27540, 15,      -30420 }, { 27555, 15,      -30517 }, { 27570, 20,      -30587 }, { 27590, 13,       -5385 },
+		{ 27603, 28,      -30582 }, { 27631, 20,       -3281 }, { 27651, 19,      -13887 }, { 27670, 19,       -4176 },
+		{ 27689, 12,        -193 }, { 27701, 21,       -8803 }, { 27722, 26,       -3283 }, { 27748, 22,       -4001 },
+		{ 27770, 16,       -2814 }, { 27786, 20,      -10010 }, { 27806, 21,      -30441 }, { 27827,  8,        -111 },
+		{ 27835, 16,      100001 }, { 27851, 17,       -9090 }, { 27868, 22,       -4183 }, { 27890, 15,          81 },
+		{ 27905, 25,       -2020 }, { 27930, 16,       -2023 }, { 27946, 10,       -3210 }, { 27956, 24,      -25315 },
+		{ 27980, 27,       -2063 }, { 28007, 15,       -2206 }, { 28022, 10,       -3158 }, { 28032, 12,       -6971 },
+		{ 28044, 16,       -4201 }, { 28060,  8,         -37 }, { 28068, 19,       -2897 }, { 28087, 15,      -30429 },
+		{ 28102, 32,       -5609 }, { 28134, 10,        -318 }, { 28144, 22,       -2079 }, { 28166, 17,       -5400 },
+		{ 28183, 22,        -861 }, { 28205, 14,           2 }, { 28219,  7,        -304 }, { 28226, 23,       -2094 },
+		{ 28249, 18,       -9070 }, { 28267, 29,       -2066 }, { 28296, 20,       -2823 }, { 28316, 17,      -30555 },
+		{ 28333,  9,       -5002 }, { 28342, 26,      -22006 }, { 28368, 10,      -10043 }, { 28378, 23,       -6949 },
+		{ 28401, 20,      100084 }, { 28421, 19,       -8784 }, { 28440, 20,       -2537 }, { 28460, 21,      -30367 },
+		{ 28481, 24,      -30447 }, { 28505, 22,       -8739 }, { 28527,  9,         -90 }, { 28536, 20,       -2814 },
+		{ 28556, 21,      -30377 }, { 28577, 18,       -1405 }, { 28595, 20,       -4182 }, { 28615, 18,      -30504 },
+		{ 28633, 20,       -5386 }, { 28653, 18,        -463 }, { 28671, 28,       -8982 }, { 28699, 15,        -227 },
+		{ 28714, 10,      -32640 }, { 28724, 13,      -10102 }, { 28737, 28,      -13883 }, { 28765, 25,       -2552 },
+		{ 28790, 10,       -3233 }, { 28800, 23,      100047 }, { 28823, 28,       -5227 }, { 28851, 16,       -1417 },
+		{ 28867, 16,       -8756 }, { 28883, 18,       -6988 }, { 28901, 27,       -9405 }, { 28928, 25,      -13929 },
+		{ 28953, 29,       -8797 }, { 28982, 15,       -9085 }, { 28997, 17,      100014 }, { 29014, 20,      -22017 },
+		{ 29034, 33,       -5697 }, { 29067, 24,      -30448 }, { 29091, 22,       -4271 }, { 29113, 17,       -8964 },
+		{ 29130, 20,       -2068 }, { 29150,  9,          31 }, { 29159, 21,       -4217 }, { 29180, 12,      -10050 },
+		{ 29192, 12,       -3236 }, { 29204, 17,      100024 }, { 29221, 21,       -2750 }, { 29242, 13,       -8962 },
+		{ 29255, 16,       -1702 }, { 29271, 14,       -7101 }, { 29285, 11,       -5035 }, { 29296, 15,       -7105 },
+		{ 29311, 18,         118 }, { 29329, 23,       -9106 }, { 29352, 17,       -5251 }, { 29369, 17,      -10024 },
+		{ 29386, 11,           0 }, { 29397, 18,       -1853 }, { 29415, 11,        -151 }, { 29426, 16,        -922 },
+		{ 29442, 21,       -2103 }, { 29463, 19,       -1757 }, { 29482, 21,      -30425 }, { 29503, 18,       -8905 },
+		{ 29521, 11,       -1300 }, { 29532, 14,       -2502 }, { 29546, 16,      -10064 }, { 29562, 13,       -3170 },
+		{ 29575, 10,        -108 }, { 29585, 12,       -9406 }, { 29597, 17,       -3168 }, { 29614, 24,      -13933 },
+		{ 29638, 29,       -8806 }, { 29667, 11,       -1098 }, { 29678, 16,       -2415 }, { 29694, 18,       -2507 },
+		{ 29712, 10,         -77 }, { 29722, 19,       -2019 }, { 29741, 23,       -5225 }, { 29764, 21,       -4197 },
+		{ 29785, 22,      -32014 }, { 29807, 24,       -4200 }, { 29831, 23,      -30424 }, { 29854, 12,        -908 },
+		{ 29866, 13,       -1068 }, { 29879, 16,       -2547 }, { 29895, 24,       -2022 }, { 29919, 12,          10 },
+		{ 29931, 15,      -10016 }, { 29946, 13,      -10107 }, { 29959, 13,       -2823 }, { 29972, 18,       -9400 },
+		{ 29990, 10,           0 }, { 30000, 19,       -7118 }, { 30019, 28,       -5223 }, { 30047, 21,       -1423 },
+		{ 30068, 19,       -8796 }, { 30087, 10,       -9060 }, { 30097, 21,       -5404 }, { 30118, 19,       -2159 },
+		{ 30137,  8,          -4 }, { 30145, 14,           3 }, { 30159, 15,       -2035 }, { 30174, 18,       -2802 },
+		{ 30192, 27,       -5209 }, { 30219, 21,       -7125 }, { 30240, 21,       -8976 }, { 30261, 13,      -32768 },
+		{ 30274, 10,       -3213 }, { 30284, 26,       -7135 }, { 30310, 21,       -1723 }, { 30331, 28,      -22004 },
+		{ 30359, 19,       -2816 }, { 30378, 14,       -4990 }, { 30392, 14,       -5029 }, { 30406, 24,       -4186 },
+		{ 30430,  9,         -88 }, { 30439, 19,      -10082 }, { 30458, 20,       -5753 }, { 30478,  9,        -179 },
+		{ 30487, 16,       -4000 }, { 30503, 17,        -859 }, { 30520,  9,         -97 }, { 30529, 23,       -7120 },
+		{ 30552, 10,       -1303 }, { 30562, 26,       -8977 }, { 30588, 18,       -6986 }, { 30606,  8,       -8960 },
+		{ 30614, 14,       -2102 }, { 30628, 10,      -10042 }, { 30638, 17,       -5550 }, { 30655, 16,      100062 },
+		{ 30671, 17,      -10062 }, { 30688,  8,      -10090 }, { 30696, 11,       -9064 }, { 30707, 12,        -308 },
+		{ 30719, 20,      -30560 }, { 30739, 11,      -10114 }, { 30750, 20,       -8800 }, { 30770, 23,       -5604 },
+		{ 30793, 14,      -30511 }, { 30807, 11,        -808 }, { 30818, 21,       -1859 }, { 30839, 21,       -3954 },
+		{ 30860,  7,         -49 }, { 30867,  8,          87 }, { 30875, 26,       -7129 }, { 30901, 20,       -2821 },
+		{ 30921, 24,       -7117 }, { 30945, 10,      -10059 }, { 30955, 28,        -628 }, { 30983, 25,      -29584 },
+		{ 31008, 17,      -29292 }, { 31025, 19,      -13924 }, { 31044, 20,       -6981 }, { 31064, 17,       -6225 },
+		{ 31081, 17,       -3156 }, { 31098, 30,      -13881 }, { 31128, 17,      100017 }, { 31145, 19,       -2018 },
+		{ 31164, 27,       -4180 }, { 31191, 27,       -2707 }, { 31218, 12,       20003 }, { 31230, 18,       -6991 },
+		{ 31248, 20,       -1752 }, { 31268, 10,        -205 }, { 31278, 21,      -30523 }, { 31299, 20,       -3216 },
+		{ 31319, 16,       -8978 }, { 31335, 27,       -6231 }, { 31362, 19,       -4002 }, { 31381, 22,      -13010 },
+		{ 31403, 22,      -30512 }, { 31425, 14,          87 }, { 31439, 15,       -4008 }, { 31454, 13,        -251 },
+		{ 31467, 15,      100033 }, { 31482, 16,       -2083 }, { 31498, 20,       -2060 }, { 31518, 18,       -3167 },
+		{ 31536,  8,           0 }, { 31544, 16,      -32004 }, { 31560,  9,       -1096 }, { 31569, 25,       -5229 },
+		{ 31594, 14,       -6229 }, { 31608, 15,       -2014 }, { 31623, 12,        -319 }, { 31635, 27,       -4215 },
+		{ 31662, 27,      -13944 }, { 31689, 16,       -2815 }, { 31705, 10,          11 }, { 31715, 13,       -5382 },
+		{ 31728, 11,       -2536 }, { 31739, 23,      -30515 }, { 31762, 20,       -1720 }, { 31782, 17,       -1719 },
+		{ 31799, 17,       -3248 }, { 31816, 15,         -65 }, { 31831, 20,       -7133 }, { 31851, 10,           0 },
+		{ 31861, 24,       -2071 }, { 31885, 21,       -2763 }, { 31906, 20,        -149 }, { 31926, 22,       -7113 },
+		{ 31948, 15,      -30449 }, { 31963, 14,       -6914 }, { 31977, 25,       -2143 }, { 32002, 12,        -260 },
+		{ 32014, 16,        -876 }, { 32030, 19,       -1855 }, { 32049, 16,      100080 }, { 32065, 24,      -25313 },
+		{ 32089, 31,       -2704 }, { 32120, 17,       -1701 }, { 32137, 23,        -622 }, { 32160, 19,       -5603 },
+		{ 32179, 27,       -2074 }, { 32206, 20,        -461 }, { 32226, 17,      100069 }, { 32243, 20,       -3030 },
+		{ 32263, 23,       -9076 }, { 32286, 24,       -5614 }, { 32310, 13,        -244 }, { 32323, 19,       -7116 },
+		{ 32342, 16,       -2046 }, { 32358, 12,       -5004 }, { 32370, 20,      100081 }, { 32390, 14,          88 },
+		{ 32404,  5,         -36 }, { 32409, 14,       -1067 }, { 32423, 12,        -905 }, { 32435, 10,       -9054 },
+		{ 32445, 16,       -1411 }, { 32461, 16,        -188 }, { 32477, 22,       -6227 }, { 32499, 15,       -6910 },
+		{ 32514, 11,        -302 }, { 32525, 11,       -5005 }, { 32536, 10,       -1105 }, { 32546, 18,        -932 },
+		{ 32564, 31,       -2529 }, { 32595, 17,      -32005 }, { 32612, 26,      -30568 }, { 32638, 21,       -2078 },
+		{ 32659, 12,       -2111 }, { 32671, 17,       -5048 }, { 32688, 26,       -2130 }, { 32714, 20,        -201 },
+		{ 32734, 18,       -1857 }, { 32752, 10,        -502 }, { 32762, 11,       -3255 }, { 32773, 11,         -57 },
+		{ 32784, 16,       -8751 }, { 32800, 20,       -3002 }, { 32820, 25,       -2139 }, { 32845, 12,        -117 },
+		{ 32857, 25,      -30361 }, { 32882, 26,       -3952 }, { 32908, 21,      -30426 }, { 32929, 19,       -7115 },
+		{ 32948, 17,       -1728 }, { 32965, 16,       -7102 }, { 32981, 23,       -2509 }, { 33004, 13,       -8764 },
+		{ 33017, 12,       -3249 }, { 33029, 15,       -5046 }, { 33044, 40,       -5201 }, { 33084, 16,       -1400 },
+		{ 33100, 14,      -10072 }, { 33114, 13,        -312 }, { 33127, 23,      -13885 }, { 33150, 24,       -5252 },
+		{ 33174,  7,        -156 }, { 33181, 21,         119 }, { 33202, 11,       -3202 }, { 33213,  8,        -121 },
+		{ 33221,  9,       -1280 }, { 33230, 10,        -307 }, { 33240, 19,       20000 }, { 33259, 20,       -7110 },
+		{ 33279, 18,       -5407 }, { 33297, 17,       -8752 }, { 33314, 14,       -3201 }, { 33328, 14,       -2006 },
+		{ 33342, 13,      -29295 }, { 33355, 21,       -8765 }, { 33376, 22,      -30580 }, { 33398, 19,       -2821 },
+		{ 33417, 22,        -641 }, { 33439, 21,       -6954 }, { 33460, 10,       -8961 }, { 33470, 20,       -2422 },
+		{ 33490, 29,       -2082 }, { 33519, 18,       -7111 }, { 33537, 19,       -2517 }, { 33556, 19,       -7106 },
+		{ 33575, 17,        -910 }, { 33592, 17,       -1711 }, { 33609, 20,         -13 }, { 33629, 21,       -3285 },
+		{ 33650, 18,       -1735 }, { 33668, 19,       -5384 }, { 33687,  9,       -3270 }, { 33696, 19,      -10004 },
+		{ 33715, 10,       -9053 }, { 33725, 11,           1 }, { 33736, 18,       -3153 }, { 33754, 24,      -29583 },
+		{ 33778, 18,      100083 }, { 33796, 26,       -2072 }, { 33822, 15,      -30364 }, { 33837, 17,      -25302 },
+		{ 33854, 26,       -8807 }, { 33880, 23,      -29587 }, { 33903,  7,         -92 }, { 33910, 14,       -9050 },
+		{ 33924, 17,       29203 }, { 33941, 24,       -1756 }, { 33965, 13,       -2123 }, { 33978,  9,         -76 },
+		{ 33987, 18,       -2108 }, { 34005, 19,       -7000 }, { 34024, 16,       -1700 }, { 34040, 23,       -7104 },
+		{ 34063, 15,       -2817 }, { 34078, 24,       -8740 }, { 34102, 10,       -5014 }, { 34112,  9,       -3205 },
+		{ 34121, 27,       -1738 }, { 34148, 19,       -2401 }, { 34167, 29,      -30786 }, { 34196, 16,       29201 },
+		{ 34212, 23,       -2413 }, { 34235, 11,        -338 }, { 34246, 16,       -2538 }, { 34262, 18,      -30043 },
+		{ 34280, 16,      100006 }, { 34296, 10,         -71 }, { 34306, 14,       -8801 }, { 34320, 15,      -10011 },
+		{ 34335, 13,       -3263 }, { 34348, 10,           8 }, { 34358, 17,      100091 }, { 34375,  8,        -626 },
+		{ 34383, 15,       -6990 }, { 34398, 21,      -10063 }, { 34419, 17,      -29297 }, { 34436, 16,        -913 },
+		{ 34452, 15,       -4173 }, { 34467, 25,      -30001 }, { 34492, 20,      -30520 }, { 34512, 16,       -2005 },
+		{ 34528, 18,      100026 }, { 34546, 17,      -30396 }, { 34563,  9,       -3108 }, { 34572,  7,          18 },
+		{ 34579,  4,          -1 }, { 34583, 13,          33 }, { 34596, 14,       -6908 }, { 34610, 29,       -2064 },
+		{ 34639,  9,        -150 }, { 34648,  9,         -81 }, { 34657, 10,        -602 }, { 34667, 16,       -8974 },
+		{ 34683,  9,           7 }, { 34692,  9,         -99 }, { 34701, 19,       -2819 }, { 34720, 17,       -5018 },
+		{ 34737, 17,       -7117 }, { 34754, 11,       -9056 }, { 34765, 18,      -11000 }, { 34783, 17,        -231 },
+		{ 34800, 11,        -400 }, { 34811, 26,       -5696 }, { 34837, 19,       -2076 }, { 34856, 13,       -6989 },
+		{ 34869, 25,      -30445 }, { 34894, 18,      -30554 }, { 34912, 17,       -5421 }, { 34929,  9,         -98 },
+		{ 34938, 20,      -25298 }, { 34958, 10,         -64 }, { 34968, 26,       -7122 }, { 34994, 14,       -1000 },
+		{ 35008,  9,        -157 }, { 35017, 11,        -606 }, { 35028, 12,      -10057 }, { 35040, 17,      -30421 },
+		{ 35057, 24,        -877 }, { 35081, 26,      -22007 }, { 35107, 10,        -127 }, { 35117, 20,      -13945 },
+		{ 35137, 17,      -25291 }, { 35154, 28,       -8900 }, { 35182, 34,       -9997 }, { 35216, 12,       -3032 },
+		{ 35228, 16,        -433 }, { 35244,  7,          19 }, { 35251, 14,         106 }, { 35265, 20,       -2026 },
+		{ 35285, 24,       -2407 }, { 35309, 16,        -230 }, { 35325, 14,      -10041 }, { 35339, 14,      -32002 },
+		{ 35353, 15,      -25293 }, { 35368, 17,       -8971 }, { 35385, 18,       -8809 }, { 35403, 13,       -5040 },
+		{ 35416, 11,       -5008 }, { 35427, 21,       -2504 }, { 35448, 17,      -30584 }, { 35465, 22,        -437 },
+		{ 35487, 24,       -2041 }, { 35511, 17,      -30365 }, { 35528, 17,        -245 }, { 35545, 22,       -2499 },
+		{ 35567, 15,       -5246 }, { 35582, 20,      -10025 }, { 35602, 14,       -2032 }, { 35616, 10,        -331 },
+		{ 35626, 24,       -5699 }, { 35650, 16,      100004 }, { 35666, 14,       -2115 }, { 35680, 16,       -1854 },
+		{ 35696, 10,          99 }, { 35706,  7,         -41 }, { 35713,  9,       -1301 }, { 35722, 19,       -2140 },
+		{ 35741, 15,      -10040 }, { 35756, 17,       -6975 }, { 35773, 12,        -623 }, { 35785, 19,      100050 },
+		{ 35804, 13,       -5003 }, { 35817, 14,       -3155 }, { 35831, 23,        -145 }, { 35854, 17,      100034 },
+		{ 35871, 17,       -9995 }, { 35888, 23,        -462 }, { 35911, 21,       -1428 }, { 35932, 28,       -9999 },
+		{ 35960, 13,      -10023 }, { 35973, 19,      -32003 }, { 35992, 22,      -32007 }, { 36014, 22,      -13886 },
+		{ 36036, 24,      -14001 }, { 36060, 14,       -4006 }, { 36074, 20,       -1708 }, { 36094, 16,        -175 },
+		{ 36110, 23,       -4191 }, { 36133, 29,       -2524 }, { 36162, 10,       -1279 }, { 36172,  9,         -91 },
+		{ 36181, 13,        -349 }, { 36194, 10,           0 }, { 36204, 18,       -2053 }, { 36222, 15,      -30386 },
+		{ 36237, 23,      100076 }, { 36260,  7,         -80 }, { 36267, 27,      -30583 }, { 36294, 14,        -147 },
+		{ 36308, 17,      100078 }, { 36325,  7,          21 }, { 36332, 19,      -22000 }, { 36351, 28,        -213 },
+		{ 36379,  8,         -27 }, { 36387, 19,      -30773 }, { 36406, 16,      -10000 }, { 36422, 24,       -4205 },
+		{ 36446, 11,        -927 }, { 36457, 15,       -5032 }, { 36472, 10,          84 }, { 36482, 26,       -3026 },
+		{ 36508, 16,       -8970 }, { 36524, 19,        -225 }, { 36543, 21,       -1737 }, { 36564, 19,      -30775 },
+		{ 36583, 12,        -904 }, { 36595, 20,        -460 }, { 36615, 13,       -4207 }, { 36628, 15,       -2522 },
+		{ 36643, 13,       -1401 }, { 36656, 21,      -32013 }, { 36677, 14,       -3178 }, { 36691, 14,       -4003 },
+		{ 36705, 19,       -9081 }, { 36724, 20,       -6998 }, { 36744, 25,       -8770 }, { 36769, 26,       -2145 },
+		{ 36795, 16,      -30524 }, { 36811, 22,       -2081 }, { 36833, 15,       -5248 }, { 36848, 13,        -350 },
+		{ 36861, 17,       -8902 }, { 36878, 17,       -5062 }, { 36895,  8,       32767 }, { 36903, 15,        -250 },
+		{ 36918, 31,      -13006 }, { 36949, 27,      -13882 }, { 36976, 23,      -25340 }, { 36999, 15,       -9078 },
+		{ 37014, 18,       -2700 }, { 37032, 16,       -6969 }, { 37048, 19,       -2755 }, { 37067, 20,      100066 },
+		{ 37087, 10,       -9071 }, { 37097, 25,       -5362 }, { 37122, 11,          26 }, { 37133, 16,      -10060 },
+		{ 37149, 17,       -8762 }, { 37166, 15,      -10031 }, { 37181, 22,      -30446 }, { 37203, 18,       -2113 },
+		{ 37221, 23,      -30343 }, { 37244, 30,       -2760 }, { 37274, 38,       -5601 }, { 37312, 11,        -229 },
+		{ 37323, 17,      100013 }, { 37340, 10,       -5013 }, { 37350, 13,      -10015 }, { 37363, 13,       -5402 },
+		{ 37376, 17,       -9097 }, { 37393,  6,          -8 }, { 37399, 10,       -3278 }, { 37409, 26,       -4997 },
+		{ 37435, 19,      -30370 }, { 37454, 16,       -2710 }, { 37470, 14,       -1704 }, { 37484, 19,      100086 },
+		{ 37503, 26,      -30592 }, { 37529, 30,      -25341 }, { 37559, 25,       -7127 }, { 37584, 16,       -1810 },
+		{ 37600, 19,       -3001 }, { 37619, 17,       -4203 }, { 37636, 17,      -25300 }, { 37653, 13,       -8966 },
+		{ 37666, 18,      -30588 }, { 37684, 11,       -5039 }, { 37695, 23,       -7130 }, { 37718, 29,       -6230 },
+		{ 37747, 20,       -7118 }, { 37767, 22,       -2080 }, { 37789, 23,      -30048 }, { 37812, 16,       -2549 },
+		{ 37828, 14,       -5623 }, { 37842, 13,        -454 }, { 37855, 19,       -3284 }, { 37874, 26,       -4170 },
+		{ 37900, 17,      100021 }, { 37917, 10,       -9066 }, { 37927,  9,        -801 }, { 37936, 12,        -340 },
+		{ 37948, 34,      -25280 }, { 37982, 12,       -6226 }, { 37994, 13,          14 }, { 38007, 14,      -10013 },
+		{ 38021, 18,      100045 }, { 38039, 23,        -438 }, { 38062, 15,       -2851 }, { 38077, 20,       -9102 },
+		{ 38097, 14,      100005 }, { 38111, 18,         -10 }, { 38129, 19,       -2417 }, { 38148,  9,      -13000 },
+		{ 38157, 10,        -199 }, { 38167, 28,      -32020 }, { 38195, 14,        -211 }, { 38209, 14,        -347 },
+		{ 38223, 18,       -2826 }, { 38241, 16,        -232 }, { 38257, 29,      -30444 }, { 38286, 13,        -292 },
+		{ 38299, 16,       -2802 }, { 38315, 21,       -6952 }, { 38336, 12,        -928 }, { 38348, 12,       -3152 },
+		{ 38360, 21,       -5245 }, { 38381, 11,       -5016 }, { 38392, 19,       -2109 }, { 38411, 26,       -1732 },
+		{ 38437, 21,       -9403 }, { 38458, 17,       -2095 }, { 38475, 27,       -4995 }, { 38502, 19,       -2104 },
+		{ 38521, 25,       -1858 }, { 38546, 17,      -10061 }, { 38563, 21,       -2555 }, { 38584, 17,        -813 },
+		{ 38601, 20,      -13935 }, { 38621, 28,       -2138 }, { 38649, 14,          89 }, { 38663, 25,       -5604 },
+		{ 38688, 27,      -29507 }, { 38715, 19,      100067 }, { 38734, 16,        -190 }, { 38750, 20,        -223 },
+		{ 38770, 15,       -5380 }, { 38785, 22,      -30383 }, { 38807,  9,        -152 }, { 38816,  8,        -334 },
+		{ 38824, 16,        -809 }, { 38840, 10,        -621 }, { 38850, 18,      100072 }, { 38868, 27,       -2056 },
+		{ 38895, 24,       -4991 }, { 38919, 19,       -2854 }, { 38938, 13,       -7113 }, { 38951, 27,       -5606 },
+	};
+
+	inline constexpr uint16_t kNameDisplacements[kNameBucketCount] = {
+		    1,     0,    70,    15,    34,    26,   147,   263,    48,     0,     1,    15,
+		   10,     0,     7,     0,    59,     1,     0,     0,     7,     0,    13,   305,
+		   45,     0,     0,    39,   113,     0,    57,     4,    34,    31,     1,     9,
+		  134,   674,    81,     1,    35,    26,    38,    25,   269,     0,    55,     4,
+		   35,   213,    37,     5,     6,    33,    90,    68,    31,   119,     0,     2,
+		    7,    22,    36,   319,     7,    10,    79,    24,     0,     4,    20,     0,
+		   19,     0,    28,     0,    88,     5,    49,     0,    49,    68,     9,    27,
+		   23,     1,    90,    35,    47,     3,    41,     2,    20,     5,     1,     0,
+		   84,   110,     0,    89,   185,    27,    17,   128,    29,    39,    30,    59,
+		   25,     0,   346,    76,     4,     1,    17,    21,   191,     4,   356,   145,
+		    0,     3,     1,   206,     1,    59,     0,   145,     2,    34,    11,     9,
+		    2,     1,    59,     0,     0,   369,     2,    14,   257,     5,    20,     0,
+		   52,   561,   143,    15,   165,    14,   205,   198,    21,   561,     1,     4,
+		   28,   143,     1,    58,     5,    42,   989,   148,   143,    53,    12,    16,
+		    1,    14,    54,   179,     2,    34,     7,   930,    48,     0,     4,    15,
+		   32,    22,    63,     3,    31,   159,     1,    35,    36,    75,     2,     0,
+		    0,   101,    68,   152,    27,    13,    13,    16,    38,     9,   262,     8,
+		  131,   131,    27,   114,     3,    53,   178,  1119,     4,    36,    62,    10,
+		   44,    56,     0,    90,    58,   335,     7,     2,     5,    17,   176,    14,
+		  132,    24,   277,     1,    27,     7,    21,    71,     0,     9,    17,    27,
+		  142,    48,   347,    43,    96,    46,    17,     6,   394,    49,     4,     8,
+		  809,     1,   202,     0,   226,     7,    75,     0,   234,     0,    16,    93,
+		  160,    26,    42,    21,    14,    57,  1060,    22,   251,     1,   358,   347,
+		    4,    59,     3,   167,    14,    13,   430,     4,    64,   323,   492,    81,
+		    3,    78,   260,    35,   159,    42,   137,   125,    30,  1314,   236,     9,
+		    0,   327,   218,    10,     7,   311,   192,     0,    16,    11,    47,     0,
+		 1341,    11,    19,    35,    32,    15,   142,   438,   160,    48,     6,     7,
+		   42,    63,     1,   193,     0,     2,    21,   161,     3,     0,    86,   497,
+		  195,     8,    69,    10,    13,    45,    30,   313,    78,     4,   300,    76,
+		  202,   161,   100,    73,    36,   689,    16,   292,   267,     4,   187,   130,
+		    5,   525,   784,    54,    44,   384,  1752,    23,    86,     1,   399,     2,
+		  228,    38,    10,     0,    58,   115,     1,    13,    41,   119,   218,     3,
+		   53,   265,     1,   446,    33,     0,   645,   826,   266,   632,    41,   137,
+		   95,   797,     1,   336,   505,   807,   192,     6,    52,     1,     4,   173,
+		    7,     3,  1198,   357,  1512,    66,     2,   519,   154,     5,    12,   233,
+		  197,   134,     3,   694,     8,    18,  1048,   553,   217,    19,    21,  2811,
+		  232,    14,     6,  1211,   167,   406,  1929,   382,   556,     3,     5,  1357,
+		   38,    85,   411,   239,   310,     6,     1,     0,    38,     1,     7,   112,
+		 1025,     2,   746,     2,  1712,    58,    15,     1,   290,  1585,    40,     1,
+		   70,   169,     0,    24,    23,    20,   240,    30,     4,  1211,   500,   155,
+		 3011,   419,  1969,   348,     2,   384,   253,   442,    34,     1,    43,    11,
+		   65,     0,   163,   874,   106,     2,    13,  1020,    89,  4630,     0,   527,
+		 4931,     2,    32,    17,     8,    87,   735,     1,    35,     4,     2,   655,
+		  243,     4,    15,  2119,     0,    11,     1,    11,     1,   840,    21,    17,
+		  206,   152,  1103,   364,    68,    14,    91,     2,  3040,     0,     0,   342,
+		  730,  1114,     3,   311,  4025,  4401,    20,  4576,    28,   375,     0,    48,
+		    1,  1450,     3,     3,
+	};
+
+#if defined(__MACERRORSCODES_LOADS__)
+	inline uint64_t
+	NameLoad64(const char *bytes) noexcept
+	{
+		uint64_t word;
+
+		__builtin_memcpy(&word, bytes, sizeof(word));
+	#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+		word = __builtin_bswap64(word);
+	#endif
+		return word;
+	}
+
+	inline uint64_t
+	NameLoad32(const char *bytes) noexcept
+	{
+		uint32_t word;
+
+		__builtin_memcpy(&word, bytes, sizeof(word));
+	#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+		word = __builtin_bswap32(word);
+	#endif
+		return word;
+	}
+
+	/* The first count (1 to 7) bytes, zero-extended, read with at most two overlapping loads. */
+	inline uint64_t
+	NameLoadShort(const char *bytes, size_t count) noexcept
+	{
+		if ( count >= 4 )
+			return NameLoad32(bytes) | NameLoad32(bytes + count - 4) << (8 * (count - 4));
+		return (uint64_t)(unsigned char)bytes[0] |
+			   (uint64_t)(unsigned char)bytes[count / 2] << (8 * (count / 2)) |
+			   (uint64_t)(unsigned char)bytes[count - 1] << (8 * (count - 1));
+	}
+#endif
+
+	/* The index-th 8 bytes of name, little-endian and zero-padded. */
+	constexpr uint64_t
+	NameWord(std::string_view name, size_t index) noexcept
+	{
+		uint64_t word = 0;
+
+#if defined(__MACERRORSCODES_LOADS__)
+		if ( !__builtin_is_constant_evaluated() )
+		{
+			size_t end = 8 * index + 8;
+
+			if ( end <= name.size() )
+				return NameLoad64(name.data() + end - 8);
+			if ( name.size() >= 8 )
+				return NameLoad64(name.data() + name.size() - 8) >> (8 * (end - name.size()));
+			return NameLoadShort(name.data(), name.size());
+		}
+#endif
+		for ( size_t i = 8 * index; i < name.size() && i < 8 * index + 8; ++i )
+			word |= (uint64_t)(unsigned char)name[i] << (8 * (i % 8));
+		return word;
+	}
+
+	/* Must match key_hash() in tools/MacErrorsTable.py. */
+	constexpr uint64_t
+	NameHash(std::string_view name) noexcept
+	{
+		uint64_t hash = name.size() * 0x9E3779B97F4A7C15ull;
+
+		for ( size_t i = 0; i < (name.size() + 7) / 8; ++i )
+		{
+			hash = (hash ^ NameWord(name, i)) * 0xFF51AFD7ED558CCDull;
+			hash ^= hash >> 29;
+		}
+		return hash;
+	}
+
+	/* Must match key_slot() in tools/MacErrorsTable.py. */
+	constexpr size_t
+	NameSlot(uint64_t hash) noexcept
+	{
+		uint64_t    seed = kNameDisplacements[((hash >> 32) * kNameBucketCount) >> 32];
+		uint64_t    x = hash ^ (seed * 0x9E3779B97F4A7C15ull);
+
+		x ^= x >> 33;
+		x *= 0xC4CEB9FE1A85EC53ull;
+		x ^= x >> 33;
+		return (size_t)(((x & 0xFFFFFFFFu) * kNameCount) >> 32);
+	}
+
+#if defined(__MACERRORSCODES_LOADS__)
+	/* Compares length (at least 1) bytes; the last block of each overlaps the one before. */
+	inline bool
+	NameEquals(const char *name, const char *candidate, size_t length) noexcept
+	{
+	#if defined(__MACERRORSCODES_SSE2__) || defined(__MACERRORSCODES_NEON__)
+		if ( length >= 16 )
+		{
+			for ( size_t i = 0; ; i += 16 )
+			{
+				size_t at = (i + 16 < length) ? i : length - 16;
+		#if defined(__MACERRORSCODES_SSE2__)
+				int same = _mm_movemask_epi8(_mm_cmpeq_epi8(
+						   _mm_loadu_si128((const __m128i *)(const void *)(name + at)),
+						   _mm_loadu_si128((const __m128i *)(const void *)(candidate + at))));
+
+				if ( same != 0xFFFF )
+					return false;
+		#else
+				if ( vminvq_u8(vceqq_u8(vld1q_u8((const uint8_t *)(name + at)),
+										vld1q_u8((const uint8_t *)(candidate + at)))) != 0xFF )
+					return false;
+		#endif
+				if ( at + 16 == length )
+					return true;
+			}
+		}
+	#endif
+		if ( length >= 8 )
+		{
+			for ( size_t i = 0; i + 8 < length; i += 8 )
+			{
+				if ( NameLoad64(name + i) != NameLoad64(candidate + i) )
+					return false;
+			}
+			return NameLoad64(name + length - 8) == NameLoad64(candidate + length - 8);
+		}
+		return NameLoadShort(name, length) == NameLoadShort(candidate, length);
+	}
+#endif
+
+} /* namespace Private */
+
+/*
+ *  ErrorCodeOf()
+ *
+ *  Summary:
+ *    Returns the value of a name MacErrors.h defines ("fnfErr", "handlerNotFoundErr",
+ *    or an alias such as "iIOAbortErr"), or std::nullopt if it defines no such name.
+ *    Names are case-sensitive and must match exactly.  Usable in constant expressions.
+ */
+constexpr std::optional<int32_t>
+ErrorCodeOf(std::string_view name) noexcept
+{
+	if ( name.size() > Private::kNameLengthMax )
+		return std::nullopt;
+
+	const Private::NameKey &key = Private::kNameKeys[Private::NameSlot(Private::NameHash(name))];
+
+	if ( key.length != name.size() )
+		return std::nullopt;
+#if defined(__MACERRORSCODES_LOADS__)
+	if ( !__builtin_is_constant_evaluated() )
+		return Private::NameEquals(name.data(), &Private::kNamePool[key.offset], key.length) ?
+			std::optional<int32_t>(key.status) : std::nullopt;
+#endif
+	for ( size_t i = 0; i < key.length; ++i )
+	{
+		if ( name[i] != Private::kNamePool[key.offset + i] )
+			return std::nullopt;
+	}
+	return key.status;
+}
+
+} /* namespace MacErrors */
+
+#endif /* defined(__cplusplus) && (__cplusplus >= 201703L) */
+
+#endif /* __MACERRORSCODES__ */
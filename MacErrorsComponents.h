@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 1985-2008 by Apple Inc.. All rights reserved.
+ *
+ * @APPLE_LICENSE_HEADER_START@
+ * 
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ * 
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ * 
+ * @APPLE_LICENSE_HEADER_END@
+ */
+ 
+/*
+     File:       MacErrorsComponents.h
+ 
+     Contains:   OSErr codes: Component Manager errors.
+ 
+                 MacErrors.h includes this header; include it alone to define only
+                 these codes.  Split from MacErrors.h by tools/MacErrorsSplit.py.
+ 
+     Version:    CarbonCore-769~1
+  
+     Bugs?:      For bug reports, consult the following page on
+                 the World Wide Web:
+ 
+                     http://developer.apple.com/bugreporter/
+ 
+*/
+#ifndef __MACERRORSCOMPONENTS__
+#define __MACERRORSCOMPONENTS__
+
+/*Component Manager & component errors*/
+enum {
+  invalidComponentID            = -3000,
+  validInstancesExist           = -3001,
+  componentNotCaptured          = -3002,
+  componentDontRegister         = -3003,
+  unresolvedComponentDLLErr     = -3004,
+  retryComponentRegistrationErr = -3005
+};
+
+/* ComponentError codes*/
+enum {
+  badComponentInstance          = (long)0x80008001, /* when cast to an OSErr this is -32767*/
+  badComponentSelector          = (long)0x80008002 /* when cast to an OSErr this is -32766*/
+};
+
+#endif /* __MACERRORSCOMPONENTS__ */
+
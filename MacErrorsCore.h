@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 1985-2008 by Apple Inc.. All rights reserved.
+ *
+ * @APPLE_LICENSE_HEADER_START@
+ * 
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ * 
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ * 
+ * @APPLE_LICENSE_HEADER_END@
+ */
+ 
+/*
+     File:       MacErrorsCore.h
+ 
+     Contains:   OSErr codes: general errors and those of the system software core: processes, threads, code fragments and the kernel.
+ 
+                 MacErrors.h includes this header; include it alone to define only
+                 these codes.  Split from MacErrors.h by tools/MacErrorsSplit.py.
+ 
+     Version:    CarbonCore-769~1
+  
+     Bugs?:      For bug reports, consult the following page on
+                 the World Wide Web:
+ 
+                     http://developer.apple.com/bugreporter/
+ 
+*/
+#ifndef __MACERRORSCORE__
+#define __MACERRORSCORE__
+
+#ifndef __CONDITIONALMACROS__
+#include <ConditionalMacros.h>
+#endif
+
+enum {
+  paramErr                      = -50,  /*error in user parameter list*/
+  noHardwareErr                 = -200, /*Sound Manager Error Returns*/
+  notEnoughHardwareErr          = -201, /*Sound Manager Error Returns*/
+  userCanceledErr               = -128,
+  qErr                          = -1,   /*queue element not found during deletion*/
+  vTypErr                       = -2,   /*invalid queue element*/
+  corErr                        = -3,   /*core routine number out of range*/
+  unimpErr                      = -4,   /*unimplemented core routine*/
+  SlpTypeErr                    = -5,   /*invalid queue element*/
+  seNoDB                        = -8,   /*no debugger installed to handle debugger command*/
+  controlErr                    = -17,  /*I/O System Errors*/
+  statusErr                     = -18,  /*I/O System Errors*/
+  readErr                       = -19,  /*I/O System Errors*/
+  writErr                       = -20,  /*I/O System Errors*/
+  badUnitErr                    = -21,  /*I/O System Errors*/
+  unitEmptyErr                  = -22,  /*I/O System Errors*/
+  openErr                       = -23,  /*I/O System Errors*/
+  closErr                       = -24,  /*I/O System Errors*/
+  dRemovErr                     = -25,  /*tried to remove an open driver*/
+  dInstErr                      = -26   /*DrvrInstall couldn't find driver in resources*/
+};
+
+
+enum {
+  nmTypErr                      = -299  /*Notification Manager:wrong queue type*/
+};
+
+enum {
+                                        /*Process Manager errors*/
+  procNotFound                  = -600, /*no eligible process with specified descriptor*/
+  memFragErr                    = -601, /*not enough room to launch app w/special requirements*/
+  appModeErr                    = -602, /*memory mode is 32-bit, but app not 32-bit clean*/
+  protocolErr                   = -603, /*app made module calls in improper order*/
+  hardwareConfigErr             = -604, /*hardware configuration not correct for call*/
+  appMemFullErr                 = -605, /*application SIZE not big enough for launch*/
+  appIsDaemon                   = -606, /*app is BG-only, and launch flags disallow this*/
+  bufferIsSmall                 = -607, /*error returns from Post and Accept */
+  noOutstandingHLE              = -608,
+  connectionInvalid             = -609,
+  noUserInteractionAllowed      = -610  /* no user interaction allowed */
+};
+
+enum {
+                                        /* More Process Manager errors */
+  wrongApplicationPlatform      = -875, /* The application could not launch because the required platform is not available    */
+  appVersionTooOld              = -876, /* The application's creator and version are incompatible with the current version of Mac OS. */
+  notAppropriateForClassic      = -877  /* This application won't or shouldn't run on Classic (Problem 2481058). */
+};
+
+/* Thread Manager Error Codes */
+enum {
+  threadTooManyReqsErr          = -617,
+  threadNotFoundErr             = -618,
+  threadProtocolErr             = -619
+};
+
+enum {
+  threadBadAppContextErr        = -616
+};
+
+
+/*  Kernel Error Codes  */
+enum {
+  kernelIncompleteErr           = -2401,
+  kernelCanceledErr             = -2402,
+  kernelOptionsErr              = -2403,
+  kernelPrivilegeErr            = -2404,
+  kernelUnsupportedErr          = -2405,
+  kernelObjectExistsErr         = -2406,
+  kernelWritePermissionErr      = -2407,
+  kernelReadPermissionErr       = -2408,
+  kernelExecutePermissionErr    = -2409,
+  kernelDeletePermissionErr     = -2410,
+  kernelExecutionLevelErr       = -2411,
+  kernelAttributeErr            = -2412,
+  kernelAsyncSendLimitErr       = -2413,
+  kernelAsyncReceiveLimitErr    = -2414,
+  kernelTimeoutErr              = -2415,
+  kernelInUseErr                = -2416,
+  kernelTerminatedErr           = -2417,
+  kernelExceptionErr            = -2418,
+  kernelIDErr                   = -2419,
+  kernelAlreadyFreeErr          = -2421,
+  kernelReturnValueErr          = -2422,
+  kernelUnrecoverableErr        = -2499
+};
+
+
+enum {
+                                        /* Mixed Mode error codes */
+  mmInternalError               = -2526
+};
+
+
+/* The preferred spelling for Code Fragment Manager errors:*/
+enum {
+  cfragFirstErrCode             = -2800, /* The first value in the range of CFM errors.*/
+  cfragContextIDErr             = -2800, /* The context ID was not valid.*/
+  cfragConnectionIDErr          = -2801, /* The connection ID was not valid.*/
+  cfragNoSymbolErr              = -2802, /* The specified symbol was not found.*/
+  cfragNoSectionErr             = -2803, /* The specified section was not found.*/
+  cfragNoLibraryErr             = -2804, /* The named library was not found.*/
+  cfragDupRegistrationErr       = -2805, /* The registration name was already in use.*/
+  cfragFragmentFormatErr        = -2806, /* A fragment's container format is unknown.*/
+  cfragUnresolvedErr            = -2807, /* A fragment had "hard" unresolved imports.*/
+  cfragNoPositionErr            = -2808, /* The registration insertion point was not found.*/
+  cfragNoPrivateMemErr          = -2809, /* Out of memory for internal bookkeeping.*/
+  cfragNoClientMemErr           = -2810, /* Out of memory for fragment mapping or section instances.*/
+  cfragNoIDsErr                 = -2811, /* No more CFM IDs for contexts, connections, etc.*/
+  cfragInitOrderErr             = -2812, /* */
+  cfragImportTooOldErr          = -2813, /* An import library was too old for a client.*/
+  cfragImportTooNewErr          = -2814, /* An import library was too new for a client.*/
+  cfragInitLoopErr              = -2815, /* Circularity in required initialization order.*/
+  cfragInitAtBootErr            = -2816, /* A boot library has an initialization function.  (System 7 only)*/
+  cfragLibConnErr               = -2817, /* */
+  cfragCFMStartupErr            = -2818, /* Internal error during CFM initialization.*/
+  cfragCFMInternalErr           = -2819, /* An internal inconstistancy has been detected.*/
+  cfragFragmentCorruptErr       = -2820, /* A fragment's container was corrupt (known format).*/
+  cfragInitFunctionErr          = -2821, /* A fragment's initialization routine returned an error.*/
+  cfragNoApplicationErr         = -2822, /* No application member found in the cfrg resource.*/
+  cfragArchitectureErr          = -2823, /* A fragment has an unacceptable architecture.*/
+  cfragFragmentUsageErr         = -2824, /* A semantic error in usage of the fragment.*/
+  cfragFileSizeErr              = -2825, /* A file was too large to be mapped.*/
+  cfragNotClosureErr            = -2826, /* The closure ID was actually a connection ID.*/
+  cfragNoRegistrationErr        = -2827, /* The registration name was not found.*/
+  cfragContainerIDErr           = -2828, /* The fragment container ID was not valid.*/
+  cfragClosureIDErr             = -2829, /* The closure ID was not valid.*/
+  cfragAbortClosureErr          = -2830, /* Used by notification handlers to abort a closure.*/
+  cfragOutputLengthErr          = -2831, /* An output parameter is too small to hold the value.*/
+  cfragMapFileErr               = -2851, /* A file could not be mapped.*/
+  cfragExecFileRefErr           = -2854, /* Bundle does not have valid executable file.*/
+  cfragStdFolderErr             = -2855, /* Could not find standard CFM folder.*/
+  cfragRsrcForkErr              = -2856, /* Resource fork could not be opened.*/
+  cfragCFragRsrcErr             = -2857, /* 'cfrg' resource could not be loaded.*/
+  cfragLastErrCode              = -2899 /* The last value in the range of CFM errors.*/
+};
+
+enum {
+                                        /* Reserved values for internal "warnings".*/
+  cfragFirstReservedCode        = -2897,
+  cfragReservedCode_3           = -2897,
+  cfragReservedCode_2           = -2898,
+  cfragReservedCode_1           = -2899
+};
+
+#if OLDROUTINENAMES
+/* The old spelling for Code Fragment Manager errors, kept for compatibility:*/
+enum {
+  fragContextNotFound           = cfragContextIDErr,
+  fragConnectionIDNotFound      = cfragConnectionIDErr,
+  fragSymbolNotFound            = cfragNoSymbolErr,
+  fragSectionNotFound           = cfragNoSectionErr,
+  fragLibNotFound               = cfragNoLibraryErr,
+  fragDupRegLibName             = cfragDupRegistrationErr,
+  fragFormatUnknown             = cfragFragmentFormatErr,
+  fragHadUnresolveds            = cfragUnresolvedErr,
+  fragNoMem                     = cfragNoPrivateMemErr,
+  fragNoAddrSpace               = cfragNoClientMemErr,
+  fragNoContextIDs              = cfragNoIDsErr,
+  fragObjectInitSeqErr          = cfragInitOrderErr,
+  fragImportTooOld              = cfragImportTooOldErr,
+  fragImportTooNew              = cfragImportTooNewErr,
+  fragInitLoop                  = cfragInitLoopErr,
+  fragInitRtnUsageErr           = cfragInitAtBootErr,
+  fragLibConnErr                = cfragLibConnErr,
+  fragMgrInitErr                = cfragCFMStartupErr,
+  fragConstErr                  = cfragCFMInternalErr,
+  fragCorruptErr                = cfragFragmentCorruptErr,
+  fragUserInitProcErr           = cfragInitFunctionErr,
+  fragAppNotFound               = cfragNoApplicationErr,
+  fragArchError                 = cfragArchitectureErr,
+  fragInvalidFragmentUsage      = cfragFragmentUsageErr,
+  fragLastErrCode               = cfragLastErrCode
+};
+
+#endif  /* OLDROUTINENAMES */
+
+
+/* Core Foundation errors*/
+enum {
+  coreFoundationUnknownErr      = -4960
+};
+
+/* CoreEndian error codes.  These can be returned by Flippers. */
+enum {
+  errCoreEndianDataTooShortForFormat = -4940,
+  errCoreEndianDataTooLongForFormat = -4941,
+  errCoreEndianDataDoesNotMatchFormat = -4942
+};
+
+
+enum {
+                                        /*Gestalt error codes*/
+  gestaltUnknownErr             = -5550, /*value returned if Gestalt doesn't know the answer*/
+  gestaltUndefSelectorErr       = -5551, /*undefined selector was passed to Gestalt*/
+  gestaltDupSelectorErr         = -5552, /*tried to add an entry that already existed*/
+  gestaltLocationErr            = -5553 /*gestalt function ptr wasn't in sysheap*/
+};
+
+enum {
+  errTaskNotFound               = -10780 /* no task with that task id exists */
+};
+
+
+/* Debugging library errors */
+enum {
+  debuggingExecutionContextErr  = -13880, /* routine cannot be called at this time */
+  debuggingDuplicateSignatureErr = -13881, /* componentSignature already registered */
+  debuggingDuplicateOptionErr   = -13882, /* optionSelectorNum already registered */
+  debuggingInvalidSignatureErr  = -13883, /* componentSignature not registered */
+  debuggingInvalidOptionErr     = -13884, /* optionSelectorNum is not registered */
+  debuggingInvalidNameErr       = -13885, /* componentName or optionName is invalid (NULL) */
+  debuggingNoCallbackErr        = -13886, /* debugging component has no callback */
+  debuggingNoMatchErr           = -13887 /* debugging component or option not found at this index */
+};
+
+/* Multiprocessing API error codes*/
+enum {
+  kMPIterationEndErr            = -29275,
+  kMPPrivilegedErr              = -29276,
+  kMPProcessCreatedErr          = -29288,
+  kMPProcessTerminatedErr       = -29289,
+  kMPTaskCreatedErr             = -29290,
+  kMPTaskBlockedErr             = -29291,
+  kMPTaskStoppedErr             = -29292, /* A convention used with MPThrowException.*/
+  kMPBlueBlockingErr            = -29293,
+  kMPDeletedErr                 = -29295,
+  kMPTimeoutErr                 = -29296,
+  kMPTaskAbortedErr             = -29297,
+  kMPInsufficientResourcesErr   = -29298,
+  kMPInvalidIDErr               = -29299
+};
+
+enum {
+  kMPNanokernelNeedsMemoryErr   = -29294
+};
+
+/*
+    Error Codes for C++ Exceptions
+
+        C++ exceptions cannot be thrown across certain boundaries, for example,
+        from an event handler back to the main application.  You may use these
+        error codes to communicate an exception through an API that only supports
+        OSStatus error codes.  Mac OS APIs will never generate these error codes;
+        they are reserved for developer convenience only.
+*/
+enum {
+  errCppGeneral                 = -32000,
+  errCppbad_alloc               = -32001, /* thrown by new */
+  errCppbad_cast                = -32002, /* thrown by dynamic_cast when fails with a referenced type */
+  errCppbad_exception           = -32003, /* thrown when an exception doesn't match any catch */
+  errCppbad_typeid              = -32004, /* thrown by typeid */
+  errCpplogic_error             = -32005,
+  errCppdomain_error            = -32006,
+  errCppinvalid_argument        = -32007,
+  errCpplength_error            = -32008,
+  errCppout_of_range            = -32009,
+  errCppruntime_error           = -32010,
+  errCppoverflow_error          = -32011,
+  errCpprange_error             = -32012,
+  errCppunderflow_error         = -32013,
+  errCppios_base_failure        = -32014,
+  errCppLastSystemDefinedError  = -32020,
+  errCppLastUserDefinedError    = -32049 /* -32021 through -32049 are free for developer-defined exceptions*/
+};
+
+#endif /* __MACERRORSCORE__ */
+
@@ -0,0 +1,118 @@
+/*
+     File:       MacErrorsDatabase.h
+
+     Contains:   Names and descriptions of the OSStatus values defined in MacErrors.h,
+                 read from a database file instead of linked in.
+
+                 MacErrorsLookup.h puts every name and comment in the binary that uses
+                 it.  For small tools, MacErrors.db (built by "make database" and
+                 installed with libCarbonHeaders) holds the same strings in a compact
+                 form: names front-coded, comments encoded against a dictionary of their
+                 common words.  Opening it maps the file read-only and checks its header;
+                 nothing is decompressed up front, and each query decodes only the
+                 strings it returns, so every process shares the same clean pages.
+
+*/
+#ifndef __MACERRORSDATABASE__
+#define __MACERRORSDATABASE__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ *  kMacErrorsDatabasePath
+ *
+ *  Summary:
+ *    Where MacErrorsDatabaseOpen(NULL) looks for the database unless the
+ *    MACERRORS_DATABASE environment variable names another file.
+ */
+#ifndef kMacErrorsDatabasePath
+	#define kMacErrorsDatabasePath "/usr/local/share/CarbonHeaders/MacErrors.db"
+#endif
+
+typedef struct OpaqueMacErrorsDatabase *MacErrorsDatabaseRef;
+
+/*
+ *  MacErrorsDatabaseOpen()
+ *
+ *  Summary:
+ *    Maps a database and returns a reference to it, or NULL (with errno set) if the
+ *    file cannot be mapped or is not a database this version can read.
+ *
+ *  Parameters:
+ *
+ *    path:
+ *      The database to open, or NULL for the default one.
+ */
+extern MacErrorsDatabaseRef
+MacErrorsDatabaseOpen(const char *path);
+
+/*
+ *  MacErrorsDatabaseClose()
+ *
+ *  Summary:
+ *    Unmaps a database.  Strings copied out of it remain valid.
+ */
+extern void
+MacErrorsDatabaseClose(MacErrorsDatabaseRef database);
+
+/*
+ *  MacErrorsDatabaseCountNames()
+ *
+ *  Summary:
+ *    Returns the number of names the database has for an OSStatus value: 0 if it is
+ *    unknown, more than 1 if it has aliases.  Names are ordered as by GetIndMacErrorName().
+ */
+extern uint32_t
+MacErrorsDatabaseCountNames(MacErrorsDatabaseRef database, int32_t status);
+
+/*
+ *  MacErrorsDatabaseCopyName()
+ *
+ *  Summary:
+ *    Copies the index-th name of an OSStatus value into a buffer, truncating it and
+ *    always terminating it if the buffer is not empty.  Returns the length of the whole
+ *    name, as strlcpy() does, or 0 if there is no such name.
+ *
+ *  Parameters:
+ *
+ *    database:
+ *      The database to search.
+ *
+ *    status:
+ *      The value to look up.
+ *
+ *    index:
+ *      Which of its names to copy; 0 is the one GetMacErrorName() returns.
+ *
+ *    buffer:
+ *      Receives the name.
+ *
+ *    bufferSize:
+ *      The size of buffer in bytes, which may be 0.
+ */
+extern size_t
+MacErrorsDatabaseCopyName(MacErrorsDatabaseRef database, int32_t status, uint32_t index,
+						  char *buffer, size_t bufferSize);
+
+/*
+ *  MacErrorsDatabaseCopyComment()
+ *
+ *  Summary:
+ *    Copies the description of an OSStatus value, the first comment among its names as
+ *    with GetMacErrorComment(), the way MacErrorsDatabaseCopyName() copies a name.
+ *    Returns 0 if there is none.
+ */
+extern size_t
+MacErrorsDatabaseCopyComment(MacErrorsDatabaseRef database, int32_t status,
+							 char *buffer, size_t bufferSize);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MACERRORSDATABASE__ */
@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) 1985-2008 by Apple Inc.. All rights reserved.
+ *
+ * @APPLE_LICENSE_HEADER_START@
+ * 
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ * 
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ * 
+ * @APPLE_LICENSE_HEADER_END@
+ */
+ 
+/*
+     File:       MacErrorsDevices.h
+ 
+     Contains:   OSErr codes: device and expansion bus errors: slots, PC Card, USB, HID and power management.
+ 
+                 MacErrors.h includes this header; include it alone to define only
+                 these codes.  Split from MacErrors.h by tools/MacErrorsSplit.py.
+ 
+     Version:    CarbonCore-769~1
+  
+     Bugs?:      For bug reports, consult the following page on
+                 the World Wide Web:
+ 
+                     http://developer.apple.com/bugreporter/
+ 
+*/
+#ifndef __MACERRORSDEVICES__
+#define __MACERRORSDEVICES__
+
+enum {
+  smSDMInitErr                  = -290, /*Error; SDM could not be initialized.*/
+  smSRTInitErr                  = -291, /*Error; Slot Resource Table could not be initialized.*/
+  smPRAMInitErr                 = -292, /*Error; Slot Resource Table could not be initialized.*/
+  smPriInitErr                  = -293, /*Error; Cards could not be initialized.*/
+  smEmptySlot                   = -300, /*No card in slot*/
+  smCRCFail                     = -301, /*CRC check failed for declaration data*/
+  smFormatErr                   = -302, /*FHeader Format is not Apple's*/
+  smRevisionErr                 = -303, /*Wrong revison level*/
+  smNoDir                       = -304, /*Directory offset is Nil*/
+  smDisabledSlot                = -305, /*This slot is disabled (-305 use to be smLWTstBad)*/
+  smNosInfoArray                = -306  /*No sInfoArray. Memory Mgr error.*/
+};
+
+
+enum {
+  smResrvErr                    = -307, /*Fatal reserved error. Resreved field <> 0.*/
+  smUnExBusErr                  = -308, /*Unexpected BusError*/
+  smBLFieldBad                  = -309, /*ByteLanes field was bad.*/
+  smFHBlockRdErr                = -310, /*Error occurred during _sGetFHeader.*/
+  smFHBlkDispErr                = -311, /*Error occurred during _sDisposePtr (Dispose of FHeader block).*/
+  smDisposePErr                 = -312, /*_DisposePointer error*/
+  smNoBoardSRsrc                = -313, /*No Board sResource.*/
+  smGetPRErr                    = -314, /*Error occurred during _sGetPRAMRec (See SIMStatus).*/
+  smNoBoardId                   = -315, /*No Board Id.*/
+  smInitStatVErr                = -316, /*The InitStatusV field was negative after primary or secondary init.*/
+  smInitTblVErr                 = -317, /*An error occurred while trying to initialize the Slot Resource Table.*/
+  smNoJmpTbl                    = -318, /*SDM jump table could not be created.*/
+  smReservedSlot                = -318, /*slot is reserved, VM should not use this address space.*/
+  smBadBoardId                  = -319, /*BoardId was wrong; re-init the PRAM record.*/
+  smBusErrTO                    = -320, /*BusError time out.*/
+                                        /* These errors are logged in the  vendor status field of the sInfo record. */
+  svTempDisable                 = -32768L, /*Temporarily disable card but run primary init.*/
+  svDisabled                    = -32640, /*Reserve range -32640 to -32768 for Apple temp disables.*/
+  smBadRefId                    = -330, /*Reference Id not found in List*/
+  smBadsList                    = -331, /*Bad sList: Id1 < Id2 < Id3 ...format is not followed.*/
+  smReservedErr                 = -332, /*Reserved field not zero*/
+  smCodeRevErr                  = -333  /*Code revision is wrong*/
+};
+
+enum {
+  smCPUErr                      = -334, /*Code revision is wrong*/
+  smsPointerNil                 = -335, /*LPointer is nil From sOffsetData. If this error occurs; check sInfo rec for more information.*/
+  smNilsBlockErr                = -336, /*Nil sBlock error (Don't allocate and try to use a nil sBlock)*/
+  smSlotOOBErr                  = -337, /*Slot out of bounds error*/
+  smSelOOBErr                   = -338, /*Selector out of bounds error*/
+  smNewPErr                     = -339, /*_NewPtr error*/
+  smBlkMoveErr                  = -340, /*_BlockMove error*/
+  smCkStatusErr                 = -341, /*Status of slot = fail.*/
+  smGetDrvrNamErr               = -342, /*Error occurred during _sGetDrvrName.*/
+  smDisDrvrNamErr               = -343, /*Error occurred during _sDisDrvrName.*/
+  smNoMoresRsrcs                = -344, /*No more sResources*/
+  smsGetDrvrErr                 = -345, /*Error occurred during _sGetDriver.*/
+  smBadsPtrErr                  = -346, /*Bad pointer was passed to sCalcsPointer*/
+  smByteLanesErr                = -347, /*NumByteLanes was determined to be zero.*/
+  smOffsetErr                   = -348, /*Offset was too big (temporary error*/
+  smNoGoodOpens                 = -349, /*No opens were successfull in the loop.*/
+  smSRTOvrFlErr                 = -350, /*SRT over flow.*/
+  smRecNotFnd                   = -351  /*Record not found in the SRT.*/
+};
+
+/* NameRegistry error codes */
+enum {
+  nrLockedErr                   = -2536,
+  nrNotEnoughMemoryErr          = -2537,
+  nrInvalidNodeErr              = -2538,
+  nrNotFoundErr                 = -2539,
+  nrNotCreatedErr               = -2540,
+  nrNameErr                     = -2541,
+  nrNotSlotDeviceErr            = -2542,
+  nrDataTruncatedErr            = -2543,
+  nrPowerErr                    = -2544,
+  nrPowerSwitchAbortErr         = -2545,
+  nrTypeMismatchErr             = -2546,
+  nrNotModifiedErr              = -2547,
+  nrOverrunErr                  = -2548,
+  nrResultCodeBase              = -2549,
+  nrPathNotFound                = -2550, /* a path component lookup failed */
+  nrPathBufferTooSmall          = -2551, /* buffer for path is too small */
+  nrInvalidEntryIterationOp     = -2552, /* invalid entry iteration operation */
+  nrPropertyAlreadyExists       = -2553, /* property already exists */
+  nrIterationDone               = -2554, /* iteration operation is done */
+  nrExitedIteratorScope         = -2555, /* outer scope of iterator was exited */
+  nrTransactionAborted          = -2556, /* transaction was aborted */
+  nrCallNotSupported            = -2557 /* This call is not available or supported on this machine */
+};
+
+
+enum {
+  kUSBNoErr                     = 0,
+  kUSBNoTran                    = 0,
+  kUSBNoDelay                   = 0,
+  kUSBPending                   = 1
+};
+
+/*
+   
+   USB Hardware Errors 
+   Note pipe stalls are communication 
+   errors. The affected pipe can not 
+   be used until USBClearPipeStallByReference  
+   is used.
+   kUSBEndpointStallErr is returned in 
+   response to a stall handshake 
+   from a device. The device has to be 
+   cleared before a USBClearPipeStallByReference 
+   can be used.
+*/
+enum {
+  kUSBNotSent2Err               = -6901, /*  Transaction not sent */
+  kUSBNotSent1Err               = -6902, /*  Transaction not sent */
+  kUSBBufUnderRunErr            = -6903, /*  Host hardware failure on data out, PCI busy? */
+  kUSBBufOvrRunErr              = -6904, /*  Host hardware failure on data in, PCI busy? */
+  kUSBRes2Err                   = -6905,
+  kUSBRes1Err                   = -6906,
+  kUSBUnderRunErr               = -6907, /*  Less data than buffer */
+  kUSBOverRunErr                = -6908, /*  Packet too large or more data than buffer */
+  kUSBWrongPIDErr               = -6909, /*  Pipe stall, Bad or wrong PID */
+  kUSBPIDCheckErr               = -6910, /*  Pipe stall, PID CRC error */
+  kUSBNotRespondingErr          = -6911, /*  Pipe stall, No device, device hung */
+  kUSBEndpointStallErr          = -6912, /*  Device didn't understand */
+  kUSBDataToggleErr             = -6913, /*  Pipe stall, Bad data toggle */
+  kUSBBitstufErr                = -6914, /*  Pipe stall, bitstuffing */
+  kUSBCRCErr                    = -6915, /*  Pipe stall, bad CRC */
+  kUSBLinkErr                   = -6916
+};
+
+
+/*
+   
+   USB Manager Errors 
+*/
+enum {
+  kUSBQueueFull                 = -6948, /* Internal queue maxxed  */
+  kUSBNotHandled                = -6987, /* Notification was not handled   (same as NotFound)*/
+  kUSBUnknownNotification       = -6949, /* Notification type not defined  */
+  kUSBBadDispatchTable          = -6950 /* Improper driver dispatch table     */
+};
+
+
+/*
+   USB internal errors are in range -6960 to -6951
+   please do not use this range
+   
+*/
+enum {
+  kUSBInternalReserved10        = -6951,
+  kUSBInternalReserved9         = -6952,
+  kUSBInternalReserved8         = -6953,
+  kUSBInternalReserved7         = -6954,
+  kUSBInternalReserved6         = -6955,
+  kUSBInternalReserved5         = -6956,
+  kUSBInternalReserved4         = -6957,
+  kUSBInternalReserved3         = -6958,
+  kUSBInternalReserved2         = -6959,
+  kUSBInternalReserved1         = -6960 /* reserved*/
+};
+
+/* USB Services Errors */
+enum {
+  kUSBPortDisabled              = -6969, /* The port you are attached to is disabled, use USBDeviceReset.*/
+  kUSBQueueAborted              = -6970, /* Pipe zero stall cleared.*/
+  kUSBTimedOut                  = -6971, /* Transaction timed out. */
+  kUSBDeviceDisconnected        = -6972, /* Disconnected during suspend or reset */
+  kUSBDeviceNotSuspended        = -6973, /* device is not suspended for resume */
+  kUSBDeviceSuspended           = -6974, /* Device is suspended */
+  kUSBInvalidBuffer             = -6975, /* bad buffer, usually nil */
+  kUSBDevicePowerProblem        = -6976, /*  Device has a power problem */
+  kUSBDeviceBusy                = -6977, /*  Device is already being configured */
+  kUSBUnknownInterfaceErr       = -6978, /*  Interface ref not recognised */
+  kUSBPipeStalledError          = -6979, /*  Pipe has stalled, error needs to be cleared */
+  kUSBPipeIdleError             = -6980, /*  Pipe is Idle, it will not accept transactions */
+  kUSBNoBandwidthError          = -6981, /*  Not enough bandwidth available */
+  kUSBAbortedError              = -6982, /*  Pipe aborted */
+  kUSBFlagsError                = -6983, /*  Unused flags not zeroed */
+  kUSBCompletionError           = -6984, /*  no completion routine specified */
+  kUSBPBLengthError             = -6985, /*  pbLength too small */
+  kUSBPBVersionError            = -6986, /*  Wrong pbVersion */
+  kUSBNotFound                  = -6987, /*  Not found */
+  kUSBOutOfMemoryErr            = -6988, /*  Out of memory */
+  kUSBDeviceErr                 = -6989, /*  Device error */
+  kUSBNoDeviceErr               = -6990, /*  No device*/
+  kUSBAlreadyOpenErr            = -6991, /*  Already open */
+  kUSBTooManyTransactionsErr    = -6992, /*  Too many transactions */
+  kUSBUnknownRequestErr         = -6993, /*  Unknown request */
+  kUSBRqErr                     = -6994, /*  Request error */
+  kUSBIncorrectTypeErr          = -6995, /*  Incorrect type */
+  kUSBTooManyPipesErr           = -6996, /*  Too many pipes */
+  kUSBUnknownPipeErr            = -6997, /*  Pipe ref not recognised */
+  kUSBUnknownDeviceErr          = -6998, /*  device ref not recognised */
+  kUSBInternalErr               = -6999 /* Internal error */
+};
+
+
+/* PCCard error codes */
+enum {
+  kBadAdapterErr                = -9050, /* invalid adapter number*/
+  kBadAttributeErr              = -9051, /* specified attributes field value is invalid*/
+  kBadBaseErr                   = -9052, /* specified base system memory address is invalid*/
+  kBadEDCErr                    = -9053, /* specified EDC generator specified is invalid*/
+  kBadIRQErr                    = -9054, /* specified IRQ level is invalid*/
+  kBadOffsetErr                 = -9055, /* specified PC card memory array offset is invalid*/
+  kBadPageErr                   = -9056, /* specified page is invalid*/
+  kBadSizeErr                   = -9057, /* specified size is invalid*/
+  kBadSocketErr                 = -9058, /* specified logical or physical socket number is invalid*/
+  kBadTypeErr                   = -9059, /* specified window or interface type is invalid*/
+  kBadVccErr                    = -9060, /* specified Vcc power level index is invalid*/
+  kBadVppErr                    = -9061, /* specified Vpp1 or Vpp2 power level index is invalid*/
+  kBadWindowErr                 = -9062, /* specified window is invalid*/
+  kBadArgLengthErr              = -9063, /* ArgLength argument is invalid*/
+  kBadArgsErr                   = -9064, /* values in argument packet are invalid*/
+  kBadHandleErr                 = -9065, /* clientHandle is invalid*/
+  kBadCISErr                    = -9066, /* CIS on card is invalid*/
+  kBadSpeedErr                  = -9067, /* specified speed is unavailable*/
+  kReadFailureErr               = -9068, /* unable to complete read request*/
+  kWriteFailureErr              = -9069, /* unable to complete write request*/
+  kGeneralFailureErr            = -9070, /* an undefined error has occurred*/
+  kNoCardErr                    = -9071, /* no PC card in the socket*/
+  kUnsupportedFunctionErr       = -9072, /* function is not supported by this implementation*/
+  kUnsupportedModeErr           = -9073, /* mode is not supported*/
+  kBusyErr                      = -9074, /* unable to process request at this time - try later*/
+  kWriteProtectedErr            = -9075, /* media is write-protected*/
+  kConfigurationLockedErr       = -9076, /* a configuration has already been locked*/
+  kInUseErr                     = -9077, /* requested resource is being used by a client*/
+  kNoMoreItemsErr               = -9078, /* there are no more of the requested item*/
+  kOutOfResourceErr             = -9079, /* Card Services has exhausted the resource*/
+  kNoCardSevicesSocketsErr      = -9080,
+  kInvalidRegEntryErr           = -9081,
+  kBadLinkErr                   = -9082,
+  kBadDeviceErr                 = -9083,
+  k16BitCardErr                 = -9084,
+  kCardBusCardErr               = -9085,
+  kPassCallToChainErr           = -9086,
+  kCantConfigureCardErr         = -9087,
+  kPostCardEventErr             = -9088, /* _PCCSLPostCardEvent failed and dropped an event */
+  kInvalidDeviceNumber          = -9089,
+  kUnsupportedVsErr             = -9090, /* Unsupported Voltage Sense */
+  kInvalidCSClientErr           = -9091, /* Card Services ClientID is not registered */
+  kBadTupleDataErr              = -9092, /* Data in tuple is invalid */
+  kBadCustomIFIDErr             = -9093, /* Custom interface ID is invalid */
+  kNoIOWindowRequestedErr       = -9094, /* Request I/O window before calling configuration */
+  kNoMoreTimerClientsErr        = -9095, /* All timer callbacks are in use */
+  kNoMoreInterruptSlotsErr      = -9096, /* All internal Interrupt slots are in use */
+  kNoClientTableErr             = -9097, /* The client table has not be initialized yet */
+  kUnsupportedCardErr           = -9098, /* Card not supported by generic enabler*/
+  kNoCardEnablersFoundErr       = -9099, /* No Enablers were found*/
+  kNoEnablerForCardErr          = -9100, /* No Enablers were found that can support the card*/
+  kNoCompatibleNameErr          = -9101, /* There is no compatible driver name for this device*/
+  kClientRequestDenied          = -9102, /* CS Clients should return this code inorder to */
+                                        /*   deny a request-type CS Event                */
+  kNotReadyErr                  = -9103, /* PC Card failed to go ready */
+  kTooManyIOWindowsErr          = -9104, /* device requested more than one I/O window */
+  kAlreadySavedStateErr         = -9105, /* The state has been saved on previous call */
+  kAttemptDupCardEntryErr       = -9106, /* The Enabler was asked to create a duplicate card entry */
+  kCardPowerOffErr              = -9107, /* Power to the card has been turned off */
+  kNotZVCapableErr              = -9108, /* This socket does not support Zoomed Video */
+  kNoCardBusCISErr              = -9109 /* No valid CIS exists for this CardBus card */
+};
+
+
+/* Video driver Errorrs -10930 to -10959 */
+/* Defined in video.h. */
+
+enum {
+                                        /*Power Manager Errors*/
+  pmBusyErr                     = -13000, /*Power Mgr never ready to start handshake*/
+  pmReplyTOErr                  = -13001, /*Timed out waiting for reply*/
+  pmSendStartErr                = -13002, /*during send, pmgr did not start hs*/
+  pmSendEndErr                  = -13003, /*during send, pmgr did not finish hs*/
+  pmRecvStartErr                = -13004, /*during receive, pmgr did not start hs*/
+  pmRecvEndErr                  = -13005 /*during receive, pmgr did not finish hs configured for this connection*/
+};
+
+/*Power Manager 2.0 Errors*/
+enum {
+  kPowerHandlerExistsForDeviceErr = -13006,
+  kPowerHandlerNotFoundForDeviceErr = -13007,
+  kPowerHandlerNotFoundForProcErr = -13008,
+  kPowerMgtMessageNotHandled    = -13009,
+  kPowerMgtRequestDenied        = -13010,
+  kCantReportProcessorTemperatureErr = -13013,
+  kProcessorTempRoutineRequiresMPLib2 = -13014,
+  kNoSuchPowerSource            = -13020,
+  kBridgeSoftwareRunningCantSleep = -13038
+};
+
+
+/* HID device driver error codes */
+enum {
+  kHIDVersionIncompatibleErr    = -13909,
+  kHIDDeviceNotReady            = -13910 /* The device is still initializing, try again later*/
+};
+
+
+/* HID error codes */
+enum {
+  kHIDSuccess                   = 0,
+  kHIDInvalidRangePageErr       = -13923,
+  kHIDReportIDZeroErr           = -13924,
+  kHIDReportCountZeroErr        = -13925,
+  kHIDReportSizeZeroErr         = -13926,
+  kHIDUnmatchedDesignatorRangeErr = -13927,
+  kHIDUnmatchedStringRangeErr   = -13928,
+  kHIDInvertedUsageRangeErr     = -13929,
+  kHIDUnmatchedUsageRangeErr    = -13930,
+  kHIDInvertedPhysicalRangeErr  = -13931,
+  kHIDInvertedLogicalRangeErr   = -13932,
+  kHIDBadLogicalMaximumErr      = -13933,
+  kHIDBadLogicalMinimumErr      = -13934,
+  kHIDUsagePageZeroErr          = -13935,
+  kHIDEndOfDescriptorErr        = -13936,
+  kHIDNotEnoughMemoryErr        = -13937,
+  kHIDBadParameterErr           = -13938,
+  kHIDNullPointerErr            = -13939,
+  kHIDInvalidReportLengthErr    = -13940,
+  kHIDInvalidReportTypeErr      = -13941,
+  kHIDBadLogPhysValuesErr       = -13942,
+  kHIDIncompatibleReportErr     = -13943,
+  kHIDInvalidPreparsedDataErr   = -13944,
+  kHIDNotValueArrayErr          = -13945,
+  kHIDUsageNotFoundErr          = -13946,
+  kHIDValueOutOfRangeErr        = -13947,
+  kHIDBufferTooSmallErr         = -13948,
+  kHIDNullStateErr              = -13949,
+  kHIDBaseError                 = -13950
+};
+
+
+/* InputSprockets error codes */
+enum {
+  kISpInternalErr               = -30420,
+  kISpSystemListErr             = -30421,
+  kISpBufferToSmallErr          = -30422,
+  kISpElementInListErr          = -30423,
+  kISpElementNotInListErr       = -30424,
+  kISpSystemInactiveErr         = -30425,
+  kISpDeviceInactiveErr         = -30426,
+  kISpSystemActiveErr           = -30427,
+  kISpDeviceActiveErr           = -30428,
+  kISpListBusyErr               = -30429
+};
+
+#endif /* __MACERRORSDEVICES__ */
+
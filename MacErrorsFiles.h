@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 1985-2008 by Apple Inc.. All rights reserved.
+ *
+ * @APPLE_LICENSE_HEADER_START@
+ * 
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ * 
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ * 
+ * @APPLE_LICENSE_HEADER_END@
+ */
+ 
+/*
+     File:       MacErrorsFiles.h
+ 
+     Contains:   OSErr codes: core I/O errors: the File Manager, disk drivers, resources and file services.
+ 
+                 MacErrors.h includes this header; include it alone to define only
+                 these codes.  Split from MacErrors.h by tools/MacErrorsSplit.py.
+ 
+     Version:    CarbonCore-769~1
+  
+     Bugs?:      For bug reports, consult the following page on
+                 the World Wide Web:
+ 
+                     http://developer.apple.com/bugreporter/
+ 
+*/
+#ifndef __MACERRORSFILES__
+#define __MACERRORSFILES__
+
+enum {
+  abortErr                      = -27,  /*IO call aborted by KillIO*/
+  iIOAbortErr                   = -27,  /*IO abort error (Printing Manager)*/
+  notOpenErr                    = -28,  /*Couldn't rd/wr/ctl/sts cause driver not opened*/
+  unitTblFullErr                = -29,  /*unit table has no more entries*/
+  dceExtErr                     = -30,  /*dce extension error*/
+  slotNumErr                    = -360, /*invalid slot # error*/
+  gcrOnMFMErr                   = -400, /*gcr format on high density media error*/
+  dirFulErr                     = -33,  /*Directory full*/
+  dskFulErr                     = -34,  /*disk full*/
+  nsvErr                        = -35,  /*no such volume*/
+  ioErr                         = -36,  /*I/O error (bummers)*/
+  bdNamErr                      = -37,  /* bad file name passed to routine; there may be no bad names in the final system!*/
+  fnOpnErr                      = -38,  /*File not open*/
+  eofErr                        = -39,  /*End of file*/
+  posErr                        = -40,  /*tried to position to before start of file (r/w)*/
+  mFulErr                       = -41,  /*memory full (open) or file won't fit (load)*/
+  tmfoErr                       = -42,  /*too many files open*/
+  fnfErr                        = -43,  /*File not found*/
+  wPrErr                        = -44,  /*diskette is write protected.*/
+  fLckdErr                      = -45   /*file is locked*/
+};
+
+enum {
+  vLckdErr                      = -46,  /*volume is locked*/
+  fBsyErr                       = -47,  /*File is busy (delete)*/
+  dupFNErr                      = -48,  /*duplicate filename (rename)*/
+  opWrErr                       = -49,  /*file already open with with write permission*/
+  rfNumErr                      = -51,  /*refnum error*/
+  gfpErr                        = -52,  /*get file position error*/
+  volOffLinErr                  = -53,  /*volume not on line error (was Ejected)*/
+  permErr                       = -54,  /*permissions error (on file open)*/
+  volOnLinErr                   = -55,  /*drive volume already on-line at MountVol*/
+  nsDrvErr                      = -56,  /*no such drive (tried to mount a bad drive num)*/
+  noMacDskErr                   = -57,  /*not a mac diskette (sig bytes are wrong)*/
+  extFSErr                      = -58,  /*volume in question belongs to an external fs*/
+  fsRnErr                       = -59,  /*file system internal error:during rename the old entry was deleted but could not be restored.*/
+  badMDBErr                     = -60,  /*bad master directory block*/
+  wrPermErr                     = -61,  /*write permissions error*/
+  dirNFErr                      = -120, /*Directory not found*/
+  tmwdoErr                      = -121, /*No free WDCB available*/
+  badMovErr                     = -122, /*Move into offspring error*/
+  wrgVolTypErr                  = -123, /*Wrong volume type error [operation not supported for MFS]*/
+  volGoneErr                    = -124  /*Server volume has been disconnected.*/
+};
+
+enum {
+  fidNotFound                   = -1300, /*no file thread exists.*/
+  fidExists                     = -1301, /*file id already exists*/
+  notAFileErr                   = -1302, /*directory specified*/
+  diffVolErr                    = -1303, /*files on different volumes*/
+  catChangedErr                 = -1304, /*the catalog has been modified*/
+  desktopDamagedErr             = -1305, /*desktop database files are corrupted*/
+  sameFileErr                   = -1306, /*can't exchange a file with itself*/
+  badFidErr                     = -1307, /*file id is dangling or doesn't match with the file number*/
+  notARemountErr                = -1308, /*when _Mount allows only remounts and doesn't get one*/
+  fileBoundsErr                 = -1309, /*file's EOF, offset, mark or size is too big*/
+  fsDataTooBigErr               = -1310, /*file or volume is too big for system*/
+  volVMBusyErr                  = -1311, /*can't eject because volume is in use by VM*/
+  badFCBErr                     = -1327, /*FCBRecPtr is not valid*/
+  errFSUnknownCall              = -1400, /* selector is not recognized by this filesystem */
+  errFSBadFSRef                 = -1401, /* FSRef parameter is bad */
+  errFSBadForkName              = -1402, /* Fork name parameter is bad */
+  errFSBadBuffer                = -1403, /* A buffer parameter was bad */
+  errFSBadForkRef               = -1404, /* A ForkRefNum parameter was bad */
+  errFSBadInfoBitmap            = -1405, /* A CatalogInfoBitmap or VolumeInfoBitmap has reserved or invalid bits set */
+  errFSMissingCatInfo           = -1406, /* A CatalogInfo parameter was NULL */
+  errFSNotAFolder               = -1407, /* Expected a folder, got a file */
+  errFSForkNotFound             = -1409, /* Named fork does not exist */
+  errFSNameTooLong              = -1410, /* File/fork name is too long to create/rename */
+  errFSMissingName              = -1411, /* A Unicode name parameter was NULL or nameLength parameter was zero */
+  errFSBadPosMode               = -1412, /* Newline bits set in positionMode */
+  errFSBadAllocFlags            = -1413, /* Invalid bits set in allocationFlags */
+  errFSNoMoreItems              = -1417, /* Iteration ran out of items to return */
+  errFSBadItemCount             = -1418, /* maximumItems was zero */
+  errFSBadSearchParams          = -1419, /* Something wrong with CatalogSearch searchParams */
+  errFSRefsDifferent            = -1420, /* FSCompareFSRefs; refs are for different objects */
+  errFSForkExists               = -1421, /* Named fork already exists. */
+  errFSBadIteratorFlags         = -1422, /* Flags passed to FSOpenIterator are bad */
+  errFSIteratorNotFound         = -1423, /* Passed FSIterator is not an open iterator */
+  errFSIteratorNotSupported     = -1424, /* The iterator's flags or container are not supported by this call */
+  errFSQuotaExceeded            = -1425, /* The user's quota of disk blocks has been exhausted. */
+  errFSOperationNotSupported    = -1426, /* The attempted operation is not supported */
+  errFSAttributeNotFound        = -1427, /* The requested attribute does not exist */
+  errFSPropertyNotValid         = -1428, /* The requested property is not valid (has not been set yet) */
+  errFSNotEnoughSpaceForOperation = -1429, /* There is not enough disk space to perform the requested operation */
+  envNotPresent                 = -5500, /*returned by glue.*/
+  envBadVers                    = -5501, /*Version non-positive*/
+  envVersTooBig                 = -5502, /*Version bigger than call can handle*/
+  fontDecError                  = -64,  /*error during font declaration*/
+  fontNotDeclared               = -65,  /*font not declared*/
+  fontSubErr                    = -66,  /*font substitution occurred*/
+  fontNotOutlineErr             = -32615, /*bitmap font passed to routine that does outlines only*/
+  firstDskErr                   = -84,  /*I/O System Errors*/
+  lastDskErr                    = -64,  /*I/O System Errors*/
+  noDriveErr                    = -64,  /*drive not installed*/
+  offLinErr                     = -65,  /*r/w requested for an off-line drive*/
+  noNybErr                      = -66   /*couldn't find 5 nybbles in 200 tries*/
+};
+
+enum {
+  noAdrMkErr                    = -67,  /*couldn't find valid addr mark*/
+  dataVerErr                    = -68,  /*read verify compare failed*/
+  badCksmErr                    = -69,  /*addr mark checksum didn't check*/
+  badBtSlpErr                   = -70,  /*bad addr mark bit slip nibbles*/
+  noDtaMkErr                    = -71,  /*couldn't find a data mark header*/
+  badDCksum                     = -72,  /*bad data mark checksum*/
+  badDBtSlp                     = -73,  /*bad data mark bit slip nibbles*/
+  wrUnderrun                    = -74,  /*write underrun occurred*/
+  cantStepErr                   = -75,  /*step handshake failed*/
+  tk0BadErr                     = -76,  /*track 0 detect doesn't change*/
+  initIWMErr                    = -77,  /*unable to initialize IWM*/
+  twoSideErr                    = -78,  /*tried to read 2nd side on a 1-sided drive*/
+  spdAdjErr                     = -79,  /*unable to correctly adjust disk speed*/
+  seekErr                       = -80,  /*track number wrong on address mark*/
+  sectNFErr                     = -81,  /*sector number never found on a track*/
+  fmt1Err                       = -82,  /*can't find sector 0 after track format*/
+  fmt2Err                       = -83,  /*can't get enough sync*/
+  verErr                        = -84,  /*track failed to verify*/
+  clkRdErr                      = -85,  /*unable to read same clock value twice*/
+  clkWrErr                      = -86,  /*time written did not verify*/
+  prWrErr                       = -87,  /*parameter ram written didn't read-verify*/
+  prInitErr                     = -88,  /*InitUtil found the parameter ram uninitialized*/
+  rcvrErr                       = -89,  /*SCC receiver error (framing; parity; OR)*/
+  breakRecd                     = -90   /*Break received (SCC)*/
+};
+
+
+enum {
+  resourceInMemory              = -188, /*Resource already in memory*/
+  writingPastEnd                = -189, /*Writing past end of file*/
+  inputOutOfBounds              = -190, /*Offset of Count out of bounds*/
+  resNotFound                   = -192, /*Resource not found*/
+  resFNotFound                  = -193, /*Resource file not found*/
+  addResFailed                  = -194, /*AddResource failed*/
+  addRefFailed                  = -195, /*AddReference failed*/
+  rmvResFailed                  = -196, /*RmveResource failed*/
+  rmvRefFailed                  = -197, /*RmveReference failed*/
+  resAttrErr                    = -198, /*attribute inconsistent with operation*/
+  mapReadErr                    = -199, /*map inconsistent with operation*/
+  CantDecompress                = -186, /*resource bent ("the bends") - can't decompress a compressed resource*/
+  badExtResource                = -185, /*extended resource has a bad format.*/
+  noMemForPictPlaybackErr       = -145,
+  rgnOverflowErr                = -147,
+  rgnTooBigError                = -147,
+  pixMapTooDeepErr              = -148,
+  insufficientStackErr          = -149,
+  nsStackErr                    = -149
+};
+
+
+/*
+ * Error codes from FSM functions
+ */
+enum {
+  fsmFFSNotFoundErr             = -431, /* Foreign File system does not exist - new Pack2 could return this error too */
+  fsmBusyFFSErr                 = -432, /* File system is busy, cannot be removed */
+  fsmBadFFSNameErr              = -433, /* Name length not 1 <= length <= 31 */
+  fsmBadFSDLenErr               = -434, /* FSD size incompatible with current FSM vers */
+  fsmDuplicateFSIDErr           = -435, /* FSID already exists on InstallFS */
+  fsmBadFSDVersionErr           = -436, /* FSM version incompatible with FSD */
+  fsmNoAlternateStackErr        = -437, /* no alternate stack for HFS CI */
+  fsmUnknownFSMMessageErr       = -438  /* unknown message passed to FSM */
+};
+
+/* FileMapping errors */
+enum {
+  vmInvalidBackingFileIDErr     = -640, /* invalid BackingFileID */
+  vmMappingPrivilegesErr        = -641, /* requested MappingPrivileges cannot be obtained */
+  vmBusyBackingFileErr          = -642, /* open views found on BackingFile */
+  vmNoMoreBackingFilesErr       = -643, /* no more BackingFiles were found */
+  vmInvalidFileViewIDErr        = -644, /*invalid FileViewID */
+  vmFileViewAccessErr           = -645, /* requested FileViewAccess cannot be obtained */
+  vmNoMoreFileViewsErr          = -646, /* no more FileViews were found */
+  vmAddressNotInFileViewErr     = -647, /* address is not in a FileView */
+  vmInvalidOwningProcessErr     = -648  /* current process does not own the BackingFileID or FileViewID */
+};
+
+/* new Folder Manager error codes */
+enum {
+  badFolderDescErr              = -4270,
+  duplicateFolderDescErr        = -4271,
+  noMoreFolderDescErr           = -4272,
+  invalidFolderTypeErr          = -4273,
+  duplicateRoutingErr           = -4274,
+  routingNotFoundErr            = -4275,
+  badRoutingSizeErr             = -4276
+};
+
+
+enum {
+                                        /*  AFP Protocol Errors */
+  afpAccessDenied               = -5000, /* Insufficient access privileges for operation */
+  afpAuthContinue               = -5001, /* Further information required to complete AFPLogin call */
+  afpBadUAM                     = -5002, /* Unknown user authentication method specified */
+  afpBadVersNum                 = -5003, /* Unknown AFP protocol version number specified */
+  afpBitmapErr                  = -5004, /* Bitmap contained bits undefined for call */
+  afpCantMove                   = -5005, /* Move destination is offspring of source, or root was specified */
+  afpDenyConflict               = -5006, /* Specified open/deny modes conflict with current open modes */
+  afpDirNotEmpty                = -5007, /* Cannot delete non-empty directory */
+  afpDiskFull                   = -5008, /* Insufficient free space on volume for operation */
+  afpEofError                   = -5009, /* Read beyond logical end-of-file */
+  afpFileBusy                   = -5010, /* Cannot delete an open file */
+  afpFlatVol                    = -5011, /* Cannot create directory on specified volume */
+  afpItemNotFound               = -5012, /* Unknown UserName/UserID or missing comment/APPL entry */
+  afpLockErr                    = -5013, /* Some or all of requested range is locked by another user */
+  afpMiscErr                    = -5014, /* Unexpected error encountered during execution */
+  afpNoMoreLocks                = -5015, /* Maximum lock limit reached */
+  afpNoServer                   = -5016, /* Server not responding */
+  afpObjectExists               = -5017, /* Specified destination file or directory already exists */
+  afpObjectNotFound             = -5018, /* Specified file or directory does not exist */
+  afpParmErr                    = -5019, /* A specified parameter was out of allowable range */
+  afpRangeNotLocked             = -5020, /* Tried to unlock range that was not locked by user */
+  afpRangeOverlap               = -5021, /* Some or all of range already locked by same user */
+  afpSessClosed                 = -5022, /* Session closed*/
+  afpUserNotAuth                = -5023, /* No AFPLogin call has successfully been made for this session */
+  afpCallNotSupported           = -5024, /* Unsupported AFP call was made */
+  afpObjectTypeErr              = -5025, /* File/Directory specified where Directory/File expected */
+  afpTooManyFilesOpen           = -5026, /* Maximum open file count reached */
+  afpServerGoingDown            = -5027, /* Server is shutting down */
+  afpCantRename                 = -5028, /* AFPRename cannot rename volume */
+  afpDirNotFound                = -5029, /* Unknown directory specified */
+  afpIconTypeError              = -5030, /* Icon size specified different from existing icon size */
+  afpVolLocked                  = -5031, /* Volume is Read-Only */
+  afpObjectLocked               = -5032, /* Object is M/R/D/W inhibited*/
+  afpContainsSharedErr          = -5033, /* the folder being shared contains a shared folder*/
+  afpIDNotFound                 = -5034,
+  afpIDExists                   = -5035,
+  afpDiffVolErr                 = -5036,
+  afpCatalogChanged             = -5037,
+  afpSameObjectErr              = -5038,
+  afpBadIDErr                   = -5039,
+  afpPwdSameErr                 = -5040, /* Someone tried to change their password to the same password on a mantadory password change */
+  afpPwdTooShortErr             = -5041, /* The password being set is too short: there is a minimum length that must be met or exceeded */
+  afpPwdExpiredErr              = -5042, /* The password being used is too old: this requires the user to change the password before log-in can continue */
+  afpInsideSharedErr            = -5043, /* The folder being shared is inside a shared folder OR the folder contains a shared folder and is being moved into a shared folder */
+                                        /* OR the folder contains a shared folder and is being moved into the descendent of a shared folder.*/
+  afpInsideTrashErr             = -5044, /* The folder being shared is inside the trash folder OR the shared folder is being moved into the trash folder */
+                                        /* OR the folder is being moved to the trash and it contains a shared folder */
+  afpPwdNeedsChangeErr          = -5045, /* The password needs to be changed*/
+  afpPwdPolicyErr               = -5046, /* Password does not conform to servers password policy */
+  afpAlreadyLoggedInErr         = -5047, /* User has been authenticated but is already logged in from another machine (and that's not allowed on this server) */
+  afpCallNotAllowed             = -5048 /* The server knows what you wanted to do, but won't let you do it just now */
+};
+
+enum {
+                                        /*  AppleShare Client Errors */
+  afpBadDirIDType               = -5060,
+  afpCantMountMoreSrvre         = -5061, /* The Maximum number of server connections has been reached */
+  afpAlreadyMounted             = -5062, /* The volume is already mounted */
+  afpSameNodeErr                = -5063 /* An Attempt was made to connect to a file server running on the same machine */
+};
+
+
+/*
+   ***************************************************************************
+   Find By Content errors are assigned in the range -30500 to -30539, inclusive.
+   ***************************************************************************
+*/
+enum {
+  kFBCvTwinExceptionErr         = -30500, /*no telling what it was*/
+  kFBCnoIndexesFound            = -30501,
+  kFBCallocFailed               = -30502, /*probably low memory*/
+  kFBCbadParam                  = -30503,
+  kFBCfileNotIndexed            = -30504,
+  kFBCbadIndexFile              = -30505, /*bad FSSpec, or bad data in file*/
+  kFBCcompactionFailed          = -30506, /*V-Twin exception caught*/
+  kFBCvalidationFailed          = -30507, /*V-Twin exception caught*/
+  kFBCindexingFailed            = -30508, /*V-Twin exception caught*/
+  kFBCcommitFailed              = -30509, /*V-Twin exception caught*/
+  kFBCdeletionFailed            = -30510, /*V-Twin exception caught*/
+  kFBCmoveFailed                = -30511, /*V-Twin exception caught*/
+  kFBCtokenizationFailed        = -30512, /*couldn't read from document or query*/
+  kFBCmergingFailed             = -30513, /*couldn't merge index files*/
+  kFBCindexCreationFailed       = -30514, /*couldn't create index*/
+  kFBCaccessorStoreFailed       = -30515,
+  kFBCaddDocFailed              = -30516,
+  kFBCflushFailed               = -30517,
+  kFBCindexNotFound             = -30518,
+  kFBCnoSearchSession           = -30519,
+  kFBCindexingCanceled          = -30520,
+  kFBCaccessCanceled            = -30521,
+  kFBCindexFileDestroyed        = -30522,
+  kFBCindexNotAvailable         = -30523,
+  kFBCsearchFailed              = -30524,
+  kFBCsomeFilesNotIndexed       = -30525,
+  kFBCillegalSessionChange      = -30526, /*tried to add/remove vols to a session*/
+                                        /*that has hits*/
+  kFBCanalysisNotAvailable      = -30527,
+  kFBCbadIndexFileVersion       = -30528,
+  kFBCsummarizationCanceled     = -30529,
+  kFBCindexDiskIOFailed         = -30530,
+  kFBCbadSearchSession          = -30531,
+  kFBCnoSuchHit                 = -30532
+};
+
+#endif /* __MACERRORSFILES__ */
+
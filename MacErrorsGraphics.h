@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 1985-2008 by Apple Inc.. All rights reserved.
+ *
+ * @APPLE_LICENSE_HEADER_START@
+ * 
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ * 
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ * 
+ * @APPLE_LICENSE_HEADER_END@
+ */
+ 
+/*
+     File:       MacErrorsGraphics.h
+ 
+     Contains:   OSErr codes: QuickDraw, ColorSync, font, display and printing errors.
+ 
+                 MacErrors.h includes this header; include it alone to define only
+                 these codes.  Split from MacErrors.h by tools/MacErrorsSplit.py.
+ 
+     Version:    CarbonCore-769~1
+  
+     Bugs?:      For bug reports, consult the following page on
+                 the World Wide Web:
+ 
+                     http://developer.apple.com/bugreporter/
+ 
+*/
+#ifndef __MACERRORSGRAPHICS__
+#define __MACERRORSGRAPHICS__
+
+enum {
+                                        /* Printing Errors */
+  iMemFullErr                   = -108,
+  iIOAbort                      = -27
+};
+
+/* OffScreen QuickDraw Errors */
+enum {
+  cMatchErr                     = -150, /*Color2Index failed to find an index*/
+  cTempMemErr                   = -151, /*failed to allocate memory for temporary structures*/
+  cNoMemErr                     = -152, /*failed to allocate memory for structure*/
+  cRangeErr                     = -153, /*range error on colorTable request*/
+  cProtectErr                   = -154, /*colorTable entry protection violation*/
+  cDevErr                       = -155, /*invalid type of graphics device*/
+  cResErr                       = -156, /*invalid resolution for MakeITable*/
+  cDepthErr                     = -157, /*invalid pixel depth */
+  rgnTooBigErr                  = -500, /* should have never been added! (cf. rgnTooBigError = 147) */
+  updPixMemErr                  = -125, /*insufficient memory to update a pixmap*/
+  pictInfoVersionErr            = -11000, /*wrong version of the PictInfo structure*/
+  pictInfoIDErr                 = -11001, /*the internal consistancy check for the PictInfoID is wrong*/
+  pictInfoVerbErr               = -11002, /*the passed verb was invalid*/
+  cantLoadPickMethodErr         = -11003, /*unable to load the custom pick proc*/
+  colorsRequestedErr            = -11004, /*the number of colors requested was illegal*/
+  pictureDataErr                = -11005 /*the picture data was invalid*/
+};
+
+/* ColorSync Result codes */
+enum {
+                                        /* General Errors */
+  cmProfileError                = -170,
+  cmMethodError                 = -171,
+  cmMethodNotFound              = -175, /* CMM not present */
+  cmProfileNotFound             = -176, /* Responder error */
+  cmProfilesIdentical           = -177, /* Profiles the same */
+  cmCantConcatenateError        = -178, /* Profile can't be concatenated */
+  cmCantXYZ                     = -179, /* CMM cant handle XYZ space */
+  cmCantDeleteProfile           = -180, /* Responder error */
+  cmUnsupportedDataType         = -181, /* Responder error */
+  cmNoCurrentProfile            = -182  /* Responder error */
+};
+
+/* Font Mgr errors*/
+enum {
+  kFMIterationCompleted         = -980L,
+  kFMInvalidFontFamilyErr       = -981L,
+  kFMInvalidFontErr             = -982L,
+  kFMIterationScopeModifiedErr  = -983L,
+  kFMFontTableAccessErr         = -984L,
+  kFMFontContainerAccessErr     = -985L
+};
+
+enum {
+  noMaskFoundErr                = -1000 /*Icon Utilties Error*/
+};
+
+/* Icon Services error codes */
+enum {
+  invalidIconRefErr             = -2580, /* The icon ref is not valid */
+  noSuchIconErr                 = -2581, /* The requested icon could not be found */
+  noIconDataAvailableErr        = -2582 /* The necessary icon data is not available */
+};
+
+
+/* Additional Quickdraw errors in the assigned range -3950 .. -3999*/
+enum {
+  kQDNoPalette                  = -3950, /* PaletteHandle is NULL*/
+  kQDNoColorHWCursorSupport     = -3951, /* CGSSystemSupportsColorHardwareCursors() returned false*/
+  kQDCursorAlreadyRegistered    = -3952, /* can be returned from QDRegisterNamedPixMapCursor()*/
+  kQDCursorNotRegistered        = -3953, /* can be returned from QDSetNamedPixMapCursor()*/
+  kQDCorruptPICTDataErr         = -3954
+};
+
+
+
+/* Color Picker errors*/
+enum {
+  firstPickerError              = -4000,
+  invalidPickerType             = firstPickerError,
+  requiredFlagsDontMatch        = -4001,
+  pickerResourceError           = -4002,
+  cantLoadPicker                = -4003,
+  cantCreatePickerWindow        = -4004,
+  cantLoadPackage               = -4005,
+  pickerCantLive                = -4006,
+  colorSyncNotInstalled         = -4007,
+  badProfileError               = -4008,
+  noHelpForItem                 = -4009
+};
+
+
+
+/* desktop printing error codes*/
+enum {
+  kDTPHoldJobErr                = -4200,
+  kDTPStopQueueErr              = -4201,
+  kDTPTryAgainErr               = -4202,
+  kDTPAbortJobErr               = 128
+};
+
+
+/* ColorSync Result codes */
+enum {
+                                        /* Profile Access Errors */
+  cmElementTagNotFound          = -4200,
+  cmIndexRangeErr               = -4201, /* Tag index out of range */
+  cmCantDeleteElement           = -4202,
+  cmFatalProfileErr             = -4203,
+  cmInvalidProfile              = -4204, /* A Profile must contain a 'cs1 ' tag to be valid */
+  cmInvalidProfileLocation      = -4205, /* Operation not supported for this profile location */
+  cmCantCopyModifiedV1Profile   = -4215, /* Illegal to copy version 1 profiles that have been modified */
+                                        /* Profile Search Errors */
+  cmInvalidSearch               = -4206, /* Bad Search Handle */
+  cmSearchError                 = -4207,
+  cmErrIncompatibleProfile      = -4208, /* Other ColorSync Errors */
+  cmInvalidColorSpace           = -4209, /* Profile colorspace does not match bitmap type */
+  cmInvalidSrcMap               = -4210, /* Source pix/bit map was invalid */
+  cmInvalidDstMap               = -4211, /* Destination pix/bit map was invalid */
+  cmNoGDevicesError             = -4212, /* Begin/End Matching -- no gdevices available */
+  cmInvalidProfileComment       = -4213, /* Bad Profile comment during drawpicture */
+  cmRangeOverFlow               = -4214, /* Color conversion warning that some output color values over/underflowed and were clipped */
+  cmNamedColorNotFound          = -4216, /* NamedColor not found */
+  cmCantGamutCheckError         = -4217 /* Gammut checking not supported by this ColorWorld */
+};
+
+
+enum {
+                                        /* Display Manager error codes (-6220...-6269)*/
+  kDMGenErr                     = -6220, /*Unexpected Error*/
+                                        /* Mirroring-Specific Errors */
+  kDMMirroringOnAlready         = -6221, /*Returned by all calls that need mirroring to be off to do their thing.*/
+  kDMWrongNumberOfDisplays      = -6222, /*Can only handle 2 displays for now.*/
+  kDMMirroringBlocked           = -6223, /*DMBlockMirroring() has been called.*/
+  kDMCantBlock                  = -6224, /*Mirroring is already on, cant Block now (call DMUnMirror() first).*/
+  kDMMirroringNotOn             = -6225, /*Returned by all calls that need mirroring to be on to do their thing.*/
+                                        /* Other Display Manager Errors */
+  kSysSWTooOld                  = -6226, /*Missing critical pieces of System Software.*/
+  kDMSWNotInitializedErr        = -6227, /*Required software not initialized (eg windowmanager or display mgr).*/
+  kDMDriverNotDisplayMgrAwareErr = -6228, /*Video Driver does not support display manager.*/
+  kDMDisplayNotFoundErr         = -6229, /*Could not find item (will someday remove).*/
+  kDMNotFoundErr                = -6229, /*Could not find item.*/
+  kDMDisplayAlreadyInstalledErr = -6230, /*Attempt to add an already installed display.*/
+  kDMMainDisplayCannotMoveErr   = -6231, /*Trying to move main display (or a display mirrored to it) */
+  kDMNoDeviceTableclothErr      = -6231, /*obsolete*/
+  kDMFoundErr                   = -6232 /*Did not proceed because we found an item*/
+};
+
+
+
+
+/*Possible errors from the PrinterStatus bottleneck*/
+enum {
+  printerStatusOpCodeNotSupportedErr = -25280
+};
+
+
+/* FontSync OSStatus Codes */
+enum {
+  kFNSInvalidReferenceErr       = -29580, /* ref. was NULL or otherwise bad */
+  kFNSBadReferenceVersionErr    = -29581, /* ref. version is out of known range */
+  kFNSInvalidProfileErr         = -29582, /* profile is NULL or otherwise bad */
+  kFNSBadProfileVersionErr      = -29583, /* profile version is out of known range */
+  kFNSDuplicateReferenceErr     = -29584, /* the ref. being added is already in the profile */
+  kFNSMismatchErr               = -29585, /* reference didn't match or wasn't found in profile */
+  kFNSInsufficientDataErr       = -29586, /* insufficient data for the operation */
+  kFNSBadFlattenedSizeErr       = -29587, /* flattened size didn't match input or was too small */
+  kFNSNameNotFoundErr           = -29589 /* The name with the requested paramters was not found */
+};
+
+/* DrawSprockets error/warning codes */
+enum {
+  kDSpNotInitializedErr         = -30440L,
+  kDSpSystemSWTooOldErr         = -30441L,
+  kDSpInvalidContextErr         = -30442L,
+  kDSpInvalidAttributesErr      = -30443L,
+  kDSpContextAlreadyReservedErr = -30444L,
+  kDSpContextNotReservedErr     = -30445L,
+  kDSpContextNotFoundErr        = -30446L,
+  kDSpFrameRateNotReadyErr      = -30447L,
+  kDSpConfirmSwitchWarning      = -30448L,
+  kDSpInternalErr               = -30449L,
+  kDSpStereoContextErr          = -30450L
+};
+
+#endif /* __MACERRORSGRAPHICS__ */
+
@@ -0,0 +1,113 @@
+/*
+     File:       MacErrorsHistogram.h
+
+     Contains:   A process-wide count of the OSStatus values a program returns.
+
+                 MacErrorsHistogramRecord() adds one to the counter of a value, chosen by
+                 its index among the values MacErrors.h defines (GetMacErrorIndex()), or
+                 by its subsystem if MacErrors.h does not define it.  Each processor has
+                 its own set of counters, so threads recording the same error do not
+                 contend for a cache line, and nothing takes a lock.  The counters are
+                 allocated the first time anything is recorded.
+
+                 A snapshot adds the counters of all processors together and names each
+                 value and its subsystem.  If the MACERRORS_HISTOGRAM_REPORT environment
+                 variable names a file (or "-" for stderr), MacErrorsHistogramReport() is
+                 also written there at exit.
+
+                 When DEBUG_ASSERT_ERROR_HISTOGRAM is defined to 1 before AssertMacros.h is
+                 included, every failure of __Require_noErr and its variants is recorded.
+
+*/
+#ifndef __MACERRORSHISTOGRAM__
+#define __MACERRORSHISTOGRAM__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ *  MacErrorsHistogramEntry
+ *
+ *  Summary:
+ *    The merged count of one OSStatus value, or of the values MacErrors.h does not
+ *    define within one subsystem.
+ */
+struct MacErrorsHistogramEntry {
+	int32_t         status;             /* 0 when name is NULL */
+	const char *    name;               /* NULL for values MacErrors.h does not define */
+	uint32_t        subsystem;          /* as GetMacErrorSubsystem() */
+	const char *    subsystemName;      /* NULL for subsystem 0 */
+	uint64_t        count;
+};
+typedef struct MacErrorsHistogramEntry  MacErrorsHistogramEntry;
+
+/*
+ *  MacErrorsHistogramRecord()
+ *
+ *  Summary:
+ *    Counts one occurrence of an OSStatus value.  Safe to call from any thread; the
+ *    first call allocates the counters, and if that fails nothing is counted.
+ */
+extern void
+MacErrorsHistogramRecord(int32_t status);
+
+/*
+ *  MacErrorsHistogramSnapshot()
+ *
+ *  Summary:
+ *    Copies the non-zero counts, most frequent first, and returns how many there are,
+ *    which may be more than were copied.
+ *
+ *  Discussion:
+ *    The counters are read without stopping other threads, so a snapshot taken while
+ *    errors are being recorded may be slightly behind.
+ *
+ *  Parameters:
+ *
+ *    entries:
+ *      Receives the counts; may be NULL if capacity is 0.
+ *
+ *    capacity:
+ *      The number of entries that fit.
+ */
+extern size_t
+MacErrorsHistogramSnapshot(MacErrorsHistogramEntry *entries, size_t capacity);
+
+/*
+ *  MacErrorsHistogramReset()
+ *
+ *  Summary:
+ *    Sets every counter to 0.  Occurrences recorded while it runs may or may not be
+ *    kept.
+ */
+extern void
+MacErrorsHistogramReset(void);
+
+/*
+ *  MacErrorsHistogramReport()
+ *
+ *  Summary:
+ *    Writes the most frequent values with their names and counts, then the total of
+ *    each subsystem.
+ *
+ *  Parameters:
+ *
+ *    stream:
+ *      Where to write the report.
+ *
+ *    limit:
+ *      The number of values to list, or 0 to list them all.
+ */
+extern void
+MacErrorsHistogramReport(FILE *stream, size_t limit);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MACERRORSHISTOGRAM__ */
@@ -0,0 +1,195 @@
+/*
+     File:       MacErrorsLookup.h
+
+     Contains:   Names and descriptions of the OSStatus values defined in MacErrors.h.
+
+                 The table behind these functions is generated from MacErrors.h when
+                 libCarbonHeaders is built (tools/MacErrorsTable.py), so it covers every
+                 enumerator, including aliases such as iIOAbortErr for abortErr (-27).
+                 Each lookup is one hash and one probe into constant data: nothing is
+                 allocated, no lock is taken, and the functions may be called from signal
+                 handlers and from DEBUG_ASSERT_MESSAGE.
+
+*/
+#ifndef __MACERRORSLOOKUP__
+#define __MACERRORSLOOKUP__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ *  GetMacErrorName()
+ *
+ *  Summary:
+ *    Returns the name of an OSStatus value ("fnfErr" for -43), or NULL if MacErrors.h
+ *    does not define it.  When several names share the value, the one defined directly
+ *    (rather than as another enumerator, or as the bound of a range) comes first.
+ */
+extern const char *
+GetMacErrorName(int32_t status);
+
+/*
+ *  GetMacErrorComment()
+ *
+ *  Summary:
+ *    Returns the description MacErrors.h gives an OSStatus value ("File not found" for
+ *    -43), taken from its first name that has one, or NULL if there is none.
+ */
+extern const char *
+GetMacErrorComment(int32_t status);
+
+/*
+ *  CountMacErrorNames()
+ *
+ *  Summary:
+ *    Returns the number of names MacErrors.h defines for an OSStatus value: 0 if it is
+ *    unknown, more than 1 if it has aliases.
+ */
+extern uint32_t
+CountMacErrorNames(int32_t status);
+
+/*
+ *  GetIndMacErrorName()
+ *
+ *  Summary:
+ *    Returns the index-th name of an OSStatus value, or NULL if index is not less than
+ *    CountMacErrorNames(status).  Index 0 is the name GetMacErrorName() returns.
+ *
+ *  Parameters:
+ *
+ *    status:
+ *      The value to look up.
+ *
+ *    index:
+ *      Which of its names to return.
+ *
+ *    comment:
+ *      If not NULL, receives the comment of that name, or NULL if it has none.
+ */
+extern const char *
+GetIndMacErrorName(int32_t status, uint32_t index, const char **comment);
+
+/*
+ *  GetMacErrorIndex()
+ *
+ *  Summary:
+ *    Returns the position of an OSStatus value among the values MacErrors.h defines,
+ *    in numeric order, as a number from 1 to CountMacErrors(), or 0 if it does not
+ *    define it.  Aliases share their value's index.
+ *
+ *  Discussion:
+ *    Indexes are dense, so they can index per-code counters directly.  Like subsystem
+ *    numbers, they change whenever MacErrors.h does.
+ */
+extern uint32_t
+GetMacErrorIndex(int32_t status);
+
+/*
+ *  GetIndMacError()
+ *
+ *  Summary:
+ *    Returns the OSStatus value with the given index, or 0 (which is also the value of
+ *    noErr) if index is 0 or greater than CountMacErrors().
+ */
+extern int32_t
+GetIndMacError(uint32_t index);
+
+/*
+ *  CountMacErrors()
+ *
+ *  Summary:
+ *    Returns the number of distinct values MacErrors.h defines, noErr included.
+ */
+extern uint32_t
+CountMacErrors(void);
+
+/*
+ *  GetMacErrorSubsystem()
+ *
+ *  Summary:
+ *    Returns the subsystem an OSStatus value belongs to, as a number from 1 to
+ *    CountMacErrorSubsystems(), or 0 if it is outside every range MacErrors.h assigns.
+ *
+ *  Discussion:
+ *    A value MacErrors.h does not define is still classified when it falls between two
+ *    codes of one subsystem, or within a range reserved for one, so errors returned by
+ *    newer versions of a subsystem are usually attributed to it.  Subsystems are
+ *    numbered in order of name: the numbers change whenever MacErrors.h gains or loses
+ *    a subsystem, so keep the names, not the numbers, in anything persistent.
+ */
+extern uint32_t
+GetMacErrorSubsystem(int32_t status);
+
+/*
+ *  GetMacErrorSubsystemName()
+ *
+ *  Summary:
+ *    Returns the name of a subsystem ("File Manager", "QuickTime", "POSIX"), or NULL
+ *    for 0 and for numbers greater than CountMacErrorSubsystems().
+ */
+extern const char *
+GetMacErrorSubsystemName(uint32_t subsystem);
+
+/*
+ *  CountMacErrorSubsystems()
+ *
+ *  Summary:
+ *    Returns the number of subsystems, for sizing per-subsystem counters.
+ */
+extern uint32_t
+CountMacErrorSubsystems(void);
+
+/*
+ *  MacErrorToErrno()
+ *
+ *  Summary:
+ *    Returns the errno an OSStatus value corresponds to (ENOENT for fnfErr, EINTR for
+ *    kPOSIXErrorEINTR), 0 for noErr, or unknownErrno if it has none.
+ *
+ *  Discussion:
+ *    Every kPOSIXError code, every Open Transport kE...Err code, and the common File
+ *    Manager, Memory Manager and AFP errors are translated.
+ */
+extern int
+MacErrorToErrno(int32_t status, int unknownErrno);
+
+/*
+ *  ErrnoToMacError()
+ *
+ *  Summary:
+ *    Returns the OSStatus value an errno corresponds to, 0 for 0, or unknownStatus if it
+ *    has none.  The classic code is preferred where there is one (fnfErr for ENOENT);
+ *    otherwise the kPOSIXError code is returned.
+ */
+extern int32_t
+ErrnoToMacError(int errnum, int32_t unknownStatus);
+
+/*
+ *  MacErrorsToErrnos()
+ *
+ *  Summary:
+ *    Translates count OSStatus values as MacErrorToErrno() does, several at a time
+ *    where the processor allows.  The arrays must not overlap.
+ */
+extern void
+MacErrorsToErrnos(const int32_t *statuses, int *errnos, size_t count, int unknownErrno);
+
+/*
+ *  ErrnosToMacErrors()
+ *
+ *  Summary:
+ *    Translates count errno values as ErrnoToMacError() does, several at a time where
+ *    the processor allows.  The arrays must not overlap.
+ */
+extern void
+ErrnosToMacErrors(const int *errnos, int32_t *statuses, size_t count, int32_t unknownStatus);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MACERRORSLOOKUP__ */
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 1985-2008 by Apple Inc.. All rights reserved.
+ *
+ * @APPLE_LICENSE_HEADER_START@
+ * 
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ * 
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ * 
+ * @APPLE_LICENSE_HEADER_END@
+ */
+ 
+/*
+     File:       MacErrorsMemory.h
+ 
+     Contains:   OSErr codes: Memory Manager and virtual memory errors.
+ 
+                 MacErrors.h includes this header; include it alone to define only
+                 these codes.  Split from MacErrors.h by tools/MacErrorsSplit.py.
+ 
+     Version:    CarbonCore-769~1
+  
+     Bugs?:      For bug reports, consult the following page on
+                 the World Wide Web:
+ 
+                     http://developer.apple.com/bugreporter/
+ 
+*/
+#ifndef __MACERRORSMEMORY__
+#define __MACERRORSMEMORY__
+
+enum {
+                                        /* Memory Manager errors*/
+  memROZWarn                    = -99,  /*soft error in ROZ*/
+  memROZError                   = -99,  /*hard error in ROZ*/
+  memROZErr                     = -99,  /*hard error in ROZ*/
+  memFullErr                    = -108, /*Not enough room in heap zone*/
+  nilHandleErr                  = -109, /*Master Pointer was NIL in HandleZone or other*/
+  memWZErr                      = -111, /*WhichZone failed (applied to free block)*/
+  memPurErr                     = -112, /*trying to purge a locked or non-purgeable block*/
+  memAdrErr                     = -110, /*address was odd; or out of range*/
+  memAZErr                      = -113, /*Address in zone check failed*/
+  memPCErr                      = -114, /*Pointer Check failed*/
+  memBCErr                      = -115, /*Block Check failed*/
+  memSCErr                      = -116, /*Size Check failed*/
+  memLockedErr                  = -117  /*trying to move a locked block (MoveHHi)*/
+};
+
+/*MemoryDispatch errors*/
+enum {
+  notEnoughMemoryErr            = -620, /*insufficient physical memory*/
+  notHeldErr                    = -621, /*specified range of memory is not held*/
+  cannotMakeContiguousErr       = -622, /*cannot make specified range contiguous*/
+  notLockedErr                  = -623, /*specified range of memory is not locked*/
+  interruptsMaskedErr           = -624, /*dont call with interrupts masked*/
+  cannotDeferErr                = -625, /*unable to defer additional functions*/
+  noMMUErr                      = -626  /*no MMU present*/
+};
+
+/* Internal VM error codes returned in pVMGLobals (b78) if VM doesn't load */
+enum {
+  vmMorePhysicalThanVirtualErr  = -628, /*VM could not start because there was more physical memory than virtual memory (bad setting in VM config resource)*/
+  vmKernelMMUInitErr            = -629, /*VM could not start because VM_MMUInit kernel call failed*/
+  vmOffErr                      = -630, /*VM was configured off, or command key was held down at boot*/
+  vmMemLckdErr                  = -631, /*VM could not start because of a lock table conflict (only on non-SuperMario ROMs)*/
+  vmBadDriver                   = -632, /*VM could not start because the driver was incompatible*/
+  vmNoVectorErr                 = -633  /*VM could not start because the vector code could not load*/
+};
+
+#endif /* __MACERRORSMEMORY__ */
+
@@ -0,0 +1,2418 @@
+/*
+     File:       MacErrorsNames.h
+
+     Contains:   Compile-time names of the OSStatus values defined in MacErrors.h.
+
+                 Generated by tools/MacErrorsTable.py --constexpr from MacErrors.h; do
+                 not edit.  Run "make generated_headers" after changing MacErrors.h.
+
+                 MacErrors::ErrorName<fnfErr>() is the string literal "fnfErr", found while
+                 compiling; a code MacErrors.h does not define fails to compile.  An alias
+                 yields the name GetMacErrorName() would return for its value, so
+                 ErrorName<iIOAbortErr>() is "abortErr".  MacErrors::ErrorNameOf(status) is
+                 the same search as a constexpr function returning NULL for an unknown
+                 code; called at run time it links the tables below into the caller, so
+                 use GetMacErrorName() from MacErrorsLookup.h there instead.
+
+                 Values are taken as OSStatus, so enumerators wider than 32 bits, such as
+                 badComponentInstance ((long)0x80008001), name the value they wrap to.
+
+                 Requires C++17.  Including this header from C does nothing.
+
+                 2057 codes.
+
+*/
+#ifndef __MACERRORSNAMES__
+#define __MACERRORSNAMES__
+
+#if defined(__cplusplus) && (__cplusplus >= 201703L)
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace MacErrors {
+
+namespace Private {
+
+	inline constexpr int32_t kCodes[2057] = {
+		-2147450879, -2147450878, -32768, -32640, -32615, -32049, -32020, -32014,
+		-32013, -32012, -32011, -32010, -32009, -32008, -32007, -32006,
+		-32005, -32004, -32003, -32002, -32001, -32000, -30788, -30787,
+		-30786, -30785, -30783, -30781, -30780, -30779, -30778, -30777,
+		-30776, -30775, -30774, -30773, -30772, -30771, -30770, -30599,
+		-30597, -30596, -30595, -30594, -30593, -30592, -30591, -30590,
+		-30589, -30588, -30587, -30586, -30585, -30584, -30583, -30582,
+		-30581, -30580, -30568, -30567, -30566, -30565, -30564, -30563,
+		-30562, -30561, -30560, -30555, -30554, -30553, -30552, -30551,
+		-30550, -30549, -30548, -30547, -30546, -30545, -30544, -30543,
+		-30542, -30541, -30540, -30532, -30531, -30530, -30529, -30528,
+		-30527, -30526, -30525, -30524, -30523, -30522, -30521, -30520,
+		-30519, -30518, -30517, -30516, -30515, -30514, -30513, -30512,
+		-30511, -30510, -30509, -30508, -30507, -30506, -30505, -30504,
+		-30503, -30502, -30501, -30500, -30450, -30449, -30448, -30447,
+		-30446, -30445, -30444, -30443, -30442, -30441, -30440, -30429,
+		-30428, -30427, -30426, -30425, -30424, -30423, -30422, -30421,
+		-30420, -30399, -30398, -30397, -30396, -30395, -30394, -30393,
+		-30392, -30391, -30390, -30389, -30388, -30387, -30386, -30385,
+		-30384, -30383, -30382, -30381, -30380, -30379, -30378, -30377,
+		-30376, -30374, -30373, -30371, -30370, -30369, -30367, -30366,
+		-30365, -30364, -30362, -30361, -30360, -30344, -30343, -30342,
+		-30341, -30340, -30049, -30048, -30047, -30046, -30045, -30044,
+		-30043, -30042, -30029, -30002, -30001, -29589, -29587, -29586,
+		-29585, -29584, -29583, -29582, -29581, -29580, -29507, -29506,
+		-29505, -29504, -29503, -29502, -29501, -29500, -29299, -29298,
+		-29297, -29296, -29295, -29294, -29293, -29292, -29291, -29290,
+		-29289, -29288, -29276, -29275, -25346, -25345, -25344, -25343,
+		-25342, -25341, -25340, -25318, -25317, -25316, -25315, -25314,
+		-25313, -25312, -25311, -25310, -25309, -25308, -25307, -25306,
+		-25305, -25304, -25303, -25302, -25301, -25300, -25299, -25298,
+		-25297, -25296, -25295, -25294, -25293, -25292, -25291, -25280,
+		-22018, -22017, -22016, -22015, -22014, -22013, -22012, -22011,
+		-22010, -22009, -22008, -22007, -22006, -22005, -22004, -22003,
+		-22002, -22001, -22000, -20002, -20001, -20000, -14002, -14001,
+		-14000, -13950, -13949, -13948, -13947, -13946, -13945, -13944,
+		-13943, -13942, -13941, -13940, -13939, -13938, -13937, -13936,
+		-13935, -13934, -13933, -13932, -13931, -13930, -13929, -13928,
+		-13927, -13926, -13925, -13924, -13923, -13910, -13909, -13887,
+		-13886, -13885, -13884, -13883, -13882, -13881, -13880, -13038,
+		-13020, -13014, -13013, -13010, -13009, -13008, -13007, -13006,
+		-13005, -13004, -13003, -13002, -13001, -13000, -11005, -11004,
+		-11003, -11002, -11001, -11000, -10780, -10116, -10115, -10114,
+		-10113, -10112, -10111, -10110, -10109, -10108, -10107, -10106,
+		-10103, -10102, -10091, -10090, -10082, -10081, -10080, -10072,
+		-10071, -10070, -10064, -10063, -10062, -10061, -10060, -10059,
+		-10058, -10057, -10056, -10055, -10054, -10053, -10052, -10051,
+		-10050, -10047, -10046, -10045, -10044, -10043, -10042, -10041,
+		-10040, -10033, -10032, -10031, -10030, -10025, -10024, -10023,
+		-10022, -10021, -10020, -10019, -10018, -10017, -10016, -10015,
+		-10014, -10013, -10012, -10011, -10010, -10009, -10008, -10007,
+		-10006, -10005, -10004, -10003, -10002, -10001, -10000, -9999,
+		-9998, -9997, -9996, -9995, -9994, -9408, -9407, -9406,
+		-9405, -9404, -9403, -9402, -9401, -9400, -9109, -9108,
+		-9107, -9106, -9105, -9104, -9103, -9102, -9101, -9100,
+		-9099, -9098, -9097, -9096, -9095, -9094, -9093, -9092,
+		-9091, -9090, -9089, -9088, -9087, -9086, -9085, -9084,
+		-9083, -9082, -9081, -9080, -9079, -9078, -9077, -9076,
+		-9075, -9074, -9073, -9072, -9071, -9070, -9069, -9068,
+		-9067, -9066, -9065, -9064, -9063, -9062, -9061, -9060,
+		-9059, -9058, -9057, -9056, -9055, -9054, -9053, -9052,
+		-9051, -9050, -8994, -8993, -8992, -8991, -8990, -8989,
+		-8988, -8987, -8986, -8985, -8984, -8983, -8982, -8981,
+		-8980, -8979, -8978, -8977, -8976, -8975, -8974, -8973,
+		-8972, -8971, -8970, -8969, -8968, -8967, -8966, -8965,
+		-8964, -8963, -8962, -8961, -8960, -8959, -8905, -8904,
+		-8903, -8902, -8901, -8900, -8852, -8851, -8850, -8809,
+		-8808, -8807, -8806, -8805, -8804, -8803, -8802, -8801,
+		-8800, -8799, -8798, -8797, -8796, -8795, -8794, -8793,
+		-8792, -8791, -8790, -8785, -8784, -8783, -8771, -8770,
+		-8769, -8768, -8767, -8766, -8765, -8764, -8763, -8762,
+		-8761, -8760, -8759, -8758, -8757, -8756, -8755, -8754,
+		-8753, -8752, -8751, -8750, -8749, -8748, -8747, -8746,
+		-8745, -8740, -8739, -8738, -7139, -7138, -7137, -7136,
+		-7135, -7134, -7133, -7132, -7131, -7130, -7129, -7128,
+		-7127, -7126, -7125, -7124, -7123, -7122, -7121, -7120,
+		-7119, -7118, -7117, -7116, -7115, -7114, -7113, -7112,
+		-7111, -7110, -7109, -7108, -7107, -7106, -7105, -7104,
+		-7103, -7102, -7101, -7100, -7000, -6999, -6998, -6997,
+		-6996, -6995, -6994, -6993, -6992, -6991, -6990, -6989,
+		-6988, -6987, -6986, -6985, -6984, -6983, -6982, -6981,
+		-6980, -6979, -6978, -6977, -6976, -6975, -6974, -6973,
+		-6972, -6971, -6970, -6969, -6960, -6959, -6958, -6957,
+		-6956, -6955, -6954, -6953, -6952, -6951, -6950, -6949,
+		-6948, -6916, -6915, -6914, -6913, -6912, -6911, -6910,
+		-6909, -6908, -6907, -6906, -6905, -6904, -6903, -6902,
+		-6901, -6232, -6231, -6230, -6229, -6228, -6227, -6226,
+		-6225, -6224, -6223, -6222, -6221, -6220, -6150, -5753,
+		-5752, -5751, -5750, -5699, -5698, -5697, -5696, -5695,
+		-5694, -5640, -5623, -5622, -5621, -5620, -5618, -5617,
+		-5616, -5615, -5614, -5613, -5612, -5611, -5610, -5609,
+		-5608, -5607, -5606, -5605, -5604, -5603, -5602, -5601,
+		-5600, -5553, -5552, -5551, -5550, -5502, -5501, -5500,
+		-5421, -5420, -5408, -5407, -5406, -5405, -5404, -5403,
+		-5402, -5401, -5400, -5388, -5387, -5386, -5385, -5384,
+		-5383, -5382, -5381, -5380, -5363, -5362, -5361, -5360,
+		-5253, -5252, -5251, -5250, -5249, -5248, -5247, -5246,
+		-5245, -5244, -5243, -5242, -5241, -5240, -5229, -5228,
+		-5227, -5226, -5225, -5224, -5223, -5222, -5221, -5220,
+		-5212, -5211, -5210, -5209, -5208, -5207, -5206, -5205,
+		-5204, -5203, -5202, -5201, -5200, -5063, -5062, -5061,
+		-5060, -5048, -5047, -5046, -5045, -5044, -5043, -5042,
+		-5041, -5040, -5039, -5038, -5037, -5036, -5035, -5034,
+		-5033, -5032, -5031, -5030, -5029, -5028, -5027, -5026,
+		-5025, -5024, -5023, -5022, -5021, -5020, -5019, -5018,
+		-5017, -5016, -5015, -5014, -5013, -5012, -5011, -5010,
+		-5009, -5008, -5007, -5006, -5005, -5004, -5003, -5002,
+		-5001, -5000, -4999, -4998, -4997, -4996, -4995, -4994,
+		-4993, -4992, -4991, -4990, -4989, -4988, -4960, -4942,
+		-4941, -4940, -4276, -4275, -4274, -4273, -4272, -4271,
+		-4270, -4217, -4216, -4215, -4214, -4213, -4212, -4211,
+		-4210, -4209, -4208, -4207, -4206, -4205, -4204, -4203,
+		-4202, -4201, -4200, -4199, -4198, -4197, -4196, -4195,
+		-4194, -4193, -4192, -4191, -4190, -4189, -4188, -4187,
+		-4186, -4185, -4184, -4183, -4182, -4181, -4180, -4179,
+		-4178, -4177, -4176, -4175, -4174, -4173, -4172, -4171,
+		-4170, -4009, -4008, -4007, -4006, -4005, -4004, -4003,
+		-4002, -4001, -4000, -3954, -3953, -3952, -3951, -3950,
+		-3285, -3284, -3283, -3282, -3281, -3280, -3279, -3278,
+		-3277, -3276, -3275, -3274, -3273, -3272, -3271, -3270,
+		-3269, -3264, -3263, -3260, -3259, -3258, -3257, -3256,
+		-3255, -3254, -3253, -3252, -3251, -3250, -3249, -3248,
+		-3247, -3244, -3243, -3242, -3241, -3240, -3239, -3238,
+		-3237, -3236, -3234, -3233, -3231, -3224, -3221, -3218,
+		-3216, -3215, -3213, -3212, -3211, -3210, -3208, -3205,
+		-3204, -3203, -3202, -3201, -3200, -3180, -3179, -3178,
+		-3177, -3176, -3175, -3174, -3173, -3172, -3171, -3170,
+		-3169, -3168, -3167, -3166, -3165, -3164, -3163, -3162,
+		-3161, -3160, -3159, -3158, -3157, -3156, -3155, -3154,
+		-3153, -3152, -3151, -3150, -3109, -3108, -3107, -3106,
+		-3105, -3104, -3103, -3102, -3101, -3032, -3031, -3030,
+		-3026, -3025, -3005, -3004, -3003, -3002, -3001, -3000,
+		-2899, -2898, -2897, -2857, -2856, -2855, -2854, -2851,
+		-2831, -2830, -2829, -2828, -2827, -2826, -2825, -2824,
+		-2823, -2822, -2821, -2820, -2819, -2818, -2817, -2816,
+		-2815, -2814, -2813, -2812, -2811, -2810, -2809, -2808,
+		-2807, -2806, -2805, -2804, -2803, -2802, -2801, -2800,
+		-2780, -2763, -2762, -2761, -2760, -2755, -2754, -2753,
+		-2752, -2751, -2750, -2742, -2741, -2740, -2721, -2720,
+		-2710, -2709, -2708, -2707, -2706, -2705, -2704, -2703,
+		-2702, -2701, -2700, -2582, -2581, -2580, -2557, -2556,
+		-2555, -2554, -2553, -2552, -2551, -2550, -2549, -2548,
+		-2547, -2546, -2545, -2544, -2543, -2542, -2541, -2540,
+		-2539, -2538, -2537, -2536, -2533, -2532, -2531, -2530,
+		-2529, -2528, -2526, -2524, -2523, -2522, -2521, -2520,
+		-2519, -2518, -2517, -2516, -2515, -2514, -2513, -2512,
+		-2511, -2510, -2509, -2508, -2507, -2506, -2505, -2504,
+		-2503, -2502, -2501, -2500, -2499, -2422, -2421, -2419,
+		-2418, -2417, -2416, -2415, -2414, -2413, -2412, -2411,
+		-2410, -2409, -2408, -2407, -2406, -2405, -2404, -2403,
+		-2402, -2401, -2209, -2208, -2207, -2206, -2205, -2204,
+		-2203, -2202, -2201, -2159, -2158, -2157, -2149, -2148,
+		-2147, -2146, -2145, -2144, -2143, -2142, -2141, -2140,
+		-2139, -2138, -2137, -2136, -2135, -2134, -2133, -2132,
+		-2131, -2130, -2129, -2127, -2126, -2125, -2124, -2123,
+		-2122, -2121, -2120, -2119, -2118, -2117, -2116, -2115,
+		-2114, -2113, -2112, -2111, -2110, -2109, -2108, -2107,
+		-2106, -2105, -2104, -2103, -2102, -2101, -2098, -2097,
+		-2096, -2095, -2094, -2093, -2092, -2091, -2090, -2089,
+		-2087, -2086, -2085, -2084, -2083, -2082, -2081, -2080,
+		-2079, -2078, -2077, -2076, -2075, -2074, -2073, -2072,
+		-2071, -2070, -2069, -2068, -2067, -2066, -2065, -2064,
+		-2063, -2062, -2061, -2060, -2059, -2058, -2057, -2056,
+		-2055, -2054, -2053, -2052, -2051, -2050, -2049, -2048,
+		-2047, -2046, -2045, -2044, -2043, -2042, -2041, -2040,
+		-2039, -2038, -2037, -2036, -2035, -2034, -2033, -2032,
+		-2031, -2030, -2029, -2028, -2027, -2026, -2025, -2024,
+		-2023, -2022, -2021, -2020, -2019, -2018, -2017, -2016,
+		-2015, -2014, -2013, -2012, -2011, -2010, -2009, -2008,
+		-2007, -2006, -2005, -2004, -2003, -2002, -2001, -2000,
+		-1862, -1861, -1860, -1859, -1858, -1857, -1856, -1855,
+		-1854, -1853, -1852, -1851, -1850, -1813, -1812, -1811,
+		-1810, -1801, -1800, -1762, -1761, -1759, -1758, -1757,
+		-1756, -1754, -1753, -1752, -1751, -1750, -1741, -1740,
+		-1739, -1738, -1737, -1736, -1735, -1734, -1733, -1732,
+		-1731, -1730, -1729, -1728, -1727, -1726, -1725, -1723,
+		-1721, -1720, -1719, -1718, -1717, -1716, -1715, -1714,
+		-1713, -1712, -1711, -1710, -1709, -1708, -1707, -1706,
+		-1705, -1704, -1703, -1702, -1701, -1700, -1429, -1428,
+		-1427, -1426, -1425, -1424, -1423, -1422, -1421, -1420,
+		-1419, -1418, -1417, -1413, -1412, -1411, -1410, -1409,
+		-1407, -1406, -1405, -1404, -1403, -1402, -1401, -1400,
+		-1327, -1311, -1310, -1309, -1308, -1307, -1306, -1305,
+		-1304, -1303, -1302, -1301, -1300, -1280, -1279, -1278,
+		-1277, -1276, -1275, -1274, -1273, -1105, -1104, -1103,
+		-1102, -1101, -1100, -1099, -1098, -1097, -1096, -1075,
+		-1074, -1073, -1072, -1071, -1070, -1069, -1068, -1067,
+		-1066, -1029, -1028, -1027, -1026, -1025, -1024, -1000,
+		-985, -984, -983, -982, -981, -980, -932, -931,
+		-930, -928, -927, -926, -925, -924, -923, -922,
+		-919, -917, -916, -915, -914, -913, -912, -911,
+		-910, -909, -908, -907, -906, -905, -904, -903,
+		-902, -900, -877, -876, -875, -863, -862, -861,
+		-859, -858, -857, -855, -854, -853, -850, -813,
+		-812, -811, -810, -809, -808, -807, -806, -805,
+		-804, -803, -802, -801, -800, -648, -647, -646,
+		-645, -644, -643, -642, -641, -640, -633, -632,
+		-631, -630, -629, -628, -626, -625, -624, -623,
+		-622, -621, -620, -619, -618, -617, -616, -610,
+		-609, -608, -607, -606, -605, -604, -603, -602,
+		-601, -600, -503, -502, -501, -500, -492, -491,
+		-490, -463, -462, -461, -460, -454, -453, -452,
+		-451, -450, -438, -437, -436, -435, -434, -433,
+		-432, -431, -417, -416, -415, -414, -413, -410,
+		-400, -360, -351, -350, -349, -348, -347, -346,
+		-345, -344, -343, -342, -341, -340, -339, -338,
+		-337, -336, -335, -334, -333, -332, -331, -330,
+		-320, -319, -318, -317, -316, -315, -314, -313,
+		-312, -311, -310, -309, -308, -307, -306, -305,
+		-304, -303, -302, -301, -300, -299, -293, -292,
+		-291, -290, -261, -260, -259, -258, -257, -256,
+		-255, -254, -253, -252, -251, -250, -247, -246,
+		-245, -244, -243, -242, -241, -240, -232, -231,
+		-230, -229, -228, -227, -226, -225, -224, -223,
+		-222, -221, -220, -213, -212, -211, -210, -209,
+		-208, -207, -206, -205, -204, -203, -201, -200,
+		-199, -198, -197, -196, -195, -194, -193, -192,
+		-190, -189, -188, -186, -185, -182, -181, -180,
+		-179, -178, -177, -176, -175, -171, -170, -157,
+		-156, -155, -154, -153, -152, -151, -150, -149,
+		-148, -147, -145, -128, -127, -126, -125, -124,
+		-123, -122, -121, -120, -117, -116, -115, -114,
+		-113, -112, -111, -110, -109, -108, -102, -100,
+		-99, -98, -97, -96, -95, -94, -93, -92,
+		-91, -90, -89, -88, -87, -86, -85, -84,
+		-83, -82, -81, -80, -79, -78, -77, -76,
+		-75, -74, -73, -72, -71, -70, -69, -68,
+		-67, -66, -65, -64, -61, -60, -59, -58,
+		-57, -56, -55, -54, -53, -52, -51, -50,
+		-49, -48, -47, -46, -45, -44, -43, -42,
+		-41, -40, -39, -38, -37, -36, -35, -34,
+		-33, -30, -29, -28, -27, -26, -25, -24,
+		-23, -22, -21, -20, -19, -18, -17, -13,
+		-12, -11, -10, -8, -5, -4, -3, -2,
+		-1, 0, 1, 2, 3, 4, 5, 6,
+		7, 8, 9, 10, 11, 12, 13, 14,
+		15, 16, 17, 18, 19, 20, 21, 22,
+		23, 24, 25, 26, 27, 28, 30, 31,
+		33, 40, 41, 42, 43, 51, 81, 83,
+		84, 85, 86, 87, 88, 89, 90, 98,
+		99, 101, 102, 103, 104, 105, 106, 112,
+		113, 114, 116, 117, 118, 119, 120, 121,
+		122, 128, 1010, 1011, 20000, 20001, 20002, 20003,
+		20004, 20010, 20109, 29200, 29201, 29202, 29203, 29204,
+		29205, 32767, 100000, 100001, 100002, 100003, 100004, 100005,
+		100006, 100007, 100008, 100009, 100010, 100011, 100012, 100013,
+		100014, 100015, 100016, 100017, 100018, 100019, 100020, 100021,
+		100022, 100023, 100024, 100025, 100026, 100027, 100028, 100029,
+		100030, 100031, 100032, 100033, 100034, 100035, 100036, 100037,
+		100038, 100039, 100040, 100041, 100042, 100043, 100044, 100045,
+		100046, 100047, 100048, 100049, 100050, 100051, 100052, 100053,
+		100054, 100055, 100056, 100057, 100058, 100059, 100060, 100061,
+		100062, 100063, 100064, 100065, 100066, 100067, 100068, 100069,
+		100070, 100071, 100072, 100073, 100074, 100075, 100076, 100077,
+		100078, 100079, 100080, 100081, 100082, 100083, 100084, 100085,
+		100086, 100087, 100088, 100089, 100090, 100091, 100092, 100093,
+		100094, 100095, 100096, 100097, 100098, 100099, 100100, 100101,
+		100102,
+	};
+
+	inline constexpr const char *kNames[2057] = {
+		"badComponentInstance",
+		"badComponentSelector",
+		"svTempDisable",
+		"svDisabled",
+		"fontNotOutlineErr",
+		"errCppLastUserDefinedError",
+		"errCppLastSystemDefinedError",
+		"errCppios_base_failure",
+		"errCppunderflow_error",
+		"errCpprange_error",
+		"errCppoverflow_error",
+		"errCppruntime_error",
+		"errCppout_of_range",
+		"errCpplength_error",
+		"errCppinvalid_argument",
+		"errCppdomain_error",
+		"errCpplogic_error",
+		"errCppbad_typeid",
+		"errCppbad_exception",
+		"errCppbad_cast",
+		"errCppbad_alloc",
+		"errCppGeneral",
+		"kURL68kNotSupportedError",
+		"kURLAccessNotAvailableError",
+		"kURLInvalidConfigurationError",
+		"kURLExtensionFailureError",
+		"kURLFileEmptyError",
+		"kURLInvalidCallError",
+		"kURLUnsettablePropertyError",
+		"kURLPropertyBufferTooSmallError",
+		"kURLUnknownPropertyError",
+		"kURLPropertyNotYetKnownError",
+		"kURLAuthenticationError",
+		"kURLServerBusyError",
+		"kURLUnsupportedSchemeError",
+		"kURLInvalidURLError",
+		"kURLDestinationExistsError",
+		"kURLProgressAlreadyDisplayedError",
+		"kURLInvalidURLReferenceError",
+		"controlHandleInvalidErr",
+		"controlInvalidDataVersionErr",
+		"errItemNotControl",
+		"errCantEmbedRoot",
+		"errCantEmbedIntoSelf",
+		"errWindowRegionCodeInvalid",
+		"errControlHiddenOrDisabled",
+		"errDataSizeMismatch",
+		"errControlIsNotEmbedder",
+		"errControlsAlreadyExist",
+		"errInvalidPartCode",
+		"errRootAlreadyExists",
+		"errNoRootControl",
+		"errCouldntSetFocus",
+		"errUnknownControl",
+		"errWindowDoesntSupportFocus",
+		"errControlDoesntSupportFocus",
+		"errDataNotSupported",
+		"errMessageNotSupported",
+		"themeNoAppropriateBrushErr",
+		"themeMonitorDepthNotSupportedErr",
+		"themeScriptFontNotFoundErr",
+		"themeBadCursorIndexErr",
+		"themeHasNoAccentsErr",
+		"themeBadTextColorErr",
+		"themeProcessNotRegisteredErr",
+		"themeProcessRegisteredErr",
+		"themeInvalidBrushErr",
+		"qtvrUninitialized",
+		"qtvrLibraryLoadErr",
+		"streamingNodeNotReadyErr",
+		"noMemoryNodeFailedInitialize",
+		"invalidHotSpotIDErr",
+		"invalidNodeFormatErr",
+		"limitReachedErr",
+		"settingNotSupportedByNodeErr",
+		"propertyNotSupportedByNodeErr",
+		"timeNotInViewErr",
+		"invalidViewStateErr",
+		"invalidNodeIDErr",
+		"selectorNotSupportedByNodeErr",
+		"callNotSupportedByNodeErr",
+		"constraintReachedErr",
+		"notAQTVRMovieErr",
+		"kFBCnoSuchHit",
+		"kFBCbadSearchSession",
+		"kFBCindexDiskIOFailed",
+		"kFBCsummarizationCanceled",
+		"kFBCbadIndexFileVersion",
+		"kFBCanalysisNotAvailable",
+		"kFBCillegalSessionChange",
+		"kFBCsomeFilesNotIndexed",
+		"kFBCsearchFailed",
+		"kFBCindexNotAvailable",
+		"kFBCindexFileDestroyed",
+		"kFBCaccessCanceled",
+		"kFBCindexingCanceled",
+		"kFBCnoSearchSession",
+		"kFBCindexNotFound",
+		"kFBCflushFailed",
+		"kFBCaddDocFailed",
+		"kFBCaccessorStoreFailed",
+		"kFBCindexCreationFailed",
+		"kFBCmergingFailed",
+		"kFBCtokenizationFailed",
+		"kFBCmoveFailed",
+		"kFBCdeletionFailed",
+		"kFBCcommitFailed",
+		"kFBCindexingFailed",
+		"kFBCvalidationFailed",
+		"kFBCcompactionFailed",
+		"kFBCbadIndexFile",
+		"kFBCfileNotIndexed",
+		"kFBCbadParam",
+		"kFBCallocFailed",
+		"kFBCnoIndexesFound",
+		"kFBCvTwinExceptionErr",
+		"kDSpStereoContextErr",
+		"kDSpInternalErr",
+		"kDSpConfirmSwitchWarning",
+		"kDSpFrameRateNotReadyErr",
+		"kDSpContextNotFoundErr",
+		"kDSpContextNotReservedErr",
+		"kDSpContextAlreadyReservedErr",
+		"kDSpInvalidAttributesErr",
+		"kDSpInvalidContextErr",
+		"kDSpSystemSWTooOldErr",
+		"kDSpNotInitializedErr",
+		"kISpListBusyErr",
+		"kISpDeviceActiveErr",
+		"kISpSystemActiveErr",
+		"kISpDeviceInactiveErr",
+		"kISpSystemInactiveErr",
+		"kISpElementNotInListErr",
+		"kISpElementInListErr",
+		"kISpBufferToSmallErr",
+		"kISpSystemListErr",
+		"kISpInternalErr",
+		"kNSpJoinFailedErr",
+		"kNSpCantBlockErr",
+		"kNSpMessageTooBigErr",
+		"kNSpSendFailedErr",
+		"kNSpConnectFailedErr",
+		"kNSpGameTerminatedErr",
+		"kNSpTimeoutErr",
+		"kNSpInvalidProtocolListErr",
+		"kNSpInvalidProtocolRefErr",
+		"kNSpInvalidDefinitionErr",
+		"kNSpAddPlayerFailedErr",
+		"kNSpCreateGroupFailedErr",
+		"kNSpNoHostVolunteersErr",
+		"kNSpNoGroupsErr",
+		"kNSpNoPlayersErr",
+		"kNSpInvalidGroupIDErr",
+		"kNSpInvalidPlayerIDErr",
+		"kNSpNameRequiredErr",
+		"kNSpFeatureNotImplementedErr",
+		"kNSpAddressInUseErr",
+		"kNSpRemovePlayerFailedErr",
+		"kNSpFreeQExhaustedErr",
+		"kNSpInvalidAddressErr",
+		"kNSpNotAdvertisingErr",
+		"kNSpAlreadyAdvertisingErr",
+		"kNSpMemAllocationErr",
+		"kNSpOTVersionTooOldErr",
+		"kNSpOTNotPresentErr",
+		"kNSpInvalidParameterErr",
+		"kNSpInvalidGameRefErr",
+		"kNSpProtocolNotAvailableErr",
+		"kNSpHostFailedErr",
+		"kNSpPipeFullErr",
+		"kNSpTopologyNotSupportedErr",
+		"kNSpAlreadyInitializedErr",
+		"kNSpInitializationFailedErr",
+		"kSSpScaleToZeroErr",
+		"kSSpParallelUpVectorErr",
+		"kSSpCantInstallErr",
+		"kSSpVersionErr",
+		"kSSpInternalErr",
+		"kALMInternalErr",
+		"kALMGroupNotFoundErr",
+		"kALMNoSuchModuleErr",
+		"kALMModuleCommunicationErr",
+		"kALMDuplicateModuleErr",
+		"kALMInstallationErr",
+		"kALMDeferSwitchErr",
+		"kALMRebootFlagsLevelErr",
+		"kLocalesDefaultDisplayStatus",
+		"kLocalesTableFormatErr",
+		"kLocalesBufferTooSmallErr",
+		"kFNSNameNotFoundErr",
+		"kFNSBadFlattenedSizeErr",
+		"kFNSInsufficientDataErr",
+		"kFNSMismatchErr",
+		"kFNSDuplicateReferenceErr",
+		"kFNSBadProfileVersionErr",
+		"kFNSInvalidProfileErr",
+		"kFNSBadReferenceVersionErr",
+		"kFNSInvalidReferenceErr",
+		"kCollateInvalidCollationRef",
+		"kCollateBufferTooSmall",
+		"kCollateInvalidChar",
+		"kCollatePatternNotFoundErr",
+		"kCollateUnicodeConvertFailedErr",
+		"kCollateMissingUnicodeTableErr",
+		"kCollateInvalidOptions",
+		"kCollateAttributesNotFoundErr",
+		"kMPInvalidIDErr",
+		"kMPInsufficientResourcesErr",
+		"kMPTaskAbortedErr",
+		"kMPTimeoutErr",
+		"kMPDeletedErr",
+		"kMPNanokernelNeedsMemoryErr",
+		"kMPBlueBlockingErr",
+		"kMPTaskStoppedErr",
+		"kMPTaskBlockedErr",
+		"kMPTaskCreatedErr",
+		"kMPProcessTerminatedErr",
+		"kMPProcessCreatedErr",
+		"kMPPrivilegedErr",
+		"kMPIterationEndErr",
+		"kUCTokenNotFound",
+		"kUCTokenizerUnknownLang",
+		"kUCTokenizerIterationFinished",
+		"kUCTSSearchListErr",
+		"kUCTSNoKeysAddedToObjectErr",
+		"kUCTextBreakLocatorMissingType",
+		"kUCOutputBufferTooSmall",
+		"errKCCreateChainFailed",
+		"errKCDataNotModifiable",
+		"errKCDataNotAvailable",
+		"errKCInteractionRequired",
+		"errKCNoPolicyModule",
+		"errKCNoCertificateModule",
+		"errKCNoStorageModule",
+		"errKCKeySizeNotAllowed",
+		"errKCWrongKCVersion",
+		"errKCReadOnlyAttr",
+		"errKCInteractionNotAllowed",
+		"errKCNoDefaultKeychain",
+		"errKCNoSuchClass",
+		"errKCInvalidSearchRef",
+		"errKCInvalidItemRef",
+		"errKCNoSuchAttr",
+		"errKCDataTooLarge",
+		"errKCBufferTooSmall",
+		"errKCItemNotFound",
+		"errKCDuplicateItem",
+		"errKCInvalidCallback",
+		"errKCDuplicateCallback",
+		"errKCDuplicateKeychain",
+		"errKCInvalidKeychain",
+		"errKCNoSuchKeychain",
+		"errKCAuthFailed",
+		"errKCReadOnly",
+		"errKCNotAvailable",
+		"printerStatusOpCodeNotSupportedErr",
+		"kTXNOutsideOfFrameErr",
+		"kTXNOutsideOfLineErr",
+		"kTXNATSUIIsNotInstalledErr",
+		"kTXNDataTypeNotAllowedErr",
+		"kTXNCopyNotAllowedInEchoModeErr",
+		"kTXNCannotTurnTSMOffWhenUsingUnicodeErr",
+		"kTXNAlreadyInitializedErr",
+		"kTXNInvalidRunIndex",
+		"kTXNSomeOrAllTagsInvalidForRunErr",
+		"kTXNAttributeTagInvalidForRunErr",
+		"kTXNNoMatchErr",
+		"kTXNRunIndexOutofBoundsErr",
+		"kTXNCannotSetAutoIndentErr",
+		"kTXNBadDefaultFileTypeWarning",
+		"kTXNUserCanceledOperationErr",
+		"kTXNIllegalToCrossDataBoundariesErr",
+		"kTXNInvalidFrameIDErr",
+		"kTXNCannotAddFrameErr",
+		"kTXNEndIterationErr",
+		"invalidIndexErr",
+		"recordDataTooBigErr",
+		"unknownInsertModeErr",
+		"kModemScriptMissing",
+		"kModemPreferencesMissing",
+		"kModemOutOfMemory",
+		"kHIDBaseError",
+		"kHIDNullStateErr",
+		"kHIDBufferTooSmallErr",
+		"kHIDValueOutOfRangeErr",
+		"kHIDUsageNotFoundErr",
+		"kHIDNotValueArrayErr",
+		"kHIDInvalidPreparsedDataErr",
+		"kHIDIncompatibleReportErr",
+		"kHIDBadLogPhysValuesErr",
+		"kHIDInvalidReportTypeErr",
+		"kHIDInvalidReportLengthErr",
+		"kHIDNullPointerErr",
+		"kHIDBadParameterErr",
+		"kHIDNotEnoughMemoryErr",
+		"kHIDEndOfDescriptorErr",
+		"kHIDUsagePageZeroErr",
+		"kHIDBadLogicalMinimumErr",
+		"kHIDBadLogicalMaximumErr",
+		"kHIDInvertedLogicalRangeErr",
+		"kHIDInvertedPhysicalRangeErr",
+		"kHIDUnmatchedUsageRangeErr",
+		"kHIDInvertedUsageRangeErr",
+		"kHIDUnmatchedStringRangeErr",
+		"kHIDUnmatchedDesignatorRangeErr",
+		"kHIDReportSizeZeroErr",
+		"kHIDReportCountZeroErr",
+		"kHIDReportIDZeroErr",
+		"kHIDInvalidRangePageErr",
+		"kHIDDeviceNotReady",
+		"kHIDVersionIncompatibleErr",
+		"debuggingNoMatchErr",
+		"debuggingNoCallbackErr",
+		"debuggingInvalidNameErr",
+		"debuggingInvalidOptionErr",
+		"debuggingInvalidSignatureErr",
+		"debuggingDuplicateOptionErr",
+		"debuggingDuplicateSignatureErr",
+		"debuggingExecutionContextErr",
+		"kBridgeSoftwareRunningCantSleep",
+		"kNoSuchPowerSource",
+		"kProcessorTempRoutineRequiresMPLib2",
+		"kCantReportProcessorTemperatureErr",
+		"kPowerMgtRequestDenied",
+		"kPowerMgtMessageNotHandled",
+		"kPowerHandlerNotFoundForProcErr",
+		"kPowerHandlerNotFoundForDeviceErr",
+		"kPowerHandlerExistsForDeviceErr",
+		"pmRecvEndErr",
+		"pmRecvStartErr",
+		"pmSendEndErr",
+		"pmSendStartErr",
+		"pmReplyTOErr",
+		"pmBusyErr",
+		"pictureDataErr",
+		"colorsRequestedErr",
+		"cantLoadPickMethodErr",
+		"pictInfoVerbErr",
+		"pictInfoIDErr",
+		"pictInfoVersionErr",
+		"errTaskNotFound",
+		"telNotEnoughdspBW",
+		"telBadSampleRate",
+		"telBadSWErr",
+		"telDetAlreadyOn",
+		"telAutoAnsNotOn",
+		"telValidateFailed",
+		"telBadProcID",
+		"telDeviceNotFound",
+		"telBadCodeResource",
+		"telInitFailed",
+		"telNoCommFolder",
+		"telUnknownErr",
+		"telNoSuchTool",
+		"telBadFunction",
+		"telPBErr",
+		"telCANotDeflectable",
+		"telCANotRejectable",
+		"telCANotAcceptable",
+		"telTermNotOpen",
+		"telStillNeeded",
+		"telAlreadyOpen",
+		"telNoCallbackRef",
+		"telDisplayModeNotSupp",
+		"telBadDisplayMode",
+		"telFwdTypeNotSupp",
+		"telDNTypeNotSupp",
+		"telBadRate",
+		"telBadBearerType",
+		"telBadSelect",
+		"telBadParkID",
+		"telBadPickupGroupID",
+		"telBadFwdType",
+		"telBadFeatureID",
+		"telBadIntercomID",
+		"telBadPageID",
+		"telBadDNType",
+		"telConfLimitExceeded",
+		"telCBErr",
+		"telTransferRej",
+		"telTransferErr",
+		"telConfRej",
+		"telConfErr",
+		"telConfNoLimit",
+		"telConfLimitErr",
+		"telFeatNotSupp",
+		"telFeatActive",
+		"telFeatNotAvail",
+		"telFeatNotSub",
+		"errAEPropertiesClash",
+		"errAECantPutThatThere",
+		"errAENotAnEnumMember",
+		"telIntExtNotSupp",
+		"telBadIntExt",
+		"telStateNotSupp",
+		"telBadStateErr",
+		"telIndexNotSupp",
+		"telBadIndex",
+		"errAELocalOnly",
+		"errAECantUndo",
+		"errAENotASingleObject",
+		"errAENoUserSelection",
+		"errAENoSuchTransaction",
+		"errAEInTransaction",
+		"errAECantHandleClass",
+		"errAECantSupplyType",
+		"errAENotAnElement",
+		"errAEIndexTooLarge",
+		"errOSACantAssign",
+		"errAEReadDenied",
+		"errAEPrivilegeError",
+		"OSAIllegalAssign",
+		"errAEBadKeyForm",
+		"errAETypeError",
+		"errAEEventFailed",
+		"cannotMoveAttachedController",
+		"controllerHasFixedHeight",
+		"cannotSetWidthOfAttachedController",
+		"controllerBoundsNotExact",
+		"editingNotAllowed",
+		"badControllerHeight",
+		"deviceCantMeetRequest",
+		"seqGrabInfoNotAvailable",
+		"badSGChannel",
+		"couldntGetRequiredComponent",
+		"notEnoughDiskSpaceToGrab",
+		"notEnoughMemoryToGrab",
+		"cantDoThatInCurrentMode",
+		"grabTimeComplete",
+		"noDeviceForChannel",
+		"kNoCardBusCISErr",
+		"kNotZVCapableErr",
+		"kCardPowerOffErr",
+		"kAttemptDupCardEntryErr",
+		"kAlreadySavedStateErr",
+		"kTooManyIOWindowsErr",
+		"kNotReadyErr",
+		"kClientRequestDenied",
+		"kNoCompatibleNameErr",
+		"kNoEnablerForCardErr",
+		"kNoCardEnablersFoundErr",
+		"kUnsupportedCardErr",
+		"kNoClientTableErr",
+		"kNoMoreInterruptSlotsErr",
+		"kNoMoreTimerClientsErr",
+		"kNoIOWindowRequestedErr",
+		"kBadCustomIFIDErr",
+		"kBadTupleDataErr",
+		"kInvalidCSClientErr",
+		"kUnsupportedVsErr",
+		"kInvalidDeviceNumber",
+		"kPostCardEventErr",
+		"kCantConfigureCardErr",
+		"kPassCallToChainErr",
+		"kCardBusCardErr",
+		"k16BitCardErr",
+		"kBadDeviceErr",
+		"kBadLinkErr",
+		"kInvalidRegEntryErr",
+		"kNoCardSevicesSocketsErr",
+		"kOutOfResourceErr",
+		"kNoMoreItemsErr",
+		"kInUseErr",
+		"kConfigurationLockedErr",
+		"kWriteProtectedErr",
+		"kBusyErr",
+		"kUnsupportedModeErr",
+		"kUnsupportedFunctionErr",
+		"kNoCardErr",
+		"kGeneralFailureErr",
+		"kWriteFailureErr",
+		"kReadFailureErr",
+		"kBadSpeedErr",
+		"kBadCISErr",
+		"kBadHandleErr",
+		"kBadArgsErr",
+		"kBadArgLengthErr",
+		"kBadWindowErr",
+		"kBadVppErr",
+		"kBadVccErr",
+		"kBadTypeErr",
+		"kBadSocketErr",
+		"kBadSizeErr",
+		"kBadPageErr",
+		"kBadOffsetErr",
+		"kBadIRQErr",
+		"kBadEDCErr",
+		"kBadBaseErr",
+		"kBadAttributeErr",
+		"kBadAdapterErr",
+		"noThumbnailFoundErr",
+		"badCodecCharacterizationErr",
+		"codecOffscreenFailedPleaseRetryErr",
+		"lockPortBitsWrongGDeviceErr",
+		"directXObjectAlreadyExists",
+		"codecDroppedFrameErr",
+		"codecOffscreenFailedErr",
+		"codecNeedAccessKeyErr",
+		"codecParameterDialogConfirm",
+		"lockPortBitsSurfaceLostErr",
+		"lockPortBitsBadPortErr",
+		"lockPortBitsWindowClippedErr",
+		"lockPortBitsWindowResizedErr",
+		"lockPortBitsWindowMovedErr",
+		"lockPortBitsBadSurfaceErr",
+		"codecNeedToFlushChainErr",
+		"codecDisabledErr",
+		"codecNoMemoryPleaseWaitErr",
+		"codecNothingToBlitErr",
+		"codecCantQueueErr",
+		"codecCantWhenErr",
+		"codecOpenErr",
+		"codecConditionErr",
+		"codecExtensionNotFoundErr",
+		"codecDataVersErr",
+		"codecBadDataErr",
+		"codecWouldOffscreenErr",
+		"codecAbortErr",
+		"codecSpoolErr",
+		"codecImageBufErr",
+		"codecScreenBufErr",
+		"codecSizeErr",
+		"codecUnimpErr",
+		"noCodecErr",
+		"codecErr",
+		"kATSULastErr",
+		"kATSUNoFontNameErr",
+		"kATSUInvalidCallInsideCallbackErr",
+		"kATSUOutputBufferTooSmallErr",
+		"kATSUBadStreamErr",
+		"kATSUUnsupportedStreamFormatErr",
+		"kATSUInvalidFontFallbacksErr",
+		"kIllegalClockValueErr",
+		"kUTCOverflowErr",
+		"kUTCUnderflowErr",
+		"kATSUBusyObjectErr",
+		"kATSULineBreakInWord",
+		"kATSUCoordinateOverflowErr",
+		"kATSUNoFontScalerAvailableErr",
+		"kATSUNoFontCmapAvailableErr",
+		"kATSULowLevelErr",
+		"kATSUQuickDrawTextErr",
+		"kATSUNoStyleRunsAssignedErr",
+		"kATSUNotSetErr",
+		"kATSUInvalidCacheErr",
+		"kATSUInvalidAttributeTagErr",
+		"kATSUInvalidAttributeSizeErr",
+		"kATSUInvalidAttributeValueErr",
+		"kATSUInvalidFontErr",
+		"kATSUNoCorrespondingFontErr",
+		"kATSUFontsNotMatched",
+		"kATSUFontsMatched",
+		"kATSUInvalidTextRangeErr",
+		"kATSUInvalidStyleErr",
+		"kATSUInvalidTextLayoutErr",
+		"kTECOutputBufferFullStatus",
+		"kTECNeedFlushStatus",
+		"kTECUsedFallbacksStatus",
+		"kTECItemUnavailableErr",
+		"kTECGlobalsUnavailableErr",
+		"unicodeChecksumErr",
+		"unicodeNoTableErr",
+		"unicodeVariantErr",
+		"unicodeFallbacksErr",
+		"unicodePartConvertErr",
+		"unicodeBufErr",
+		"unicodeCharErr",
+		"unicodeElementErr",
+		"unicodeNotFoundErr",
+		"unicodeTableFormatErr",
+		"unicodeDirectionErr",
+		"unicodeContextualErr",
+		"unicodeTextEncodingDataErr",
+		"kTECDirectionErr",
+		"kTECIncompleteElementErr",
+		"kTECUnmappableElementErr",
+		"kTECPartialCharErr",
+		"kTECBadTextRunErr",
+		"kTECArrayFullErr",
+		"kTECBufferBelowMinimumSizeErr",
+		"kTECNoConversionPathErr",
+		"kTECCorruptConverterErr",
+		"kTECTableFormatErr",
+		"kTECTableChecksumErr",
+		"kTECMissingTableErr",
+		"kTextUndefinedElementErr",
+		"kTextMalformedInputErr",
+		"kTextUnsupportedEncodingErr",
+		"kRANotEnabled",
+		"kRACallBackFailed",
+		"kRADuplicateIPAddr",
+		"kRANCPRejectedbyPeer",
+		"kRAExtAuthenticationFailed",
+		"kRAATalkInactive",
+		"kRAPeerNotResponding",
+		"kRAPPPPeerDisconnected",
+		"kRAPPPUserDisconnected",
+		"kRAPPPNegotiationFailed",
+		"kRAPPPAuthenticationFailed",
+		"kRAPPPProtocolRejected",
+		"dcmBufferOverflowErr",
+		"dcmIterationCompleteErr",
+		"kRATCPIPNotConfigured",
+		"dcmBadFeatureErr",
+		"kRARemoteAccessNotReady",
+		"dcmNoAccessMethodErr",
+		"dcmProtectedErr",
+		"kRAUserPwdEntryRequired",
+		"dcmBadPropertyErr",
+		"dcmBadFindMethodErr",
+		"dcmBadDataSizeErr",
+		"dcmTooManyKeyErr",
+		"dcmBadKeyErr",
+		"kRAPortBusy",
+		"dcmNoFieldErr",
+		"dcmBadFieldTypeErr",
+		"dcmBadFieldInfoErr",
+		"dcmNecessaryFieldErr",
+		"dcmDupRecordErr",
+		"dcmNoRecordErr",
+		"dcmBlockFullErr",
+		"kRAMissingResources",
+		"dcmDictionaryBusyErr",
+		"dcmDictionaryNotOpenErr",
+		"dcmPermissionErr",
+		"dcmBadDictionaryErr",
+		"dcmNotDictionaryErr",
+		"dcmParamErr",
+		"laEngineNotFoundErr",
+		"laPropertyErr",
+		"laPropertyNotFoundErr",
+		"laPropertyIsReadOnlyErr",
+		"laPropertyUnknownErr",
+		"laPropertyValueErr",
+		"laDictionaryTooManyErr",
+		"laDictionaryUnknownErr",
+		"laDictionaryNotOpenedErr",
+		"laTextOverFlowErr",
+		"laFailAnalysisErr",
+		"laNoMoreMorphemeErr",
+		"laInvalidPathErr",
+		"laEnvironmentExistErr",
+		"laEnvironmentNotFoundErr",
+		"laEnvironmentBusyErr",
+		"laTooSmallBufferErr",
+		"kUSBFlagsError",
+		"kUSBAbortedError",
+		"kUSBNoBandwidthError",
+		"kUSBPipeIdleError",
+		"kUSBPipeStalledError",
+		"kUSBUnknownInterfaceErr",
+		"kUSBDeviceBusy",
+		"kUSBDevicePowerProblem",
+		"kUSBInvalidBuffer",
+		"kUSBDeviceSuspended",
+		"kUSBDeviceNotSuspended",
+		"kUSBDeviceDisconnected",
+		"kUSBTimedOut",
+		"kUSBQueueAborted",
+		"kUSBPortDisabled",
+		"kUSBInternalReserved1",
+		"kUSBInternalReserved2",
+		"kUSBInternalReserved3",
+		"kUSBInternalReserved4",
+		"kUSBInternalReserved5",
+		"kUSBInternalReserved6",
+		"kUSBInternalReserved7",
+		"kUSBInternalReserved8",
+		"kUSBInternalReserved9",
+		"kUSBInternalReserved10",
+		"kUSBBadDispatchTable",
+		"kUSBUnknownNotification",
+		"kUSBQueueFull",
+		"kUSBLinkErr",
+		"kUSBCRCErr",
+		"kUSBBitstufErr",
+		"kUSBDataToggleErr",
+		"kUSBEndpointStallErr",
+		"kUSBNotRespondingErr",
+		"kUSBPIDCheckErr",
+		"kUSBWrongPIDErr",
+		"kUSBOverRunErr",
+		"kUSBUnderRunErr",
+		"kUSBRes1Err",
+		"kUSBRes2Err",
+		"kUSBBufOvrRunErr",
+		"kUSBBufUnderRunErr",
+		"kUSBNotSent1Err",
+		"kUSBNotSent2Err",
+		"kDMFoundErr",
+		"kDMMainDisplayCannotMoveErr",
+		"kDMDisplayAlreadyInstalledErr",
+		"kDMDisplayNotFoundErr",
+		"kDMDriverNotDisplayMgrAwareErr",
+		"kDMSWNotInitializedErr",
+		"kSysSWTooOld",
+		"kDMMirroringNotOn",
+		"kDMCantBlock",
+		"kDMMirroringBlocked",
+		"kDMWrongNumberOfDisplays",
+		"kDMMirroringOnAlready",
+		"kDMGenErr",
+		"kQTSSUnknownErr",
+		"collectionVersionErr",
+		"collectionIndexRangeErr",
+		"collectionItemNotFoundErr",
+		"collectionItemLockedErr",
+		"kNavMissingKindStringErr",
+		"kNavInvalidCustomControlMessageErr",
+		"kNavCustomControlMessageFailedErr",
+		"kNavInvalidSystemConfigErr",
+		"kNavWrongDialogClassErr",
+		"kNavWrongDialogStateErr",
+		"dialogNoTimeoutErr",
+		"menuInvalidErr",
+		"menuItemNotFoundErr",
+		"menuUsesSystemDefErr",
+		"menuNotFoundErr",
+		"windowNoAppModalStateErr",
+		"windowAppModalStateAlreadyExistsErr",
+		"windowGroupInvalidErr",
+		"windowWrongStateErr",
+		"windowManagerInternalErr",
+		"windowAttributesConflictErr",
+		"windowAttributeImmutableErr",
+		"errWindowDoesNotFitOnscreen",
+		"errWindowNotFound",
+		"errFloatingWindowsNotInitialized",
+		"errWindowsAlreadyInitialized",
+		"errUserWantsToDragWindow",
+		"errCorruptWindowDescription",
+		"errUnrecognizedWindowClass",
+		"menuPropertyNotFoundErr",
+		"menuPropertyInvalidErr",
+		"errWindowDoesNotHaveProxy",
+		"errUnsupportedWindowAttributesForClass",
+		"errInvalidWindowPtr",
+		"gestaltLocationErr",
+		"gestaltDupSelectorErr",
+		"gestaltUndefSelectorErr",
+		"gestaltUnknownErr",
+		"envVersTooBig",
+		"envBadVers",
+		"envNotPresent",
+		"qtsAddressBusyErr",
+		"qtsConnectionFailedErr",
+		"qtsTimeoutErr",
+		"qtsUnknownValueErr",
+		"qtsTooMuchDataErr",
+		"qtsUnsupportedFeatureErr",
+		"qtsUnsupportedRateErr",
+		"qtsUnsupportedDataTypeErr",
+		"qtsBadDataErr",
+		"qtsBadStateErr",
+		"qtsBadSelectorErr",
+		"errIAEndOfTextRun",
+		"errIATextExtractionErr",
+		"errIAInvalidDocument",
+		"errIACanceled",
+		"errIABufferTooSmall",
+		"errIANoMoreItems",
+		"errIAParamErr",
+		"errIAAllocationErr",
+		"errIAUnknownErr",
+		"hrURLNotHandledErr",
+		"hrUnableToResizeHandleErr",
+		"hrMiscellaneousExceptionErr",
+		"hrHTMLRenderingLibNotInstalledErr",
+		"errCannotUndo",
+		"errNonContiuousAttribute",
+		"errUnknownElement",
+		"errReadOnlyText",
+		"errEmptyScrap",
+		"errNoHiliteText",
+		"errOffsetNotOnElementBounday",
+		"errInvalidRange",
+		"errIteratorReachedEnd",
+		"errEngineNotFound",
+		"errAlreadyInImagingMode",
+		"errNotInImagingMode",
+		"errMarginWilllNotFit",
+		"errUnknownAttributeTag",
+		"textParserNoMoreTokensErr",
+		"textParserNoSuchTokenFoundErr",
+		"textParserBadTextEncodingErr",
+		"textParserBadTextLanguageErr",
+		"textParserNoMoreTextErr",
+		"textParserParamErr",
+		"textParserBadParserObjectErr",
+		"textParserBadTokenValueErr",
+		"textParserObjectNotFoundErr",
+		"textParserBadParamErr",
+		"numberFormattingNotADigitErr",
+		"numberFormattingBadCurrencyPositionErr",
+		"numberFormattingUnOrderedCurrencyRangeErr",
+		"numberFormattingBadTokenErr",
+		"numberFormattingBadOptionsErr",
+		"numberFormattingBadFormatErr",
+		"numberFormattingEmptyFormatErr",
+		"numberFormattingDelimiterMissingErr",
+		"numberFormattingLiteralMissingErr",
+		"numberFormattingSpuriousCharErr",
+		"numberFormattingBadNumberFormattingObjectErr",
+		"numberFormattingOverflowInDestinationErr",
+		"numberFormattingNotANumberErr",
+		"afpSameNodeErr",
+		"afpAlreadyMounted",
+		"afpCantMountMoreSrvre",
+		"afpBadDirIDType",
+		"afpCallNotAllowed",
+		"afpAlreadyLoggedInErr",
+		"afpPwdPolicyErr",
+		"afpPwdNeedsChangeErr",
+		"afpInsideTrashErr",
+		"afpInsideSharedErr",
+		"afpPwdExpiredErr",
+		"afpPwdTooShortErr",
+		"afpPwdSameErr",
+		"afpBadIDErr",
+		"afpSameObjectErr",
+		"afpCatalogChanged",
+		"afpDiffVolErr",
+		"afpIDExists",
+		"afpIDNotFound",
+		"afpContainsSharedErr",
+		"afpObjectLocked",
+		"afpVolLocked",
+		"afpIconTypeError",
+		"afpDirNotFound",
+		"afpCantRename",
+		"afpServerGoingDown",
+		"afpTooManyFilesOpen",
+		"afpObjectTypeErr",
+		"afpCallNotSupported",
+		"afpUserNotAuth",
+		"afpSessClosed",
+		"afpRangeOverlap",
+		"afpRangeNotLocked",
+		"afpParmErr",
+		"afpObjectNotFound",
+		"afpObjectExists",
+		"afpNoServer",
+		"afpNoMoreLocks",
+		"afpMiscErr",
+		"afpLockErr",
+		"afpItemNotFound",
+		"afpFlatVol",
+		"afpFileBusy",
+		"afpEofError",
+		"afpDiskFull",
+		"afpDirNotEmpty",
+		"afpDenyConflict",
+		"afpCantMove",
+		"afpBitmapErr",
+		"afpBadVersNum",
+		"afpBadUAM",
+		"afpAuthContinue",
+		"afpAccessDenied",
+		"illegalScrapFlavorSizeErr",
+		"illegalScrapFlavorTypeErr",
+		"illegalScrapFlavorFlagsErr",
+		"scrapFlavorSizeMismatchErr",
+		"scrapFlavorFlagsMismatchErr",
+		"nilScrapFlavorDataErr",
+		"noScrapPromiseKeeperErr",
+		"scrapPromiseNotKeptErr",
+		"processStateIncorrectErr",
+		"badScrapRefErr",
+		"duplicateScrapFlavorErr",
+		"internalScrapErr",
+		"coreFoundationUnknownErr",
+		"errCoreEndianDataDoesNotMatchFormat",
+		"errCoreEndianDataTooLongForFormat",
+		"errCoreEndianDataTooShortForFormat",
+		"badRoutingSizeErr",
+		"routingNotFoundErr",
+		"duplicateRoutingErr",
+		"invalidFolderTypeErr",
+		"noMoreFolderDescErr",
+		"duplicateFolderDescErr",
+		"badFolderDescErr",
+		"cmCantGamutCheckError",
+		"cmNamedColorNotFound",
+		"cmCantCopyModifiedV1Profile",
+		"cmRangeOverFlow",
+		"cmInvalidProfileComment",
+		"cmNoGDevicesError",
+		"cmInvalidDstMap",
+		"cmInvalidSrcMap",
+		"cmInvalidColorSpace",
+		"cmErrIncompatibleProfile",
+		"cmSearchError",
+		"cmInvalidSearch",
+		"cmInvalidProfileLocation",
+		"cmInvalidProfile",
+		"cmFatalProfileErr",
+		"kDTPTryAgainErr",
+		"kDTPStopQueueErr",
+		"kNSLInitializationFailed",
+		"kNSLNotInitialized",
+		"kNSLInsufficientSysVer",
+		"kNSLInsufficientOTVer",
+		"kNSLNoElementsInList",
+		"kNSLBadReferenceErr",
+		"kNSLBadServiceTypeErr",
+		"kNSLBadDataTypeErr",
+		"kNSLBadNetConnection",
+		"kNSLNoSupportForService",
+		"kNSLInvalidPluginSpec",
+		"kNSLRequestBufferAlreadyInList",
+		"kNSLNoContextAvailable",
+		"kNSLBufferTooSmallForData",
+		"kNSLCannotContinueLookup",
+		"kNSLBadClientInfoPtr",
+		"kNSLNullListPtr",
+		"kNSLBadProtocolTypeErr",
+		"kNSLPluginLoadFailed",
+		"kNSLNoPluginsFound",
+		"kNSLSearchAlreadyInProgress",
+		"kNSLNoPluginsForSearch",
+		"kNSLNullNeighborhoodPtr",
+		"kNSLSomePluginsFailedToLoad",
+		"kNSLErrNullPtrError",
+		"kNSLNotImplementedYet",
+		"kNSLUILibraryNotAvailable",
+		"kNSLNoCarbonLib",
+		"kNSLBadURLSyntax",
+		"kNSLSchedulerError",
+		"kNSL68kContextNotSupported",
+		"noHelpForItem",
+		"badProfileError",
+		"colorSyncNotInstalled",
+		"pickerCantLive",
+		"cantLoadPackage",
+		"cantCreatePickerWindow",
+		"cantLoadPicker",
+		"pickerResourceError",
+		"requiredFlagsDontMatch",
+		"firstPickerError",
+		"kQDCorruptPICTDataErr",
+		"kQDCursorNotRegistered",
+		"kQDCursorAlreadyRegistered",
+		"kQDNoColorHWCursorSupport",
+		"kQDNoPalette",
+		"kOTPortLostConnection",
+		"kOTUserRequestedErr",
+		"kOTConfigurationChangedErr",
+		"kOTBadConfigurationErr",
+		"kOTPortWasEjectedErr",
+		"kOTPortHasDiedErr",
+		"kOTClientNotInittedErr",
+		"kENOMSGErr",
+		"kESRCHErr",
+		"kEINPROGRESSErr",
+		"kENODATAErr",
+		"kENOSTRErr",
+		"kECANCELErr",
+		"kEBADMSGErr",
+		"kENOSRErr",
+		"kETIMEErr",
+		"kEPROTOErr",
+		"kEHOSTUNREACHErr",
+		"kEHOSTDOWNErr",
+		"kECONNREFUSEDErr",
+		"kETIMEDOUTErr",
+		"kETOOMANYREFSErr",
+		"kESHUTDOWNErr",
+		"kENOTCONNErr",
+		"kEISCONNErr",
+		"kENOBUFSErr",
+		"kECONNRESETErr",
+		"kECONNABORTEDErr",
+		"kENETRESETErr",
+		"kENETUNREACHErr",
+		"kENETDOWNErr",
+		"kEADDRNOTAVAILErr",
+		"kEADDRINUSEErr",
+		"kEOPNOTSUPPErr",
+		"kESOCKTNOSUPPORTErr",
+		"kEPROTONOSUPPORTErr",
+		"kENOPROTOOPTErr",
+		"kEPROTOTYPEErr",
+		"kEMSGSIZEErr",
+		"kEDESTADDRREQErr",
+		"kENOTSOCKErr",
+		"kEALREADYErr",
+		"kEWOULDBLOCKErr",
+		"kERANGEErr",
+		"kEPIPEErr",
+		"kENOTTYErr",
+		"kEINVALErr",
+		"kENODEVErr",
+		"kOTDuplicateFoundErr",
+		"kEBUSYErr",
+		"kEFAULTErr",
+		"kEACCESErr",
+		"kOTOutOfMemoryErr",
+		"kEAGAINErr",
+		"kEBADFErr",
+		"kENXIOErr",
+		"kEIOErr",
+		"kEINTRErr",
+		"kENORSRCErr",
+		"kOTNotFoundErr",
+		"kEPERMErr",
+		"kOTCanceledErr",
+		"kOTBadSyncErr",
+		"kOTProtocolErr",
+		"kOTQFullErr",
+		"kOTResAddressErr",
+		"kOTResQLenErr",
+		"kOTProviderMismatchErr",
+		"kOTIndOutErr",
+		"kOTAddressBusyErr",
+		"kOTBadQLenErr",
+		"kOTBadNameErr",
+		"kOTNoStructureTypeErr",
+		"kOTStateChangeErr",
+		"kOTNotSupportedErr",
+		"kOTNoReleaseErr",
+		"kOTBadFlagErr",
+		"kOTNoUDErrErr",
+		"kOTNoDisconnectErr",
+		"kOTNoDataErr",
+		"kOTFlowErr",
+		"kOTBufferOverflowErr",
+		"kOTBadDataErr",
+		"kOTLookErr",
+		"kOTSysErrorErr",
+		"kOTBadSequenceErr",
+		"kOTOutStateErr",
+		"kOTNoAddressErr",
+		"kOTBadReferenceErr",
+		"kOTAccessErr",
+		"kOTBadOptionErr",
+		"kOTBadAddressErr",
+		"sktClosedErr",
+		"recNotFnd",
+		"atpBadRsp",
+		"atpLenErr",
+		"readQErr",
+		"extractErr",
+		"ckSumErr",
+		"noMPPErr",
+		"buf2SmallErr",
+		"noPrefAppErr",
+		"badTranslationSpecErr",
+		"noTranslationPathErr",
+		"couldNotParseSourceFileErr",
+		"invalidTranslationPathErr",
+		"retryComponentRegistrationErr",
+		"unresolvedComponentDLLErr",
+		"componentDontRegister",
+		"componentNotCaptured",
+		"validInstancesExist",
+		"invalidComponentID",
+		"cfragReservedCode_1",
+		"cfragReservedCode_2",
+		"cfragFirstReservedCode",
+		"cfragCFragRsrcErr",
+		"cfragRsrcForkErr",
+		"cfragStdFolderErr",
+		"cfragExecFileRefErr",
+		"cfragMapFileErr",
+		"cfragOutputLengthErr",
+		"cfragAbortClosureErr",
+		"cfragClosureIDErr",
+		"cfragContainerIDErr",
+		"cfragNoRegistrationErr",
+		"cfragNotClosureErr",
+		"cfragFileSizeErr",
+		"cfragFragmentUsageErr",
+		"cfragArchitectureErr",
+		"cfragNoApplicationErr",
+		"cfragInitFunctionErr",
+		"cfragFragmentCorruptErr",
+		"cfragCFMInternalErr",
+		"cfragCFMStartupErr",
+		"cfragLibConnErr",
+		"cfragInitAtBootErr",
+		"cfragInitLoopErr",
+		"cfragImportTooNewErr",
+		"cfragImportTooOldErr",
+		"cfragInitOrderErr",
+		"cfragNoIDsErr",
+		"cfragNoClientMemErr",
+		"cfragNoPrivateMemErr",
+		"cfragNoPositionErr",
+		"cfragUnresolvedErr",
+		"cfragFragmentFormatErr",
+		"cfragDupRegistrationErr",
+		"cfragNoLibraryErr",
+		"cfragNoSectionErr",
+		"cfragNoSymbolErr",
+		"cfragConnectionIDErr",
+		"cfragContextIDErr",
+		"errASInconsistentNames",
+		"errASNoResultReturned",
+		"errASParameterNotForEvent",
+		"errASIllegalFormalParameter",
+		"errASTerminologyNestingTooDeep",
+		"OSAControlFlowError",
+		"OSAInconsistentDeclarations",
+		"OSAUndefinedVariable",
+		"OSADuplicateHandler",
+		"OSADuplicateProperty",
+		"OSADuplicateParameter",
+		"OSATokenTooLong",
+		"OSASyntaxTypeError",
+		"OSASyntaxError",
+		"errASCantCompareMoreThan32k",
+		"errASCantConsiderAndIgnore",
+		"errOSACantCreate",
+		"errOSACantGetTerminology",
+		"errOSADataBlockTooLarge",
+		"errOSAInternalTableOverflow",
+		"errOSAStackOverflow",
+		"errOSACorruptTerminology",
+		"errOSAAppNotHighLevelEventAware",
+		"errOSACantLaunch",
+		"errOSANumericOverflow",
+		"errOSADivideByZero",
+		"errOSAGeneralError",
+		"noIconDataAvailableErr",
+		"noSuchIconErr",
+		"invalidIconRefErr",
+		"nrCallNotSupported",
+		"nrTransactionAborted",
+		"nrExitedIteratorScope",
+		"nrIterationDone",
+		"nrPropertyAlreadyExists",
+		"nrInvalidEntryIterationOp",
+		"nrPathBufferTooSmall",
+		"nrPathNotFound",
+		"nrResultCodeBase",
+		"nrOverrunErr",
+		"nrNotModifiedErr",
+		"nrTypeMismatchErr",
+		"nrPowerSwitchAbortErr",
+		"nrPowerErr",
+		"nrDataTruncatedErr",
+		"nrNotSlotDeviceErr",
+		"nrNameErr",
+		"nrNotCreatedErr",
+		"nrNotFoundErr",
+		"nrInvalidNodeErr",
+		"nrNotEnoughMemoryErr",
+		"nrLockedErr",
+		"tsmInputModeChangeFailedErr",
+		"tsmComponentPropertyNotFoundErr",
+		"tsmComponentPropertyUnsupportedErr",
+		"tsmCantChangeForcedClassStateErr",
+		"tsmDocPropertyBufferTooSmallErr",
+		"tsmDocPropertyNotFoundErr",
+		"mmInternalError",
+		"tsmDefaultIsNotInputMethodErr",
+		"tsmNoStem",
+		"tsmNoMoreTokens",
+		"tsmNoHandler",
+		"tsmInvalidContext",
+		"tsmUnknownErr",
+		"tsmUnsupportedTypeErr",
+		"tsmScriptHasNoIMErr",
+		"tsmInputMethodIsOldErr",
+		"tsmComponentAlreadyOpenErr",
+		"tsmTSNotOpenErr",
+		"tsmTSHasNoMenuErr",
+		"tsmUseInputWindowErr",
+		"tsmDocumentOpenErr",
+		"tsmTextServiceNotFoundErr",
+		"tsmCantOpenComponentErr",
+		"tsmNoOpenTSErr",
+		"tsmDocNotActiveErr",
+		"tsmTSMDocBusyErr",
+		"tsmInvalidDocIDErr",
+		"tsmNeverRegisteredErr",
+		"tsmAlreadyRegisteredErr",
+		"tsmNotAnAppErr",
+		"tsmInputMethodNotFoundErr",
+		"tsmUnsupScriptLanguageErr",
+		"kernelUnrecoverableErr",
+		"kernelReturnValueErr",
+		"kernelAlreadyFreeErr",
+		"kernelIDErr",
+		"kernelExceptionErr",
+		"kernelTerminatedErr",
+		"kernelInUseErr",
+		"kernelTimeoutErr",
+		"kernelAsyncReceiveLimitErr",
+		"kernelAsyncSendLimitErr",
+		"kernelAttributeErr",
+		"kernelExecutionLevelErr",
+		"kernelDeletePermissionErr",
+		"kernelExecutePermissionErr",
+		"kernelReadPermissionErr",
+		"kernelWritePermissionErr",
+		"kernelObjectExistsErr",
+		"kernelUnsupportedErr",
+		"kernelPrivilegeErr",
+		"kernelOptionsErr",
+		"kernelCanceledErr",
+		"kernelIncompleteErr",
+		"badCallOrderErr",
+		"noDMAErr",
+		"badDepthErr",
+		"notExactSizeErr",
+		"noMoreKeyColorsErr",
+		"notExactMatrixErr",
+		"matrixErr",
+		"qtParamErr",
+		"digiUnimpErr",
+		"qtXMLApplicationErr",
+		"qtXMLParseErr",
+		"qtActionNotHandledErr",
+		"notEnoughDataErr",
+		"urlDataHFTPURLErr",
+		"urlDataHFTPServerDisconnectedErr",
+		"urlDataHFTPNoPasswordErr",
+		"urlDataHFTPNeedPasswordErr",
+		"urlDataHFTPBadNameListErr",
+		"urlDataHFTPNoNetDriverErr",
+		"urlDataHFTPFilenameErr",
+		"urlDataHFTPPermissionsErr",
+		"urlDataHFTPQuotaErr",
+		"urlDataHFTPNoDirectoryErr",
+		"urlDataHFTPDataConnectionErr",
+		"urlDataHFTPServerErr",
+		"urlDataHFTPBadPasswordErr",
+		"urlDataHFTPBadUserErr",
+		"urlDataHFTPShutdownErr",
+		"urlDataHFTPProtocolErr",
+		"urlDataHHTTPRedirectErr",
+		"urlDataHHTTPURLErr",
+		"urlDataHHTTPNoNetDriverErr",
+		"urlDataHHTTPProtocolErr",
+		"qtNetworkAlreadyAllocatedErr",
+		"notAllowedToSaveMovieErr",
+		"fileOffsetTooBigErr",
+		"ASDEntryNotFoundErr",
+		"ASDBadForkErr",
+		"ASDBadHeaderErr",
+		"AAPNotFoundErr",
+		"AAPNotCreatedErr",
+		"qfcbNotCreatedErr",
+		"qfcbNotFoundErr",
+		"wackBadMetaDataErr",
+		"wackForkNotFoundErr",
+		"wackBadFileErr",
+		"unknownFormatErr",
+		"pathNotVerifiedErr",
+		"noPathMappingErr",
+		"emptyPathErr",
+		"pathTooLongErr",
+		"cannotBeLeafAtomErr",
+		"invalidAtomTypeErr",
+		"invalidAtomContainerErr",
+		"invalidAtomErr",
+		"duplicateAtomTypeAndIDErr",
+		"atomIndexInvalidErr",
+		"atomsNotOfSameTypeErr",
+		"notLeafAtomErr",
+		"cannotFindAtomErr",
+		"componentNotThreadSafeErr",
+		"unsupportedProcessorErr",
+		"unsupportedOSErr",
+		"qtmlUninitialized",
+		"qtmlDllEntryNotFoundErr",
+		"qtmlDllLoadErr",
+		"componentDllEntryNotFoundErr",
+		"componentDllLoadErr",
+		"videoOutputInUseErr",
+		"noExportProcAvailableErr",
+		"tuneParseOSErr",
+		"tunePlayerFullOSErr",
+		"noteChannelNotAllocatedOSErr",
+		"illegalNoteChannelOSErr",
+		"synthesizerOSErr",
+		"synthesizerNotRespondingOSErr",
+		"midiManagerAbsentOSErr",
+		"illegalControllerOSErr",
+		"illegalInstrumentOSErr",
+		"illegalKnobValueOSErr",
+		"illegalKnobOSErr",
+		"illegalChannelOSErr",
+		"illegalPartOSErr",
+		"illegalVoiceAllocationOSErr",
+		"cantReceiveFromSynthesizerOSErr",
+		"cantSendToSynthesizerOSErr",
+		"notImplementedMusicOSErr",
+		"internalComponentErr",
+		"invalidSpriteIDErr",
+		"invalidImageIndexErr",
+		"invalidSpriteIndexErr",
+		"gWorldsNotSameDepthAndSizeErr",
+		"invalidSpritePropertyErr",
+		"invalidSpriteWorldPropertyErr",
+		"missingRequiredParameterErr",
+		"movieTextNotFoundErr",
+		"sourceNotFoundErr",
+		"noSourceTreeFoundErr",
+		"samplesAlreadyInMediaErr",
+		"auxiliaryExportDataUnavailable",
+		"unsupportedAuxiliaryImportData",
+		"soundSupportNotAvailableErr",
+		"noSoundTrackInMovieErr",
+		"noVideoTrackInMovieErr",
+		"featureUnsupported",
+		"couldNotUseAnExistingSample",
+		"noDefaultDataRef",
+		"badDataRefIndex",
+		"invalidDataRefContainer",
+		"noMovieFound",
+		"dataNoDataRef",
+		"endOfDataReached",
+		"dataAlreadyClosed",
+		"dataAlreadyOpenForWrite",
+		"dataNotOpenForWrite",
+		"dataNotOpenForRead",
+		"invalidSampleDescription",
+		"invalidChunkCache",
+		"invalidSampleDescIndex",
+		"invalidChunkNum",
+		"invalidSampleNum",
+		"invalidRect",
+		"cantEnableTrack",
+		"internalQuickTimeError",
+		"badEditIndex",
+		"timeNotInMedia",
+		"timeNotInTrack",
+		"trackNotInMovie",
+		"trackIDNotFound",
+		"badTrackIndex",
+		"maxSizeToGrowTooSmall",
+		"userDataItemNotFound",
+		"staleEditState",
+		"nonMatchingEditState",
+		"invalidEditState",
+		"cantCreateSingleForkFile",
+		"wfFileNotFound",
+		"movieToolboxUninitialized",
+		"progressProcAborted",
+		"mediaTypesDontMatch",
+		"badEditList",
+		"cantPutPublicMovieAtom",
+		"invalidTime",
+		"invalidDuration",
+		"invalidHandler",
+		"invalidDataRef",
+		"invalidSampleTable",
+		"invalidMovie",
+		"invalidTrack",
+		"invalidMedia",
+		"noDataHandler",
+		"noMediaHandler",
+		"badComponentType",
+		"cantOpenHandler",
+		"cantFindHandler",
+		"badPublicMovieAtom",
+		"badImageDescription",
+		"couldNotResolveDataRef",
+		"nonDragOriginatorErr",
+		"badImageErr",
+		"badImageRgnErr",
+		"noSuitableDisplaysErr",
+		"unsupportedForPlatformErr",
+		"dragNotAcceptedErr",
+		"handlerNotFoundErr",
+		"duplicateHandlerErr",
+		"cantGetFlavorErr",
+		"duplicateFlavorErr",
+		"badDragFlavorErr",
+		"badDragItemErr",
+		"badDragRefErr",
+		"errEndOfBody",
+		"errEndOfDocument",
+		"errTopOfBody",
+		"errTopOfDocument",
+		"errOffsetIsOutsideOfView",
+		"errOffsetInvalid",
+		"errOSACantOpenComponent",
+		"errOSAComponentMismatch",
+		"errOSADataFormatTooNew",
+		"errOSADataFormatObsolete",
+		"errOSANoSuchDialect",
+		"errOSASourceNotAvailable",
+		"errOSABadSelector",
+		"errOSAScriptError",
+		"errOSABadStorageType",
+		"errOSAInvalidID",
+		"errOSASystemError",
+		"errAEBufferTooSmall",
+		"errAEBuildSyntaxError",
+		"errAEDescIsNull",
+		"errAEStreamAlreadyConverted",
+		"errAEStreamBadNesting",
+		"errAEDuplicateHandler",
+		"errAEEventFiltered",
+		"errAEReceiveEscapeCurrent",
+		"errAEReceiveTerminate",
+		"errAERecordingIsAlreadyOn",
+		"errAEUnknownObjectType",
+		"errAEEmptyListContainer",
+		"errAENegativeCount",
+		"errAENoSuchObject",
+		"errAENotAnObjSpec",
+		"errAEBadTestKey",
+		"errAENoSuchLogical",
+		"errAEAccessorNotFound",
+		"errAEWrongNumberArgs",
+		"errAEImpossibleRange",
+		"errAEIllegalIndex",
+		"errAEReplyNotArrived",
+		"errAEHandlerNotFound",
+		"errAEUnknownAddressType",
+		"errAEParamMissed",
+		"errAENotASpecialFunction",
+		"errAENoUserInteraction",
+		"errAETimeout",
+		"errAEWaitCanceled",
+		"errAEUnknownSendMode",
+		"errAEReplyNotValid",
+		"errAEEventNotHandled",
+		"errAENotAppleEvent",
+		"errAENewerVersion",
+		"errAEBadListItem",
+		"errAENotAEDesc",
+		"errAEWrongDataType",
+		"errAECorruptData",
+		"errAEDescNotFound",
+		"errAECoercionFail",
+		"errFSNotEnoughSpaceForOperation",
+		"errFSPropertyNotValid",
+		"errFSAttributeNotFound",
+		"errFSOperationNotSupported",
+		"errFSQuotaExceeded",
+		"errFSIteratorNotSupported",
+		"errFSIteratorNotFound",
+		"errFSBadIteratorFlags",
+		"errFSForkExists",
+		"errFSRefsDifferent",
+		"errFSBadSearchParams",
+		"errFSBadItemCount",
+		"errFSNoMoreItems",
+		"errFSBadAllocFlags",
+		"errFSBadPosMode",
+		"errFSMissingName",
+		"errFSNameTooLong",
+		"errFSForkNotFound",
+		"errFSNotAFolder",
+		"errFSMissingCatInfo",
+		"errFSBadInfoBitmap",
+		"errFSBadForkRef",
+		"errFSBadBuffer",
+		"errFSBadForkName",
+		"errFSBadFSRef",
+		"errFSUnknownCall",
+		"badFCBErr",
+		"volVMBusyErr",
+		"fsDataTooBigErr",
+		"fileBoundsErr",
+		"notARemountErr",
+		"badFidErr",
+		"sameFileErr",
+		"desktopDamagedErr",
+		"catChangedErr",
+		"diffVolErr",
+		"notAFileErr",
+		"fidExists",
+		"fidNotFound",
+		"errRefNum",
+		"errAborted",
+		"errState",
+		"errOpening",
+		"errAttention",
+		"errFwdReset",
+		"errDSPQueueSize",
+		"errOpenDenied",
+		"reqAborted",
+		"noDataArea",
+		"noSendResp",
+		"cbNotFound",
+		"noRelErr",
+		"badBuffNum",
+		"badATPSkt",
+		"tooManySkts",
+		"tooManyReqs",
+		"reqFailed",
+		"aspNoAck",
+		"aspTooMany",
+		"aspSizeErr",
+		"aspSessClosed",
+		"aspServerBusy",
+		"aspParamErr",
+		"aspNoServers",
+		"aspNoMoreSess",
+		"aspBufTooSmall",
+		"aspBadVersNum",
+		"nbpNISErr",
+		"nbpNotFound",
+		"nbpDuplicate",
+		"nbpConfDiff",
+		"nbpNoConfirm",
+		"nbpBuffOvr",
+		"noMaskFoundErr",
+		"kFMFontContainerAccessErr",
+		"kFMFontTableAccessErr",
+		"kFMIterationScopeModifiedErr",
+		"kFMInvalidFontErr",
+		"kFMInvalidFontFamilyErr",
+		"kFMIterationCompleted",
+		"guestNotAllowedErr",
+		"badLocNameErr",
+		"badServiceMethodErr",
+		"noUserRecErr",
+		"authFailErr",
+		"noInformErr",
+		"networkErr",
+		"noUserRefErr",
+		"notLoggedInErr",
+		"noDefaultUserErr",
+		"badPortNameErr",
+		"sessClosedErr",
+		"portClosedErr",
+		"noResponseErr",
+		"noToolboxNameErr",
+		"noMachineNameErr",
+		"userRejectErr",
+		"noUserNameErr",
+		"portNameExistsErr",
+		"badReqErr",
+		"noSessionErr",
+		"sessTableErr",
+		"destPortErr",
+		"localOnlyErr",
+		"noGlobalsErr",
+		"noPortErr",
+		"nameTypeErr",
+		"notInitErr",
+		"notAppropriateForClassic",
+		"appVersionTooOld",
+		"wrongApplicationPlatform",
+		"hmCloseViewActive",
+		"hmNoBalloonUp",
+		"hmOperationUnsupported",
+		"hmUnknownHelpType",
+		"hmWrongVersion",
+		"hmSkippedBalloon",
+		"hmHelpManagerNotInited",
+		"hmSameAsLastBalloon",
+		"hmBalloonAborted",
+		"hmHelpDisabled",
+		"rcDBPackNotInited",
+		"rcDBWrongVersion",
+		"rcDBNoHandler",
+		"rcDBBadAsyncPB",
+		"rcDBAsyncNotSupp",
+		"rcDBBadDDEV",
+		"rcDBBadSessNum",
+		"rcDBBadSessID",
+		"rcDBExec",
+		"rcDBBreak",
+		"rcDBBadType",
+		"rcDBError",
+		"rcDBValue",
+		"rcDBNull",
+		"vmInvalidOwningProcessErr",
+		"vmAddressNotInFileViewErr",
+		"vmNoMoreFileViewsErr",
+		"vmFileViewAccessErr",
+		"vmInvalidFileViewIDErr",
+		"vmNoMoreBackingFilesErr",
+		"vmBusyBackingFileErr",
+		"vmMappingPrivilegesErr",
+		"vmInvalidBackingFileIDErr",
+		"vmNoVectorErr",
+		"vmBadDriver",
+		"vmMemLckdErr",
+		"vmOffErr",
+		"vmKernelMMUInitErr",
+		"vmMorePhysicalThanVirtualErr",
+		"noMMUErr",
+		"cannotDeferErr",
+		"interruptsMaskedErr",
+		"notLockedErr",
+		"cannotMakeContiguousErr",
+		"notHeldErr",
+		"notEnoughMemoryErr",
+		"threadProtocolErr",
+		"threadNotFoundErr",
+		"threadTooManyReqsErr",
+		"threadBadAppContextErr",
+		"noUserInteractionAllowed",
+		"connectionInvalid",
+		"noOutstandingHLE",
+		"bufferIsSmall",
+		"appIsDaemon",
+		"appMemFullErr",
+		"hardwareConfigErr",
+		"protocolErr",
+		"appModeErr",
+		"memFragErr",
+		"procNotFound",
+		"driverHardwareGoneErr",
+		"hwParamErr",
+		"teScrapSizeErr",
+		"rgnTooBigErr",
+		"exUserBreak",
+		"strUserBreak",
+		"userBreak",
+		"notThePublisherWrn",
+		"containerAlreadyOpenWrn",
+		"containerNotFoundWrn",
+		"multiplePublisherWrn",
+		"badSubPartErr",
+		"badEditionFileErr",
+		"notRegisteredSectionErr",
+		"badSectionErr",
+		"editionMgrInitErr",
+		"fsmUnknownFSMMessageErr",
+		"fsmNoAlternateStackErr",
+		"fsmBadFSDVersionErr",
+		"fsmDuplicateFSIDErr",
+		"fsmBadFSDLenErr",
+		"fsmBadFFSNameErr",
+		"fsmBusyFFSErr",
+		"fsmFFSNotFoundErr",
+		"btKeyAttrErr",
+		"btKeyLenErr",
+		"btRecNotFnd",
+		"btDupRecErr",
+		"btNoSpace",
+		"notBTree",
+		"gcrOnMFMErr",
+		"slotNumErr",
+		"smRecNotFnd",
+		"smSRTOvrFlErr",
+		"smNoGoodOpens",
+		"smOffsetErr",
+		"smByteLanesErr",
+		"smBadsPtrErr",
+		"smsGetDrvrErr",
+		"smNoMoresRsrcs",
+		"smDisDrvrNamErr",
+		"smGetDrvrNamErr",
+		"smCkStatusErr",
+		"smBlkMoveErr",
+		"smNewPErr",
+		"smSelOOBErr",
+		"smSlotOOBErr",
+		"smNilsBlockErr",
+		"smsPointerNil",
+		"smCPUErr",
+		"smCodeRevErr",
+		"smReservedErr",
+		"smBadsList",
+		"smBadRefId",
+		"smBusErrTO",
+		"smBadBoardId",
+		"smNoJmpTbl",
+		"smInitTblVErr",
+		"smInitStatVErr",
+		"smNoBoardId",
+		"smGetPRErr",
+		"smNoBoardSRsrc",
+		"smDisposePErr",
+		"smFHBlkDispErr",
+		"smFHBlockRdErr",
+		"smBLFieldBad",
+		"smUnExBusErr",
+		"smResrvErr",
+		"smNosInfoArray",
+		"smDisabledSlot",
+		"smNoDir",
+		"smRevisionErr",
+		"smFormatErr",
+		"smCRCFail",
+		"smEmptySlot",
+		"nmTypErr",
+		"smPriInitErr",
+		"smPRAMInitErr",
+		"smSRTInitErr",
+		"smSDMInitErr",
+		"midiInvalidCmdErr",
+		"midiDupIDErr",
+		"midiNameLenErr",
+		"midiWriteErr",
+		"midiNoConErr",
+		"midiVConnectRmvd",
+		"midiVConnectMade",
+		"midiVConnectErr",
+		"midiTooManyConsErr",
+		"midiTooManyPortsErr",
+		"midiNoPortErr",
+		"midiNoClientErr",
+		"badInputText",
+		"badDictFormat",
+		"incompatibleVoice",
+		"voiceNotFound",
+		"bufTooSmall",
+		"synthNotReady",
+		"synthOpenFailed",
+		"noSynthFound",
+		"siUnknownQuality",
+		"siUnknownInfoType",
+		"siInputDeviceErr",
+		"siBadRefNum",
+		"siBadDeviceName",
+		"siDeviceBusyErr",
+		"siInvalidSampleSize",
+		"siInvalidSampleRate",
+		"siHardDriveTooSlow",
+		"siInvalidCompression",
+		"siNoBufferSpecified",
+		"siBadSoundInDevice",
+		"siNoSoundInHardware",
+		"siVBRCompressionNotSupported",
+		"noMoreRealTime",
+		"channelNotBusy",
+		"buffersTooSmall",
+		"channelBusy",
+		"badFileFormat",
+		"notEnoughBufferSpace",
+		"badFormat",
+		"badChannel",
+		"resProblem",
+		"queueFull",
+		"notEnoughHardwareErr",
+		"noHardwareErr",
+		"mapReadErr",
+		"resAttrErr",
+		"rmvRefFailed",
+		"rmvResFailed",
+		"addRefFailed",
+		"addResFailed",
+		"resFNotFound",
+		"resNotFound",
+		"inputOutOfBounds",
+		"writingPastEnd",
+		"resourceInMemory",
+		"CantDecompress",
+		"badExtResource",
+		"cmNoCurrentProfile",
+		"cmUnsupportedDataType",
+		"cmCantDeleteProfile",
+		"cmCantXYZ",
+		"cmCantConcatenateError",
+		"cmProfilesIdentical",
+		"cmProfileNotFound",
+		"cmMethodNotFound",
+		"cmMethodError",
+		"cmProfileError",
+		"cDepthErr",
+		"cResErr",
+		"cDevErr",
+		"cProtectErr",
+		"cRangeErr",
+		"cNoMemErr",
+		"cTempMemErr",
+		"cMatchErr",
+		"insufficientStackErr",
+		"pixMapTooDeepErr",
+		"rgnOverflowErr",
+		"noMemForPictPlaybackErr",
+		"userCanceledErr",
+		"fsDSIntErr",
+		"mBarNFnd",
+		"updPixMemErr",
+		"volGoneErr",
+		"wrgVolTypErr",
+		"badMovErr",
+		"tmwdoErr",
+		"dirNFErr",
+		"memLockedErr",
+		"memSCErr",
+		"memBCErr",
+		"memPCErr",
+		"memAZErr",
+		"memPurErr",
+		"memWZErr",
+		"memAdrErr",
+		"nilHandleErr",
+		"memFullErr",
+		"noTypeErr",
+		"noScrapErr",
+		"memROZWarn",
+		"portNotCf",
+		"portInUse",
+		"portNotPwr",
+		"excessCollsns",
+		"lapProtErr",
+		"noBridgeErr",
+		"eLenErr",
+		"eMultiErr",
+		"breakRecd",
+		"rcvrErr",
+		"prInitErr",
+		"prWrErr",
+		"clkWrErr",
+		"clkRdErr",
+		"verErr",
+		"fmt2Err",
+		"fmt1Err",
+		"sectNFErr",
+		"seekErr",
+		"spdAdjErr",
+		"twoSideErr",
+		"initIWMErr",
+		"tk0BadErr",
+		"cantStepErr",
+		"wrUnderrun",
+		"badDBtSlp",
+		"badDCksum",
+		"noDtaMkErr",
+		"badBtSlpErr",
+		"badCksmErr",
+		"dataVerErr",
+		"noAdrMkErr",
+		"fontSubErr",
+		"fontNotDeclared",
+		"fontDecError",
+		"wrPermErr",
+		"badMDBErr",
+		"fsRnErr",
+		"extFSErr",
+		"noMacDskErr",
+		"nsDrvErr",
+		"volOnLinErr",
+		"permErr",
+		"volOffLinErr",
+		"gfpErr",
+		"rfNumErr",
+		"paramErr",
+		"opWrErr",
+		"dupFNErr",
+		"fBsyErr",
+		"vLckdErr",
+		"fLckdErr",
+		"wPrErr",
+		"fnfErr",
+		"tmfoErr",
+		"mFulErr",
+		"posErr",
+		"eofErr",
+		"fnOpnErr",
+		"bdNamErr",
+		"ioErr",
+		"nsvErr",
+		"dskFulErr",
+		"dirFulErr",
+		"dceExtErr",
+		"unitTblFullErr",
+		"notOpenErr",
+		"abortErr",
+		"dInstErr",
+		"dRemovErr",
+		"closErr",
+		"openErr",
+		"unitEmptyErr",
+		"badUnitErr",
+		"writErr",
+		"readErr",
+		"statusErr",
+		"controlErr",
+		"dsExtensionsDisabled",
+		"dsHD20Installed",
+		"dsDisassemblerInstalled",
+		"dsMacsBugInstalled",
+		"seNoDB",
+		"SlpTypeErr",
+		"unimpErr",
+		"corErr",
+		"vTypErr",
+		"qErr",
+		"noErr",
+		"evtNotEnb",
+		"siInitVBLQsErr",
+		"siInitSPTblErr",
+		"dsZeroDivErr",
+		"dsChkErr",
+		"dsOvflowErr",
+		"dsPrivErr",
+		"telNoTools",
+		"dsLineAErr",
+		"sdmJTInitErr",
+		"sdmInitErr",
+		"sdmSRTInitErr",
+		"sdmPRAMInitErr",
+		"sdmPriInitErr",
+		"dsLoadErr",
+		"dsFPErr",
+		"dsNoPackErr",
+		"dsNoPk1",
+		"dsNoPk2",
+		"dsNoPk3",
+		"dsNoPk4",
+		"dsNoPk5",
+		"dsNoPk6",
+		"dsNoPk7",
+		"dsMemFullErr",
+		"dsBadLaunch",
+		"dsFSErr",
+		"dsStknHeap",
+		"dsReinsert",
+		"dsNotThe1",
+		"negZcbFreeErr",
+		"dsGreeting",
+		"dsFinderErr",
+		"shutDownAlert",
+		"dsSystemFileErr",
+		"dsBadSlotInt",
+		"dsBadSANEOpcode",
+		"dsBadPatchHeader",
+		"menuPrgErr",
+		"dsMBarNFnd",
+		"dsHMenuFindErr",
+		"dsWDEFNotFound",
+		"dsCDEFNotFound",
+		"dsMDEFNotFound",
+		"dsNoFPU",
+		"dsNoPatch",
+		"dsBadPatch",
+		"dsParityErr",
+		"dsOldSystem",
+		"ds32BitMode",
+		"dsNeedToWriteBootBlocks",
+		"dsNotEnoughRAMToBoot",
+		"dsBufPtrTooLow",
+		"dsVMDeferredFuncTableFull",
+		"dsVMBadBackingStore",
+		"dsCantHoldSystemHeap",
+		"dsSystemRequiresPowerPC",
+		"dsGibblyMovedToDisabledFolder",
+		"dsUnBootableSystem",
+		"dsMustUseFCBAccessors",
+		"dsMacOSROMVersionTooOld",
+		"dsLostConnectionToNetworkDisk",
+		"dsRAMDiskTooBig",
+		"kDTPAbortJobErr",
+		"dsBadLibrary",
+		"dsMixedModeFailure",
+		"dsShutDownOrRestart",
+		"dsSwitchOffOrRestart",
+		"dsForcedQuit",
+		"dsRemoveDisk",
+		"dsDirtyDisk",
+		"dsSCSIWarn",
+		"dsShutDownOrResume",
+		"dsMBSysError",
+		"dsMBFlpySysError",
+		"dsMBATASysError",
+		"dsMBATAPISysError",
+		"dsMBExternFlpySysError",
+		"dsPCCardATASysError",
+		"dsSysErr",
+		"kPOSIXErrorBase",
+		"kPOSIXErrorEPERM",
+		"kPOSIXErrorENOENT",
+		"kPOSIXErrorESRCH",
+		"kPOSIXErrorEINTR",
+		"kPOSIXErrorEIO",
+		"kPOSIXErrorENXIO",
+		"kPOSIXErrorE2BIG",
+		"kPOSIXErrorENOEXEC",
+		"kPOSIXErrorEBADF",
+		"kPOSIXErrorECHILD",
+		"kPOSIXErrorEDEADLK",
+		"kPOSIXErrorENOMEM",
+		"kPOSIXErrorEACCES",
+		"kPOSIXErrorEFAULT",
+		"kPOSIXErrorENOTBLK",
+		"kPOSIXErrorEBUSY",
+		"kPOSIXErrorEEXIST",
+		"kPOSIXErrorEXDEV",
+		"kPOSIXErrorENODEV",
+		"kPOSIXErrorENOTDIR",
+		"kPOSIXErrorEISDIR",
+		"kPOSIXErrorEINVAL",
+		"kPOSIXErrorENFILE",
+		"kPOSIXErrorEMFILE",
+		"kPOSIXErrorENOTTY",
+		"kPOSIXErrorETXTBSY",
+		"kPOSIXErrorEFBIG",
+		"kPOSIXErrorENOSPC",
+		"kPOSIXErrorESPIPE",
+		"kPOSIXErrorEROFS",
+		"kPOSIXErrorEMLINK",
+		"kPOSIXErrorEPIPE",
+		"kPOSIXErrorEDOM",
+		"kPOSIXErrorERANGE",
+		"kPOSIXErrorEAGAIN",
+		"kPOSIXErrorEINPROGRESS",
+		"kPOSIXErrorEALREADY",
+		"kPOSIXErrorENOTSOCK",
+		"kPOSIXErrorEDESTADDRREQ",
+		"kPOSIXErrorEMSGSIZE",
+		"kPOSIXErrorEPROTOTYPE",
+		"kPOSIXErrorENOPROTOOPT",
+		"kPOSIXErrorEPROTONOSUPPORT",
+		"kPOSIXErrorESOCKTNOSUPPORT",
+		"kPOSIXErrorENOTSUP",
+		"kPOSIXErrorEPFNOSUPPORT",
+		"kPOSIXErrorEAFNOSUPPORT",
+		"kPOSIXErrorEADDRINUSE",
+		"kPOSIXErrorEADDRNOTAVAIL",
+		"kPOSIXErrorENETDOWN",
+		"kPOSIXErrorENETUNREACH",
+		"kPOSIXErrorENETRESET",
+		"kPOSIXErrorECONNABORTED",
+		"kPOSIXErrorECONNRESET",
+		"kPOSIXErrorENOBUFS",
+		"kPOSIXErrorEISCONN",
+		"kPOSIXErrorENOTCONN",
+		"kPOSIXErrorESHUTDOWN",
+		"kPOSIXErrorETOOMANYREFS",
+		"kPOSIXErrorETIMEDOUT",
+		"kPOSIXErrorECONNREFUSED",
+		"kPOSIXErrorELOOP",
+		"kPOSIXErrorENAMETOOLONG",
+		"kPOSIXErrorEHOSTDOWN",
+		"kPOSIXErrorEHOSTUNREACH",
+		"kPOSIXErrorENOTEMPTY",
+		"kPOSIXErrorEPROCLIM",
+		"kPOSIXErrorEUSERS",
+		"kPOSIXErrorEDQUOT",
+		"kPOSIXErrorESTALE",
+		"kPOSIXErrorEREMOTE",
+		"kPOSIXErrorEBADRPC",
+		"kPOSIXErrorERPCMISMATCH",
+		"kPOSIXErrorEPROGUNAVAIL",
+		"kPOSIXErrorEPROGMISMATCH",
+		"kPOSIXErrorEPROCUNAVAIL",
+		"kPOSIXErrorENOLCK",
+		"kPOSIXErrorENOSYS",
+		"kPOSIXErrorEFTYPE",
+		"kPOSIXErrorEAUTH",
+		"kPOSIXErrorENEEDAUTH",
+		"kPOSIXErrorEPWROFF",
+		"kPOSIXErrorEDEVERR",
+		"kPOSIXErrorEOVERFLOW",
+		"kPOSIXErrorEBADEXEC",
+		"kPOSIXErrorEBADARCH",
+		"kPOSIXErrorESHLIBVERS",
+		"kPOSIXErrorEBADMACHO",
+		"kPOSIXErrorECANCELED",
+		"kPOSIXErrorEIDRM",
+		"kPOSIXErrorENOMSG",
+		"kPOSIXErrorEILSEQ",
+		"kPOSIXErrorENOATTR",
+		"kPOSIXErrorEBADMSG",
+		"kPOSIXErrorEMULTIHOP",
+		"kPOSIXErrorENODATA",
+		"kPOSIXErrorENOLINK",
+		"kPOSIXErrorENOSR",
+		"kPOSIXErrorENOSTR",
+		"kPOSIXErrorEPROTO",
+		"kPOSIXErrorETIME",
+		"kPOSIXErrorEOPNOTSUPP",
+	};
+
+	inline constexpr size_t kCodeCount = sizeof(kCodes) / sizeof(kCodes[0]);
+
+	constexpr int32_t
+	ToStatus(long long status) noexcept
+	{
+		return (int32_t)(uint32_t)(unsigned long long)status;
+	}
+
+} /* namespace Private */
+
+/*
+ *  ErrorNameOf()
+ *
+ *  Summary:
+ *    Returns the name of an OSStatus value, or NULL if MacErrors.h does not define it.
+ *    Usable in constant expressions.
+ */
+constexpr const char *
+ErrorNameOf(long long status) noexcept
+{
+	int32_t     code = Private::ToStatus(status);
+	size_t      low = 0;
+	size_t      high = Private::kCodeCount;
+
+	while ( low < high )
+	{
+		size_t middle = low + (high - low) / 2;
+
+		if ( Private::kCodes[middle] < code )
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	return ( low < Private::kCodeCount && Private::kCodes[low] == code ) ? Private::kNames[low] : NULL;
+}
+
+/*
+ *  ErrorName()
+ *
+ *  Summary:
+ *    The name of an OSStatus constant, always computed at compile time.
+ *
+ *  Examples:
+ *     fprintf(stderr, "open failed: %s\n", MacErrors::ErrorName<fnfErr>());
+ *     static_assert(MacErrors::ErrorName<-43>()[0] == 'f', "");
+ */
+template <long long status>
+constexpr const char *
+ErrorName() noexcept
+{
+	constexpr const char *name = ErrorNameOf(status);
+
+	static_assert(name != NULL, "not an OSStatus defined in MacErrors.h");
+	return name;
+}
+
+} /* namespace MacErrors */
+
+#endif /* defined(__cplusplus) && (__cplusplus >= 201703L) */
+
+#endif /* __MACERRORSNAMES__ */
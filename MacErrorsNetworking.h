@@ -0,0 +1,493 @@
+/*
+ * Copyright (c) 1985-2008 by Apple Inc.. All rights reserved.
+ *
+ * @APPLE_LICENSE_HEADER_START@
+ * 
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ * 
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ * 
+ * @APPLE_LICENSE_HEADER_END@
+ */
+ 
+/*
+     File:       MacErrorsNetworking.h
+ 
+     Contains:   OSErr codes: AppleTalk, Open Transport and other networking errors.
+ 
+                 MacErrors.h includes this header; include it alone to define only
+                 these codes.  Split from MacErrors.h by tools/MacErrorsSplit.py.
+ 
+     Version:    CarbonCore-769~1
+  
+     Bugs?:      For bug reports, consult the following page on
+                 the World Wide Web:
+ 
+                     http://developer.apple.com/bugreporter/
+ 
+*/
+#ifndef __MACERRORSNETWORKING__
+#define __MACERRORSNETWORKING__
+
+enum {
+                                        /* ENET error codes */
+  eLenErr                       = -92,  /*Length error ddpLenErr*/
+  eMultiErr                     = -91   /*Multicast address error ddpSktErr*/
+};
+
+enum {
+  ddpSktErr                     = -91,  /*error in soket number*/
+  ddpLenErr                     = -92,  /*data length too big*/
+  noBridgeErr                   = -93,  /*no network bridge for non-local send*/
+  lapProtErr                    = -94,  /*error in attaching/detaching protocol*/
+  excessCollsns                 = -95,  /*excessive collisions on write*/
+  portNotPwr                    = -96,  /*serial port not currently powered*/
+  portInUse                     = -97,  /*driver Open error code (port is in use)*/
+  portNotCf                     = -98   /*driver Open error code (parameter RAM not configured for this connection)*/
+};
+
+
+
+enum {
+                                        /*PPC errors*/
+  notInitErr                    = -900, /*PPCToolBox not initialized*/
+  nameTypeErr                   = -902, /*Invalid or inappropriate locationKindSelector in locationName*/
+  noPortErr                     = -903, /*Unable to open port or bad portRefNum.  If you're calling */
+                                        /* AESend, this is because your application does not have */
+                                        /* the isHighLevelEventAware bit set in your SIZE resource. */
+  noGlobalsErr                  = -904, /*The system is hosed, better re-boot*/
+  localOnlyErr                  = -905, /*Network activity is currently disabled*/
+  destPortErr                   = -906, /*Port does not exist at destination*/
+  sessTableErr                  = -907, /*Out of session tables, try again later*/
+  noSessionErr                  = -908, /*Invalid session reference number*/
+  badReqErr                     = -909, /*bad parameter or invalid state for operation*/
+  portNameExistsErr             = -910, /*port is already open (perhaps in another app)*/
+  noUserNameErr                 = -911, /*user name unknown on destination machine*/
+  userRejectErr                 = -912, /*Destination rejected the session request*/
+  noMachineNameErr              = -913, /*user hasn't named his Macintosh in the Network Setup Control Panel*/
+  noToolboxNameErr              = -914, /*A system resource is missing, not too likely*/
+  noResponseErr                 = -915, /*unable to contact destination*/
+  portClosedErr                 = -916, /*port was closed*/
+  sessClosedErr                 = -917, /*session was closed*/
+  badPortNameErr                = -919, /*PPCPortRec malformed*/
+  noDefaultUserErr              = -922, /*user hasn't typed in owners name in Network Setup Control Pannel*/
+  notLoggedInErr                = -923, /*The default userRefNum does not yet exist*/
+  noUserRefErr                  = -924, /*unable to create a new userRefNum*/
+  networkErr                    = -925, /*An error has occurred in the network, not too likely*/
+  noInformErr                   = -926, /*PPCStart failed because destination did not have inform pending*/
+  authFailErr                   = -927, /*unable to authenticate user at destination*/
+  noUserRecErr                  = -928, /*Invalid user reference number*/
+  badServiceMethodErr           = -930, /*illegal service type, or not supported*/
+  badLocNameErr                 = -931, /*location name malformed*/
+  guestNotAllowedErr            = -932  /*destination port requires authentication*/
+};
+
+enum {
+  nbpBuffOvr                    = -1024, /*Buffer overflow in LookupName*/
+  nbpNoConfirm                  = -1025,
+  nbpConfDiff                   = -1026, /*Name confirmed at different socket*/
+  nbpDuplicate                  = -1027, /*Duplicate name exists already*/
+  nbpNotFound                   = -1028, /*Name not found on remove*/
+  nbpNISErr                     = -1029 /*Error trying to open the NIS*/
+};
+
+enum {
+  aspBadVersNum                 = -1066, /*Server cannot support this ASP version*/
+  aspBufTooSmall                = -1067, /*Buffer too small*/
+  aspNoMoreSess                 = -1068, /*No more sessions on server*/
+  aspNoServers                  = -1069, /*No servers at that address*/
+  aspParamErr                   = -1070, /*Parameter error*/
+  aspServerBusy                 = -1071, /*Server cannot open another session*/
+  aspSessClosed                 = -1072, /*Session closed*/
+  aspSizeErr                    = -1073, /*Command block too big*/
+  aspTooMany                    = -1074, /*Too many clients (server error)*/
+  aspNoAck                      = -1075 /*No ack on attention request (server err)*/
+};
+
+enum {
+  reqFailed                     = -1096,
+  tooManyReqs                   = -1097,
+  tooManySkts                   = -1098,
+  badATPSkt                     = -1099,
+  badBuffNum                    = -1100,
+  noRelErr                      = -1101,
+  cbNotFound                    = -1102,
+  noSendResp                    = -1103,
+  noDataArea                    = -1104,
+  reqAborted                    = -1105
+};
+
+/* ADSP Error Codes */
+enum {
+                                        /* driver control ioResults */
+  errRefNum                     = -1280, /* bad connection refNum */
+  errAborted                    = -1279, /* control call was aborted */
+  errState                      = -1278, /* bad connection state for this operation */
+  errOpening                    = -1277, /* open connection request failed */
+  errAttention                  = -1276, /* attention message too long */
+  errFwdReset                   = -1275, /* read terminated by forward reset */
+  errDSPQueueSize               = -1274, /* DSP Read/Write Queue Too small */
+  errOpenDenied                 = -1273 /* open connection request was denied */
+};
+
+enum {
+  buf2SmallErr                  = -3101,
+  noMPPErr                      = -3102,
+  ckSumErr                      = -3103,
+  extractErr                    = -3104,
+  readQErr                      = -3105,
+  atpLenErr                     = -3106,
+  atpBadRsp                     = -3107,
+  recNotFnd                     = -3108,
+  sktClosedErr                  = -3109
+};
+
+
+/* OpenTransport errors*/
+enum {
+  kOTNoError                    = 0,    /* No Error occurred                    */
+  kOTOutOfMemoryErr             = -3211, /* OT ran out of memory, may be a temporary      */
+  kOTNotFoundErr                = -3201, /* OT generic not found error               */
+  kOTDuplicateFoundErr          = -3216, /* OT generic duplicate found error             */
+  kOTBadAddressErr              = -3150, /* XTI2OSStatus(TBADADDR) A Bad address was specified          */
+  kOTBadOptionErr               = -3151, /* XTI2OSStatus(TBADOPT) A Bad option was specified             */
+  kOTAccessErr                  = -3152, /* XTI2OSStatus(TACCES) Missing access permission           */
+  kOTBadReferenceErr            = -3153, /* XTI2OSStatus(TBADF) Bad provider reference               */
+  kOTNoAddressErr               = -3154, /* XTI2OSStatus(TNOADDR) No address was specified           */
+  kOTOutStateErr                = -3155, /* XTI2OSStatus(TOUTSTATE) Call issued in wrong state           */
+  kOTBadSequenceErr             = -3156, /* XTI2OSStatus(TBADSEQ) Sequence specified does not exist         */
+  kOTSysErrorErr                = -3157, /* XTI2OSStatus(TSYSERR) A system error occurred            */
+  kOTLookErr                    = -3158, /* XTI2OSStatus(TLOOK) An event occurred - call Look()         */
+  kOTBadDataErr                 = -3159, /* XTI2OSStatus(TBADDATA) An illegal amount of data was specified */
+  kOTBufferOverflowErr          = -3160, /* XTI2OSStatus(TBUFOVFLW) Passed buffer not big enough          */
+  kOTFlowErr                    = -3161, /* XTI2OSStatus(TFLOW) Provider is flow-controlled          */
+  kOTNoDataErr                  = -3162, /* XTI2OSStatus(TNODATA) No data available for reading          */
+  kOTNoDisconnectErr            = -3163, /* XTI2OSStatus(TNODIS) No disconnect indication available         */
+  kOTNoUDErrErr                 = -3164, /* XTI2OSStatus(TNOUDERR) No Unit Data Error indication available */
+  kOTBadFlagErr                 = -3165, /* XTI2OSStatus(TBADFLAG) A Bad flag value was supplied          */
+  kOTNoReleaseErr               = -3166, /* XTI2OSStatus(TNOREL) No orderly release indication available   */
+  kOTNotSupportedErr            = -3167, /* XTI2OSStatus(TNOTSUPPORT) Command is not supported           */
+  kOTStateChangeErr             = -3168, /* XTI2OSStatus(TSTATECHNG) State is changing - try again later     */
+  kOTNoStructureTypeErr         = -3169, /* XTI2OSStatus(TNOSTRUCTYPE) Bad structure type requested for OTAlloc    */
+  kOTBadNameErr                 = -3170, /* XTI2OSStatus(TBADNAME) A bad endpoint name was supplied         */
+  kOTBadQLenErr                 = -3171, /* XTI2OSStatus(TBADQLEN) A Bind to an in-use addr with qlen > 0   */
+  kOTAddressBusyErr             = -3172, /* XTI2OSStatus(TADDRBUSY) Address requested is already in use       */
+  kOTIndOutErr                  = -3173, /* XTI2OSStatus(TINDOUT) Accept failed because of pending listen  */
+  kOTProviderMismatchErr        = -3174, /* XTI2OSStatus(TPROVMISMATCH) Tried to accept on incompatible endpoint   */
+  kOTResQLenErr                 = -3175, /* XTI2OSStatus(TRESQLEN)                            */
+  kOTResAddressErr              = -3176, /* XTI2OSStatus(TRESADDR)                            */
+  kOTQFullErr                   = -3177, /* XTI2OSStatus(TQFULL)                          */
+  kOTProtocolErr                = -3178, /* XTI2OSStatus(TPROTO) An unspecified provider error occurred       */
+  kOTBadSyncErr                 = -3179, /* XTI2OSStatus(TBADSYNC) A synchronous call at interrupt time       */
+  kOTCanceledErr                = -3180, /* XTI2OSStatus(TCANCELED) The command was cancelled            */
+  kEPERMErr                     = -3200, /* Permission denied            */
+  kENOENTErr                    = -3201, /* No such file or directory       */
+  kENORSRCErr                   = -3202, /* No such resource               */
+  kEINTRErr                     = -3203, /* Interrupted system service        */
+  kEIOErr                       = -3204, /* I/O error                 */
+  kENXIOErr                     = -3205, /* No such device or address       */
+  kEBADFErr                     = -3208, /* Bad file number                 */
+  kEAGAINErr                    = -3210, /* Try operation again later       */
+  kENOMEMErr                    = -3211, /* Not enough space               */
+  kEACCESErr                    = -3212, /* Permission denied            */
+  kEFAULTErr                    = -3213, /* Bad address                   */
+  kEBUSYErr                     = -3215, /* Device or resource busy          */
+  kEEXISTErr                    = -3216, /* File exists                   */
+  kENODEVErr                    = -3218, /* No such device               */
+  kEINVALErr                    = -3221, /* Invalid argument               */
+  kENOTTYErr                    = -3224, /* Not a character device          */
+  kEPIPEErr                     = -3231, /* Broken pipe                   */
+  kERANGEErr                    = -3233, /* Message size too large for STREAM  */
+  kEWOULDBLOCKErr               = -3234, /* Call would block, so was aborted     */
+  kEDEADLKErr                   = -3234, /* or a deadlock would occur       */
+  kEALREADYErr                  = -3236, /*                          */
+  kENOTSOCKErr                  = -3237, /* Socket operation on non-socket     */
+  kEDESTADDRREQErr              = -3238, /* Destination address required      */
+  kEMSGSIZEErr                  = -3239, /* Message too long               */
+  kEPROTOTYPEErr                = -3240, /* Protocol wrong type for socket     */
+  kENOPROTOOPTErr               = -3241, /* Protocol not available          */
+  kEPROTONOSUPPORTErr           = -3242, /* Protocol not supported          */
+  kESOCKTNOSUPPORTErr           = -3243, /* Socket type not supported       */
+  kEOPNOTSUPPErr                = -3244, /* Operation not supported on socket  */
+  kEADDRINUSEErr                = -3247, /* Address already in use          */
+  kEADDRNOTAVAILErr             = -3248, /* Can't assign requested address     */
+  kENETDOWNErr                  = -3249, /* Network is down                 */
+  kENETUNREACHErr               = -3250, /* Network is unreachable          */
+  kENETRESETErr                 = -3251, /* Network dropped connection on reset    */
+  kECONNABORTEDErr              = -3252, /* Software caused connection abort     */
+  kECONNRESETErr                = -3253, /* Connection reset by peer          */
+  kENOBUFSErr                   = -3254, /* No buffer space available       */
+  kEISCONNErr                   = -3255, /* Socket is already connected         */
+  kENOTCONNErr                  = -3256, /* Socket is not connected          */
+  kESHUTDOWNErr                 = -3257, /* Can't send after socket shutdown     */
+  kETOOMANYREFSErr              = -3258, /* Too many references: can't splice  */
+  kETIMEDOUTErr                 = -3259, /* Connection timed out             */
+  kECONNREFUSEDErr              = -3260, /* Connection refused           */
+  kEHOSTDOWNErr                 = -3263, /* Host is down                */
+  kEHOSTUNREACHErr              = -3264, /* No route to host               */
+  kEPROTOErr                    = -3269, /*  fill out missing codes      */
+  kETIMEErr                     = -3270, /*                          */
+  kENOSRErr                     = -3271, /*                          */
+  kEBADMSGErr                   = -3272, /*                          */
+  kECANCELErr                   = -3273, /*                          */
+  kENOSTRErr                    = -3274, /*                          */
+  kENODATAErr                   = -3275, /*                          */
+  kEINPROGRESSErr               = -3276, /*                          */
+  kESRCHErr                     = -3277, /*                          */
+  kENOMSGErr                    = -3278, /*                          */
+  kOTClientNotInittedErr        = -3279, /*                          */
+  kOTPortHasDiedErr             = -3280, /*                          */
+  kOTPortWasEjectedErr          = -3281, /*                          */
+  kOTBadConfigurationErr        = -3282, /*                          */
+  kOTConfigurationChangedErr    = -3283, /*                          */
+  kOTUserRequestedErr           = -3284, /*                          */
+  kOTPortLostConnection         = -3285 /*                          */
+};
+
+
+
+/* NSL error codes*/
+enum {
+  kNSL68kContextNotSupported    = -4170, /* no 68k allowed*/
+  kNSLSchedulerError            = -4171, /* A custom thread routine encountered an error*/
+  kNSLBadURLSyntax              = -4172, /* URL contains illegal characters*/
+  kNSLNoCarbonLib               = -4173,
+  kNSLUILibraryNotAvailable     = -4174, /* The NSL UI Library needs to be in the Extensions Folder*/
+  kNSLNotImplementedYet         = -4175,
+  kNSLErrNullPtrError           = -4176,
+  kNSLSomePluginsFailedToLoad   = -4177, /* (one or more plugins failed to load, but at least one did load; this error isn't fatal)*/
+  kNSLNullNeighborhoodPtr       = -4178, /* (client passed a null neighborhood ptr)*/
+  kNSLNoPluginsForSearch        = -4179, /* (no plugins will respond to search request; bad protocol(s)?)*/
+  kNSLSearchAlreadyInProgress   = -4180, /* (you can only have one ongoing search per clientRef)*/
+  kNSLNoPluginsFound            = -4181, /* (manager didn't find any valid plugins to load)*/
+  kNSLPluginLoadFailed          = -4182, /* (manager unable to load one of the plugins)*/
+  kNSLBadProtocolTypeErr        = -4183, /* (client is trying to add a null protocol type)*/
+  kNSLNullListPtr               = -4184, /* (client is trying to add items to a nil list)*/
+  kNSLBadClientInfoPtr          = -4185, /* (nil ClientAsyncInfoPtr; no reference available)*/
+  kNSLCannotContinueLookup      = -4186, /* (Can't continue lookup; error or bad state)*/
+  kNSLBufferTooSmallForData     = -4187, /* (Client buffer too small for data from plugin)*/
+  kNSLNoContextAvailable        = -4188, /* (ContinueLookup function ptr invalid)*/
+  kNSLRequestBufferAlreadyInList = -4189,
+  kNSLInvalidPluginSpec         = -4190,
+  kNSLNoSupportForService       = -4191,
+  kNSLBadNetConnection          = -4192,
+  kNSLBadDataTypeErr            = -4193,
+  kNSLBadServiceTypeErr         = -4194,
+  kNSLBadReferenceErr           = -4195,
+  kNSLNoElementsInList          = -4196,
+  kNSLInsufficientOTVer         = -4197,
+  kNSLInsufficientSysVer        = -4198,
+  kNSLNotInitialized            = -4199,
+  kNSLInitializationFailed      = -4200 /* UNABLE TO INITIALIZE THE MANAGER!!!!! DO NOT CONTINUE!!!!*/
+};
+
+
+/* Apple Remote Access error codes*/
+enum {
+  kRAInvalidParameter           = -7100,
+  kRAInvalidPort                = -7101,
+  kRAStartupFailed              = -7102,
+  kRAPortSetupFailed            = -7103,
+  kRAOutOfMemory                = -7104,
+  kRANotSupported               = -7105,
+  kRAMissingResources           = -7106,
+  kRAIncompatiblePrefs          = -7107,
+  kRANotConnected               = -7108,
+  kRAConnectionCanceled         = -7109,
+  kRAUnknownUser                = -7110,
+  kRAInvalidPassword            = -7111,
+  kRAInternalError              = -7112,
+  kRAInstallationDamaged        = -7113,
+  kRAPortBusy                   = -7114,
+  kRAUnknownPortState           = -7115,
+  kRAInvalidPortState           = -7116,
+  kRAInvalidSerialProtocol      = -7117,
+  kRAUserLoginDisabled          = -7118,
+  kRAUserPwdChangeRequired      = -7119,
+  kRAUserPwdEntryRequired       = -7120,
+  kRAUserInteractionRequired    = -7121,
+  kRAInitOpenTransportFailed    = -7122,
+  kRARemoteAccessNotReady       = -7123,
+  kRATCPIPInactive              = -7124, /* TCP/IP inactive, cannot be loaded*/
+  kRATCPIPNotConfigured         = -7125, /* TCP/IP not configured, could be loaded*/
+  kRANotPrimaryInterface        = -7126, /* when IPCP is not primary TCP/IP intf.*/
+  kRAConfigurationDBInitErr     = -7127,
+  kRAPPPProtocolRejected        = -7128,
+  kRAPPPAuthenticationFailed    = -7129,
+  kRAPPPNegotiationFailed       = -7130,
+  kRAPPPUserDisconnected        = -7131,
+  kRAPPPPeerDisconnected        = -7132,
+  kRAPeerNotResponding          = -7133,
+  kRAATalkInactive              = -7134,
+  kRAExtAuthenticationFailed    = -7135,
+  kRANCPRejectedbyPeer          = -7136,
+  kRADuplicateIPAddr            = -7137,
+  kRACallBackFailed             = -7138,
+  kRANotEnabled                 = -7139
+};
+
+/* TELErr */
+enum {
+  telGenericError               = -1,
+  telNoErr                      = 0,
+  telNoTools                    = 8,    /* no telephone tools found in extension folder */
+  telBadTermErr                 = -10001, /* invalid TELHandle or handle not found*/
+  telBadDNErr                   = -10002, /* TELDNHandle not found or invalid */
+  telBadCAErr                   = -10003, /* TELCAHandle not found or invalid */
+  telBadHandErr                 = -10004, /* bad handle specified */
+  telBadProcErr                 = -10005, /* bad msgProc specified */
+  telCAUnavail                  = -10006, /* a CA is not available */
+  telNoMemErr                   = -10007, /* no memory to allocate handle */
+  telNoOpenErr                  = -10008, /* unable to open terminal */
+  telBadHTypeErr                = -10010, /* bad hook type specified */
+  telHTypeNotSupp               = -10011, /* hook type not supported by this tool */
+  telBadLevelErr                = -10012, /* bad volume level setting */
+  telBadVTypeErr                = -10013, /* bad volume type error */
+  telVTypeNotSupp               = -10014, /* volume type not supported by this tool*/
+  telBadAPattErr                = -10015, /* bad alerting pattern specified */
+  telAPattNotSupp               = -10016, /* alerting pattern not supported by tool*/
+  telBadIndex                   = -10017, /* bad index specified */
+  telIndexNotSupp               = -10018, /* index not supported by this tool */
+  telBadStateErr                = -10019, /* bad device state specified */
+  telStateNotSupp               = -10020, /* device state not supported by tool */
+  telBadIntExt                  = -10021, /* bad internal external error */
+  telIntExtNotSupp              = -10022, /* internal external type not supported by this tool */
+  telBadDNDType                 = -10023, /* bad DND type specified */
+  telDNDTypeNotSupp             = -10024, /* DND type is not supported by this tool */
+  telFeatNotSub                 = -10030, /* feature not subscribed */
+  telFeatNotAvail               = -10031, /* feature subscribed but not available */
+  telFeatActive                 = -10032, /* feature already active */
+  telFeatNotSupp                = -10033, /* feature program call not supported by this tool */
+  telConfLimitErr               = -10040, /* limit specified is too high for this configuration */
+  telConfNoLimit                = -10041, /* no limit was specified but required*/
+  telConfErr                    = -10042, /* conference was not prepared */
+  telConfRej                    = -10043, /* conference request was rejected */
+  telTransferErr                = -10044, /* transfer not prepared */
+  telTransferRej                = -10045, /* transfer request rejected */
+  telCBErr                      = -10046, /* call back feature not set previously */
+  telConfLimitExceeded          = -10047, /* attempt to exceed switch conference limits */
+  telBadDNType                  = -10050, /* DN type invalid */
+  telBadPageID                  = -10051, /* bad page ID specified*/
+  telBadIntercomID              = -10052, /* bad intercom ID specified */
+  telBadFeatureID               = -10053, /* bad feature ID specified */
+  telBadFwdType                 = -10054, /* bad fwdType specified */
+  telBadPickupGroupID           = -10055, /* bad pickup group ID specified */
+  telBadParkID                  = -10056, /* bad park id specified */
+  telBadSelect                  = -10057, /* unable to select or deselect DN */
+  telBadBearerType              = -10058, /* bad bearerType specified */
+  telBadRate                    = -10059, /* bad rate specified */
+  telDNTypeNotSupp              = -10060, /* DN type not supported by tool */
+  telFwdTypeNotSupp             = -10061, /* forward type not supported by tool */
+  telBadDisplayMode             = -10062, /* bad display mode specified */
+  telDisplayModeNotSupp         = -10063, /* display mode not supported by tool */
+  telNoCallbackRef              = -10064, /* no call back reference was specified, but is required */
+  telAlreadyOpen                = -10070, /* terminal already open */
+  telStillNeeded                = -10071, /* terminal driver still needed by someone else */
+  telTermNotOpen                = -10072, /* terminal not opened via TELOpenTerm */
+  telCANotAcceptable            = -10080, /* CA not "acceptable" */
+  telCANotRejectable            = -10081, /* CA not "rejectable" */
+  telCANotDeflectable           = -10082, /* CA not "deflectable" */
+  telPBErr                      = -10090, /* parameter block error, bad format */
+  telBadFunction                = -10091, /* bad msgCode specified */
+                                        /*    telNoTools        = -10101,        unable to find any telephone tools */
+  telNoSuchTool                 = -10102, /* unable to find tool with name specified */
+  telUnknownErr                 = -10103, /* unable to set config */
+  telNoCommFolder               = -10106, /* Communications/Extensions  not found */
+  telInitFailed                 = -10107, /* initialization failed */
+  telBadCodeResource            = -10108, /* code resource not found */
+  telDeviceNotFound             = -10109, /* device not found */
+  telBadProcID                  = -10110, /* invalid procID */
+  telValidateFailed             = -10111, /* telValidate failed */
+  telAutoAnsNotOn               = -10112, /* autoAnswer in not turned on */
+  telDetAlreadyOn               = -10113, /* detection is already turned on */
+  telBadSWErr                   = -10114, /* Software not installed properly */
+  telBadSampleRate              = -10115, /* incompatible sample rate */
+  telNotEnoughdspBW             = -10116 /* not enough real-time for allocation */
+};
+
+
+/* the OT modem module may return the following error codes:*/
+enum {
+  kModemOutOfMemory             = -14000,
+  kModemPreferencesMissing      = -14001,
+  kModemScriptMissing           = -14002
+};
+
+
+/* NetSprocket Error Codes */
+enum {
+  kNSpInitializationFailedErr   = -30360,
+  kNSpAlreadyInitializedErr     = -30361,
+  kNSpTopologyNotSupportedErr   = -30362,
+  kNSpPipeFullErr               = -30364,
+  kNSpHostFailedErr             = -30365,
+  kNSpProtocolNotAvailableErr   = -30366,
+  kNSpInvalidGameRefErr         = -30367,
+  kNSpInvalidParameterErr       = -30369,
+  kNSpOTNotPresentErr           = -30370,
+  kNSpOTVersionTooOldErr        = -30371,
+  kNSpMemAllocationErr          = -30373,
+  kNSpAlreadyAdvertisingErr     = -30374,
+  kNSpNotAdvertisingErr         = -30376,
+  kNSpInvalidAddressErr         = -30377,
+  kNSpFreeQExhaustedErr         = -30378,
+  kNSpRemovePlayerFailedErr     = -30379,
+  kNSpAddressInUseErr           = -30380,
+  kNSpFeatureNotImplementedErr  = -30381,
+  kNSpNameRequiredErr           = -30382,
+  kNSpInvalidPlayerIDErr        = -30383,
+  kNSpInvalidGroupIDErr         = -30384,
+  kNSpNoPlayersErr              = -30385,
+  kNSpNoGroupsErr               = -30386,
+  kNSpNoHostVolunteersErr       = -30387,
+  kNSpCreateGroupFailedErr      = -30388,
+  kNSpAddPlayerFailedErr        = -30389,
+  kNSpInvalidDefinitionErr      = -30390,
+  kNSpInvalidProtocolRefErr     = -30391,
+  kNSpInvalidProtocolListErr    = -30392,
+  kNSpTimeoutErr                = -30393,
+  kNSpGameTerminatedErr         = -30394,
+  kNSpConnectFailedErr          = -30395,
+  kNSpSendFailedErr             = -30396,
+  kNSpMessageTooBigErr          = -30397,
+  kNSpCantBlockErr              = -30398,
+  kNSpJoinFailedErr             = -30399
+};
+
+
+
+
+/* URLAccess Error Codes */
+enum {
+  kURLInvalidURLReferenceError  = -30770,
+  kURLProgressAlreadyDisplayedError = -30771,
+  kURLDestinationExistsError    = -30772,
+  kURLInvalidURLError           = -30773,
+  kURLUnsupportedSchemeError    = -30774,
+  kURLServerBusyError           = -30775,
+  kURLAuthenticationError       = -30776,
+  kURLPropertyNotYetKnownError  = -30777,
+  kURLUnknownPropertyError      = -30778,
+  kURLPropertyBufferTooSmallError = -30779,
+  kURLUnsettablePropertyError   = -30780,
+  kURLInvalidCallError          = -30781,
+  kURLFileEmptyError            = -30783,
+  kURLExtensionFailureError     = -30785,
+  kURLInvalidConfigurationError = -30786,
+  kURLAccessNotAvailableError   = -30787,
+  kURL68kNotSupportedError      = -30788
+};
+
+#endif /* __MACERRORSNETWORKING__ */
+
@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 1985-2008 by Apple Inc.. All rights reserved.
+ *
+ * @APPLE_LICENSE_HEADER_START@
+ * 
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ * 
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ * 
+ * @APPLE_LICENSE_HEADER_END@
+ */
+ 
+/*
+     File:       MacErrorsQuickTime.h
+ 
+     Contains:   OSErr codes: QuickTime errors.
+ 
+                 MacErrors.h includes this header; include it alone to define only
+                 these codes.  Split from MacErrors.h by tools/MacErrorsSplit.py.
+ 
+     Version:    CarbonCore-769~1
+  
+     Bugs?:      For bug reports, consult the following page on
+                 the World Wide Web:
+ 
+                     http://developer.apple.com/bugreporter/
+ 
+*/
+#ifndef __MACERRORSQUICKTIME__
+#define __MACERRORSQUICKTIME__
+
+/*QuickTime errors*/
+enum {
+  couldNotResolveDataRef        = -2000,
+  badImageDescription           = -2001,
+  badPublicMovieAtom            = -2002,
+  cantFindHandler               = -2003,
+  cantOpenHandler               = -2004,
+  badComponentType              = -2005,
+  noMediaHandler                = -2006,
+  noDataHandler                 = -2007,
+  invalidMedia                  = -2008,
+  invalidTrack                  = -2009,
+  invalidMovie                  = -2010,
+  invalidSampleTable            = -2011,
+  invalidDataRef                = -2012,
+  invalidHandler                = -2013,
+  invalidDuration               = -2014,
+  invalidTime                   = -2015,
+  cantPutPublicMovieAtom        = -2016,
+  badEditList                   = -2017,
+  mediaTypesDontMatch           = -2018,
+  progressProcAborted           = -2019,
+  movieToolboxUninitialized     = -2020,
+  noRecordOfApp                 = movieToolboxUninitialized, /* replica */
+  wfFileNotFound                = -2021,
+  cantCreateSingleForkFile      = -2022, /* happens when file already exists */
+  invalidEditState              = -2023,
+  nonMatchingEditState          = -2024,
+  staleEditState                = -2025,
+  userDataItemNotFound          = -2026,
+  maxSizeToGrowTooSmall         = -2027,
+  badTrackIndex                 = -2028,
+  trackIDNotFound               = -2029,
+  trackNotInMovie               = -2030,
+  timeNotInTrack                = -2031,
+  timeNotInMedia                = -2032,
+  badEditIndex                  = -2033,
+  internalQuickTimeError        = -2034,
+  cantEnableTrack               = -2035,
+  invalidRect                   = -2036,
+  invalidSampleNum              = -2037,
+  invalidChunkNum               = -2038,
+  invalidSampleDescIndex        = -2039,
+  invalidChunkCache             = -2040,
+  invalidSampleDescription      = -2041,
+  dataNotOpenForRead            = -2042,
+  dataNotOpenForWrite           = -2043,
+  dataAlreadyOpenForWrite       = -2044,
+  dataAlreadyClosed             = -2045,
+  endOfDataReached              = -2046,
+  dataNoDataRef                 = -2047,
+  noMovieFound                  = -2048,
+  invalidDataRefContainer       = -2049,
+  badDataRefIndex               = -2050,
+  noDefaultDataRef              = -2051,
+  couldNotUseAnExistingSample   = -2052,
+  featureUnsupported            = -2053,
+  noVideoTrackInMovieErr        = -2054, /* QT for Windows error */
+  noSoundTrackInMovieErr        = -2055, /* QT for Windows error */
+  soundSupportNotAvailableErr   = -2056, /* QT for Windows error */
+  unsupportedAuxiliaryImportData = -2057,
+  auxiliaryExportDataUnavailable = -2058,
+  samplesAlreadyInMediaErr      = -2059,
+  noSourceTreeFoundErr          = -2060,
+  sourceNotFoundErr             = -2061,
+  movieTextNotFoundErr          = -2062,
+  missingRequiredParameterErr   = -2063,
+  invalidSpriteWorldPropertyErr = -2064,
+  invalidSpritePropertyErr      = -2065,
+  gWorldsNotSameDepthAndSizeErr = -2066,
+  invalidSpriteIndexErr         = -2067,
+  invalidImageIndexErr          = -2068,
+  invalidSpriteIDErr            = -2069
+};
+
+enum {
+  internalComponentErr          = -2070,
+  notImplementedMusicOSErr      = -2071,
+  cantSendToSynthesizerOSErr    = -2072,
+  cantReceiveFromSynthesizerOSErr = -2073,
+  illegalVoiceAllocationOSErr   = -2074,
+  illegalPartOSErr              = -2075,
+  illegalChannelOSErr           = -2076,
+  illegalKnobOSErr              = -2077,
+  illegalKnobValueOSErr         = -2078,
+  illegalInstrumentOSErr        = -2079,
+  illegalControllerOSErr        = -2080,
+  midiManagerAbsentOSErr        = -2081,
+  synthesizerNotRespondingOSErr = -2082,
+  synthesizerOSErr              = -2083,
+  illegalNoteChannelOSErr       = -2084,
+  noteChannelNotAllocatedOSErr  = -2085,
+  tunePlayerFullOSErr           = -2086,
+  tuneParseOSErr                = -2087,
+  noExportProcAvailableErr      = -2089,
+  videoOutputInUseErr           = -2090
+};
+
+enum {
+  componentDllLoadErr           = -2091, /* Windows specific errors (when component is loading)*/
+  componentDllEntryNotFoundErr  = -2092, /* Windows specific errors (when component is loading)*/
+  qtmlDllLoadErr                = -2093, /* Windows specific errors (when qtml is loading)*/
+  qtmlDllEntryNotFoundErr       = -2094, /* Windows specific errors (when qtml is loading)*/
+  qtmlUninitialized             = -2095,
+  unsupportedOSErr              = -2096,
+  unsupportedProcessorErr       = -2097,
+  componentNotThreadSafeErr     = -2098 /* component is not thread-safe*/
+};
+
+enum {
+  cannotFindAtomErr             = -2101,
+  notLeafAtomErr                = -2102,
+  atomsNotOfSameTypeErr         = -2103,
+  atomIndexInvalidErr           = -2104,
+  duplicateAtomTypeAndIDErr     = -2105,
+  invalidAtomErr                = -2106,
+  invalidAtomContainerErr       = -2107,
+  invalidAtomTypeErr            = -2108,
+  cannotBeLeafAtomErr           = -2109,
+  pathTooLongErr                = -2110,
+  emptyPathErr                  = -2111,
+  noPathMappingErr              = -2112,
+  pathNotVerifiedErr            = -2113,
+  unknownFormatErr              = -2114,
+  wackBadFileErr                = -2115,
+  wackForkNotFoundErr           = -2116,
+  wackBadMetaDataErr            = -2117,
+  qfcbNotFoundErr               = -2118,
+  qfcbNotCreatedErr             = -2119,
+  AAPNotCreatedErr              = -2120,
+  AAPNotFoundErr                = -2121,
+  ASDBadHeaderErr               = -2122,
+  ASDBadForkErr                 = -2123,
+  ASDEntryNotFoundErr           = -2124,
+  fileOffsetTooBigErr           = -2125,
+  notAllowedToSaveMovieErr      = -2126,
+  qtNetworkAlreadyAllocatedErr  = -2127,
+  urlDataHHTTPProtocolErr       = -2129,
+  urlDataHHTTPNoNetDriverErr    = -2130,
+  urlDataHHTTPURLErr            = -2131,
+  urlDataHHTTPRedirectErr       = -2132,
+  urlDataHFTPProtocolErr        = -2133,
+  urlDataHFTPShutdownErr        = -2134,
+  urlDataHFTPBadUserErr         = -2135,
+  urlDataHFTPBadPasswordErr     = -2136,
+  urlDataHFTPServerErr          = -2137,
+  urlDataHFTPDataConnectionErr  = -2138,
+  urlDataHFTPNoDirectoryErr     = -2139,
+  urlDataHFTPQuotaErr           = -2140,
+  urlDataHFTPPermissionsErr     = -2141,
+  urlDataHFTPFilenameErr        = -2142,
+  urlDataHFTPNoNetDriverErr     = -2143,
+  urlDataHFTPBadNameListErr     = -2144,
+  urlDataHFTPNeedPasswordErr    = -2145,
+  urlDataHFTPNoPasswordErr      = -2146,
+  urlDataHFTPServerDisconnectedErr = -2147,
+  urlDataHFTPURLErr             = -2148,
+  notEnoughDataErr              = -2149,
+  qtActionNotHandledErr         = -2157,
+  qtXMLParseErr                 = -2158,
+  qtXMLApplicationErr           = -2159
+};
+
+
+enum {
+  digiUnimpErr                  = -2201, /* feature unimplemented */
+  qtParamErr                    = -2202, /* bad input parameter (out of range, etc) */
+  matrixErr                     = -2203, /* bad matrix, digitizer did nothing */
+  notExactMatrixErr             = -2204, /* warning of bad matrix, digitizer did its best */
+  noMoreKeyColorsErr            = -2205, /* all key indexes in use */
+  notExactSizeErr               = -2206, /* Cant do exact size requested */
+  badDepthErr                   = -2207, /* Cant digitize into this depth */
+  noDMAErr                      = -2208, /* Cant do DMA digitizing (i.e. can't go to requested dest */
+  badCallOrderErr               = -2209 /* Usually due to a status call being called prior to being setup first */
+};
+
+
+/* QuickTime Streaming Errors */
+enum {
+  qtsBadSelectorErr             = -5400,
+  qtsBadStateErr                = -5401,
+  qtsBadDataErr                 = -5402, /* something is wrong with the data */
+  qtsUnsupportedDataTypeErr     = -5403,
+  qtsUnsupportedRateErr         = -5404,
+  qtsUnsupportedFeatureErr      = -5405,
+  qtsTooMuchDataErr             = -5406,
+  qtsUnknownValueErr            = -5407,
+  qtsTimeoutErr                 = -5408,
+  qtsConnectionFailedErr        = -5420,
+  qtsAddressBusyErr             = -5421
+};
+
+
+/* QuickTime Streaming Server Errors */
+enum {
+  kQTSSUnknownErr               = -6150
+};
+
+
+/* QuickTime errors (Image Compression Manager) */
+enum {
+  codecErr                      = -8960,
+  noCodecErr                    = -8961,
+  codecUnimpErr                 = -8962,
+  codecSizeErr                  = -8963,
+  codecScreenBufErr             = -8964,
+  codecImageBufErr              = -8965,
+  codecSpoolErr                 = -8966,
+  codecAbortErr                 = -8967,
+  codecWouldOffscreenErr        = -8968,
+  codecBadDataErr               = -8969,
+  codecDataVersErr              = -8970,
+  codecExtensionNotFoundErr     = -8971,
+  scTypeNotFoundErr             = codecExtensionNotFoundErr,
+  codecConditionErr             = -8972,
+  codecOpenErr                  = -8973,
+  codecCantWhenErr              = -8974,
+  codecCantQueueErr             = -8975,
+  codecNothingToBlitErr         = -8976,
+  codecNoMemoryPleaseWaitErr    = -8977,
+  codecDisabledErr              = -8978, /* codec disabled itself -- pass codecFlagReenable to reset*/
+  codecNeedToFlushChainErr      = -8979,
+  lockPortBitsBadSurfaceErr     = -8980,
+  lockPortBitsWindowMovedErr    = -8981,
+  lockPortBitsWindowResizedErr  = -8982,
+  lockPortBitsWindowClippedErr  = -8983,
+  lockPortBitsBadPortErr        = -8984,
+  lockPortBitsSurfaceLostErr    = -8985,
+  codecParameterDialogConfirm   = -8986,
+  codecNeedAccessKeyErr         = -8987, /* codec needs password in order to decompress*/
+  codecOffscreenFailedErr       = -8988,
+  codecDroppedFrameErr          = -8989, /* returned from ImageCodecDrawBand */
+  directXObjectAlreadyExists    = -8990,
+  lockPortBitsWrongGDeviceErr   = -8991,
+  codecOffscreenFailedPleaseRetryErr = -8992,
+  badCodecCharacterizationErr   = -8993,
+  noThumbnailFoundErr           = -8994
+};
+
+
+enum {
+  noDeviceForChannel            = -9400,
+  grabTimeComplete              = -9401,
+  cantDoThatInCurrentMode       = -9402,
+  notEnoughMemoryToGrab         = -9403,
+  notEnoughDiskSpaceToGrab      = -9404,
+  couldntGetRequiredComponent   = -9405,
+  badSGChannel                  = -9406,
+  seqGrabInfoNotAvailable       = -9407,
+  deviceCantMeetRequest         = -9408,
+  badControllerHeight           = -9994,
+  editingNotAllowed             = -9995,
+  controllerBoundsNotExact      = -9996,
+  cannotSetWidthOfAttachedController = -9997,
+  controllerHasFixedHeight      = -9998,
+  cannotMoveAttachedController  = -9999
+};
+
+
+/* QuickTime VR Errors */
+enum {
+  notAQTVRMovieErr              = -30540,
+  constraintReachedErr          = -30541,
+  callNotSupportedByNodeErr     = -30542,
+  selectorNotSupportedByNodeErr = -30543,
+  invalidNodeIDErr              = -30544,
+  invalidViewStateErr           = -30545,
+  timeNotInViewErr              = -30546,
+  propertyNotSupportedByNodeErr = -30547,
+  settingNotSupportedByNodeErr  = -30548,
+  limitReachedErr               = -30549,
+  invalidNodeFormatErr          = -30550,
+  invalidHotSpotIDErr           = -30551,
+  noMemoryNodeFailedInitialize  = -30552,
+  streamingNodeNotReadyErr      = -30553,
+  qtvrLibraryLoadErr            = -30554,
+  qtvrUninitialized             = -30555
+};
+
+#endif /* __MACERRORSQUICKTIME__ */
+
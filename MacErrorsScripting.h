@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 1985-2008 by Apple Inc.. All rights reserved.
+ *
+ * @APPLE_LICENSE_HEADER_START@
+ * 
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ * 
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ * 
+ * @APPLE_LICENSE_HEADER_END@
+ */
+ 
+/*
+     File:       MacErrorsScripting.h
+ 
+     Contains:   OSErr codes: Apple Event Manager and Open Scripting Architecture errors.
+ 
+                 MacErrors.h includes this header; include it alone to define only
+                 these codes.  Split from MacErrors.h by tools/MacErrorsSplit.py.
+ 
+     Version:    CarbonCore-769~1
+  
+     Bugs?:      For bug reports, consult the following page on
+                 the World Wide Web:
+ 
+                     http://developer.apple.com/bugreporter/
+ 
+*/
+#ifndef __MACERRORSSCRIPTING__
+#define __MACERRORSSCRIPTING__
+
+/*--------------------------------------------------------------
+        Apple event manager error messages
+--------------------------------------------------------------*/
+
+enum {
+  errAECoercionFail             = -1700, /* bad parameter data or unable to coerce the data supplied */
+  errAEDescNotFound             = -1701,
+  errAECorruptData              = -1702,
+  errAEWrongDataType            = -1703,
+  errAENotAEDesc                = -1704,
+  errAEBadListItem              = -1705, /* the specified list item does not exist */
+  errAENewerVersion             = -1706, /* need newer version of the AppleEvent manager */
+  errAENotAppleEvent            = -1707, /* the event is not in AppleEvent format */
+  errAEEventNotHandled          = -1708, /* the AppleEvent was not handled by any handler */
+  errAEReplyNotValid            = -1709, /* AEResetTimer was passed an invalid reply parameter */
+  errAEUnknownSendMode          = -1710, /* mode wasn't NoReply, WaitReply, or QueueReply or Interaction level is unknown */
+  errAEWaitCanceled             = -1711, /* in AESend, the user cancelled out of wait loop for reply or receipt */
+  errAETimeout                  = -1712, /* the AppleEvent timed out */
+  errAENoUserInteraction        = -1713, /* no user interaction is allowed */
+  errAENotASpecialFunction      = -1714, /* there is no special function for/with this keyword */
+  errAEParamMissed              = -1715, /* a required parameter was not accessed */
+  errAEUnknownAddressType       = -1716, /* the target address type is not known */
+  errAEHandlerNotFound          = -1717, /* no handler in the dispatch tables fits the parameters to AEGetEventHandler or AEGetCoercionHandler */
+  errAEReplyNotArrived          = -1718, /* the contents of the reply you are accessing have not arrived yet */
+  errAEIllegalIndex             = -1719, /* index is out of range in a put operation */
+  errAEImpossibleRange          = -1720, /* A range like 3rd to 2nd, or 1st to all. */
+  errAEWrongNumberArgs          = -1721, /* Logical op kAENOT used with other than 1 term */
+  errAEAccessorNotFound         = -1723, /* Accessor proc matching wantClass and containerType or wildcards not found */
+  errAENoSuchLogical            = -1725, /* Something other than AND, OR, or NOT */
+  errAEBadTestKey               = -1726, /* Test is neither typeLogicalDescriptor nor typeCompDescriptor */
+  errAENotAnObjSpec             = -1727, /* Param to AEResolve not of type 'obj ' */
+  errAENoSuchObject             = -1728, /* e.g.,: specifier asked for the 3rd, but there are only 2. Basically, this indicates a run-time resolution error. */
+  errAENegativeCount            = -1729, /* CountProc returned negative value */
+  errAEEmptyListContainer       = -1730, /* Attempt to pass empty list as container to accessor */
+  errAEUnknownObjectType        = -1731, /* available only in version 1.0.1 or greater */
+  errAERecordingIsAlreadyOn     = -1732, /* available only in version 1.0.1 or greater */
+  errAEReceiveTerminate         = -1733, /* break out of all levels of AEReceive to the topmost (1.1 or greater) */
+  errAEReceiveEscapeCurrent     = -1734, /* break out of only lowest level of AEReceive (1.1 or greater) */
+  errAEEventFiltered            = -1735, /* event has been filtered, and should not be propogated (1.1 or greater) */
+  errAEDuplicateHandler         = -1736, /* attempt to install handler in table for identical class and id (1.1 or greater) */
+  errAEStreamBadNesting         = -1737, /* nesting violation while streaming */
+  errAEStreamAlreadyConverted   = -1738, /* attempt to convert a stream that has already been converted */
+  errAEDescIsNull               = -1739, /* attempting to perform an invalid operation on a null descriptor */
+  errAEBuildSyntaxError         = -1740, /* AEBuildDesc and friends detected a syntax error */
+  errAEBufferTooSmall           = -1741 /* buffer for AEFlattenDesc too small */
+};
+
+enum {
+  errOSASystemError             = -1750,
+  errOSAInvalidID               = -1751,
+  errOSABadStorageType          = -1752,
+  errOSAScriptError             = -1753,
+  errOSABadSelector             = -1754,
+  errOSASourceNotAvailable      = -1756,
+  errOSANoSuchDialect           = -1757,
+  errOSADataFormatObsolete      = -1758,
+  errOSADataFormatTooNew        = -1759,
+  errOSACorruptData             = errAECorruptData,
+  errOSARecordingIsAlreadyOn    = errAERecordingIsAlreadyOn,
+  errOSAComponentMismatch       = -1761, /* Parameters are from 2 different components */
+  errOSACantOpenComponent       = -1762 /* Can't connect to scripting system with that ID */
+};
+
+
+
+/* AppleEvent error definitions */
+enum {
+  errOffsetInvalid              = -1800,
+  errOffsetIsOutsideOfView      = -1801,
+  errTopOfDocument              = -1810,
+  errTopOfBody                  = -1811,
+  errEndOfDocument              = -1812,
+  errEndOfBody                  = -1813
+};
+
+
+/*        
+    Dynamic AppleScript errors:
+
+    These errors result from data-dependent conditions and are typically
+    signaled at runtime.
+*/
+enum {
+  errOSACantCoerce              = errAECoercionFail, /* Signaled when a value can't be coerced to the desired type. */
+  errOSACantAccess              = errAENoSuchObject, /* Signaled when an object is not found in a container*/
+  errOSACantAssign              = -10006, /* Signaled when an object cannot be set in a container.*/
+  errOSAGeneralError            = -2700, /* Signaled by user scripts or applications when no actual error code is to be returned.*/
+  errOSADivideByZero            = -2701, /* Signaled when there is an attempt to divide by zero*/
+  errOSANumericOverflow         = -2702, /* Signaled when integer or real value is too large to be represented*/
+  errOSACantLaunch              = -2703, /* Signaled when application can't be launched or when it is remote and program linking is not enabled*/
+  errOSAAppNotHighLevelEventAware = -2704, /* Signaled when an application can't respond to AppleEvents*/
+  errOSACorruptTerminology      = -2705, /* Signaled when an application's terminology resource is not readable*/
+  errOSAStackOverflow           = -2706, /* Signaled when the runtime stack overflows*/
+  errOSAInternalTableOverflow   = -2707, /* Signaled when a runtime internal data structure overflows*/
+  errOSADataBlockTooLarge       = -2708, /* Signaled when an intrinsic limitation is exceeded for the size of a value or data structure.*/
+  errOSACantGetTerminology      = -2709,
+  errOSACantCreate              = -2710
+};
+
+/*        
+    Component-specific dynamic script errors:
+
+    The range -2720 thru -2739 is reserved for component-specific runtime errors.
+    (Note that error codes from different scripting components in this range will
+    overlap.)
+*/
+/*        
+    Static AppleScript errors:
+
+    These errors comprise what are commonly thought of as parse and compile-
+    time errors.  However, in a dynamic system (e.g. AppleScript) any or all
+    of these may also occur at runtime.
+*/
+enum {
+  errOSATypeError               = errAEWrongDataType,
+  OSAMessageNotUnderstood       = errAEEventNotHandled, /* Signaled when a message was sent to an object that didn't handle it*/
+  OSAUndefinedHandler           = errAEHandlerNotFound, /* Signaled when a function to be returned doesn't exist. */
+  OSAIllegalAccess              = errAEAccessorNotFound, /* Signaled when a container can never have the requested object*/
+  OSAIllegalIndex               = errAEIllegalIndex, /* Signaled when index was out of range. Specialization of errOSACantAccess*/
+  OSAIllegalRange               = errAEImpossibleRange, /* Signaled when a range is screwy. Specialization of errOSACantAccess*/
+  OSAIllegalAssign              = -10003, /* Signaled when an object can never be set in a container*/
+  OSASyntaxError                = -2740, /* Signaled when a syntax error occurs. (e.g. "Syntax error" or "<this> can't go after <that>")*/
+  OSASyntaxTypeError            = -2741, /* Signaled when another form of syntax was expected. (e.g. "expected a <type> but found <this>")*/
+  OSATokenTooLong               = -2742, /* Signaled when a name or number is too long to be parsed*/
+  OSAMissingParameter           = errAEDescNotFound, /* Signaled when a parameter is missing for a function invocation*/
+  OSAParameterMismatch          = errAEWrongNumberArgs, /* Signaled when function is called with the wrong number of parameters, or a parameter pattern cannot be matched*/
+  OSADuplicateParameter         = -2750, /* Signaled when a formal parameter, local variable, or instance variable is specified more than once*/
+  OSADuplicateProperty          = -2751, /* Signaled when a formal parameter, local variable, or instance variable is specified more than once.*/
+  OSADuplicateHandler           = -2752, /* Signaled when more than one handler is defined with the same name in a scope where the language doesn't allow it*/
+  OSAUndefinedVariable          = -2753, /* Signaled when a variable is accessed that has no value*/
+  OSAInconsistentDeclarations   = -2754, /* Signaled when a variable is declared inconsistently in the same scope, such as both local and global*/
+  OSAControlFlowError           = -2755 /* Signaled when illegal control flow occurs in an application (no catcher for throw, non-lexical loop exit, etc.)*/
+};
+
+/*        
+    Component-specific AppleScript static errors:
+
+    The range -2760 thru -2779 is reserved for component-specific parsing and
+    compile-time errors. (Note that error codes from different scripting
+    components in this range will overlap.)
+*/
+/*        
+    Dialect-specific AppleScript errors:
+
+    The range -2780 thru -2799 is reserved for dialect specific error codes for
+    scripting components that support dialects. (Note that error codes from
+    different scripting components in this range will overlap, as well as error
+    codes from different dialects in the same scripting component.)
+*/
+
+/**************************************************************************
+    Apple Script Error Codes
+**************************************************************************/
+/* Runtime errors: */
+enum {
+  errASCantConsiderAndIgnore    = -2720,
+  errASCantCompareMoreThan32k   = -2721, /* Parser/Compiler errors: */
+  errASTerminologyNestingTooDeep = -2760,
+  errASIllegalFormalParameter   = -2761,
+  errASParameterNotForEvent     = -2762,
+  errASNoResultReturned         = -2763, /*    The range -2780 thru -2799 is reserved for dialect specific error codes. (Error codes from different dialects may overlap.) */
+  errASInconsistentNames        = -2780 /*    English errors: */
+};
+
+/* AERegistry Errors */
+enum {
+  errAEBadKeyForm               = -10002,
+  errAECantHandleClass          = -10010,
+  errAECantSupplyType           = -10009,
+  errAECantUndo                 = -10015,
+  errAEEventFailed              = -10000,
+  errAEIndexTooLarge            = -10007,
+  errAEInTransaction            = -10011,
+  errAELocalOnly                = -10016,
+  errAENoSuchTransaction        = -10012,
+  errAENotAnElement             = -10008,
+  errAENotASingleObject         = -10014,
+  errAENotModifiable            = -10003,
+  errAENoUserSelection          = -10013,
+  errAEPrivilegeError           = -10004,
+  errAEReadDenied               = -10005,
+  errAETypeError                = -10001,
+  errAEWriteDenied              = -10006,
+  errAENotAnEnumMember          = -10023, /* enumerated value in SetData is not allowed for this property */
+  errAECantPutThatThere         = -10024, /* in make new, duplicate, etc. class can't be an element of container */
+  errAEPropertiesClash          = -10025 /* illegal combination of properties settings for Set Data, make new, or duplicate */
+};
+
+#endif /* __MACERRORSSCRIPTING__ */
+
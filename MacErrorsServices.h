@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 1985-2008 by Apple Inc.. All rights reserved.
+ *
+ * @APPLE_LICENSE_HEADER_START@
+ * 
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ * 
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ * 
+ * @APPLE_LICENSE_HEADER_END@
+ */
+ 
+/*
+     File:       MacErrorsServices.h
+ 
+     Contains:   OSErr codes: keychain, data access, collection and other application service errors.
+ 
+                 MacErrors.h includes this header; include it alone to define only
+                 these codes.  Split from MacErrors.h by tools/MacErrorsSplit.py.
+ 
+     Version:    CarbonCore-769~1
+  
+     Bugs?:      For bug reports, consult the following page on
+                 the World Wide Web:
+ 
+                     http://developer.apple.com/bugreporter/
+ 
+*/
+#ifndef __MACERRORSSERVICES__
+#define __MACERRORSSERVICES__
+
+/* Database access error codes */
+enum {
+  rcDBNull                      = -800,
+  rcDBValue                     = -801,
+  rcDBError                     = -802,
+  rcDBBadType                   = -803,
+  rcDBBreak                     = -804,
+  rcDBExec                      = -805,
+  rcDBBadSessID                 = -806,
+  rcDBBadSessNum                = -807, /* bad session number for DBGetConnInfo */
+  rcDBBadDDEV                   = -808, /* bad ddev specified on DBInit */
+  rcDBAsyncNotSupp              = -809, /* ddev does not support async calls */
+  rcDBBadAsyncPB                = -810, /* tried to kill a bad pb */
+  rcDBNoHandler                 = -811, /* no app handler for specified data type */
+  rcDBWrongVersion              = -812, /* incompatible versions */
+  rcDBPackNotInited             = -813  /* attempt to call other routine before InitDBPack */
+};
+
+
+/* Collection Manager errors */
+enum {
+  collectionItemLockedErr       = -5750,
+  collectionItemNotFoundErr     = -5751,
+  collectionIndexRangeErr       = -5752,
+  collectionVersionErr          = -5753
+};
+
+
+/* UTCUtils Status Codes */
+enum {
+  kUTCUnderflowErr              = -8850,
+  kUTCOverflowErr               = -8851,
+  kIllegalClockValueErr         = -8852
+};
+
+
+/* Keychain Manager error codes */
+enum {
+  errKCNotAvailable             = -25291,
+  errKCReadOnly                 = -25292,
+  errKCAuthFailed               = -25293,
+  errKCNoSuchKeychain           = -25294,
+  errKCInvalidKeychain          = -25295,
+  errKCDuplicateKeychain        = -25296,
+  errKCDuplicateCallback        = -25297,
+  errKCInvalidCallback          = -25298,
+  errKCDuplicateItem            = -25299,
+  errKCItemNotFound             = -25300,
+  errKCBufferTooSmall           = -25301,
+  errKCDataTooLarge             = -25302,
+  errKCNoSuchAttr               = -25303,
+  errKCInvalidItemRef           = -25304,
+  errKCInvalidSearchRef         = -25305,
+  errKCNoSuchClass              = -25306,
+  errKCNoDefaultKeychain        = -25307,
+  errKCInteractionNotAllowed    = -25308,
+  errKCReadOnlyAttr             = -25309,
+  errKCWrongKCVersion           = -25310,
+  errKCKeySizeNotAllowed        = -25311,
+  errKCNoStorageModule          = -25312,
+  errKCNoCertificateModule      = -25313,
+  errKCNoPolicyModule           = -25314,
+  errKCInteractionRequired      = -25315,
+  errKCDataNotAvailable         = -25316,
+  errKCDataNotModifiable        = -25317,
+  errKCCreateChainFailed        = -25318
+};
+
+
+/* Settings Manager (formerly known as Location Manager) Errors */
+enum {
+  kALMInternalErr               = -30049,
+  kALMGroupNotFoundErr          = -30048,
+  kALMNoSuchModuleErr           = -30047,
+  kALMModuleCommunicationErr    = -30046,
+  kALMDuplicateModuleErr        = -30045,
+  kALMInstallationErr           = -30044,
+  kALMDeferSwitchErr            = -30043,
+  kALMRebootFlagsLevelErr       = -30042
+};
+
+enum {
+  kALMLocationNotFoundErr       = kALMGroupNotFoundErr /* Old name */
+};
+
+#endif /* __MACERRORSSERVICES__ */
+
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 1985-2008 by Apple Inc.. All rights reserved.
+ *
+ * @APPLE_LICENSE_HEADER_START@
+ * 
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ * 
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ * 
+ * @APPLE_LICENSE_HEADER_END@
+ */
+ 
+/*
+     File:       MacErrorsSound.h
+ 
+     Contains:   OSErr codes: Sound Manager, speech and MIDI errors.
+ 
+                 MacErrors.h includes this header; include it alone to define only
+                 these codes.  Split from MacErrors.h by tools/MacErrorsSplit.py.
+ 
+     Version:    CarbonCore-769~1
+  
+     Bugs?:      For bug reports, consult the following page on
+                 the World Wide Web:
+ 
+                     http://developer.apple.com/bugreporter/
+ 
+*/
+#ifndef __MACERRORSSOUND__
+#define __MACERRORSSOUND__
+
+#ifndef __MACERRORSCORE__
+#include <MacErrorsCore.h>
+#endif
+
+enum {
+                                        /*Sound Manager errors*/
+  noHardware                    = noHardwareErr, /*obsolete spelling*/
+  notEnoughHardware             = notEnoughHardwareErr, /*obsolete spelling*/
+  queueFull                     = -203, /*Sound Manager Error Returns*/
+  resProblem                    = -204, /*Sound Manager Error Returns*/
+  badChannel                    = -205, /*Sound Manager Error Returns*/
+  badFormat                     = -206, /*Sound Manager Error Returns*/
+  notEnoughBufferSpace          = -207, /*could not allocate enough memory*/
+  badFileFormat                 = -208, /*was not type AIFF or was of bad format,corrupt*/
+  channelBusy                   = -209, /*the Channel is being used for a PFD already*/
+  buffersTooSmall               = -210, /*can not operate in the memory allowed*/
+  channelNotBusy                = -211,
+  noMoreRealTime                = -212, /*not enough CPU cycles left to add another task*/
+  siVBRCompressionNotSupported  = -213, /*vbr audio compression not supported for this operation*/
+  siNoSoundInHardware           = -220, /*no Sound Input hardware*/
+  siBadSoundInDevice            = -221, /*invalid index passed to SoundInGetIndexedDevice*/
+  siNoBufferSpecified           = -222, /*returned by synchronous SPBRecord if nil buffer passed*/
+  siInvalidCompression          = -223, /*invalid compression type*/
+  siHardDriveTooSlow            = -224, /*hard drive too slow to record to disk*/
+  siInvalidSampleRate           = -225, /*invalid sample rate*/
+  siInvalidSampleSize           = -226, /*invalid sample size*/
+  siDeviceBusyErr               = -227, /*input device already in use*/
+  siBadDeviceName               = -228, /*input device could not be opened*/
+  siBadRefNum                   = -229, /*invalid input device reference number*/
+  siInputDeviceErr              = -230, /*input device hardware failure*/
+  siUnknownInfoType             = -231, /*invalid info type selector (returned by driver)*/
+  siUnknownQuality              = -232  /*invalid quality selector (returned by driver)*/
+};
+
+/*Speech Manager errors*/
+enum {
+  noSynthFound                  = -240,
+  synthOpenFailed               = -241,
+  synthNotReady                 = -242,
+  bufTooSmall                   = -243,
+  voiceNotFound                 = -244,
+  incompatibleVoice             = -245,
+  badDictFormat                 = -246,
+  badInputText                  = -247
+};
+
+/* Midi Manager Errors: */
+enum {
+  midiNoClientErr               = -250, /*no client with that ID found*/
+  midiNoPortErr                 = -251, /*no port with that ID found*/
+  midiTooManyPortsErr           = -252, /*too many ports already installed in the system*/
+  midiTooManyConsErr            = -253, /*too many connections made*/
+  midiVConnectErr               = -254, /*pending virtual connection created*/
+  midiVConnectMade              = -255, /*pending virtual connection resolved*/
+  midiVConnectRmvd              = -256, /*pending virtual connection removed*/
+  midiNoConErr                  = -257, /*no connection exists between specified ports*/
+  midiWriteErr                  = -258, /*MIDIWritePacket couldn't write to all connected ports*/
+  midiNameLenErr                = -259, /*name supplied is longer than 31 characters*/
+  midiDupIDErr                  = -260, /*duplicate client ID*/
+  midiInvalidCmdErr             = -261  /*command not supported for port type*/
+};
+
+
+enum {
+  siInitSDTblErr                = 1,    /*slot int dispatch table could not be initialized.*/
+  siInitVBLQsErr                = 2,    /*VBLqueues for all slots could not be initialized.*/
+  siInitSPTblErr                = 3,    /*slot priority table could not be initialized.*/
+  sdmJTInitErr                  = 10,   /*SDM Jump Table could not be initialized.*/
+  sdmInitErr                    = 11,   /*SDM could not be initialized.*/
+  sdmSRTInitErr                 = 12,   /*Slot Resource Table could not be initialized.*/
+  sdmPRAMInitErr                = 13,   /*Slot PRAM could not be initialized.*/
+  sdmPriInitErr                 = 14    /*Cards could not be initialized.*/
+};
+
+
+/* SoundSprocket Error Codes */
+enum {
+  kSSpInternalErr               = -30340,
+  kSSpVersionErr                = -30341,
+  kSSpCantInstallErr            = -30342,
+  kSSpParallelUpVectorErr       = -30343,
+  kSSpScaleToZeroErr            = -30344
+};
+
+#endif /* __MACERRORSSOUND__ */
+
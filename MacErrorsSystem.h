@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 1985-2008 by Apple Inc.. All rights reserved.
+ *
+ * @APPLE_LICENSE_HEADER_START@
+ * 
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ * 
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ * 
+ * @APPLE_LICENSE_HEADER_END@
+ */
+ 
+/*
+     File:       MacErrorsSystem.h
+ 
+     Contains:   OSErr codes: the SysError() codes (dsBusError and the rest).
+ 
+                 MacErrors.h includes this header; include it alone to define only
+                 these codes.  Split from MacErrors.h by tools/MacErrorsSplit.py.
+ 
+     Version:    CarbonCore-769~1
+  
+     Bugs?:      For bug reports, consult the following page on
+                 the World Wide Web:
+ 
+                     http://developer.apple.com/bugreporter/
+ 
+*/
+#ifndef __MACERRORSSYSTEM__
+#define __MACERRORSSYSTEM__
+
+enum {
+  dsBusError                    = 1,    /*bus error*/
+  dsAddressErr                  = 2,    /*address error*/
+  dsIllInstErr                  = 3,    /*illegal instruction error*/
+  dsZeroDivErr                  = 4,    /*zero divide error*/
+  dsChkErr                      = 5,    /*check trap error*/
+  dsOvflowErr                   = 6,    /*overflow trap error*/
+  dsPrivErr                     = 7,    /*privilege violation error*/
+  dsTraceErr                    = 8,    /*trace mode error*/
+  dsLineAErr                    = 9,    /*line 1010 trap error*/
+  dsLineFErr                    = 10,   /*line 1111 trap error*/
+  dsMiscErr                     = 11,   /*miscellaneous hardware exception error*/
+  dsCoreErr                     = 12,   /*unimplemented core routine error*/
+  dsIrqErr                      = 13,   /*uninstalled interrupt error*/
+  dsIOCoreErr                   = 14,   /*IO Core Error*/
+  dsLoadErr                     = 15,   /*Segment Loader Error*/
+  dsFPErr                       = 16,   /*Floating point error*/
+  dsNoPackErr                   = 17,   /*package 0 not present*/
+  dsNoPk1                       = 18,   /*package 1 not present*/
+  dsNoPk2                       = 19    /*package 2 not present*/
+};
+
+enum {
+  dsNoPk3                       = 20,   /*package 3 not present*/
+  dsNoPk4                       = 21,   /*package 4 not present*/
+  dsNoPk5                       = 22,   /*package 5 not present*/
+  dsNoPk6                       = 23,   /*package 6 not present*/
+  dsNoPk7                       = 24,   /*package 7 not present*/
+  dsMemFullErr                  = 25,   /*out of memory!*/
+  dsBadLaunch                   = 26,   /*can't launch file*/
+  dsFSErr                       = 27,   /*file system map has been trashed*/
+  dsStknHeap                    = 28,   /*stack has moved into application heap*/
+  negZcbFreeErr                 = 33,   /*ZcbFree has gone negative*/
+  dsFinderErr                   = 41,   /*can't load the Finder error*/
+  dsBadSlotInt                  = 51,   /*unserviceable slot interrupt*/
+  dsBadSANEOpcode               = 81,   /*bad opcode given to SANE Pack4*/
+  dsBadPatchHeader              = 83,   /*SetTrapAddress saw the come-from header*/
+  menuPrgErr                    = 84,   /*happens when a menu is purged*/
+  dsMBarNFnd                    = 85,   /*Menu Manager Errors*/
+  dsHMenuFindErr                = 86,   /*Menu Manager Errors*/
+  dsWDEFNotFound                = 87,   /*could not load WDEF*/
+  dsCDEFNotFound                = 88,   /*could not load CDEF*/
+  dsMDEFNotFound                = 89    /*could not load MDEF*/
+};
+
+enum {
+  dsNoFPU                       = 90,   /*an FPU instruction was executed and the machine doesnt have one*/
+  dsNoPatch                     = 98,   /*Can't patch for particular Model Mac*/
+  dsBadPatch                    = 99,   /*Can't load patch resource*/
+  dsParityErr                   = 101,  /*memory parity error*/
+  dsOldSystem                   = 102,  /*System is too old for this ROM*/
+  ds32BitMode                   = 103,  /*booting in 32-bit on a 24-bit sys*/
+  dsNeedToWriteBootBlocks       = 104,  /*need to write new boot blocks*/
+  dsNotEnoughRAMToBoot          = 105,  /*must have at least 1.5MB of RAM to boot 7.0*/
+  dsBufPtrTooLow                = 106,  /*bufPtr moved too far during boot*/
+  dsVMDeferredFuncTableFull     = 112,  /*VM's DeferUserFn table is full*/
+  dsVMBadBackingStore           = 113,  /*Error occurred while reading or writing the VM backing-store file*/
+  dsCantHoldSystemHeap          = 114,  /*Unable to hold the system heap during boot*/
+  dsSystemRequiresPowerPC       = 116,  /*Startup disk requires PowerPC*/
+  dsGibblyMovedToDisabledFolder = 117,  /* For debug builds only, signals that active gibbly was disabled during boot. */
+  dsUnBootableSystem            = 118,  /* Active system file will not boot on this system because it was designed only to boot from a CD. */
+  dsMustUseFCBAccessors         = 119,  /* FCBSPtr and FSFCBLen are invalid - must use FSM FCB accessor functions */
+  dsMacOSROMVersionTooOld       = 120,  /* The version of the "Mac OS ROM" file is too old to be used with the installed version of system software */
+  dsLostConnectionToNetworkDisk = 121,  /* Lost communication with Netboot server */
+  dsRAMDiskTooBig               = 122,  /* The RAM disk is too big to boot safely; will be turned off */
+  dsWriteToSupervisorStackGuardPage = 128, /*the supervisor stack overflowed into its guard page */
+  dsReinsert                    = 30,   /*request user to reinsert off-line volume*/
+  shutDownAlert                 = 42,   /*handled like a shutdown error*/
+  dsShutDownOrRestart           = 20000, /*user choice between ShutDown and Restart*/
+  dsSwitchOffOrRestart          = 20001, /*user choice between switching off and Restart*/
+  dsForcedQuit                  = 20002, /*allow the user to ExitToShell, return if Cancel*/
+  dsRemoveDisk                  = 20003, /*request user to remove disk from manual eject drive*/
+  dsDirtyDisk                   = 20004, /*request user to return a manually-ejected dirty disk*/
+  dsShutDownOrResume            = 20109, /*allow user to return to Finder or ShutDown*/
+  dsSCSIWarn                    = 20010, /*Portable SCSI adapter warning.*/
+  dsMBSysError                  = 29200, /*Media Bay replace warning.*/
+  dsMBFlpySysError              = 29201, /*Media Bay, floppy replace warning.*/
+  dsMBATASysError               = 29202, /*Media Bay, ATA replace warning.*/
+  dsMBATAPISysError             = 29203, /*Media Bay, ATAPI replace warning...*/
+  dsMBExternFlpySysError        = 29204, /*Media Bay, external floppy drive reconnect warning*/
+  dsPCCardATASysError           = 29205 /*PCCard has been ejected while still in use. */
+};
+
+/*
+    System Errors that are used after MacsBug is loaded to put up dialogs since these should not 
+    cause MacsBug to stop, they must be in the range (30, 42, 16384-32767) negative numbers add 
+    to an existing dialog without putting up a whole new dialog 
+*/
+enum {
+  dsNoExtsMacsBug               = -1,   /*not a SysErr, just a placeholder */
+  dsNoExtsDisassembler          = -2,   /*not a SysErr, just a placeholder */
+  dsMacsBugInstalled            = -10,  /*say MacsBug Installed*/
+  dsDisassemblerInstalled       = -11,  /*say Disassembler Installed*/
+  dsExtensionsDisabled          = -13,  /*say Extensions Disabled*/
+  dsGreeting                    = 40,   /*welcome to Macintosh greeting*/
+  dsSysErr                      = 32767, /*general system error*/
+                                        /*old names here for compatibilitys sake*/
+  WDEFNFnd                      = dsWDEFNotFound
+};
+
+enum {
+  CDEFNFnd                      = dsCDEFNotFound,
+  dsNotThe1                     = 31,   /*not the disk I wanted*/
+  dsBadStartupDisk              = 42,   /*unable to mount boot volume (sad Mac only)*/
+  dsSystemFileErr               = 43,   /*cant find System file to open (sad Mac only)*/
+  dsHD20Installed               = -12,  /*say HD20 Startup*/
+  mBarNFnd                      = -126, /*system error code for MBDF not found*/
+  fsDSIntErr                    = -127, /*non-hardware Internal file system error*/
+  hMenuFindErr                  = -127, /*could not find HMenu's parent in MenuKey (wrong error code - obsolete)*/
+  userBreak                     = -490, /*user debugger break*/
+  strUserBreak                  = -491, /*user debugger break; display string on stack*/
+  exUserBreak                   = -492  /*user debugger break; execute debugger commands on stack*/
+};
+
+
+enum {
+                                        /* DS Errors which are specific to the new runtime model introduced with PowerPC */
+  dsBadLibrary                  = 1010, /* Bad shared library */
+  dsMixedModeFailure            = 1011  /* Internal Mixed Mode Failure */
+};
+
+#endif /* __MACERRORSSYSTEM__ */
+
@@ -0,0 +1,421 @@
+/*
+ * Copyright (c) 1985-2008 by Apple Inc.. All rights reserved.
+ *
+ * @APPLE_LICENSE_HEADER_START@
+ * 
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ * 
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ * 
+ * @APPLE_LICENSE_HEADER_END@
+ */
+ 
+/*
+     File:       MacErrorsText.h
+ 
+     Contains:   OSErr codes: text, Unicode and international errors.
+ 
+                 MacErrors.h includes this header; include it alone to define only
+                 these codes.  Split from MacErrors.h by tools/MacErrorsSplit.py.
+ 
+     Version:    CarbonCore-769~1
+  
+     Bugs?:      For bug reports, consult the following page on
+                 the World Wide Web:
+ 
+                     http://developer.apple.com/bugreporter/
+ 
+*/
+#ifndef __MACERRORSTEXT__
+#define __MACERRORSTEXT__
+
+enum {
+                                        /*Dictionary Manager errors*/
+  notBTree                      = -410, /*The file is not a dictionary.*/
+  btNoSpace                     = -413, /*Can't allocate disk space.*/
+  btDupRecErr                   = -414, /*Record already exists.*/
+  btRecNotFnd                   = -415, /*Record cannot be found.*/
+  btKeyLenErr                   = -416, /*Maximum key length is too long or equal to zero.*/
+  btKeyAttrErr                  = -417, /*There is no such a key attribute.*/
+  unknownInsertModeErr          = -20000, /*There is no such an insert mode.*/
+  recordDataTooBigErr           = -20001, /*The record data is bigger than buffer size (1024 bytes).*/
+  invalidIndexErr               = -20002 /*The recordIndex parameter is not valid.*/
+};
+
+enum {
+  teScrapSizeErr                = -501, /*scrap item too big for text edit record*/
+  hwParamErr                    = -502, /*bad selector for _HWPriv*/
+  driverHardwareGoneErr         = -503  /*disk driver's hardware was disconnected*/
+};
+
+
+
+enum {
+                                        /* Text Services Mgr error codes */
+  tsmComponentNoErr             = 0,    /* component result = no error */
+  tsmUnsupScriptLanguageErr     = -2500,
+  tsmInputMethodNotFoundErr     = -2501,
+  tsmNotAnAppErr                = -2502, /* not an application error */
+  tsmAlreadyRegisteredErr       = -2503, /* want to register again error */
+  tsmNeverRegisteredErr         = -2504, /* app never registered error (not TSM aware) */
+  tsmInvalidDocIDErr            = -2505, /* invalid TSM documentation id */
+  tsmTSMDocBusyErr              = -2506, /* document is still active */
+  tsmDocNotActiveErr            = -2507, /* document is NOT active */
+  tsmNoOpenTSErr                = -2508, /* no open text service */
+  tsmCantOpenComponentErr       = -2509, /* cant open the component */
+  tsmTextServiceNotFoundErr     = -2510, /* no text service found */
+  tsmDocumentOpenErr            = -2511, /* there are open documents */
+  tsmUseInputWindowErr          = -2512, /* not TSM aware because we are using input window */
+  tsmTSHasNoMenuErr             = -2513, /* the text service has no menu */
+  tsmTSNotOpenErr               = -2514, /* text service is not open */
+  tsmComponentAlreadyOpenErr    = -2515, /* text service already opened for the document */
+  tsmInputMethodIsOldErr        = -2516, /* returned by GetDefaultInputMethod */
+  tsmScriptHasNoIMErr           = -2517, /* script has no imput method or is using old IM */
+  tsmUnsupportedTypeErr         = -2518, /* unSupported interface type error */
+  tsmUnknownErr                 = -2519, /* any other errors */
+  tsmInvalidContext             = -2520, /* Invalid TSMContext specified in call */
+  tsmNoHandler                  = -2521, /* No Callback Handler exists for callback */
+  tsmNoMoreTokens               = -2522, /* No more tokens are available for the source text */
+  tsmNoStem                     = -2523, /* No stem exists for the token */
+  tsmDefaultIsNotInputMethodErr = -2524, /* Current Input source is KCHR or uchr, not Input Method  (GetDefaultInputMethod) */
+  tsmDocPropertyNotFoundErr     = -2528, /* Requested TSM Document property not found */
+  tsmDocPropertyBufferTooSmallErr = -2529, /* Buffer passed in for property value is too small */
+  tsmCantChangeForcedClassStateErr = -2530, /* Enabled state of a TextService class has been forced and cannot be changed */
+  tsmComponentPropertyUnsupportedErr = -2531, /* Component property unsupported (or failed to be set) */
+  tsmComponentPropertyNotFoundErr = -2532, /* Component property not found */
+  tsmInputModeChangeFailedErr   = -2533 /* Input Mode not changed */
+};
+
+
+
+/*Text Engines, TSystemTextEngines, HIEditText error coded*/
+
+/* NumberFormatting error codes*/
+enum {
+  numberFormattingNotANumberErr = -5200,
+  numberFormattingOverflowInDestinationErr = -5201,
+  numberFormattingBadNumberFormattingObjectErr = -5202,
+  numberFormattingSpuriousCharErr = -5203,
+  numberFormattingLiteralMissingErr = -5204,
+  numberFormattingDelimiterMissingErr = -5205,
+  numberFormattingEmptyFormatErr = -5206,
+  numberFormattingBadFormatErr  = -5207,
+  numberFormattingBadOptionsErr = -5208,
+  numberFormattingBadTokenErr   = -5209,
+  numberFormattingUnOrderedCurrencyRangeErr = -5210,
+  numberFormattingBadCurrencyPositionErr = -5211,
+  numberFormattingNotADigitErr  = -5212, /* deprecated misspelled versions:*/
+  numberFormattingUnOrdredCurrencyRangeErr = -5210,
+  numberFortmattingNotADigitErr = -5212
+};
+
+/* TextParser error codes*/
+enum {
+  textParserBadParamErr         = -5220,
+  textParserObjectNotFoundErr   = -5221,
+  textParserBadTokenValueErr    = -5222,
+  textParserBadParserObjectErr  = -5223,
+  textParserParamErr            = -5224,
+  textParserNoMoreTextErr       = -5225,
+  textParserBadTextLanguageErr  = -5226,
+  textParserBadTextEncodingErr  = -5227,
+  textParserNoSuchTokenFoundErr = -5228,
+  textParserNoMoreTokensErr     = -5229
+};
+
+enum {
+  errUnknownAttributeTag        = -5240,
+  errMarginWilllNotFit          = -5241,
+  errNotInImagingMode           = -5242,
+  errAlreadyInImagingMode       = -5243,
+  errEngineNotFound             = -5244,
+  errIteratorReachedEnd         = -5245,
+  errInvalidRange               = -5246,
+  errOffsetNotOnElementBounday  = -5247,
+  errNoHiliteText               = -5248,
+  errEmptyScrap                 = -5249,
+  errReadOnlyText               = -5250,
+  errUnknownElement             = -5251,
+  errNonContiuousAttribute      = -5252,
+  errCannotUndo                 = -5253
+};
+
+
+/* IAExtractor result codes */
+enum {
+  errIANoErr                    = 0,
+  errIAUnknownErr               = -5380,
+  errIAAllocationErr            = -5381,
+  errIAParamErr                 = -5382,
+  errIANoMoreItems              = -5383,
+  errIABufferTooSmall           = -5384,
+  errIACanceled                 = -5385,
+  errIAInvalidDocument          = -5386,
+  errIATextExtractionErr        = -5387,
+  errIAEndOfTextRun             = -5388
+};
+
+
+/*
+    Language Analysis error codes
+*/
+enum {
+  laTooSmallBufferErr           = -6984, /* output buffer is too small to store any result */
+  laEnvironmentBusyErr          = -6985, /* specified environment is used */
+  laEnvironmentNotFoundErr      = -6986, /* can't fint the specified environment */
+  laEnvironmentExistErr         = -6987, /* same name environment is already exists */
+  laInvalidPathErr              = -6988, /* path is not correct */
+  laNoMoreMorphemeErr           = -6989, /* nothing to read*/
+  laFailAnalysisErr             = -6990, /* analysis failed*/
+  laTextOverFlowErr             = -6991, /* text is too long*/
+  laDictionaryNotOpenedErr      = -6992, /* the dictionary is not opened*/
+  laDictionaryUnknownErr        = -6993, /* can't use this dictionary with this environment*/
+  laDictionaryTooManyErr        = -6994, /* too many dictionaries*/
+  laPropertyValueErr            = -6995, /* Invalid property value*/
+  laPropertyUnknownErr          = -6996, /* the property is unknown to this environment*/
+  laPropertyIsReadOnlyErr       = -6997, /* the property is read only*/
+  laPropertyNotFoundErr         = -6998, /* can't find the property*/
+  laPropertyErr                 = -6999, /* Error in properties*/
+  laEngineNotFoundErr           = -7000 /* can't find the engine*/
+};
+
+
+/*
+    DictionaryMgr error codes
+*/
+enum {
+  dcmParamErr                   = -7100, /* bad parameter*/
+  dcmNotDictionaryErr           = -7101, /* not dictionary*/
+  dcmBadDictionaryErr           = -7102, /* invalid dictionary*/
+  dcmPermissionErr              = -7103, /* invalid permission*/
+  dcmDictionaryNotOpenErr       = -7104, /* dictionary not opened*/
+  dcmDictionaryBusyErr          = -7105, /* dictionary is busy*/
+  dcmBlockFullErr               = -7107, /* dictionary block full*/
+  dcmNoRecordErr                = -7108, /* no such record*/
+  dcmDupRecordErr               = -7109, /* same record already exist*/
+  dcmNecessaryFieldErr          = -7110, /* lack required/identify field*/
+  dcmBadFieldInfoErr            = -7111, /* incomplete information*/
+  dcmBadFieldTypeErr            = -7112, /* no such field type supported*/
+  dcmNoFieldErr                 = -7113, /* no such field exist*/
+  dcmBadKeyErr                  = -7115, /* bad key information*/
+  dcmTooManyKeyErr              = -7116, /* too many key field*/
+  dcmBadDataSizeErr             = -7117, /* too big data size*/
+  dcmBadFindMethodErr           = -7118, /* no such find method supported*/
+  dcmBadPropertyErr             = -7119, /* no such property exist*/
+  dcmProtectedErr               = -7121, /* need keyword to use dictionary*/
+  dcmNoAccessMethodErr          = -7122, /* no such AccessMethod*/
+  dcmBadFeatureErr              = -7124, /* invalid AccessMethod feature*/
+  dcmIterationCompleteErr       = -7126, /* no more item in iterator*/
+  dcmBufferOverflowErr          = -7127 /* data is larger than buffer size*/
+};
+
+
+
+
+
+
+/* ATSUI Error Codes - Range 1 of 2*/
+
+
+enum {
+  kATSUInvalidTextLayoutErr     = -8790, /*    An attempt was made to use a ATSUTextLayout */
+                                        /*    which hadn't been initialized or is otherwise */
+                                        /*    in an invalid state. */
+  kATSUInvalidStyleErr          = -8791, /*    An attempt was made to use a ATSUStyle which  */
+                                        /*    hadn't been properly allocated or is otherwise  */
+                                        /*    in an invalid state.  */
+  kATSUInvalidTextRangeErr      = -8792, /*    An attempt was made to extract information   */
+                                        /*    from or perform an operation on a ATSUTextLayout */
+                                        /*    for a range of text not covered by the ATSUTextLayout.  */
+  kATSUFontsMatched             = -8793, /*    This is not an error code but is returned by    */
+                                        /*    ATSUMatchFontsToText() when changes need to    */
+                                        /*    be made to the fonts associated with the text.  */
+  kATSUFontsNotMatched          = -8794, /*    This value is returned by ATSUMatchFontsToText()    */
+                                        /*    when the text contains Unicode characters which    */
+                                        /*    cannot be represented by any installed font.  */
+  kATSUNoCorrespondingFontErr   = -8795, /*    This value is retrned by font ID conversion */
+                                        /*    routines ATSUFONDtoFontID() and ATSUFontIDtoFOND() */
+                                        /*    to indicate that the input font ID is valid but */
+                                        /*    there is no conversion possible.  For example, */
+                                        /*    data-fork fonts can only be used with ATSUI not */
+                                        /*    the FontManager, and so converting an ATSUIFontID */
+                                        /*    for such a font will fail.   */
+  kATSUInvalidFontErr           = -8796, /*    Used when an attempt was made to use an invalid font ID.*/
+  kATSUInvalidAttributeValueErr = -8797, /*    Used when an attempt was made to use an attribute with */
+                                        /*    a bad or undefined value.  */
+  kATSUInvalidAttributeSizeErr  = -8798, /*    Used when an attempt was made to use an attribute with a */
+                                        /*    bad size.  */
+  kATSUInvalidAttributeTagErr   = -8799, /*    Used when an attempt was made to use a tag value that*/
+                                        /*    was not appropriate for the function call it was used.  */
+  kATSUInvalidCacheErr          = -8800, /*    Used when an attempt was made to read in style data */
+                                        /*    from an invalid cache.  Either the format of the */
+                                        /*    cached data doesn't match that used by Apple Type */
+                                        /*    Services for Unicode Imaging, or the cached data */
+                                        /*    is corrupt.  */
+  kATSUNotSetErr                = -8801, /*    Used when the client attempts to retrieve an attribute, */
+                                        /*    font feature, or font variation from a style when it */
+                                        /*    hadn't been set.  In such a case, the default value will*/
+                                        /*    be returned for the attribute's value.*/
+  kATSUNoStyleRunsAssignedErr   = -8802, /*    Used when an attempt was made to measure, highlight or draw*/
+                                        /*    a ATSUTextLayout object that has no styleRuns associated with it.*/
+  kATSUQuickDrawTextErr         = -8803, /*    Used when QuickDraw Text encounters an error rendering or measuring*/
+                                        /*    a line of ATSUI text.*/
+  kATSULowLevelErr              = -8804, /*    Used when an error was encountered within the low level ATS */
+                                        /*    mechanism performing an operation requested by ATSUI.*/
+  kATSUNoFontCmapAvailableErr   = -8805, /*    Used when no CMAP table can be accessed or synthesized for the */
+                                        /*    font passed into a SetAttributes Font call.*/
+  kATSUNoFontScalerAvailableErr = -8806, /*    Used when no font scaler is available for the font passed*/
+                                        /*    into a SetAttributes Font call.*/
+  kATSUCoordinateOverflowErr    = -8807, /*    Used to indicate the coordinates provided to an ATSUI routine caused*/
+                                        /*    a coordinate overflow (i.e. > 32K).*/
+  kATSULineBreakInWord          = -8808, /*    This is not an error code but is returned by ATSUBreakLine to */
+                                        /*    indicate that the returned offset is within a word since there was*/
+                                        /*    only less than one word that could fit the requested width.*/
+  kATSUBusyObjectErr            = -8809 /*    An ATSUI object is being used by another thread */
+};
+
+/*
+   kATSUInvalidFontFallbacksErr, which had formerly occupied -8810 has been relocated to error code -8900. See
+   below in this range for additional error codes.
+*/
+
+
+/* Error & status codes for general text and text encoding conversion*/
+
+enum {
+                                        /* general text errors*/
+  kTextUnsupportedEncodingErr   = -8738, /* specified encoding not supported for this operation*/
+  kTextMalformedInputErr        = -8739, /* in DBCS, for example, high byte followed by invalid low byte*/
+  kTextUndefinedElementErr      = -8740, /* text conversion errors*/
+  kTECMissingTableErr           = -8745,
+  kTECTableChecksumErr          = -8746,
+  kTECTableFormatErr            = -8747,
+  kTECCorruptConverterErr       = -8748, /* invalid converter object reference*/
+  kTECNoConversionPathErr       = -8749,
+  kTECBufferBelowMinimumSizeErr = -8750, /* output buffer too small to allow processing of first input text element*/
+  kTECArrayFullErr              = -8751, /* supplied name buffer or TextRun, TextEncoding, or UnicodeMapping array is too small*/
+  kTECBadTextRunErr             = -8752,
+  kTECPartialCharErr            = -8753, /* input buffer ends in the middle of a multibyte character, conversion stopped*/
+  kTECUnmappableElementErr      = -8754,
+  kTECIncompleteElementErr      = -8755, /* text element may be incomplete or is too long for internal buffers*/
+  kTECDirectionErr              = -8756, /* direction stack overflow, etc.*/
+  kTECGlobalsUnavailableErr     = -8770, /* globals have already been deallocated (premature TERM)*/
+  kTECItemUnavailableErr        = -8771, /* item (e.g. name) not available for specified region (& encoding if relevant)*/
+                                        /* text conversion status codes*/
+  kTECUsedFallbacksStatus       = -8783,
+  kTECNeedFlushStatus           = -8784,
+  kTECOutputBufferFullStatus    = -8785, /* output buffer has no room for conversion of next input text element (partial conversion)*/
+                                        /* deprecated error & status codes for low-level converter*/
+  unicodeChecksumErr            = -8769,
+  unicodeNoTableErr             = -8768,
+  unicodeVariantErr             = -8767,
+  unicodeFallbacksErr           = -8766,
+  unicodePartConvertErr         = -8765,
+  unicodeBufErr                 = -8764,
+  unicodeCharErr                = -8763,
+  unicodeElementErr             = -8762,
+  unicodeNotFoundErr            = -8761,
+  unicodeTableFormatErr         = -8760,
+  unicodeDirectionErr           = -8759,
+  unicodeContextualErr          = -8758,
+  unicodeTextEncodingDataErr    = -8757
+};
+
+
+/* ATSUI Error Codes - Range 2 of 2*/
+
+
+enum {
+  kATSUInvalidFontFallbacksErr  = -8900, /*    An attempt was made to use a ATSUFontFallbacks which hadn't */
+                                        /*    been initialized or is otherwise in an invalid state. */
+  kATSUUnsupportedStreamFormatErr = -8901, /*    An attempt was made to use a ATSUFlattenedDataStreamFormat*/
+                                        /*    which is invalid is not compatible with this version of ATSUI.*/
+  kATSUBadStreamErr             = -8902, /*    An attempt was made to use a stream which is incorrectly*/
+                                        /*    structured, contains bad or out of range values or is*/
+                                        /*    missing required information.*/
+  kATSUOutputBufferTooSmallErr  = -8903, /*    An attempt was made to use an output buffer which was too small*/
+                                        /*    for the requested operation.*/
+  kATSUInvalidCallInsideCallbackErr = -8904, /*    A call was made within the context of a callback that could*/
+                                        /*    potetially cause an infinite recursion*/
+  kATSUNoFontNameErr            = -8905, /*    This error is returned when either ATSUFindFontName() or ATSUGetIndFontName() */
+                                        /*    function cannot find a corresponding font name given the input parameters*/
+  kATSULastErr                  = -8959 /*    The last ATSUI error code.*/
+};
+
+
+
+/* Multilingual Text Engine (MLTE) error codes */
+enum {
+  kTXNEndIterationErr           = -22000, /* Function was not able to iterate through the data contained by a text object*/
+  kTXNCannotAddFrameErr         = -22001, /* Multiple frames are not currently supported in MLTE*/
+  kTXNInvalidFrameIDErr         = -22002, /* The frame ID is invalid*/
+  kTXNIllegalToCrossDataBoundariesErr = -22003, /* Offsets specify a range that crosses a data type boundary*/
+  kTXNUserCanceledOperationErr  = -22004, /* A user canceled an operation before your application completed processing it*/
+  kTXNBadDefaultFileTypeWarning = -22005, /* The text file is not in the format you specified*/
+  kTXNCannotSetAutoIndentErr    = -22006, /* Auto indentation is not available when word wrapping is enabled*/
+  kTXNRunIndexOutofBoundsErr    = -22007, /* An index you supplied to a function is out of bounds*/
+  kTXNNoMatchErr                = -22008, /* Returned by TXNFind when a match is not found*/
+  kTXNAttributeTagInvalidForRunErr = -22009, /* Tag for a specific run is not valid (the tag's dataValue is set to this)*/
+  kTXNSomeOrAllTagsInvalidForRunErr = -22010, /* At least one of the tags given is invalid*/
+  kTXNInvalidRunIndex           = -22011, /* Index is out of range for that run*/
+  kTXNAlreadyInitializedErr     = -22012, /* You already called the TXNInitTextension function*/
+  kTXNCannotTurnTSMOffWhenUsingUnicodeErr = -22013, /* Your application tried to turn off the Text Services Manager when using Unicode*/
+  kTXNCopyNotAllowedInEchoModeErr = -22014, /* Your application tried to copy text that was in echo mode*/
+  kTXNDataTypeNotAllowedErr     = -22015, /* Your application specified a data type that MLTE does not allow*/
+  kTXNATSUIIsNotInstalledErr    = -22016, /* Indicates that ATSUI is not installed on the system*/
+  kTXNOutsideOfLineErr          = -22017, /* Indicates a value that is beyond the length of the line*/
+  kTXNOutsideOfFrameErr         = -22018 /* Indicates a value that is outside of the text object's frame*/
+};
+
+
+/* UnicodeUtilities error & status codes*/
+enum {
+  kUCOutputBufferTooSmall       = -25340, /* Output buffer too small for Unicode string result*/
+  kUCTextBreakLocatorMissingType = -25341 /* Unicode text break error*/
+};
+
+enum {
+  kUCTSNoKeysAddedToObjectErr   = -25342,
+  kUCTSSearchListErr            = -25343
+};
+
+enum {
+  kUCTokenizerIterationFinished = -25344,
+  kUCTokenizerUnknownLang       = -25345,
+  kUCTokenNotFound              = -25346
+};
+
+/* StringCompare error codes (in TextUtils range)*/
+enum {
+  kCollateAttributesNotFoundErr = -29500,
+  kCollateInvalidOptions        = -29501,
+  kCollateMissingUnicodeTableErr = -29502,
+  kCollateUnicodeConvertFailedErr = -29503,
+  kCollatePatternNotFoundErr    = -29504,
+  kCollateInvalidChar           = -29505,
+  kCollateBufferTooSmall        = -29506,
+  kCollateInvalidCollationRef   = -29507
+};
+
+
+
+/* MacLocales error codes*/
+enum {
+  kLocalesBufferTooSmallErr     = -30001,
+  kLocalesTableFormatErr        = -30002,
+  kLocalesDefaultDisplayStatus  = -30029 /* Requested display locale unavailable, used default*/
+};
+
+#endif /* __MACERRORSTEXT__ */
+
@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) 1985-2008 by Apple Inc.. All rights reserved.
+ *
+ * @APPLE_LICENSE_HEADER_START@
+ * 
+ * This file contains Original Code and/or Modifications of Original Code
+ * as defined in and that are subject to the Apple Public Source License
+ * Version 2.0 (the 'License'). You may not use this file except in
+ * compliance with the License. Please obtain a copy of the License at
+ * http://www.opensource.apple.com/apsl/ and read it before using this
+ * file.
+ * 
+ * The Original Code and all software distributed under the License are
+ * distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+ * EXPRESS OR IMPLIED, AND APPLE HEREBY DISCLAIMS ALL SUCH WARRANTIES,
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT.
+ * Please see the License for the specific language governing rights and
+ * limitations under the License.
+ * 
+ * @APPLE_LICENSE_HEADER_END@
+ */
+ 
+/*
+     File:       MacErrorsToolbox.h
+ 
+     Contains:   OSErr codes: Human Interface Toolbox errors: windows, menus, controls, dialogs, events and the services built on them.
+ 
+                 MacErrors.h includes this header; include it alone to define only
+                 these codes.  Split from MacErrors.h by tools/MacErrorsSplit.py.
+ 
+     Version:    CarbonCore-769~1
+  
+     Bugs?:      For bug reports, consult the following page on
+                 the World Wide Web:
+ 
+                     http://developer.apple.com/bugreporter/
+ 
+*/
+#ifndef __MACERRORSTOOLBOX__
+#define __MACERRORSTOOLBOX__
+
+enum {
+                                        /*Scrap Manager errors*/
+  noScrapErr                    = -100, /*No scrap exists error*/
+  noTypeErr                     = -102  /*No object of that type in scrap*/
+};
+
+enum {
+  evtNotEnb                     = 1     /*event not enabled at PostEvent*/
+};
+
+
+enum {
+                                        /* Edition Mgr errors*/
+  editionMgrInitErr             = -450, /*edition manager not inited by this app*/
+  badSectionErr                 = -451, /*not a valid SectionRecord*/
+  notRegisteredSectionErr       = -452, /*not a registered SectionRecord*/
+  badEditionFileErr             = -453, /*edition file is corrupt*/
+  badSubPartErr                 = -454, /*can not use sub parts in this release*/
+  multiplePublisherWrn          = -460, /*A Publisher is already registered for that container*/
+  containerNotFoundWrn          = -461, /*could not find editionContainer at this time*/
+  containerAlreadyOpenWrn       = -462, /*container already opened by this section*/
+  notThePublisherWrn            = -463  /*not the first registered publisher for that container*/
+};
+
+
+/*Help Mgr error range: -850 to -874*/
+enum {
+  hmHelpDisabled                = -850, /* Show Balloons mode was off, call to routine ignored */
+  hmBalloonAborted              = -853, /* Returned if mouse was moving or mouse wasn't in window port rect */
+  hmSameAsLastBalloon           = -854, /* Returned from HMShowMenuBalloon if menu & item is same as last time */
+  hmHelpManagerNotInited        = -855, /* Returned from HMGetHelpMenuHandle if help menu not setup */
+  hmSkippedBalloon              = -857, /* Returned from calls if helpmsg specified a skip balloon */
+  hmWrongVersion                = -858, /* Returned if help mgr resource was the wrong version */
+  hmUnknownHelpType             = -859, /* Returned if help msg record contained a bad type */
+  hmOperationUnsupported        = -861, /* Returned from HMShowBalloon call if bad method passed to routine */
+  hmNoBalloonUp                 = -862, /* Returned from HMRemoveBalloon if no balloon was visible when call was made */
+  hmCloseViewActive             = -863  /* Returned from HMRemoveBalloon if CloseView was active */
+};
+
+
+enum {
+                                        /* Drag Manager error codes */
+  badDragRefErr                 = -1850, /* unknown drag reference */
+  badDragItemErr                = -1851, /* unknown drag item reference */
+  badDragFlavorErr              = -1852, /* unknown flavor type */
+  duplicateFlavorErr            = -1853, /* flavor type already exists */
+  cantGetFlavorErr              = -1854, /* error while trying to get flavor data */
+  duplicateHandlerErr           = -1855, /* handler already exists */
+  handlerNotFoundErr            = -1856, /* handler not found */
+  dragNotAcceptedErr            = -1857, /* drag was not accepted by receiver */
+  unsupportedForPlatformErr     = -1858, /* call is for PowerPC only */
+  noSuitableDisplaysErr         = -1859, /* no displays support translucency */
+  badImageRgnErr                = -1860, /* bad translucent image region */
+  badImageErr                   = -1861, /* bad translucent image PixMap */
+  nonDragOriginatorErr          = -1862 /* illegal attempt at originator only data */
+};
+
+/*Translation manager & Translation components*/
+enum {
+  invalidTranslationPathErr     = -3025, /*Source type to destination type not a valid path*/
+  couldNotParseSourceFileErr    = -3026, /*Source document does not contain source type*/
+  noTranslationPathErr          = -3030,
+  badTranslationSpecErr         = -3031,
+  noPrefAppErr                  = -3032
+};
+
+
+/* ScrapMgr error codes (CarbonLib 1.0 and later)*/
+enum {
+  internalScrapErr              = -4988,
+  duplicateScrapFlavorErr       = -4989,
+  badScrapRefErr                = -4990,
+  processStateIncorrectErr      = -4991,
+  scrapPromiseNotKeptErr        = -4992,
+  noScrapPromiseKeeperErr       = -4993,
+  nilScrapFlavorDataErr         = -4994,
+  scrapFlavorFlagsMismatchErr   = -4995,
+  scrapFlavorSizeMismatchErr    = -4996,
+  illegalScrapFlavorFlagsErr    = -4997,
+  illegalScrapFlavorTypeErr     = -4998,
+  illegalScrapFlavorSizeErr     = -4999,
+  scrapFlavorNotFoundErr        = -102, /* == noTypeErr*/
+  needClearScrapErr             = -100  /* == noScrapErr*/
+};
+
+
+/* HTMLRendering OSStaus codes*/
+enum {
+  hrHTMLRenderingLibNotInstalledErr = -5360,
+  hrMiscellaneousExceptionErr   = -5361,
+  hrUnableToResizeHandleErr     = -5362,
+  hrURLNotHandledErr            = -5363
+};
+
+
+/* Menu Manager error codes*/
+enum {
+  menuPropertyInvalidErr        = -5603, /* invalid property creator */
+  menuPropertyInvalid           = menuPropertyInvalidErr, /* "menuPropertyInvalid" is deprecated */
+  menuPropertyNotFoundErr       = -5604, /* specified property wasn't found */
+  menuNotFoundErr               = -5620, /* specified menu or menu ID wasn't found */
+  menuUsesSystemDefErr          = -5621, /* GetMenuDefinition failed because the menu uses the system MDEF */
+  menuItemNotFoundErr           = -5622, /* specified menu item wasn't found*/
+  menuInvalidErr                = -5623 /* menu is invalid*/
+};
+
+
+/* Window Manager error codes*/
+enum {
+  errInvalidWindowPtr           = -5600, /* tried to pass a bad WindowRef argument*/
+  errInvalidWindowRef           = -5600, /* tried to pass a bad WindowRef argument*/
+  errUnsupportedWindowAttributesForClass = -5601, /* tried to create a window with WindowAttributes not supported by the WindowClass*/
+  errWindowDoesNotHaveProxy     = -5602, /* tried to do something requiring a proxy to a window which doesnt have a proxy*/
+  errInvalidWindowProperty      = -5603, /* tried to access a property tag with private creator*/
+  errWindowPropertyNotFound     = -5604, /* tried to get a nonexistent property*/
+  errUnrecognizedWindowClass    = -5605, /* tried to create a window with a bad WindowClass*/
+  errCorruptWindowDescription   = -5606, /* tried to load a corrupt window description (size or version fields incorrect)*/
+  errUserWantsToDragWindow      = -5607, /* if returned from TrackWindowProxyDrag, you should call DragWindow on the window*/
+  errWindowsAlreadyInitialized  = -5608, /* tried to call InitFloatingWindows twice, or called InitWindows and then floating windows*/
+  errFloatingWindowsNotInitialized = -5609, /* called HideFloatingWindows or ShowFloatingWindows without calling InitFloatingWindows*/
+  errWindowNotFound             = -5610, /* returned from FindWindowOfClass*/
+  errWindowDoesNotFitOnscreen   = -5611, /* ConstrainWindowToScreen could not make the window fit onscreen*/
+  windowAttributeImmutableErr   = -5612, /* tried to change attributes which can't be changed*/
+  windowAttributesConflictErr   = -5613, /* passed some attributes that are mutually exclusive*/
+  windowManagerInternalErr      = -5614, /* something really weird happened inside the window manager*/
+  windowWrongStateErr           = -5615, /* window is not in a state that is valid for the current action*/
+  windowGroupInvalidErr         = -5616, /* WindowGroup is invalid*/
+  windowAppModalStateAlreadyExistsErr = -5617, /* we're already running this window modally*/
+  windowNoAppModalStateErr      = -5618, /* there's no app modal state for the window*/
+  errWindowDoesntSupportFocus   = -30583,
+  errWindowRegionCodeInvalid    = -30593
+};
+
+
+/* Dialog Mgr error codes*/
+enum {
+  dialogNoTimeoutErr            = -5640
+};
+
+
+/* NavigationLib error codes*/
+enum {
+  kNavWrongDialogStateErr       = -5694,
+  kNavWrongDialogClassErr       = -5695,
+  kNavInvalidSystemConfigErr    = -5696,
+  kNavCustomControlMessageFailedErr = -5697,
+  kNavInvalidCustomControlMessageErr = -5698,
+  kNavMissingKindStringErr      = -5699
+};
+
+
+/* Appearance Manager Error Codes */
+enum {
+  themeInvalidBrushErr          = -30560, /* pattern index invalid */
+  themeProcessRegisteredErr     = -30561,
+  themeProcessNotRegisteredErr  = -30562,
+  themeBadTextColorErr          = -30563,
+  themeHasNoAccentsErr          = -30564,
+  themeBadCursorIndexErr        = -30565,
+  themeScriptFontNotFoundErr    = -30566, /* theme font requested for uninstalled script system */
+  themeMonitorDepthNotSupportedErr = -30567, /* theme not supported at monitor depth */
+  themeNoAppropriateBrushErr    = -30568 /* theme brush has no corresponding theme text color */
+};
+
+
+
+/*
+ *  Discussion:
+ *    Control Manager Error Codes
+ */
+enum {
+
+  /*
+   * Not exclusively a Control Manager error code. In general, this
+   * return value means a control, window, or menu definition does not
+   * support the message/event that underlies an API call.
+   */
+  errMessageNotSupported        = -30580,
+
+  /*
+   * This is returned from GetControlData and SetControlData if the
+   * control doesn't support the tag name and/or part code that is
+   * passed in. It can also be returned from other APIs - like
+   * SetControlFontStyle - which are wrappers around Get/SetControlData.
+   */
+  errDataNotSupported           = -30581,
+
+  /*
+   * The control you passed to a focusing API doesn't support focusing.
+   * This error isn't sent on Mac OS X; instead, you're likely to
+   * receive errCouldntSetFocus or eventNotHandledErr.
+   */
+  errControlDoesntSupportFocus  = -30582,
+
+  /*
+   * This is a variant of and serves the same purpose as
+   * controlHandleInvalidErr. Various Control Manager APIs will return
+   * this error if one of the passed-in controls is NULL or otherwise
+   * invalid.
+   */
+  errUnknownControl             = -30584,
+
+  /*
+   * The focus couldn't be set to a given control or advanced through a
+   * hierarchy of controls. This could be because the control doesn't
+   * support focusing, the control isn't currently embedded in a
+   * window, or there are no focusable controls in the window when you
+   * try to advance the focus.
+   */
+  errCouldntSetFocus            = -30585,
+
+  /*
+   * This is returned by GetRootControl before a root control was
+   * created for a given non-compositing window. Alternatively, you
+   * called a Control Manager API such as ClearKeyboardFocus or
+   * AutoEmbedControl that requires a root control, but there is no
+   * root control on the window.
+   */
+  errNoRootControl              = -30586,
+
+  /*
+   * This is returned by CreateRootControl on the second and successive
+   * calls for a given window.
+   */
+  errRootAlreadyExists          = -30587,
+
+  /*
+   * The ControlPartCode you passed to a Control Manager API is out of
+   * range, invalid, or otherwise unsupported.
+   */
+  errInvalidPartCode            = -30588,
+
+  /*
+   * You called CreateRootControl after creating one or more non-root
+   * controls in a window, which is illegal; if you want an embedding
+   * hierarchy on a given window, you must call CreateRootControl
+   * before creating any other controls for a given window. This will
+   * never be returned on Mac OS X, because a root control is created
+   * automatically if it doesn't already exist the first time any
+   * non-root control is created in a window.
+   */
+  errControlsAlreadyExist       = -30589,
+
+  /*
+   * You passed a control that doesn't support embedding to a Control
+   * Manager API which requires the control to support embedding.
+   */
+  errControlIsNotEmbedder       = -30590,
+
+  /*
+   * You called GetControlData or SetControlData with a buffer whose
+   * size does not match the size of the data you are attempting to get
+   * or set.
+   */
+  errDataSizeMismatch           = -30591,
+
+  /*
+   * You called TrackControl, HandleControlClick or a similar mouse
+   * tracking API on a control that is invisible or disabled. You
+   * cannot track controls that are invisible or disabled.
+   */
+  errControlHiddenOrDisabled    = -30592,
+
+  /*
+   * You called EmbedControl or a similar API with the same control in
+   * the parent and child parameters. You cannot embed a control into
+   * itself.
+   */
+  errCantEmbedIntoSelf          = -30594,
+
+  /*
+   * You called EmbedControl or a similiar API to embed the root
+   * control in another control. You cannot embed the root control in
+   * any other control.
+   */
+  errCantEmbedRoot              = -30595,
+
+  /*
+   * You called GetDialogItemAsControl on a dialog item such as a
+   * kHelpDialogItem that is not represented by a control.
+   */
+  errItemNotControl             = -30596,
+
+  /*
+   * You called GetControlData or SetControlData with a buffer that
+   * represents a versioned structure, but the version is unsupported
+   * by the control definition. This can happen with the Tabs control
+   * and the kControlTabInfoTag.
+   */
+  controlInvalidDataVersionErr  = -30597,
+
+  /*
+   * You called SetControlProperty, GetControlProperty, or a similar
+   * API with an illegal property creator OSType.
+   */
+  controlPropertyInvalid        = -5603,
+
+  /*
+   * You called GetControlProperty or a similar API with a property
+   * creator and property tag that does not currently exist on the
+   * given control.
+   */
+  controlPropertyNotFoundErr    = -5604,
+
+  /*
+   * You passed an invalid ControlRef to a Control Manager API.
+   */
+  controlHandleInvalidErr       = -30599
+};
+
+#endif /* __MACERRORSTOOLBOX__ */
+
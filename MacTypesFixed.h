@@ -0,0 +1,298 @@
+/*
+     File:       MacTypesFixed.h
+
+     Contains:   Arithmetic on the MacTypes.h fixed point types, one value at a time and
+                 over arrays.
+
+                 The scalar functions are inline (and constexpr in C++14 and later).  They
+                 work like the FixMath.h routines (FixMul, FixDiv, FixRatio, FracMul,
+                 FracDiv, Fix2Frac, X2Fix...), but their names differ, so both headers
+                 can be included together, and so does their rounding, which is exact:
+
+                   - Every result is the exact result rounded to the nearest value of the
+                     result type, with halves rounded up (towards +infinity).
+
+                   - A result outside the range of its type saturates to the nearest end
+                     of it: 0x7FFFFFFF or 0x80000000 for Fixed and Fract.  So does
+                     division by zero, towards the sign of the dividend.
+
+                   - Converting a NaN gives 0.
+
+                 The array functions compute the same thing for count elements, bit for
+                 bit.  libCarbonHeaders implements them with AVX2 and FMA on x86 processors
+                 that have them (chosen as the program is loaded, see TargetCPUFeatures.h),
+                 with NEON on arm64, and with the scalar functions elsewhere.  A result
+                 array may be one of the argument arrays, but must not otherwise overlap
+                 them.
+
+                 Code using the array functions must be linked with libCarbonHeaders.
+
+*/
+#ifndef __MACTYPESFIXED__
+#define __MACTYPESFIXED__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef __MACTYPES__
+#include <MacTypes.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(__cplusplus) && (__cplusplus >= 201402L)
+	#define __MACTYPESFIXED_INLINE      static inline constexpr
+#else
+	#define __MACTYPESFIXED_INLINE      static inline
+#endif
+
+/* Clamps a wider result to the range of Fixed (and Fract). */
+__MACTYPESFIXED_INLINE Fixed
+__MacTypesFixedSaturate(int64_t value)
+{
+	return value > INT32_MAX ? (Fixed)INT32_MAX : value < INT32_MIN ? (Fixed)INT32_MIN : (Fixed)value;
+}
+
+/* Returns numerator / denominator rounded half up, saturated; both are scaled alike. */
+__MACTYPESFIXED_INLINE Fixed
+__MacTypesFixedQuotient(int64_t numerator, int32_t denominator)
+{
+	int64_t divisor = denominator;
+	int64_t quotient = 0;
+
+	if ( divisor == 0 )
+		return numerator < 0 ? (Fixed)INT32_MIN : (Fixed)INT32_MAX;
+	if ( divisor < 0 )
+	{
+		numerator = -numerator;
+		divisor = -divisor;
+	}
+	/* floor(n / d + 1/2) = floor((2n + d) / 2d) */
+	numerator = 2 * numerator + divisor;
+	divisor *= 2;
+	quotient = numerator / divisor;
+	if ( numerator % divisor < 0 )
+		--quotient;
+	return __MacTypesFixedSaturate(quotient);
+}
+
+/* Returns value rounded half up to an integer, clamped to [minimum, maximum]; NaN gives 0. */
+__MACTYPESFIXED_INLINE int64_t
+__MacTypesFixedRound(double value, int64_t minimum, int64_t maximum)
+{
+	int64_t integer = 0;
+
+	if ( value != value )
+		return 0;
+	if ( value >= (double)maximum + 0.5 )
+		return maximum;
+	if ( value < (double)minimum - 0.5 )
+		return minimum;
+	integer = (int64_t)value;
+	if ( (double)integer > value )
+		--integer;
+	if ( value - (double)integer >= 0.5 )
+		++integer;
+	return integer;
+}
+
+/*
+ *  FixedMultiply(), FractMultiply()
+ *
+ *  Summary:
+ *    Return a * b: FixedMultiply() as FixMul() does for two Fixed values, FractMultiply()
+ *    as FracMul() does for two Fract values.
+ */
+__MACTYPESFIXED_INLINE Fixed
+FixedMultiply(Fixed a, Fixed b)
+{
+	return __MacTypesFixedSaturate(((int64_t)a * b + 0x8000) >> 16);
+}
+
+__MACTYPESFIXED_INLINE Fract
+FractMultiply(Fract a, Fract b)
+{
+	return __MacTypesFixedSaturate(((int64_t)a * b + 0x20000000) >> 30);
+}
+
+/*
+ *  FixedDivide(), FractDivide(), FixedRatio()
+ *
+ *  Summary:
+ *    Return a / b: FixedDivide() as a Fixed, like FixDiv(); FractDivide() as a Fract,
+ *    like FracDiv(); FixedRatio() of two integers as a Fixed, like FixRatio().
+ */
+__MACTYPESFIXED_INLINE Fixed
+FixedDivide(Fixed a, Fixed b)
+{
+	return __MacTypesFixedQuotient((int64_t)a * 0x10000, b);
+}
+
+__MACTYPESFIXED_INLINE Fract
+FractDivide(Fract a, Fract b)
+{
+	return __MacTypesFixedQuotient((int64_t)a * 0x40000000, b);
+}
+
+__MACTYPESFIXED_INLINE Fixed
+FixedRatio(short numerator, short denominator)
+{
+	return __MacTypesFixedQuotient((int64_t)numerator * 0x10000, denominator);
+}
+
+/*
+ *  FixedAdd(), FixedSubtract()
+ *
+ *  Summary:
+ *    Return a + b and a - b, saturated.  They serve for Fract values too.
+ */
+__MACTYPESFIXED_INLINE Fixed
+FixedAdd(Fixed a, Fixed b)
+{
+	return __MacTypesFixedSaturate((int64_t)a + b);
+}
+
+__MACTYPESFIXED_INLINE Fixed
+FixedSubtract(Fixed a, Fixed b)
+{
+	return __MacTypesFixedSaturate((int64_t)a - b);
+}
+
+/*
+ *  Conversions
+ *
+ *  Summary:
+ *    Convert between the fixed point types and to and from float and double.  The
+ *    conversions to float and double are exact, except FloatFromFixed() and
+ *    FloatFromFract(), which round to nearest even as the float conversions do.
+ */
+__MACTYPESFIXED_INLINE Fract
+FractFromFixed(Fixed value)
+{
+	return __MacTypesFixedSaturate((int64_t)value * 0x4000);
+}
+
+__MACTYPESFIXED_INLINE Fixed
+FixedFromFract(Fract value)
+{
+	return (Fixed)(((int64_t)value + 0x2000) >> 14);
+}
+
+__MACTYPESFIXED_INLINE ShortFixed
+ShortFixedFromFixed(Fixed value)
+{
+	int64_t rounded = ((int64_t)value + 0x80) >> 8;
+
+	return (ShortFixed)(rounded > INT16_MAX ? INT16_MAX : rounded < INT16_MIN ? INT16_MIN : rounded);
+}
+
+__MACTYPESFIXED_INLINE Fixed
+FixedFromShortFixed(ShortFixed value)
+{
+	return (Fixed)value * 0x100;
+}
+
+__MACTYPESFIXED_INLINE double
+DoubleFromFixed(Fixed value)
+{
+	return (double)value / 65536.0;
+}
+
+__MACTYPESFIXED_INLINE Fixed
+FixedFromDouble(double value)
+{
+	return (Fixed)__MacTypesFixedRound(value * 65536.0, INT32_MIN, INT32_MAX);
+}
+
+__MACTYPESFIXED_INLINE float
+FloatFromFixed(Fixed value)
+{
+	return (float)((double)value / 65536.0);
+}
+
+__MACTYPESFIXED_INLINE Fixed
+FixedFromFloat(float value)
+{
+	return (Fixed)__MacTypesFixedRound((double)value * 65536.0, INT32_MIN, INT32_MAX);
+}
+
+__MACTYPESFIXED_INLINE double
+DoubleFromFract(Fract value)
+{
+	return (double)value / 1073741824.0;
+}
+
+__MACTYPESFIXED_INLINE Fract
+FractFromDouble(double value)
+{
+	return (Fract)__MacTypesFixedRound(value * 1073741824.0, INT32_MIN, INT32_MAX);
+}
+
+__MACTYPESFIXED_INLINE float
+FloatFromFract(Fract value)
+{
+	return (float)((double)value / 1073741824.0);
+}
+
+__MACTYPESFIXED_INLINE double
+DoubleFromUnsignedFixed(UnsignedFixed value)
+{
+	return (double)value / 65536.0;
+}
+
+__MACTYPESFIXED_INLINE UnsignedFixed
+UnsignedFixedFromDouble(double value)
+{
+	return (UnsignedFixed)__MacTypesFixedRound(value * 65536.0, 0, UINT32_MAX);
+}
+
+/*
+ *  Array functions
+ *
+ *  Summary:
+ *    Each sets result[i] to the function of the same name without Array applied to
+ *    a[i] (and b[i]), for i from 0 to count - 1.
+ */
+extern void
+FixedMultiplyArray(const Fixed *a, const Fixed *b, Fixed *result, size_t count);
+
+extern void
+FractMultiplyArray(const Fract *a, const Fract *b, Fract *result, size_t count);
+
+extern void
+FixedDivideArray(const Fixed *a, const Fixed *b, Fixed *result, size_t count);
+
+extern void
+FractDivideArray(const Fract *a, const Fract *b, Fract *result, size_t count);
+
+extern void
+FixedAddArray(const Fixed *a, const Fixed *b, Fixed *result, size_t count);
+
+extern void
+FixedSubtractArray(const Fixed *a, const Fixed *b, Fixed *result, size_t count);
+
+extern void
+DoubleFromFixedArray(const Fixed *a, double *result, size_t count);
+
+extern void
+FixedFromDoubleArray(const double *a, Fixed *result, size_t count);
+
+extern void
+FloatFromFixedArray(const Fixed *a, float *result, size_t count);
+
+extern void
+FixedFromFloatArray(const float *a, Fixed *result, size_t count);
+
+extern void
+DoubleFromFractArray(const Fract *a, double *result, size_t count);
+
+extern void
+FractFromDoubleArray(const double *a, Fract *result, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MACTYPESFIXED__ */
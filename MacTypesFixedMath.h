@@ -0,0 +1,123 @@
+/*
+     File:       MacTypesFixedMath.h
+
+     Contains:   Square root, sine, cosine, arctangent and exponential on the MacTypes.h
+                 fixed point types, one value at a time and over arrays.
+
+                 They compute what the FixMath.h routines FracSqrt, FracSin, FracCos and
+                 FixATan2 compute (and FixedExp() e to a power), without going through
+                 the C library:
+
+                   - FractSqrt() is exact: the square root rounded to the nearest Fract,
+                     halves up.
+
+                   - The others reduce the argument (with a split constant, or for
+                     FixedExp() exactly, in integer arithmetic), look up the nearest of
+                     a few hundred table entries (some 1400 for FixedExp()) and correct it
+                     with a short polynomial, in double.  The result is within 2^-40 or so of the exact
+                     one before it is rounded to the result type, so it is the exact value
+                     correctly rounded but for the rare arguments whose exact result lies
+                     even closer than that to a half.
+
+                 The computation is the same sequence of IEEE double operations, never
+                 fused, in the scalar functions and in every vector version of the array
+                 functions, so their results agree bit for bit with each other and on
+                 every processor.  The array functions use AVX2 on x86 processors that
+                 have it (see TargetCPUFeatures.h), and the scalar functions elsewhere.
+
+                 The array functions are several times faster than the C library.  Of
+                 the scalar functions, FixedExp() takes about half as long as converting
+                 to double, calling exp() and converting back, and FixedATan2() about
+                 two fifths as long as atan2().  FractSqrt() takes about as long as the
+                 same path through sqrt(): both are bound by one square root instruction, but
+                 FractSqrt() rounds exactly where the double square root rounds twice.
+                 FractSin() and FractCos() are not a faster path: they take about as
+                 long as sin() and cos(), and are for their exact, library-independent
+                 results; for speed, use the array functions ("make bench_fixed_math"
+                 measures both).
+
+                 Code using this must be linked with libCarbonHeaders.
+
+*/
+#ifndef __MACTYPESFIXEDMATH__
+#define __MACTYPESFIXEDMATH__
+
+#include <stddef.h>
+
+#ifndef __MACTYPES__
+#include <MacTypes.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ *  FractSqrt()
+ *
+ *  Summary:
+ *    Returns the square root of x, taking x and the result as unsigned Fracts (0 to
+ *    4 - 2^-30, and 0 to 2), as FracSqrt() does.
+ */
+extern Fract
+FractSqrt(Fract x);
+
+/*
+ *  FractSin(), FractCos()
+ *
+ *  Summary:
+ *    Return the sine and cosine of x radians, as FracSin() and FracCos() do.
+ */
+extern Fract
+FractSin(Fixed x);
+
+extern Fract
+FractCos(Fixed x);
+
+/*
+ *  FixedATan2()
+ *
+ *  Summary:
+ *    Returns the angle, from -pi to pi radians, of the point (x, y), as FixATan2() does.
+ *    x and y may have any scale, as long as it is the same; FixedATan2(0, 0) is 0.
+ */
+extern Fixed
+FixedATan2(SInt32 x, SInt32 y);
+
+/*
+ *  FixedExp()
+ *
+ *  Summary:
+ *    Returns e to the power x, saturated at 0x7FFFFFFF (for x above about 10.4).
+ */
+extern Fixed
+FixedExp(Fixed x);
+
+/*
+ *  Array functions
+ *
+ *  Summary:
+ *    Each sets result[i] to the function of the same name without Array applied to
+ *    x[i] (and y[i]), for i from 0 to count - 1.  The result array may be an argument
+ *    array, but must not otherwise overlap one.
+ */
+extern void
+FractSqrtArray(const Fract *x, Fract *result, size_t count);
+
+extern void
+FractSinArray(const Fixed *x, Fract *result, size_t count);
+
+extern void
+FractCosArray(const Fixed *x, Fract *result, size_t count);
+
+extern void
+FixedATan2Array(const SInt32 *x, const SInt32 *y, Fixed *result, size_t count);
+
+extern void
+FixedExpArray(const Fixed *x, Fixed *result, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MACTYPESFIXEDMATH__ */
@@ -0,0 +1,111 @@
+/*
+     File:       MacTypesFixedString.h
+
+     Contains:   Conversions between the MacTypes.h fixed point types and decimal strings.
+
+                 The String functions write the shortest decimal in the type's range
+                 that reads back as the same value, and, among those of that length,
+                 the nearest one, or of two as near the one farther from zero: 0x8000
+                 is "0.5", 0x10000 is "1", 0x1199A (1.1000061...) is "1.1".  There is
+                 no exponent, no leading zero but the one before a point, and no
+                 trailing zero after it.
+
+                 The FromString functions read a decimal, with an optional sign, point
+                 and exponent ("-1.25", ".5", "3e-2"), and round its exact value as
+                 MacTypesFixed.h rounds: to the nearest value of the type, halves up
+                 (towards +infinity), saturated at the ends of its range.  However long
+                 the decimal, the result is exact.
+
+                 Neither uses floating point, the C library's formatting or locale, or
+                 the heap.
+
+                 Code using this must be linked with libCarbonHeaders.
+
+*/
+#ifndef __MACTYPESFIXEDSTRING__
+#define __MACTYPESFIXEDSTRING__
+
+#include <stddef.h>
+
+#ifndef __MACTYPES__
+#include <MacTypes.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A buffer of this many bytes holds any of the strings, with its terminating NUL. */
+enum {
+  kMacTypesFixedStringSize      = 16
+};
+
+/*
+ *  StringFromFixed(), StringFromUnsignedFixed(), StringFromFract(),
+ *  StringFromShortFixed()
+ *
+ *  Summary:
+ *    Write value as the shortest decimal that reads back as value, truncating it and
+ *    always terminating it if the buffer is not empty.  Return the length of the whole
+ *    string, as strlcpy() does.
+ *
+ *  Parameters:
+ *
+ *    value:
+ *      The value to write.
+ *
+ *    buffer:
+ *      Receives the string; kMacTypesFixedStringSize bytes are always enough.
+ *
+ *    bufferSize:
+ *      The size of buffer in bytes, which may be 0.
+ */
+extern size_t
+StringFromFixed(Fixed value, char *buffer, size_t bufferSize);
+
+extern size_t
+StringFromUnsignedFixed(UnsignedFixed value, char *buffer, size_t bufferSize);
+
+extern size_t
+StringFromFract(Fract value, char *buffer, size_t bufferSize);
+
+extern size_t
+StringFromShortFixed(ShortFixed value, char *buffer, size_t bufferSize);
+
+/*
+ *  FixedFromString(), UnsignedFixedFromString(), FractFromString(),
+ *  ShortFixedFromString()
+ *
+ *  Summary:
+ *    Read a decimal from the start of string, as strtod() does without its leading
+ *    white space, hexadecimal, infinities and NaNs.  Return the number of characters
+ *    read, or 0, leaving value alone, if string does not start with a decimal.
+ *
+ *  Parameters:
+ *
+ *    string:
+ *      The characters to read, which need not be terminated.
+ *
+ *    length:
+ *      The number of characters in string.
+ *
+ *    value:
+ *      Receives the decimal, rounded to the type.
+ */
+extern size_t
+FixedFromString(const char *string, size_t length, Fixed *value);
+
+extern size_t
+UnsignedFixedFromString(const char *string, size_t length, UnsignedFixed *value);
+
+extern size_t
+FractFromString(const char *string, size_t length, Fract *value);
+
+extern size_t
+ShortFixedFromString(const char *string, size_t length, ShortFixed *value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MACTYPESFIXEDSTRING__ */
@@ -0,0 +1,154 @@
+/*
+     File:       MacTypesTransform.h
+
+     Contains:   Affine transforms of the MacTypes.h point and rectangle types, one at a
+                 time and over arrays.
+
+                 A matrix is laid out as a QuickTime MatrixRecord, and a point is a row
+                 vector multiplied on its left:
+
+                                          | a   b   u |
+                     [x' y' 1] = [x y 1]  | c   d   v |
+                                          | tx  ty  w |
+
+                 so matrix[2] holds the translation.  The third column, where QuickTime
+                 keeps the perspective terms, is not used: the transforms are affine, and
+                 a MatrixRecord without perspective can be copied into a FixedMatrix as
+                 it is.
+
+                 With a FixedMatrix, every coordinate is the exact x * a + y * c + tx (or
+                 x * b + y * d + ty) rounded as MacTypesFixed.h rounds: to the nearest
+                 Fixed, halves up, saturated.  It cannot overflow on the way.  With a
+                 Float32Matrix, it is (x * a + y * c) + tx in float, each operation
+                 rounded and none fused.
+
+                 The array functions compute the same thing for count elements, bit for
+                 bit.  libCarbonHeaders implements them with AVX2 on x86 processors that
+                 have it (see TargetCPUFeatures.h), and with the scalar functions
+                 elsewhere.  The result array may be the argument array, but must not
+                 otherwise overlap it.
+
+                 Code using the array functions must be linked with libCarbonHeaders.
+
+*/
+#ifndef __MACTYPESTRANSFORM__
+#define __MACTYPESTRANSFORM__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef __MACTYPES__
+#include <MacTypes.h>
+#endif
+
+#ifndef __MACTYPESFIXED__
+#include <MacTypesFixed.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct FixedMatrix {
+  Fixed               matrix[3][3];
+};
+typedef struct FixedMatrix              FixedMatrix;
+
+struct Float32Matrix {
+  Float32             matrix[3][3];
+};
+typedef struct Float32Matrix            Float32Matrix;
+
+/*
+ *  Returns first + second + translation, the first two at the scale of a product of
+ *  Fixed values, rounded half up to a Fixed and saturated.  Halving the exact sum first
+ *  keeps it in 64 bits: only the two low bits of the products can carry into it.
+ */
+__MACTYPESFIXED_INLINE Fixed
+__FixedMatrixRound(int64_t first, int64_t second, Fixed translation)
+{
+	int64_t half = (first >> 1) + (second >> 1) + (first & second & 1) + (int64_t)translation * 0x8000 + 0x4000;
+
+	return __MacTypesFixedSaturate(half >> 15);
+}
+
+/*
+ *  FixedMatrixTransformPoint(), Float32MatrixTransformPoint()
+ *
+ *  Summary:
+ *    Return point transformed by matrix.  Float32MatrixTransformPoint() is not inline,
+ *    so that no compiler can fuse its operations.
+ */
+__MACTYPESFIXED_INLINE FixedPoint
+FixedMatrixTransformPoint(const FixedMatrix *matrix, FixedPoint point)
+{
+	FixedPoint  result = { 0, 0 };
+
+	result.x = __FixedMatrixRound((int64_t)point.x * matrix->matrix[0][0], (int64_t)point.y * matrix->matrix[1][0],
+								  matrix->matrix[2][0]);
+	result.y = __FixedMatrixRound((int64_t)point.x * matrix->matrix[0][1], (int64_t)point.y * matrix->matrix[1][1],
+								  matrix->matrix[2][1]);
+	return result;
+}
+
+extern Float32Point
+Float32MatrixTransformPoint(const Float32Matrix *matrix, Float32Point point);
+
+/*
+ *  FixedMatrixTransformRect()
+ *
+ *  Summary:
+ *    Returns the smallest FixedRect holding the four corners of rect transformed by
+ *    matrix: the rectangle itself when the matrix only scales and translates, its
+ *    bounding box when it rotates or skews.  Each side is the rounded extreme of the
+ *    exact corners, so it is the extreme of the corners as FixedMatrixTransformPoint()
+ *    would round them.
+ */
+__MACTYPESFIXED_INLINE FixedRect
+FixedMatrixTransformRect(const FixedMatrix *matrix, FixedRect rect)
+{
+	FixedRect   result = { 0, 0, 0, 0 };
+	int64_t     leftA = (int64_t)rect.left * matrix->matrix[0][0];
+	int64_t     rightA = (int64_t)rect.right * matrix->matrix[0][0];
+	int64_t     topC = (int64_t)rect.top * matrix->matrix[1][0];
+	int64_t     bottomC = (int64_t)rect.bottom * matrix->matrix[1][0];
+	int64_t     leftB = (int64_t)rect.left * matrix->matrix[0][1];
+	int64_t     rightB = (int64_t)rect.right * matrix->matrix[0][1];
+	int64_t     topD = (int64_t)rect.top * matrix->matrix[1][1];
+	int64_t     bottomD = (int64_t)rect.bottom * matrix->matrix[1][1];
+
+	/* Each coordinate is a sum of a term in x and a term in y, so its extremes are too. */
+	result.left = __FixedMatrixRound(leftA < rightA ? leftA : rightA, topC < bottomC ? topC : bottomC,
+									 matrix->matrix[2][0]);
+	result.right = __FixedMatrixRound(leftA < rightA ? rightA : leftA, topC < bottomC ? bottomC : topC,
+									  matrix->matrix[2][0]);
+	result.top = __FixedMatrixRound(leftB < rightB ? leftB : rightB, topD < bottomD ? topD : bottomD,
+									matrix->matrix[2][1]);
+	result.bottom = __FixedMatrixRound(leftB < rightB ? rightB : leftB, topD < bottomD ? bottomD : topD,
+									   matrix->matrix[2][1]);
+	return result;
+}
+
+/*
+ *  Array functions
+ *
+ *  Summary:
+ *    Each sets result[i] to the function of the same name with Points or Rects in
+ *    place of Point or Rect applied to matrix and source[i], for i from 0 to
+ *    count - 1.
+ */
+extern void
+FixedMatrixTransformPoints(const FixedMatrix *matrix, const FixedPoint *source, FixedPoint *result, size_t count);
+
+extern void
+FixedMatrixTransformRects(const FixedMatrix *matrix, const FixedRect *source, FixedRect *result, size_t count);
+
+extern void
+Float32MatrixTransformPoints(const Float32Matrix *matrix, const Float32Point *source, Float32Point *result,
+							 size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MACTYPESTRANSFORM__ */
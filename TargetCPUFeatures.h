@@ -0,0 +1,277 @@
+/*
+     File:       TargetCPUFeatures.h
+
+     Contains:   The instruction set extensions of the processor a program runs on.
+
+                 TargetConditionals.h says which processor the compiler generates code
+                 for (TARGET_CPU_X86_64, TARGET_CPU_ARM64...); this says which extensions
+                 of it the running machine has, and its operating system supports.  They
+                 are probed once, with cpuid and xgetbv on x86, the auxiliary vector on
+                 Linux and sysctl on Darwin, when the library is loaded or first asked,
+                 and then only read.
+
+                 TARGET_CPU_DISPATCH() defines a function that calls the best of several
+                 implementations for the running processor, chosen the first time it is
+                 needed.  With glibc the choice is made as the program is loaded, by an
+                 ifunc resolver, and the function is then called directly.  Elsewhere
+                 (Darwin has no ifunc for programs) the first call chooses, and later
+                 calls go through a function pointer.
+
+                 The implementations are usually compiled for their extensions with
+                 __attribute__((target("avx2"))) or the like, so that the rest of the
+                 file can still run anywhere.
+
+                 Code using this must be linked with libCarbonHeaders.
+
+*/
+#ifndef __TARGETCPUFEATURES__
+#define __TARGETCPUFEATURES__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ *  TargetCPUFeature
+ *
+ *  Summary:
+ *    One bit per extension.  The x86 and ARM extensions have their own bits, except for
+ *    the cryptographic ones both have, which share them.
+ */
+enum {
+	kTargetCPUFeatureAES            = 0x00000001,   /* AES-NI, or the ARMv8 AES instructions */
+	kTargetCPUFeatureCLMUL          = 0x00000002,   /* PCLMULQDQ, or ARMv8 PMULL */
+	kTargetCPUFeatureSHA2           = 0x00000004,   /* SHA-NI, or the ARMv8 SHA-256 instructions */
+
+	kTargetCPUFeatureSSE2           = 0x00000008,
+	kTargetCPUFeatureSSE3           = 0x00000010,
+	kTargetCPUFeatureSSSE3          = 0x00000020,
+	kTargetCPUFeatureSSE41          = 0x00000040,
+	kTargetCPUFeatureSSE42          = 0x00000080,
+	kTargetCPUFeaturePOPCNT         = 0x00000100,
+	kTargetCPUFeatureLZCNT          = 0x00000200,
+	kTargetCPUFeatureMOVBE          = 0x00000400,
+	kTargetCPUFeatureAVX            = 0x00000800,
+	kTargetCPUFeatureF16C           = 0x00001000,
+	kTargetCPUFeatureFMA            = 0x00002000,
+	kTargetCPUFeatureBMI1           = 0x00004000,
+	kTargetCPUFeatureBMI2           = 0x00008000,
+	kTargetCPUFeatureAVX2           = 0x00010000,
+	kTargetCPUFeatureAVX512F        = 0x00020000,
+	kTargetCPUFeatureAVX512DQ       = 0x00040000,
+	kTargetCPUFeatureAVX512BW       = 0x00080000,
+	kTargetCPUFeatureAVX512VL       = 0x00100000,
+	kTargetCPUFeatureAVX512VNNI     = 0x00200000,
+
+	kTargetCPUFeatureNEON           = 0x00400000,   /* Advanced SIMD */
+	kTargetCPUFeatureCRC32          = 0x00800000,
+	kTargetCPUFeatureLSE            = 0x01000000,   /* ARMv8.1 atomics */
+	kTargetCPUFeatureFP16           = 0x02000000,   /* half precision arithmetic */
+	kTargetCPUFeatureDotProd        = 0x04000000,   /* SDOT and UDOT */
+	kTargetCPUFeatureI8MM           = 0x08000000,
+	kTargetCPUFeatureBF16           = 0x10000000,
+	kTargetCPUFeatureSVE            = 0x20000000,
+	kTargetCPUFeatureSVE2           = 0x40000000
+};
+
+/*
+ *  TARGET_CPU_FEATURES_BASELINE
+ *
+ *  Summary:
+ *    The features the compiler was told it may assume (-mavx2, -march=...), which every
+ *    processor the code runs on must have.  TargetCPUHasFeatures() answers for these
+ *    without looking.
+ */
+#if defined(__SSE2__)
+	#define __TARGET_CPU_HAS_SSE2       kTargetCPUFeatureSSE2
+#else
+	#define __TARGET_CPU_HAS_SSE2       0
+#endif
+#if defined(__SSE4_2__)
+	#define __TARGET_CPU_HAS_SSE42      (kTargetCPUFeatureSSE3 | kTargetCPUFeatureSSSE3 | kTargetCPUFeatureSSE41 | kTargetCPUFeatureSSE42)
+#else
+	#define __TARGET_CPU_HAS_SSE42      0
+#endif
+#if defined(__AVX2__)
+	#define __TARGET_CPU_HAS_AVX2       (kTargetCPUFeatureAVX | kTargetCPUFeatureAVX2)
+#else
+	#define __TARGET_CPU_HAS_AVX2       0
+#endif
+#if defined(__FMA__)
+	#define __TARGET_CPU_HAS_FMA        kTargetCPUFeatureFMA
+#else
+	#define __TARGET_CPU_HAS_FMA        0
+#endif
+#if defined(__BMI2__)
+	#define __TARGET_CPU_HAS_BMI2       kTargetCPUFeatureBMI2
+#else
+	#define __TARGET_CPU_HAS_BMI2       0
+#endif
+#if defined(__AVX512F__)
+	#define __TARGET_CPU_HAS_AVX512F    kTargetCPUFeatureAVX512F
+#else
+	#define __TARGET_CPU_HAS_AVX512F    0
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+	#define __TARGET_CPU_HAS_NEON       kTargetCPUFeatureNEON
+#else
+	#define __TARGET_CPU_HAS_NEON       0
+#endif
+#if defined(__ARM_FEATURE_DOTPROD)
+	#define __TARGET_CPU_HAS_DOTPROD    kTargetCPUFeatureDotProd
+#else
+	#define __TARGET_CPU_HAS_DOTPROD    0
+#endif
+#if defined(__ARM_FEATURE_CRC32)
+	#define __TARGET_CPU_HAS_CRC32      kTargetCPUFeatureCRC32
+#else
+	#define __TARGET_CPU_HAS_CRC32      0
+#endif
+
+#define TARGET_CPU_FEATURES_BASELINE \
+	((uint32_t)(__TARGET_CPU_HAS_SSE2 | __TARGET_CPU_HAS_SSE42 | __TARGET_CPU_HAS_AVX2 | __TARGET_CPU_HAS_FMA | \
+				__TARGET_CPU_HAS_BMI2 | __TARGET_CPU_HAS_AVX512F | __TARGET_CPU_HAS_NEON | \
+				__TARGET_CPU_HAS_DOTPROD | __TARGET_CPU_HAS_CRC32))
+
+/*
+ *  TargetCPUFeatures
+ *
+ *  Summary:
+ *    What the running processor has, as GetTargetCPUFeatures() returns it.
+ */
+struct TargetCPUFeatures {
+	uint32_t        features;           /* kTargetCPUFeature... bits */
+	uint32_t        vectorBytes;        /* the widest vectors the features allow: 0, 16, 32 or 64 */
+};
+typedef struct TargetCPUFeatures        TargetCPUFeatures;
+
+/*
+ *  GetTargetCPUFeatures()
+ *
+ *  Summary:
+ *    Returns the features of the running processor.  They are probed when the library
+ *    is loaded, or on the first call if that comes first; the result never changes and
+ *    must not be written.
+ */
+extern const TargetCPUFeatures *
+GetTargetCPUFeatures(void);
+
+/*
+ *  TargetCPUFeaturesProbe()
+ *
+ *  Summary:
+ *    Probes the features again and returns their kTargetCPUFeature... bits, without
+ *    looking at or setting the copy GetTargetCPUFeatures() keeps.
+ *
+ *  Discussion:
+ *    It does not allocate, lock, or depend on the library having been initialized, so
+ *    it can be called from an ifunc resolver, which may run before anything else.
+ */
+extern uint32_t
+TargetCPUFeaturesProbe(void);
+
+/*
+ *  GetTargetCPUFeatureName()
+ *
+ *  Summary:
+ *    Returns the name of one feature bit ("avx2", "dotprod"), or NULL if it is not one.
+ */
+extern const char *
+GetTargetCPUFeatureName(uint32_t feature);
+
+/*
+ *  TargetCPUHasFeatures()
+ *
+ *  Summary:
+ *    Returns 1 if the running processor has every feature of a mask, otherwise 0.
+ */
+static inline int
+TargetCPUHasFeatures(uint32_t features)
+{
+	if ( (features & ~TARGET_CPU_FEATURES_BASELINE) == 0 )
+		return 1;
+	return (GetTargetCPUFeatures()->features & features) == features;
+}
+
+/*
+ *  TARGET_CPU_DISPATCH(result, name, parameters, arguments, choice)
+ *
+ *  Summary:
+ *    Defines the function name to call one of several implementations.
+ *
+ *  Discussion:
+ *    choice is an expression of the uint32_t features, the kTargetCPUFeature... bits of
+ *    the running processor, giving the implementation to use.  For example:
+ *
+ *        static uint32_t ChecksumScalar(const void *data, size_t size);
+ *        __attribute__((target("avx2")))
+ *        static uint32_t ChecksumAVX2(const void *data, size_t size);
+ *
+ *        TARGET_CPU_DISPATCH(uint32_t, Checksum, (const void *data, size_t size), (data, size),
+ *            (features & kTargetCPUFeatureAVX2) ? ChecksumAVX2 : ChecksumScalar)
+ *
+ *    defines uint32_t Checksum(const void *data, size_t size) with external linkage, as
+ *    declared elsewhere.  choice is evaluated once (with glibc, possibly before
+ *    constructors have run, so it must only test features).  result may be void only
+ *    in C++ or GNU C.
+ *
+ *    Define TARGET_CPU_DISPATCH_IFUNC to 0 to use the function pointer with glibc too.
+ */
+#ifndef TARGET_CPU_DISPATCH_IFUNC
+	#if defined(__ELF__) && defined(__GLIBC__) && defined(__has_attribute)
+		#if __has_attribute(ifunc)
+			#define TARGET_CPU_DISPATCH_IFUNC   1
+		#endif
+	#endif
+	#ifndef TARGET_CPU_DISPATCH_IFUNC
+		#define TARGET_CPU_DISPATCH_IFUNC       0
+	#endif
+#endif
+
+#ifdef __cplusplus
+	#define __TARGET_CPU_DISPATCH_C_BEGIN   extern "C" {
+	#define __TARGET_CPU_DISPATCH_C_END     }
+#else
+	#define __TARGET_CPU_DISPATCH_C_BEGIN
+	#define __TARGET_CPU_DISPATCH_C_END
+#endif
+
+#if TARGET_CPU_DISPATCH_IFUNC
+	#define TARGET_CPU_DISPATCH(result, name, parameters, arguments, choice) \
+		typedef result (*name##_Implementation) parameters; \
+		__TARGET_CPU_DISPATCH_C_BEGIN \
+		static name##_Implementation \
+		name##_Resolve(void) \
+		{ \
+			uint32_t features = TargetCPUFeaturesProbe(); \
+			return (choice); \
+		} \
+		__TARGET_CPU_DISPATCH_C_END \
+		result name parameters __attribute__((ifunc(#name "_Resolve")));
+#else
+	#define TARGET_CPU_DISPATCH(result, name, parameters, arguments, choice) \
+		typedef result (*name##_Implementation) parameters; \
+		static result name##_Choose parameters; \
+		static name##_Implementation name##_Chosen = name##_Choose; \
+		static result \
+		name##_Choose parameters \
+		{ \
+			uint32_t                features = GetTargetCPUFeatures()->features; \
+			name##_Implementation   implementation = (choice); \
+			__atomic_store_n(&name##_Chosen, implementation, __ATOMIC_RELAXED); \
+			return implementation arguments; \
+		} \
+		result \
+		name parameters \
+		{ \
+			return __atomic_load_n(&name##_Chosen, __ATOMIC_RELAXED) arguments; \
+		}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TARGETCPUFEATURES__ */
@@ -0,0 +1,202 @@
+/*
+     File:       AssertMacrosAssumeBench.c
+
+     Contains:   Codegen benchmark for DEBUG_ASSERT_ASSUME.
+
+                 Each kernel is a small hot loop whose __Check assertions state a fact
+                 the loop cannot prove on its own: an aligned, padded array, a non-negative
+                 dividend, a value already in range, or an index already in bounds.  In a
+                 plain production build those checks vanish along with the facts; with
+                 DEBUG_ASSERT_ASSUME=1 they become assumptions, which can drop sign fixups,
+                 clamps, bounds tests and remainder loops.  Build this file with
+                 DEBUG_ASSERT_PRODUCTION_CODE=1 and DEBUG_ASSERT_ASSUME set to 0 and then 1
+                 and compare the timings and the kernel sizes (AssertMacrosSize.sh); see the
+                 bench_assert_macros_assume target in the Makefile.
+
+*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "AssertMacros.h"
+
+#ifndef ASSERT_MACROS_BENCH_COUNT
+	#define ASSERT_MACROS_BENCH_COUNT       4096
+#endif
+
+#ifndef ASSERT_MACROS_BENCH_REPEAT
+	#define ASSERT_MACROS_BENCH_REPEAT      400
+#endif
+
+#ifndef ASSERT_MACROS_BENCH_TRIALS
+	#define ASSERT_MACROS_BENCH_TRIALS      5
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__)
+	#define ASSERT_MACROS_BENCH_NOINLINE    __attribute__((noinline, noipa))
+#else
+	#define ASSERT_MACROS_BENCH_NOINLINE    __attribute__((noinline))
+#endif
+
+/* Every value is in [0, 256), and the array is 32-byte aligned with a multiple of 8 entries. */
+static long gAssertMacrosAssumeTable[256];
+
+long AssertMacrosAssumeBench_Baseline(const long *values, size_t count);
+long AssertMacrosAssumeBench_AlignedSum(const long *values, size_t count);
+long AssertMacrosAssumeBench_NonNegativeDivide(const long *values, size_t count);
+long AssertMacrosAssumeBench_Clamp(const long *values, size_t count);
+long AssertMacrosAssumeBench_BoundedLookup(const long *values, size_t count);
+
+ASSERT_MACROS_BENCH_NOINLINE long
+AssertMacrosAssumeBench_Baseline(const long *values, size_t count)
+{
+	long    sum = 0;
+	size_t  i;
+
+	for ( i = 0; i < count; ++i )
+		sum += values[i];
+	return sum;
+}
+
+/* Alignment and padding: the vectorized loop needs no peeling and no scalar tail. */
+ASSERT_MACROS_BENCH_NOINLINE long
+AssertMacrosAssumeBench_AlignedSum(const long *values, size_t count)
+{
+	long    sum = 0;
+	size_t  i;
+
+	__Check(((uintptr_t)values & 31) == 0);
+	__Check((count & 7) == 0);
+	for ( i = 0; i < count; ++i )
+		sum += values[i];
+	return sum;
+}
+
+/* A non-negative dividend: signed division by 4 becomes a plain shift. */
+ASSERT_MACROS_BENCH_NOINLINE long
+AssertMacrosAssumeBench_NonNegativeDivide(const long *values, size_t count)
+{
+	long    sum = 0;
+	size_t  i;
+
+	for ( i = 0; i < count; ++i )
+	{
+		long v = values[i];
+
+		__Check(v >= 0);
+		sum += v / 4;
+	}
+	return sum;
+}
+
+/* A value already in range: the clamp folds away. */
+ASSERT_MACROS_BENCH_NOINLINE long
+AssertMacrosAssumeBench_Clamp(const long *values, size_t count)
+{
+	long    sum = 0;
+	size_t  i;
+
+	for ( i = 0; i < count; ++i )
+	{
+		long v = values[i];
+
+		__Check(v >= 0 && v <= 255);
+		sum += (v < 0) ? 0 : (v > 255) ? 255 : v;
+	}
+	return sum;
+}
+
+/* An index already in bounds: the defensive bounds test and its early exit go away. */
+ASSERT_MACROS_BENCH_NOINLINE long
+AssertMacrosAssumeBench_BoundedLookup(const long *values, size_t count)
+{
+	long    sum = 0;
+	size_t  i;
+
+	__Check(values != NULL);
+	if ( values == NULL )
+		return 0;
+	for ( i = 0; i < count; ++i )
+	{
+		unsigned long index = (unsigned long)values[i];
+
+		__Check(index < 256);
+		if ( index >= 256 )
+			return -1;
+		sum += gAssertMacrosAssumeTable[index];
+	}
+	return sum;
+}
+
+typedef long (*AssertMacrosAssumeBenchKernel)(const long *values, size_t count);
+
+struct AssertMacrosAssumeBenchEntry {
+	const char *                    name;
+	AssertMacrosAssumeBenchKernel   kernel;
+};
+
+static const struct AssertMacrosAssumeBenchEntry gAssertMacrosAssumeBenchEntries[] = {
+	{ "Baseline",           AssertMacrosAssumeBench_Baseline },
+	{ "AlignedSum",         AssertMacrosAssumeBench_AlignedSum },
+	{ "NonNegativeDivide",  AssertMacrosAssumeBench_NonNegativeDivide },
+	{ "Clamp",              AssertMacrosAssumeBench_Clamp },
+	{ "BoundedLookup",      AssertMacrosAssumeBench_BoundedLookup },
+};
+
+static double
+AssertMacrosAssumeBenchNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+int
+main(void)
+{
+	static long     values[ASSERT_MACROS_BENCH_COUNT] __attribute__((aligned(32)));
+	volatile long   seed = 12345;
+	volatile long   sink = 0;
+	double          ops = (double)ASSERT_MACROS_BENCH_COUNT * ASSERT_MACROS_BENCH_REPEAT;
+	unsigned long   state = (unsigned long)seed;
+	size_t          e;
+	size_t          i;
+
+	for ( i = 0; i < 256; ++i )
+		gAssertMacrosAssumeTable[i] = (long)(i * 7 + 1);
+	for ( i = 0; i < ASSERT_MACROS_BENCH_COUNT; ++i )
+	{
+		state = state * 6364136223846793005UL + 1442695040888963407UL;
+		values[i] = (long)(state >> 56);
+	}
+
+	printf("# DEBUG_ASSERT_PRODUCTION_CODE=%d, DEBUG_ASSERT_ASSUME=%d, %d ops per kernel\n",
+		   (int)(DEBUG_ASSERT_PRODUCTION_CODE), (int)(DEBUG_ASSERT_ASSUME), (int)ops);
+	printf("%-32s %10s\n", "kernel", "ns/op");
+
+	for ( e = 0; e < sizeof(gAssertMacrosAssumeBenchEntries) / sizeof(gAssertMacrosAssumeBenchEntries[0]); ++e )
+	{
+		const struct AssertMacrosAssumeBenchEntry *entry = &gAssertMacrosAssumeBenchEntries[e];
+		double  best = 0;
+		int     t;
+		int     r;
+
+		sink += entry->kernel(values, ASSERT_MACROS_BENCH_COUNT);
+
+		for ( t = 0; t < ASSERT_MACROS_BENCH_TRIALS; ++t )
+		{
+			double start = AssertMacrosAssumeBenchNow();
+			double elapsed;
+
+			for ( r = 0; r < ASSERT_MACROS_BENCH_REPEAT; ++r )
+				sink += entry->kernel(values, ASSERT_MACROS_BENCH_COUNT);
+			elapsed = AssertMacrosAssumeBenchNow() - start;
+			if ( t == 0 || elapsed < best )
+				best = elapsed;
+		}
+		printf("%-32s %10.3f\n", entry->name, best / ops);
+	}
+	return sink == -1;
+}
@@ -0,0 +1,355 @@
+/*
+     File:       AssertMacrosBench.c
+
+     Contains:   Success-path overhead benchmark for the AssertMacros.h macro families.
+
+                 Every macro family is expanded inside its own loop kernel which is
+                 fed an array of zero values, so each check passes.  The kernel is
+                 timed and, where the platform exposes hardware counters, the branch
+                 misses per operation are reported as well.  Build this file once with
+                 DEBUG_ASSERT_PRODUCTION_CODE=1 and once with DEBUG_ASSERT_PRODUCTION_CODE=0
+                 to compare production and debug expansions; see the bench_assert_macros
+                 target in the Makefile and AssertMacrosSize.sh for per-macro text size.
+
+                 The Step_ kernels call a step function inlined into the loop, which
+                 propagates a status to its caller: with __Require_noErr and a goto, and,
+                 when this file is compiled as C++17, with the return-based macros of
+                 AssertMacrosResult.h.  They compare error propagation in the two styles,
+                 against Step_Baseline, which propagates nothing.
+
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#include "AssertMacros.h"
+
+#if defined(__cplusplus) && (__cplusplus >= 201703L)
+	#include "AssertMacrosResult.h"
+	#define ASSERT_MACROS_BENCH_RESULT      1
+#else
+	#define ASSERT_MACROS_BENCH_RESULT      0
+#endif
+
+/* C linkage keeps the kernel symbols unmangled for AssertMacrosSize.sh. */
+#ifdef __cplusplus
+	#define ASSERT_MACROS_BENCH_LANGUAGE    "C++"
+	#define ASSERT_MACROS_BENCH_LINKAGE     extern "C"
+#else
+	#define ASSERT_MACROS_BENCH_LANGUAGE    "C"
+	#define ASSERT_MACROS_BENCH_LINKAGE
+#endif
+
+#ifndef ASSERT_MACROS_BENCH_COUNT
+	#define ASSERT_MACROS_BENCH_COUNT       4096
+#endif
+
+#ifndef ASSERT_MACROS_BENCH_REPEAT
+	#define ASSERT_MACROS_BENCH_REPEAT      400
+#endif
+
+#ifndef ASSERT_MACROS_BENCH_TRIALS
+	#define ASSERT_MACROS_BENCH_TRIALS      5
+#endif
+
+/*
+ *  gcc folds identical functions (production __Check and Baseline, for instance)
+ *  into one body plus a thunk, which would hide the real size of each kernel.
+ */
+#if defined(__GNUC__) && !defined(__clang__)
+	#define ASSERT_MACROS_BENCH_NOINLINE    __attribute__((noinline, noipa))
+#else
+	#define ASSERT_MACROS_BENCH_NOINLINE    __attribute__((noinline))
+#endif
+
+/*
+ *  Each entry is (name, statement).  The statement may refer to the current value
+ *  as "v", to the running sum as "sum" (for actions), and to the label "bail".
+ */
+#define ASSERT_MACROS_BENCH_LIST(X)                                                                    \
+	X(Baseline,                      (void)0)                                                          \
+	X(Check,                         __Check(v == 0))                                                  \
+	X(nCheck,                        __nCheck(v != 0))                                                 \
+	X(Check_String,                  __Check_String(v == 0, "check"))                                  \
+	X(nCheck_String,                 __nCheck_String(v != 0, "check"))                                 \
+	X(Check_noErr,                   __Check_noErr(v))                                                 \
+	X(Check_noErr_String,            __Check_noErr_String(v, "check"))                                 \
+	X(Verify,                        __Verify(v == 0))                                                 \
+	X(nVerify,                       __nVerify(v != 0))                                                \
+	X(Verify_String,                 __Verify_String(v == 0, "verify"))                                \
+	X(nVerify_String,                __nVerify_String(v != 0, "verify"))                               \
+	X(Verify_noErr,                  __Verify_noErr(v))                                                \
+	X(Verify_noErr_String,           __Verify_noErr_String(v, "verify"))                               \
+	X(Verify_noErr_Action,           __Verify_noErr_Action(v, sum += v * 3))                           \
+	X(Verify_Action,                 __Verify_Action(v == 0, sum += v * 3))                            \
+	X(Require,                       __Require(v == 0, bail))                                          \
+	X(nRequire,                      __nRequire(v != 0, bail))                                         \
+	X(Require_Action,                __Require_Action(v == 0, bail, sum += v * 3))                     \
+	X(nRequire_Action,               __nRequire_Action(v != 0, bail, sum += v * 3))                    \
+	X(Require_Quiet,                 __Require_Quiet(v == 0, bail))                                    \
+	X(nRequire_Quiet,                __nRequire_Quiet(v != 0, bail))                                   \
+	X(Require_Action_Quiet,          __Require_Action_Quiet(v == 0, bail, sum += v * 3))               \
+	X(nRequire_Action_Quiet,         __nRequire_Action_Quiet(v != 0, bail, sum += v * 3))              \
+	X(Require_String,                __Require_String(v == 0, bail, "require"))                        \
+	X(nRequire_String,               __nRequire_String(v != 0, bail, "require"))                       \
+	X(Require_Action_String,         __Require_Action_String(v == 0, bail, sum += v * 3, "require"))   \
+	X(nRequire_Action_String,        __nRequire_Action_String(v != 0, bail, sum += v * 3, "require"))  \
+	X(Require_noErr,                 __Require_noErr(v, bail))                                         \
+	X(Require_noErr_Action,          __Require_noErr_Action(v, bail, sum += v * 3))                    \
+	X(Require_noErr_Quiet,           __Require_noErr_Quiet(v, bail))                                   \
+	X(Require_noErr_Action_Quiet,    __Require_noErr_Action_Quiet(v, bail, sum += v * 3))              \
+	X(Require_noErr_String,          __Require_noErr_String(v, bail, "require"))                       \
+	X(Require_noErr_Action_String,   __Require_noErr_Action_String(v, bail, sum += v * 3, "require"))
+
+/*
+ *  The kernels have external linkage so that the compiler does not clone them,
+ *  which keeps their symbols intact for AssertMacrosSize.sh.
+ */
+#define ASSERT_MACROS_BENCH_KERNEL(name, statement)                                          \
+	ASSERT_MACROS_BENCH_LINKAGE long                                                        \
+	AssertMacrosBench_##name(const long *values, size_t count);                             \
+	ASSERT_MACROS_BENCH_NOINLINE long                                                       \
+	AssertMacrosBench_##name(const long *values, size_t count)                              \
+	{                                                                                       \
+		long    sum = 0;                                                                    \
+		size_t  i;                                                                          \
+		                                                                                    \
+		for ( i = 0; i < count; ++i )                                                       \
+		{                                                                                   \
+			long v = values[i];                                                             \
+			                                                                                \
+			statement;                                                                      \
+			sum += v + 1;                                                                   \
+			continue;                                                                       \
+		bail: __attribute__((unused));                                                      \
+			sum -= 7;                                                                       \
+		}                                                                                   \
+		return sum;                                                                         \
+	}
+
+ASSERT_MACROS_BENCH_LIST(ASSERT_MACROS_BENCH_KERNEL)
+
+/*
+ *  Each step entry is (name, return type, body).  The body may refer to the value as
+ *  "v" and store the step's result through "value"; it returns its status, 0 for
+ *  success, in the return type.  AssertMacrosBenchStatus() reads that status back,
+ *  and the result of a Result<long>.
+ */
+#if ASSERT_MACROS_BENCH_RESULT
+	#define ASSERT_MACROS_BENCH_RESULT_STEP_LIST(X)                                                    \
+		X(Step_Require_noErr_Return,     AssertMacros::Result<void>,                                   \
+			{ __Require_noErr_Return((OSStatus)v); *value = v; return {}; })                           \
+		X(Step_Require_noErr_OSStatus,   OSStatus,                                                     \
+			{ __Require_noErr_Return((OSStatus)v); *value = v; return noErr; })                        \
+		X(Step_Require_OK,               AssertMacros::Result<long>,                                   \
+			{ (void)value; return __Require_OK(AssertMacrosBenchMakeResult(v)); })
+
+static inline AssertMacros::Result<long>
+AssertMacrosBenchMakeResult(long v)
+{
+	return (OSStatus)v == noErr ? AssertMacros::Result<long>(v) : AssertMacros::Result<long>(AssertMacros::Failure((OSStatus)v));
+}
+
+template <typename Status>
+static inline long
+AssertMacrosBenchStatus(Status status, long *value)
+{
+	(void)value;
+	return (long)status;
+}
+
+static inline long
+AssertMacrosBenchStatus(const AssertMacros::Result<void> &result, long *value)
+{
+	(void)value;
+	return result.status();
+}
+
+static inline long
+AssertMacrosBenchStatus(const AssertMacros::Result<long> &result, long *value)
+{
+	if ( result.ok() )
+		*value = *result;
+	return result.status();
+}
+#else
+	#define ASSERT_MACROS_BENCH_RESULT_STEP_LIST(X)
+	#define AssertMacrosBenchStatus(status, value)  ((long)(status))
+#endif
+
+#define ASSERT_MACROS_BENCH_STEP_LIST(X)                                                               \
+	X(Step_Baseline,                 long,                                                             \
+		{ *value = v; return 0; })                                                                     \
+	X(Step_Require_noErr,            long,                                                             \
+		{ int err = (int)v; __Require_noErr(err, bail); *value = v; return 0; bail: return err; })     \
+	ASSERT_MACROS_BENCH_RESULT_STEP_LIST(X)
+
+#define ASSERT_MACROS_BENCH_STEP_KERNEL(name, type, body)                                    \
+	static inline __attribute__((always_inline)) type                                       \
+	AssertMacrosBenchStep_##name(long v, long *value)                                       \
+	body                                                                                    \
+	                                                                                        \
+	ASSERT_MACROS_BENCH_LINKAGE long                                                        \
+	AssertMacrosBench_##name(const long *values, size_t count);                             \
+	ASSERT_MACROS_BENCH_NOINLINE long                                                       \
+	AssertMacrosBench_##name(const long *values, size_t count)                              \
+	{                                                                                       \
+		long    sum = 0;                                                                    \
+		size_t  i;                                                                          \
+		                                                                                    \
+		for ( i = 0; i < count; ++i )                                                       \
+		{                                                                                   \
+			long value = 0;                                                                 \
+			long status = AssertMacrosBenchStatus(                                          \
+				AssertMacrosBenchStep_##name(values[i], &value), &value);                   \
+			                                                                                \
+			sum += status == 0 ? value + 1 : -7;                                            \
+		}                                                                                   \
+		return sum;                                                                         \
+	}
+
+ASSERT_MACROS_BENCH_STEP_LIST(ASSERT_MACROS_BENCH_STEP_KERNEL)
+
+typedef long (*AssertMacrosBenchKernel)(const long *values, size_t count);
+
+struct AssertMacrosBenchEntry {
+	const char *                name;
+	AssertMacrosBenchKernel     kernel;
+};
+
+#define ASSERT_MACROS_BENCH_ENTRY(name, statement)  { #name, AssertMacrosBench_##name },
+#define ASSERT_MACROS_BENCH_STEP_ENTRY(name, type, body)  { #name, AssertMacrosBench_##name },
+
+static const struct AssertMacrosBenchEntry gAssertMacrosBenchEntries[] = {
+	ASSERT_MACROS_BENCH_LIST(ASSERT_MACROS_BENCH_ENTRY)
+	ASSERT_MACROS_BENCH_STEP_LIST(ASSERT_MACROS_BENCH_STEP_ENTRY)
+};
+
+static double
+AssertMacrosBenchNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/*
+ *  Branch miss counting.  Only Linux perf_event_open is supported; everywhere else,
+ *  or when the kernel refuses access (perf_event_paranoid), the column reads "n/a".
+ */
+#ifdef __linux__
+static int
+AssertMacrosBenchOpenBranchMisses(void)
+{
+	struct perf_event_attr attr;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+	attr.disabled = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+static void
+AssertMacrosBenchStartCounter(int fd)
+{
+	if ( fd >= 0 )
+	{
+		ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+		ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+	}
+}
+
+static long long
+AssertMacrosBenchStopCounter(int fd)
+{
+	long long count = -1;
+
+	if ( fd >= 0 )
+	{
+		ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+		if ( read(fd, &count, sizeof(count)) != sizeof(count) )
+			count = -1;
+	}
+	return count;
+}
+#else
+static int       AssertMacrosBenchOpenBranchMisses(void)      { return -1; }
+static void      AssertMacrosBenchStartCounter(int fd)        { (void)fd; }
+static long long AssertMacrosBenchStopCounter(int fd)         { (void)fd; return -1; }
+#endif
+
+int
+main(void)
+{
+	static long     values[ASSERT_MACROS_BENCH_COUNT];
+	volatile long   zero = 0;
+	volatile long   sink = 0;
+	double          ops = (double)ASSERT_MACROS_BENCH_COUNT * ASSERT_MACROS_BENCH_REPEAT;
+	int             counter;
+	size_t          e;
+	size_t          i;
+
+	for ( i = 0; i < ASSERT_MACROS_BENCH_COUNT; ++i )
+		values[i] = zero;
+
+	counter = AssertMacrosBenchOpenBranchMisses();
+
+	printf("# DEBUG_ASSERT_PRODUCTION_CODE=%d, %s, %d ops per macro\n",
+		   (int)(DEBUG_ASSERT_PRODUCTION_CODE), ASSERT_MACROS_BENCH_LANGUAGE, (int)ops);
+	printf("%-32s %10s %18s\n", "macro", "ns/op", "branch-misses/op");
+
+	for ( e = 0; e < sizeof(gAssertMacrosBenchEntries) / sizeof(gAssertMacrosBenchEntries[0]); ++e )
+	{
+		const struct AssertMacrosBenchEntry *entry = &gAssertMacrosBenchEntries[e];
+		double      best = 0;
+		long long   misses = -1;
+		int         t;
+		int         r;
+
+		/* Warm the caches and the branch predictor. */
+		sink += entry->kernel(values, ASSERT_MACROS_BENCH_COUNT);
+
+		/* Report the fastest trial, and the branch misses observed during it. */
+		for ( t = 0; t < ASSERT_MACROS_BENCH_TRIALS; ++t )
+		{
+			double      start;
+			double      elapsed;
+			long long   trialMisses;
+
+			AssertMacrosBenchStartCounter(counter);
+			start = AssertMacrosBenchNow();
+			for ( r = 0; r < ASSERT_MACROS_BENCH_REPEAT; ++r )
+				sink += entry->kernel(values, ASSERT_MACROS_BENCH_COUNT);
+			elapsed = AssertMacrosBenchNow() - start;
+			trialMisses = AssertMacrosBenchStopCounter(counter);
+
+			if ( t == 0 || elapsed < best )
+			{
+				best = elapsed;
+				misses = trialMisses;
+			}
+		}
+
+		if ( misses >= 0 )
+			printf("%-32s %10.3f %18.6f\n", entry->name, best / ops, (double)misses / ops);
+		else
+			printf("%-32s %10.3f %18s\n", entry->name, best / ops, "n/a");
+	}
+
+	if ( counter >= 0 )
+		close(counter);
+	return sink == -1;
+}
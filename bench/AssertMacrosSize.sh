@@ -0,0 +1,36 @@
+#!/bin/sh
+#
+# AssertMacrosSize.sh -- per-macro text size of the AssertMacrosBench.c kernels.
+#
+# Usage: AssertMacrosSize.sh <object file> [symbol prefix]
+#
+# Prints the size in bytes of every AssertMacrosBench_<macro> kernel and its growth
+# over the Baseline kernel, which contains the same loop without any macro.  The
+# object must come from AssertMacrosBench.c, or from another benchmark whose kernels
+# share a prefix (AssertMacrosAssumeBench, for instance) and include a Baseline.
+# NM may be set to a GNU or LLVM nm that understands --print-size.
+#
+
+NM=${NM:-nm}
+
+if [ $# -lt 1 ] || [ $# -gt 2 ]; then
+	echo "usage: $0 <AssertMacrosBench object> [symbol prefix]" >&2
+	exit 1
+fi
+
+$NM --print-size --radix=d "$1" | awk -v prefix="^_?${2:-AssertMacrosBench}_" '
+	$4 ~ prefix {
+		name = $4
+		sub(prefix, "", name)
+		size[name] = $2 + 0
+		order[count++] = name
+	}
+	END {
+		if ( !("Baseline" in size) ) {
+			print "AssertMacrosSize.sh: no Baseline kernel found" > "/dev/stderr"
+			exit 1
+		}
+		printf("%-32s %10s %10s\n", "kernel", "bytes", "growth")
+		for ( i = 0; i < count; i++ )
+			printf("%-32s %10d %+10d\n", order[i], size[order[i]], size[order[i]] - size["Baseline"])
+	}'
@@ -0,0 +1,41 @@
+/*
+     File:       CarbonHeadersImportCheck.cpp
+
+     Contains:   Build check for the C++20 header units built by "make header_units".
+
+                 Imports MacTypes.h as a header unit and checks the macro caveats
+                 described in CarbonHeaders.modulemap: the macros a unit defines, such
+                 as TARGET_OS_MAC (or TARGET_OS_OSX) and FOUR_CHAR_CODE, are exported to the importing
+                 file, and AssertMacros.h, which is left out of the units and included,
+                 still takes the DEBUG_ASSERT_MESSAGE this file defines before it.  The
+                 check fails to compile, or exits non-zero, if either stops being true.
+                 See the check_header_units target in the Makefile.
+
+*/
+import <MacTypes.h>;
+
+/* TargetConditionals.h defines TARGET_OS_OSX everywhere, and TARGET_OS_MAC on Apple targets. */
+#if !defined(TARGET_OS_OSX) || (defined(__APPLE__) && !defined(TARGET_OS_MAC))
+	#error "the MacTypes.h header unit does not export TARGET_OS_OSX or TARGET_OS_MAC"
+#endif
+
+#if !defined(FOUR_CHAR_CODE)
+	#error "the MacTypes.h header unit does not export FOUR_CHAR_CODE"
+#endif
+
+static int gMessages;
+
+#define DEBUG_ASSERT_PRODUCTION_CODE    0
+#define DEBUG_ASSERT_MESSAGE(componentNameString, assertionString, exceptionLabelString, \
+							 errorString, fileName, lineNumber, errorCode)  (++gMessages)
+#include <AssertMacros.h>
+
+int
+main()
+{
+	OSType type = FOUR_CHAR_CODE(0x54455854);
+
+	__Check(type == 0);
+	__Check_noErr((OSStatus)-50);
+	return gMessages == 2 ? 0 : 1;
+}
@@ -0,0 +1,47 @@
+/*
+     File:       CarbonHeadersPrecompiledCheck.c
+
+     Contains:   Build check for the precompiled CarbonHeaders.h built by "make
+                 precompiled".
+
+                 Compiled as C and as C++, once plainly, when the check_precompiled
+                 target also requires that GCC loaded CarbonHeaders.h.gch, and once with
+                 CARBON_HEADERS_CHECK_MESSAGE defined.  That defines DEBUG_ASSERT_MESSAGE
+                 before CarbonHeaders.h is included, which, as CarbonHeaders.h describes,
+                 must still take effect even though the precompiled header cannot then
+                 be used.  Either way the target macros must be defined.  The check fails
+                 to compile, or exits non-zero, if any of this stops being true.
+
+*/
+#ifdef CARBON_HEADERS_CHECK_MESSAGE
+	static int gMessages;
+
+	#define DEBUG_ASSERT_PRODUCTION_CODE    0
+	#define DEBUG_ASSERT_MESSAGE(componentNameString, assertionString, exceptionLabelString, \
+								 errorString, fileName, lineNumber, errorCode)  (++gMessages)
+#endif
+
+#include "CarbonHeaders.h"
+
+/* TargetConditionals.h defines TARGET_OS_OSX everywhere, and TARGET_OS_MAC on Apple targets. */
+#if !defined(TARGET_OS_OSX) || (defined(__APPLE__) && !defined(TARGET_OS_MAC))
+	#error "CarbonHeaders.h does not define TARGET_OS_OSX or TARGET_OS_MAC"
+#endif
+
+#if !defined(FOUR_CHAR_CODE)
+	#error "CarbonHeaders.h does not define FOUR_CHAR_CODE"
+#endif
+
+int
+main(void)
+{
+	OSType type = FOUR_CHAR_CODE(0x54455854);
+
+#ifdef CARBON_HEADERS_CHECK_MESSAGE
+	__Check(type == 0);
+	__Check_noErr(paramErr);
+	return gMessages == 2 ? 0 : 1;
+#else
+	return type == 0x54455854 ? 0 : 1;
+#endif
+}
@@ -0,0 +1,101 @@
+#!/bin/sh
+#
+# IncludeCostBench.sh -- what each Carbon header costs to include, as JSON.
+#
+# Usage: IncludeCostBench.sh <include directory> [iterations]
+#
+# For every compiler in COMPILERS ("gcc clang" by default; those not installed are
+# skipped) and every header below, alone and together (CarbonHeaders.h), compiles a C
+# file that includes only that header iterations times (10 by default) in each of three
+# modes: preprocessing only (-E), parsing (-fsyntax-only) and compiling (-O2 -c).  A
+# file that includes nothing is timed the same way, so its time can be subtracted.
+#
+# Writes one JSON object to stdout.  Each result gives the compiler, header and mode,
+# the mean milliseconds per compile, the bytes the preprocessor produces, the number
+# of macros the header leaves defined (beyond those the compiler predefines) and the
+# number of enumerators in the preprocessed text.  CFLAGS is passed to every compile;
+# outside the SDK it needs whatever -I and -D options the headers need.
+#
+
+COMPILERS=${COMPILERS:-gcc clang}
+ITERATIONS=${2:-10}
+HEADERS="TargetConditionals.h ConditionalMacros.h MacTypes.h Endian.h MacErrors.h AssertMacros.h CarbonHeaders.h"
+
+if [ $# -lt 1 ] || [ $# -gt 2 ]; then
+	echo "usage: $0 <include directory> [iterations]" >&2
+	exit 1
+fi
+DIR=$1
+
+WORK=$(mktemp -d "${TMPDIR:-/tmp}/IncludeCostBench.XXXXXX") || exit 1
+trap 'rm -rf "$WORK"' EXIT
+
+now() {
+	perl -MTime::HiRes=time -e 'printf("%.6f\n", time())'
+}
+
+# Prints the mean milliseconds of iterations compiles: <compiler> <source> <options...>
+elapsed() {
+	compiler=$1
+	source=$2
+	shift 2
+	start=$(now)
+	i=0
+	while [ $i -lt "$ITERATIONS" ]; do
+		$compiler $CFLAGS -I"$DIR" "$@" "$source" -o "$WORK/out" || return 1
+		i=$((i + 1))
+	done
+	echo "$start $(now) $ITERATIONS" | awk '{ printf("%.3f\n", ($2 - $1) * 1000 / $3) }'
+}
+
+# Counts the enumerators in preprocessed text: the names that open a line inside enum
+# braces, followed by "=", "," or nothing.
+enumerators() {
+	awk '
+		/^[ \t]*(typedef[ \t]+)?enum([ \t]+[A-Za-z_][A-Za-z0-9_]*)?[ \t]*(:[^{]*)?\{?[ \t]*$/ { pending = 1 }
+		pending && /\{/ { inside = 1; pending = 0; next }
+		inside && /\}/ { inside = 0 }
+		inside && /^[ \t]*[A-Za-z_][A-Za-z0-9_]*[ \t]*(=|,|$)/ { count++ }
+		END { print count + 0 }' "$1"
+}
+
+: > "$WORK/none.c"
+for header in $HEADERS; do
+	echo "#include <$header>" > "$WORK/${header%.h}.c"
+done
+
+first=1
+echo "{"
+echo "  \"iterations\": $ITERATIONS,"
+echo "  \"cflags\": \"$(echo "$CFLAGS" | sed 's/["\\]/\\&/g')\","
+echo "  \"results\": ["
+for compiler in $COMPILERS; do
+	if ! command -v "$compiler" > /dev/null 2>&1; then
+		echo "$0: $compiler not found; skipped" >&2
+		continue
+	fi
+	$compiler $CFLAGS -E -dM "$WORK/none.c" | LC_ALL=C sort > "$WORK/predefined" || exit 1
+	for header in none $HEADERS; do
+		source="$WORK/${header%.h}.c"
+		$compiler $CFLAGS -I"$DIR" -E -P "$source" > "$WORK/out.i" 2> /dev/null || exit 1
+		bytes=$(wc -c < "$WORK/out.i" | tr -d ' ')
+		count=$(enumerators "$WORK/out.i")
+		macros=$($compiler $CFLAGS -I"$DIR" -E -dM "$source" | LC_ALL=C sort |
+			LC_ALL=C comm -13 "$WORK/predefined" - | wc -l | tr -d ' ')
+		for mode in E fsyntax-only O2; do
+			case $mode in
+				E)              ms=$(elapsed "$compiler" "$source" -E) ;;
+				fsyntax-only)   ms=$(elapsed "$compiler" "$source" -fsyntax-only -w) ;;
+				O2)             ms=$(elapsed "$compiler" "$source" -O2 -c -w) ;;
+			esac
+			[ -n "$ms" ] || exit 1
+			[ $first -eq 1 ] || echo ","
+			first=0
+			printf '    { "compiler": "%s", "header": "%s", "mode": "%s", "ms": %s, "bytes": %s, "macros": %s, "enumerators": %s }' \
+				"$compiler" "$header" "$mode" "$ms" "$bytes" "$macros" "$count"
+		done
+	done
+done
+echo
+echo "  ]"
+echo "}"
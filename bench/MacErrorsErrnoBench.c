@@ -0,0 +1,244 @@
+/*
+     File:       MacErrorsErrnoBench.c
+
+     Contains:   Conformance check and throughput benchmark for the errno translation
+                 functions of MacErrorsLookup.h.
+
+                 MacErrorsToErrnos() and ErrnosToMacErrors() are checked against
+                 MacErrorToErrno() and ErrnoToMacError(), value for value: over every
+                 code MacErrors.h defines and the values around each, every value from
+                 -65536 to 65535, and random ones, each with several unknownErrno and
+                 unknownStatus values; then for each count from 0 to past two vector
+                 widths and some longer ones, at every alignment of a vector.  Elements
+                 beyond count must be left alone.
+
+                 The number of mismatches is reported, and must be 0; the program fails
+                 otherwise.  Throughput is the fastest of several trials, in nanoseconds
+                 per value.  See the bench_mac_errors_errno target in the Makefile.
+
+*/
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "MacErrorsLookup.h"
+
+#ifndef MACERRORS_ERRNO_BENCH_COUNT
+	#define MACERRORS_ERRNO_BENCH_COUNT     4096
+#endif
+
+#ifndef MACERRORS_ERRNO_BENCH_REPEAT
+	#define MACERRORS_ERRNO_BENCH_REPEAT    400
+#endif
+
+#ifndef MACERRORS_ERRNO_BENCH_TRIALS
+	#define MACERRORS_ERRNO_BENCH_TRIALS    5
+#endif
+
+/* Values checked on either side of each defined code, and random values. */
+#define kMacErrorsErrnoBenchNeighbours      64
+#define kMacErrorsErrnoBenchRandom          (1 << 16)
+
+/* Counts up to this are all checked, at every alignment. */
+#define kMacErrorsErrnoBenchShortCount      40
+#define kMacErrorsErrnoBenchAlignments      8
+#define kMacErrorsErrnoBenchSentinel        0x5A5A5A5A
+
+static const int32_t gMacErrorsErrnoBenchUnknowns[] = { 0, -1, 5, INT32_MIN, INT32_MAX };
+
+static const size_t gMacErrorsErrnoBenchLongCounts[] = { 63, 64, 65, 255, 1000, 4096 };
+
+static int32_t  gStatuses[MACERRORS_ERRNO_BENCH_COUNT];
+static int      gErrnos[MACERRORS_ERRNO_BENCH_COUNT];
+
+static double
+MacErrorsErrnoBenchNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static uint64_t
+MacErrorsErrnoBenchRandom(uint64_t *state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 7;
+	*state ^= *state << 17;
+	return *state;
+}
+
+/*
+ *  The values to check, as int32_t; used both as statuses and as errno values.  Returns
+ *  an array the caller frees, or NULL.
+ */
+static int32_t *
+MacErrorsErrnoBenchValues(uint64_t *state, size_t *count)
+{
+	uint32_t    codes = CountMacErrors();
+	size_t      capacity = (size_t)codes * (2 * kMacErrorsErrnoBenchNeighbours + 1) + 131072 + kMacErrorsErrnoBenchRandom + 4;
+	int32_t *   values = malloc(capacity * sizeof(*values));
+	size_t      n = 0;
+	uint32_t    c;
+	int32_t     v;
+	int         i;
+
+	if ( values == NULL )
+		return NULL;
+	for ( c = 1; c <= codes; ++c )
+		for ( i = -kMacErrorsErrnoBenchNeighbours; i <= kMacErrorsErrnoBenchNeighbours; ++i )
+			values[n++] = (int32_t)((uint32_t)GetIndMacError(c) + (uint32_t)i);
+	for ( v = -65536; v < 65536; ++v )
+		values[n++] = v;
+	for ( i = 0; i < kMacErrorsErrnoBenchRandom; ++i )
+		values[n++] = (int32_t)(uint32_t)MacErrorsErrnoBenchRandom(state);
+	values[n++] = INT32_MIN;
+	values[n++] = INT32_MIN + 1;
+	values[n++] = INT32_MAX;
+	values[n++] = INT32_MAX - 1;
+	*count = n;
+	return values;
+}
+
+/* Translates count values from source + offset both ways and counts the differences. */
+static size_t
+MacErrorsErrnoBenchCheck(const int32_t *source, size_t count, int32_t unknown, int32_t *statuses, int *errnos)
+{
+	size_t  mismatches = 0;
+	size_t  i;
+
+	for ( i = 0; i < count + kMacErrorsErrnoBenchAlignments; ++i )
+	{
+		statuses[i] = kMacErrorsErrnoBenchSentinel;
+		errnos[i] = kMacErrorsErrnoBenchSentinel;
+	}
+	MacErrorsToErrnos(source, errnos, count, (int)unknown);
+	ErrnosToMacErrors((const int *)source, statuses, count, unknown);
+	for ( i = 0; i < count; ++i )
+	{
+		mismatches += errnos[i] != MacErrorToErrno(source[i], (int)unknown);
+		mismatches += statuses[i] != ErrnoToMacError((int)source[i], unknown);
+	}
+	for ( ; i < count + kMacErrorsErrnoBenchAlignments; ++i )
+	{
+		mismatches += errnos[i] != kMacErrorsErrnoBenchSentinel;
+		mismatches += statuses[i] != kMacErrorsErrnoBenchSentinel;
+	}
+	return mismatches;
+}
+
+/*
+ *  The loops a caller would write.  They are not inlined, so that the compiler
+ *  cannot hoist them out of the timing loop.
+ */
+static __attribute__((noinline)) void
+MacErrorsToErrnosLoop(const int32_t *statuses, int *errnos, size_t count, int unknownErrno)
+{
+	size_t i;
+
+	for ( i = 0; i < count; ++i )
+		errnos[i] = MacErrorToErrno(statuses[i], unknownErrno);
+}
+
+static __attribute__((noinline)) void
+ErrnosToMacErrorsLoop(const int *errnos, int32_t *statuses, size_t count, int32_t unknownStatus)
+{
+	size_t i;
+
+	for ( i = 0; i < count; ++i )
+		statuses[i] = ErrnoToMacError(errnos[i], unknownStatus);
+}
+
+#define MACERRORS_ERRNO_BENCH_TIME(best, call) \
+	do { \
+		int t; \
+		int r; \
+		\
+		call; \
+		for ( t = 0; t < MACERRORS_ERRNO_BENCH_TRIALS; ++t ) \
+		{ \
+			double start = MacErrorsErrnoBenchNow(); \
+			double elapsed; \
+			\
+			for ( r = 0; r < MACERRORS_ERRNO_BENCH_REPEAT; ++r ) \
+				call; \
+			elapsed = MacErrorsErrnoBenchNow() - start; \
+			if ( t == 0 || elapsed < best ) \
+				best = elapsed; \
+		} \
+		best /= (double)MACERRORS_ERRNO_BENCH_COUNT * MACERRORS_ERRNO_BENCH_REPEAT; \
+	} while ( 0 )
+
+int
+main(void)
+{
+	uint64_t    state = 0x9E3779B97F4A7C15ULL;
+	size_t      valueCount = 0;
+	int32_t *   values = MacErrorsErrnoBenchValues(&state, &valueCount);
+	int32_t *   statuses = malloc((valueCount + kMacErrorsErrnoBenchAlignments) * sizeof(*statuses));
+	int *       errnos = malloc((valueCount + kMacErrorsErrnoBenchAlignments) * sizeof(*errnos));
+	size_t      mismatches = 0;
+	size_t      u;
+	size_t      count;
+	size_t      offset;
+	size_t      i;
+	double      toErrnosLoop = 0;
+	double      toErrnos = 0;
+	double      toStatusesLoop = 0;
+	double      toStatuses = 0;
+
+	if ( values == NULL || statuses == NULL || errnos == NULL )
+	{
+		fprintf(stderr, "MacErrorsErrnoBench: out of memory\n");
+		return 1;
+	}
+
+	for ( u = 0; u < sizeof(gMacErrorsErrnoBenchUnknowns) / sizeof(gMacErrorsErrnoBenchUnknowns[0]); ++u )
+	{
+		int32_t unknown = gMacErrorsErrnoBenchUnknowns[u];
+
+		mismatches += MacErrorsErrnoBenchCheck(values, valueCount, unknown, statuses, errnos);
+		for ( count = 0; count <= kMacErrorsErrnoBenchShortCount; ++count )
+			for ( offset = 0; offset < kMacErrorsErrnoBenchAlignments; ++offset )
+			{
+				size_t start = (size_t)(MacErrorsErrnoBenchRandom(&state) % (valueCount - count + 1));
+
+				mismatches += MacErrorsErrnoBenchCheck(values + start, count, unknown, statuses + offset, errnos + offset);
+			}
+		for ( i = 0; i < sizeof(gMacErrorsErrnoBenchLongCounts) / sizeof(gMacErrorsErrnoBenchLongCounts[0]); ++i )
+			for ( offset = 0; offset < kMacErrorsErrnoBenchAlignments; ++offset )
+			{
+				size_t start;
+
+				count = gMacErrorsErrnoBenchLongCounts[i];
+				start = (size_t)(MacErrorsErrnoBenchRandom(&state) % (valueCount - count + 1));
+				mismatches += MacErrorsErrnoBenchCheck(values + start, count, unknown, statuses + offset, errnos + offset);
+			}
+	}
+
+	/* Timed over defined codes, and over errno values of which most are defined. */
+	for ( i = 0; i < MACERRORS_ERRNO_BENCH_COUNT; ++i )
+	{
+		gStatuses[i] = GetIndMacError(1 + (uint32_t)(MacErrorsErrnoBenchRandom(&state) % CountMacErrors()));
+		gErrnos[i] = (int)(MacErrorsErrnoBenchRandom(&state) % 128);
+	}
+	MACERRORS_ERRNO_BENCH_TIME(toErrnosLoop, MacErrorsToErrnosLoop(gStatuses, gErrnos, MACERRORS_ERRNO_BENCH_COUNT, -1));
+	MACERRORS_ERRNO_BENCH_TIME(toErrnos, MacErrorsToErrnos(gStatuses, gErrnos, MACERRORS_ERRNO_BENCH_COUNT, -1));
+	for ( i = 0; i < MACERRORS_ERRNO_BENCH_COUNT; ++i )
+		gErrnos[i] = (int)(MacErrorsErrnoBenchRandom(&state) % 128);
+	MACERRORS_ERRNO_BENCH_TIME(toStatusesLoop, ErrnosToMacErrorsLoop(gErrnos, gStatuses, MACERRORS_ERRNO_BENCH_COUNT, -1));
+	MACERRORS_ERRNO_BENCH_TIME(toStatuses, ErrnosToMacErrors(gErrnos, gStatuses, MACERRORS_ERRNO_BENCH_COUNT, -1));
+
+	printf("# %zu values, %zu results differing from the scalar functions\n", valueCount, mismatches);
+	printf("%-20s %10s %10s %8s\n", "function", "loop", "array", "speedup");
+	printf("%-20s %10.3f %10.3f %7.2fx\n", "MacErrorsToErrnos", toErrnosLoop, toErrnos, toErrnosLoop / toErrnos);
+	printf("%-20s %10.3f %10.3f %7.2fx\n", "ErrnosToMacErrors", toStatusesLoop, toStatuses, toStatusesLoop / toStatuses);
+	free(values);
+	free(statuses);
+	free(errnos);
+	return mismatches != 0;
+}
@@ -0,0 +1,68 @@
+#!/bin/sh
+#
+# MacErrorsParseBench.sh -- time to parse MacErrors.h against each header it includes.
+#
+# Usage: MacErrorsParseBench.sh <include directory> [iterations]
+#
+# Compiles a file that includes only one header, with -fsyntax-only, iterations times
+# (20 by default) for MacErrors.h and for each MacErrors header it includes, and once
+# for a file that includes nothing.  Prints, for each, the bytes the preprocessor
+# produces, the mean milliseconds per compile, the milliseconds over the empty file
+# (the cost of the header itself), and that cost as a percentage of MacErrors.h's.
+# CC and CFLAGS are passed to the compiler; CFLAGS needs whatever -I and -D options
+# the headers need outside the SDK.
+#
+
+CC=${CC:-cc}
+ITERATIONS=${2:-20}
+
+if [ $# -lt 1 ] || [ $# -gt 2 ]; then
+	echo "usage: $0 <include directory> [iterations]" >&2
+	exit 1
+fi
+if [ ! -f "$1/MacErrors.h" ]; then
+	echo "$0: no MacErrors.h in $1" >&2
+	exit 1
+fi
+
+WORK=$(mktemp -d "${TMPDIR:-/tmp}/MacErrorsParseBench.XXXXXX") || exit 1
+trap 'rm -rf "$WORK"' EXIT
+
+now() {
+	perl -MTime::HiRes=time -e 'printf("%.6f\n", time())'
+}
+
+# Prints the preprocessed size and the mean seconds per compile of one source file.
+measure() {
+	$CC $CFLAGS -I"$1" -E "$2" > "$WORK/out.i" || exit 1
+	bytes=$(wc -c < "$WORK/out.i")
+	start=$(now)
+	i=0
+	while [ $i -lt "$ITERATIONS" ]; do
+		$CC $CFLAGS -I"$1" -fsyntax-only "$2" || exit 1
+		i=$((i + 1))
+	done
+	echo "$bytes $start $(now) $ITERATIONS"
+}
+
+: > "$WORK/none.c"
+echo "none $(measure "$1" "$WORK/none.c")" > "$WORK/results"
+for header in MacErrors.h $(sed -n 's/^#include <\(MacErrors[A-Za-z]*\.h\)>.*/\1/p' "$1/MacErrors.h"); do
+	echo "#include <$header>" > "$WORK/${header%.h}.c"
+	echo "$header $(measure "$1" "$WORK/${header%.h}.c")" >> "$WORK/results"
+done
+
+awk '
+	{
+		name[NR] = $1
+		bytes[NR] = $2
+		ms[NR] = ($4 - $3) * 1000 / $5
+	}
+	END {
+		printf("%-24s %10s %10s %10s %8s\n", "header", "bytes", "ms", "over none", "share")
+		for ( i = 1; i <= NR; i++ ) {
+			cost = ms[i] - ms[1]
+			share = (ms[2] > ms[1]) ? sprintf("%7.1f%%", 100 * cost / (ms[2] - ms[1])) : "-"
+			printf("%-24s %10d %10.2f %10.2f %8s\n", name[i], bytes[i], ms[i], cost, i == 1 ? "" : share)
+		}
+	}' "$WORK/results"
@@ -0,0 +1,196 @@
+/*
+     File:       MacErrorsSubsystemBench.c
+
+     Contains:   Conformance check and latency benchmark for GetMacErrorSubsystem() of
+                 MacErrorsLookup.h.
+
+                 The range table GetMacErrorSubsystem() searches is checked against
+                 MacErrorsSubsystemCheck.h, which lists every code with the subsystem of
+                 its first name and the ranges MacErrors.h reserves, as the comments
+                 there state them.  A defined code belongs to its own subsystem; any
+                 other value to the subsystem of the codes on either side, if both have
+                 the same one, and otherwise to the reserved range it falls in, if any.
+                 This is checked over every code and the values around each, every value
+                 from -65536 to 65535, the values around the POSIX range, and random
+                 ones.
+
+                 The number of mismatches is reported, and must be 0; the program fails
+                 otherwise.  Latency is the fastest of several trials, in nanoseconds
+                 per lookup, over defined codes, random values in the dense OSErr range,
+                 and random 32-bit values.  See the bench_mac_errors_subsystem target in
+                 the Makefile.
+
+*/
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "MacErrorsLookup.h"
+#include "MacErrorsSubsystemCheck.h"
+
+#ifndef MACERRORS_SUBSYSTEM_BENCH_COUNT
+	#define MACERRORS_SUBSYSTEM_BENCH_COUNT     4096
+#endif
+
+#ifndef MACERRORS_SUBSYSTEM_BENCH_REPEAT
+	#define MACERRORS_SUBSYSTEM_BENCH_REPEAT    400
+#endif
+
+#ifndef MACERRORS_SUBSYSTEM_BENCH_TRIALS
+	#define MACERRORS_SUBSYSTEM_BENCH_TRIALS    5
+#endif
+
+/* Values checked on either side of each defined code, and random values. */
+#define kMacErrorsSubsystemBenchNeighbours      64
+#define kMacErrorsSubsystemBenchRandom          (1 << 16)
+
+/* Mismatches printed before the count. */
+#define kMacErrorsSubsystemBenchReported        10
+
+static int32_t  gStatuses[MACERRORS_SUBSYSTEM_BENCH_COUNT];
+static uint32_t gSubsystems[MACERRORS_SUBSYSTEM_BENCH_COUNT];
+
+static double
+MacErrorsSubsystemBenchNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static uint64_t
+MacErrorsSubsystemBenchRandom(uint64_t *state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 7;
+	*state ^= *state << 17;
+	return *state;
+}
+
+/* The subsystem MacErrors.h gives status, or NULL for none. */
+static const char *
+MacErrorsSubsystemBenchExpected(int32_t status)
+{
+	size_t  low = 0;
+	size_t  high = kMacErrorsSubsystemCheckCodeCount;
+	size_t  i;
+
+	/* low becomes the first code not below status. */
+	while ( low < high )
+	{
+		size_t middle = low + (high - low) / 2;
+
+		if ( gMacErrorsSubsystemCheckCodes[middle].code < status )
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	if ( low < kMacErrorsSubsystemCheckCodeCount && gMacErrorsSubsystemCheckCodes[low].code == status )
+		return gMacErrorsSubsystemCheckCodes[low].subsystem;
+	if ( low > 0 && low < kMacErrorsSubsystemCheckCodeCount &&
+			strcmp(gMacErrorsSubsystemCheckCodes[low - 1].subsystem, gMacErrorsSubsystemCheckCodes[low].subsystem) == 0 )
+		return gMacErrorsSubsystemCheckCodes[low].subsystem;
+	for ( i = 0; i < kMacErrorsSubsystemCheckRangeCount; ++i )
+		if ( gMacErrorsSubsystemCheckRanges[i].low <= status && status <= gMacErrorsSubsystemCheckRanges[i].high )
+			return gMacErrorsSubsystemCheckRanges[i].subsystem;
+	return NULL;
+}
+
+/* Looks status up and compares it with MacErrorsSubsystemCheck.h; returns 1 if they differ. */
+static size_t
+MacErrorsSubsystemBenchCheck(int32_t status, size_t mismatches)
+{
+	const char *    expected = MacErrorsSubsystemBenchExpected(status);
+	const char *    found = GetMacErrorSubsystemName(GetMacErrorSubsystem(status));
+
+	if ( expected == found || (expected != NULL && found != NULL && strcmp(expected, found) == 0) )
+		return 0;
+	if ( mismatches < kMacErrorsSubsystemBenchReported )
+		printf("# %d: expected %s, found %s\n", (int)status, expected ? expected : "none", found ? found : "none");
+	return 1;
+}
+
+/*
+ *  The loop a caller would write.  It is not inlined, so that the compiler cannot
+ *  hoist it out of the timing loop.
+ */
+static __attribute__((noinline)) void
+GetMacErrorSubsystemLoop(const int32_t *statuses, uint32_t *subsystems, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i < count; ++i )
+		subsystems[i] = GetMacErrorSubsystem(statuses[i]);
+}
+
+#define MACERRORS_SUBSYSTEM_BENCH_TIME(best, call) \
+	do { \
+		int t; \
+		int r; \
+		\
+		call; \
+		for ( t = 0; t < MACERRORS_SUBSYSTEM_BENCH_TRIALS; ++t ) \
+		{ \
+			double start = MacErrorsSubsystemBenchNow(); \
+			double elapsed; \
+			\
+			for ( r = 0; r < MACERRORS_SUBSYSTEM_BENCH_REPEAT; ++r ) \
+				call; \
+			elapsed = MacErrorsSubsystemBenchNow() - start; \
+			if ( t == 0 || elapsed < best ) \
+				best = elapsed; \
+		} \
+		best /= (double)MACERRORS_SUBSYSTEM_BENCH_COUNT * MACERRORS_SUBSYSTEM_BENCH_REPEAT; \
+	} while ( 0 )
+
+int
+main(void)
+{
+	uint64_t    state = 0x9E3779B97F4A7C15ULL;
+	size_t      values = 0;
+	size_t      mismatches = 0;
+	size_t      i;
+	int32_t     v;
+	int         n;
+	double      codes = 0;
+	double      dense = 0;
+	double      random = 0;
+
+	for ( i = 0; i < kMacErrorsSubsystemCheckCodeCount; ++i )
+		for ( n = -kMacErrorsSubsystemBenchNeighbours; n <= kMacErrorsSubsystemBenchNeighbours; ++n, ++values )
+			mismatches += MacErrorsSubsystemBenchCheck((int32_t)((uint32_t)gMacErrorsSubsystemCheckCodes[i].code + (uint32_t)n), mismatches);
+	for ( v = -65536; v < 65536; ++v, ++values )
+		mismatches += MacErrorsSubsystemBenchCheck(v, mismatches);
+	for ( v = 99000; v <= 102000; ++v, ++values )
+		mismatches += MacErrorsSubsystemBenchCheck(v, mismatches);
+	for ( i = 0; i < kMacErrorsSubsystemBenchRandom; ++i, ++values )
+		mismatches += MacErrorsSubsystemBenchCheck((int32_t)(uint32_t)MacErrorsSubsystemBenchRandom(&state), mismatches);
+	mismatches += MacErrorsSubsystemBenchCheck(INT32_MIN, mismatches);
+	mismatches += MacErrorsSubsystemBenchCheck(INT32_MIN + 1, mismatches);
+	mismatches += MacErrorsSubsystemBenchCheck(INT32_MAX, mismatches);
+	mismatches += MacErrorsSubsystemBenchCheck(INT32_MAX - 1, mismatches);
+	values += 4;
+
+	/* Timed over defined codes, over the OSErr range they crowd, and over any value. */
+	for ( i = 0; i < MACERRORS_SUBSYSTEM_BENCH_COUNT; ++i )
+		gStatuses[i] = GetIndMacError(1 + (uint32_t)(MacErrorsSubsystemBenchRandom(&state) % CountMacErrors()));
+	MACERRORS_SUBSYSTEM_BENCH_TIME(codes, GetMacErrorSubsystemLoop(gStatuses, gSubsystems, MACERRORS_SUBSYSTEM_BENCH_COUNT));
+	for ( i = 0; i < MACERRORS_SUBSYSTEM_BENCH_COUNT; ++i )
+		gStatuses[i] = (int16_t)MacErrorsSubsystemBenchRandom(&state);
+	MACERRORS_SUBSYSTEM_BENCH_TIME(dense, GetMacErrorSubsystemLoop(gStatuses, gSubsystems, MACERRORS_SUBSYSTEM_BENCH_COUNT));
+	for ( i = 0; i < MACERRORS_SUBSYSTEM_BENCH_COUNT; ++i )
+		gStatuses[i] = (int32_t)(uint32_t)MacErrorsSubsystemBenchRandom(&state);
+	MACERRORS_SUBSYSTEM_BENCH_TIME(random, GetMacErrorSubsystemLoop(gStatuses, gSubsystems, MACERRORS_SUBSYSTEM_BENCH_COUNT));
+
+	printf("# %d codes, %u subsystems, %zu values, %zu classified differently from MacErrors.h\n",
+		kMacErrorsSubsystemCheckCodeCount, (unsigned)CountMacErrorSubsystems(), values, mismatches);
+	printf("%-20s %10s\n", "values", "ns/lookup");
+	printf("%-20s %10.3f\n", "defined codes", codes);
+	printf("%-20s %10.3f\n", "random OSErr", dense);
+	printf("%-20s %10.3f\n", "random OSStatus", random);
+	return mismatches != 0;
+}
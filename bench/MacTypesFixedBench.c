@@ -0,0 +1,673 @@
+/*
+     File:       MacTypesFixedBench.c
+
+     Contains:   Conformance check and throughput benchmark for MacTypesFixed.h.
+
+                 Every scalar function is checked against a reference computed with
+                 __int128 and long double, which follows the rounding rules of the header
+                 literally: the exact result, rounded half up, saturated, and NaN giving
+                 0.  The arguments are random, mixed with edge values: the ends of the
+                 ranges, halves of the last place, products and quotients just past
+                 saturation, division by zero, infinities, NaNs and subnormals.
+
+                 Every array function is then checked against its scalar function, bit
+                 for bit, for each count from 0 to past two vector widths and some longer
+                 ones, at every alignment of a vector, with the result in its own array
+                 and in either argument array.  Elements beyond count must be left alone.
+
+                 The numbers of wrong results (scalar against reference) and mismatches
+                 (array against scalar) are reported, and must both be 0; the program
+                 fails otherwise.  Throughput is the fastest of several trials, in
+                 nanoseconds per element.  See the bench_fixed target in the Makefile.
+
+*/
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "MacTypesFixed.h"
+
+#ifndef MACTYPES_FIXED_BENCH_COUNT
+	#define MACTYPES_FIXED_BENCH_COUNT      4096
+#endif
+
+#ifndef MACTYPES_FIXED_BENCH_REPEAT
+	#define MACTYPES_FIXED_BENCH_REPEAT     400
+#endif
+
+#ifndef MACTYPES_FIXED_BENCH_TRIALS
+	#define MACTYPES_FIXED_BENCH_TRIALS     5
+#endif
+
+/* Arguments checked against the reference, per function. */
+#ifndef MACTYPES_FIXED_BENCH_REFERENCE
+	#define MACTYPES_FIXED_BENCH_REFERENCE  (1 << 22)
+#endif
+
+/* Counts up to this are all checked against the scalar functions, at every alignment. */
+#define kMacTypesFixedBenchShortCount       40
+#define kMacTypesFixedBenchAlignments       8
+#define kMacTypesFixedBenchSentinel         0xA5
+
+/*
+ *  Every function is wrapped to take its arguments and result through pointers, so
+ *  that one table can hold them all.  argument() makes one argument of the type the
+ *  function takes from a random number; reference() computes the result the header
+ *  specifies; loop() is the loop a caller would write with the scalar function, and
+ *  array() the array function, or NULL where there is none.
+ */
+struct MacTypesFixedBenchEntry
+{
+	const char      *name;
+	int             isBinary;
+	size_t          argumentSize;
+	size_t          resultSize;
+	void            (*argument)(uint64_t random, void *a);
+	void            (*scalar)(const void *a, const void *b, void *result);
+	void            (*reference)(const void *a, const void *b, void *result);
+	void            (*loop)(const void *a, const void *b, void *result, size_t count);
+	void            (*array)(const void *a, const void *b, void *result, size_t count);
+};
+
+#define MACTYPES_FIXED_BENCH_BINARY(function, type, to) \
+	static void \
+	function##Scalar(const void *a, const void *b, void *result) \
+	{ \
+		*(to *)result = function(*(const type *)a, *(const type *)b); \
+	} \
+	static void \
+	function##Loop(const void *a, const void *b, void *result, size_t count) \
+	{ \
+		size_t i; \
+		\
+		for ( i = 0; i < count; ++i ) \
+			((to *)result)[i] = function(((const type *)a)[i], ((const type *)b)[i]); \
+	}
+
+#define MACTYPES_FIXED_BENCH_UNARY(function, from, to) \
+	static void \
+	function##Scalar(const void *a, const void *b, void *result) \
+	{ \
+		(void)b; \
+		*(to *)result = function(*(const from *)a); \
+	} \
+	static void \
+	function##Loop(const void *a, const void *b, void *result, size_t count) \
+	{ \
+		size_t i; \
+		\
+		(void)b; \
+		for ( i = 0; i < count; ++i ) \
+			((to *)result)[i] = function(((const from *)a)[i]); \
+	}
+
+#define MACTYPES_FIXED_BENCH_BINARY_ARRAY(function, type) \
+	static void \
+	function##ArrayWrapper(const void *a, const void *b, void *result, size_t count) \
+	{ \
+		function##Array((const type *)a, (const type *)b, (type *)result, count); \
+	}
+
+#define MACTYPES_FIXED_BENCH_UNARY_ARRAY(function, from, to) \
+	static void \
+	function##ArrayWrapper(const void *a, const void *b, void *result, size_t count) \
+	{ \
+		(void)b; \
+		function##Array((const from *)a, (to *)result, count); \
+	}
+
+MACTYPES_FIXED_BENCH_BINARY(FixedMultiply, Fixed, Fixed)
+MACTYPES_FIXED_BENCH_BINARY(FractMultiply, Fract, Fract)
+MACTYPES_FIXED_BENCH_BINARY(FixedDivide, Fixed, Fixed)
+MACTYPES_FIXED_BENCH_BINARY(FractDivide, Fract, Fract)
+MACTYPES_FIXED_BENCH_BINARY(FixedRatio, short, Fixed)
+MACTYPES_FIXED_BENCH_BINARY(FixedAdd, Fixed, Fixed)
+MACTYPES_FIXED_BENCH_BINARY(FixedSubtract, Fixed, Fixed)
+MACTYPES_FIXED_BENCH_UNARY(FractFromFixed, Fixed, Fract)
+MACTYPES_FIXED_BENCH_UNARY(FixedFromFract, Fract, Fixed)
+MACTYPES_FIXED_BENCH_UNARY(ShortFixedFromFixed, Fixed, ShortFixed)
+MACTYPES_FIXED_BENCH_UNARY(FixedFromShortFixed, ShortFixed, Fixed)
+MACTYPES_FIXED_BENCH_UNARY(DoubleFromFixed, Fixed, double)
+MACTYPES_FIXED_BENCH_UNARY(FixedFromDouble, double, Fixed)
+MACTYPES_FIXED_BENCH_UNARY(FloatFromFixed, Fixed, float)
+MACTYPES_FIXED_BENCH_UNARY(FixedFromFloat, float, Fixed)
+MACTYPES_FIXED_BENCH_UNARY(DoubleFromFract, Fract, double)
+MACTYPES_FIXED_BENCH_UNARY(FractFromDouble, double, Fract)
+MACTYPES_FIXED_BENCH_UNARY(FloatFromFract, Fract, float)
+MACTYPES_FIXED_BENCH_UNARY(DoubleFromUnsignedFixed, UnsignedFixed, double)
+MACTYPES_FIXED_BENCH_UNARY(UnsignedFixedFromDouble, double, UnsignedFixed)
+
+MACTYPES_FIXED_BENCH_BINARY_ARRAY(FixedMultiply, Fixed)
+MACTYPES_FIXED_BENCH_BINARY_ARRAY(FractMultiply, Fract)
+MACTYPES_FIXED_BENCH_BINARY_ARRAY(FixedDivide, Fixed)
+MACTYPES_FIXED_BENCH_BINARY_ARRAY(FractDivide, Fract)
+MACTYPES_FIXED_BENCH_BINARY_ARRAY(FixedAdd, Fixed)
+MACTYPES_FIXED_BENCH_BINARY_ARRAY(FixedSubtract, Fixed)
+MACTYPES_FIXED_BENCH_UNARY_ARRAY(DoubleFromFixed, Fixed, double)
+MACTYPES_FIXED_BENCH_UNARY_ARRAY(FixedFromDouble, double, Fixed)
+MACTYPES_FIXED_BENCH_UNARY_ARRAY(FloatFromFixed, Fixed, float)
+MACTYPES_FIXED_BENCH_UNARY_ARRAY(FixedFromFloat, float, Fixed)
+MACTYPES_FIXED_BENCH_UNARY_ARRAY(DoubleFromFract, Fract, double)
+MACTYPES_FIXED_BENCH_UNARY_ARRAY(FractFromDouble, double, Fract)
+
+/*
+ *  Arguments.  One in eight is an edge value and one in eight a small one, so that
+ *  the edges meet each other and quotients do not all saturate.
+ */
+static const SInt32 gMacTypesFixedBenchEdges[] = {
+	0, 1, -1, 2, -2, 0x7F, 0x80, 0xFF, 0x100, -0x80, -0x81, 0x1FFF, 0x2000, -0x2000, -0x2001, 0x4000,
+	0x7FFF, 0x8000, -0x8000, 0x8001, 0xFFFF, 0x10000, -0x10000, 0x10001, 0x18000, -0x18000, 0x20000,
+	0xB504F3, 0xB504F4, -0xB504F3, -0xB504F4,                   /* FixedMultiply saturates from here */
+	0x1FFFFF, 0x200000, 0x3FFFFFFF, 0x40000000, -0x40000000, -0x40000001,
+	0x5A82799A, 0x5A82799B, -0x5A82799A, -0x5A82799B,           /* FractMultiply saturates from here */
+	0x7FFF0000, -0x7FFF0000, 0x7FFF8000, 0x7FFFFFFF, INT32_MIN, INT32_MIN + 1,
+};
+
+static const double gMacTypesFixedBenchDoubleEdges[] = {
+	0.0, -0.0, 0x1p-17, -0x1p-17, 0x1.8p-16, -0x1.8p-16, 0x1p-31, -0x1p-31, 0x1.8p-30, -0x1.8p-30,
+	0x1.fffffffffffffp-18, -0x1.fffffffffffffp-18, 0.5, -0.5, 1.0, -1.0,
+	2.0 - 0x1p-30, 2.0 - 0x1p-31, 2.0, -2.0, -2.0 - 0x1p-31, -2.0 - 0x1p-30,
+	32768.0 - 0x1p-16, 32768.0 - 0x1p-17, 32768.0, -32768.0, -32768.0 - 0x1p-17, -32768.0 - 0x1p-16,
+	65536.0 - 0x1p-16, 65536.0 - 0x1p-17, 65536.0, 1e10, -1e10,
+	DBL_MAX, -DBL_MAX, DBL_MIN, -DBL_MIN, DBL_MIN / 4, -DBL_MIN / 4,
+	INFINITY, -INFINITY, NAN, -NAN,
+};
+
+static const float gMacTypesFixedBenchFloatEdges[] = {
+	0.0f, -0.0f, 0x1p-17f, -0x1p-17f, 0x1.8p-16f, -0x1.8p-16f, 0x1.fffffep-18f, -0x1.fffffep-18f,
+	0.5f, -0.5f, 32767.0f, 32768.0f - 0x1p-9f, 32768.0f, -32768.0f, -32768.0f - 0x1p-8f, 65536.0f,
+	1e10f, -1e10f, FLT_MAX, -FLT_MAX, FLT_MIN, -FLT_MIN, FLT_MIN / 4, -FLT_MIN / 4,
+	INFINITY, -INFINITY, NAN, -NAN,
+};
+
+#define MACTYPES_FIXED_BENCH_EDGE(table, random) \
+	(table)[((random) >> 3) % (sizeof(table) / sizeof((table)[0]))]
+
+static void
+IntegerArgument(uint64_t random, void *a)
+{
+	switch ( random & 7 )
+	{
+		case 0:     *(SInt32 *)a = MACTYPES_FIXED_BENCH_EDGE(gMacTypesFixedBenchEdges, random); break;
+		case 1:     *(SInt32 *)a = (SInt32)((random >> 8) % 0x40000) - 0x20000; break;
+		default:    *(SInt32 *)a = (SInt32)(uint32_t)(random >> 16); break;
+	}
+}
+
+static void
+ShortArgument(uint64_t random, void *a)
+{
+	switch ( random & 7 )
+	{
+		case 0:     *(short *)a = (short)((random >> 3) % 5) - 2; break;
+		case 1:     *(short *)a = (random >> 3) & 1 ? INT16_MAX : INT16_MIN; break;
+		default:    *(short *)a = (short)(uint16_t)(random >> 16); break;
+	}
+}
+
+static void
+DoubleArgument(uint64_t random, void *a)
+{
+	switch ( random & 7 )
+	{
+		case 0:     *(double *)a = MACTYPES_FIXED_BENCH_EDGE(gMacTypesFixedBenchDoubleEdges, random); break;
+		case 1:     memcpy(a, &random, sizeof(double)); break;     /* any double, NaNs too */
+		case 2:     *(double *)a = ldexp((double)(int32_t)(random >> 16) + 0.5, (random >> 8) & 1 ? -16 : -30); break;
+		default:    *(double *)a = ldexp((double)(int64_t)random, -33 - (int)((random >> 3) % 32)); break;
+	}
+}
+
+static void
+FloatArgument(uint64_t random, void *a)
+{
+	uint32_t bits = (uint32_t)(random >> 32);
+
+	switch ( random & 7 )
+	{
+		case 0:     *(float *)a = MACTYPES_FIXED_BENCH_EDGE(gMacTypesFixedBenchFloatEdges, random); break;
+		case 1:     memcpy(a, &bits, sizeof(float)); break;
+		case 2:     *(float *)a = ldexpf((float)(int16_t)(random >> 16) + 0.5f, -16); break;
+		default:    *(float *)a = ldexpf((float)(int32_t)bits, -17 - (int)((random >> 3) % 16)); break;
+	}
+}
+
+/*
+ *  The reference: exact in __int128 and long double, then rounded half up and
+ *  saturated as the header describes, with none of the shortcuts of the functions.
+ */
+static __int128
+ReferenceRound(__int128 numerator, __int128 denominator)
+{
+	__int128 quotient;
+
+	if ( denominator < 0 )
+	{
+		numerator = -numerator;
+		denominator = -denominator;
+	}
+	/* floor(n / d + 1/2), with the floor of a negative quotient taken downwards */
+	numerator = 2 * numerator + denominator;
+	denominator *= 2;
+	quotient = numerator / denominator;
+	if ( quotient * denominator > numerator )
+		--quotient;
+	return quotient;
+}
+
+static __int128
+ReferenceClamp(__int128 value, __int128 minimum, __int128 maximum)
+{
+	return value < minimum ? minimum : value > maximum ? maximum : value;
+}
+
+static __int128
+ReferenceQuotient(__int128 numerator, __int128 denominator)
+{
+	if ( denominator == 0 )
+		return numerator < 0 ? INT32_MIN : INT32_MAX;
+	return ReferenceClamp(ReferenceRound(numerator, denominator), INT32_MIN, INT32_MAX);
+}
+
+/* value * scale is exact in long double for every double and float. */
+static __int128
+ReferenceFromFloating(long double value, long double scale, __int128 minimum, __int128 maximum)
+{
+	long double floored;
+
+	if ( isnan(value) )
+		return 0;
+	value *= scale;
+	if ( value >= (long double)maximum + 1 )
+		return maximum;
+	if ( value <= (long double)minimum - 1 )
+		return minimum;
+	floored = floorl(value);
+	return ReferenceClamp((__int128)floored + (value - floored >= 0.5L), minimum, maximum);
+}
+
+static void
+FixedMultiplyReference(const void *a, const void *b, void *result)
+{
+	*(Fixed *)result = (Fixed)ReferenceClamp(ReferenceRound((__int128)*(const Fixed *)a * *(const Fixed *)b, 65536),
+											 INT32_MIN, INT32_MAX);
+}
+
+static void
+FractMultiplyReference(const void *a, const void *b, void *result)
+{
+	*(Fract *)result = (Fract)ReferenceClamp(ReferenceRound((__int128)*(const Fract *)a * *(const Fract *)b,
+															1073741824), INT32_MIN, INT32_MAX);
+}
+
+static void
+FixedDivideReference(const void *a, const void *b, void *result)
+{
+	*(Fixed *)result = (Fixed)ReferenceQuotient((__int128)*(const Fixed *)a * 65536, *(const Fixed *)b);
+}
+
+static void
+FractDivideReference(const void *a, const void *b, void *result)
+{
+	*(Fract *)result = (Fract)ReferenceQuotient((__int128)*(const Fract *)a * 1073741824, *(const Fract *)b);
+}
+
+static void
+FixedRatioReference(const void *a, const void *b, void *result)
+{
+	*(Fixed *)result = (Fixed)ReferenceQuotient((__int128)*(const short *)a * 65536, *(const short *)b);
+}
+
+static void
+FixedAddReference(const void *a, const void *b, void *result)
+{
+	*(Fixed *)result = (Fixed)ReferenceClamp((__int128)*(const Fixed *)a + *(const Fixed *)b, INT32_MIN, INT32_MAX);
+}
+
+static void
+FixedSubtractReference(const void *a, const void *b, void *result)
+{
+	*(Fixed *)result = (Fixed)ReferenceClamp((__int128)*(const Fixed *)a - *(const Fixed *)b, INT32_MIN, INT32_MAX);
+}
+
+static void
+FractFromFixedReference(const void *a, const void *b, void *result)
+{
+	(void)b;
+	*(Fract *)result = (Fract)ReferenceClamp((__int128)*(const Fixed *)a * 16384, INT32_MIN, INT32_MAX);
+}
+
+static void
+FixedFromFractReference(const void *a, const void *b, void *result)
+{
+	(void)b;
+	*(Fixed *)result = (Fixed)ReferenceRound(*(const Fract *)a, 16384);
+}
+
+static void
+ShortFixedFromFixedReference(const void *a, const void *b, void *result)
+{
+	(void)b;
+	*(ShortFixed *)result = (ShortFixed)ReferenceClamp(ReferenceRound(*(const Fixed *)a, 256), INT16_MIN, INT16_MAX);
+}
+
+static void
+FixedFromShortFixedReference(const void *a, const void *b, void *result)
+{
+	(void)b;
+	*(Fixed *)result = (Fixed)((__int128)*(const ShortFixed *)a * 256);
+}
+
+/* The quotients are exact in long double, so converting them rounds once. */
+static void
+DoubleFromFixedReference(const void *a, const void *b, void *result)
+{
+	(void)b;
+	*(double *)result = (double)(*(const Fixed *)a / 65536.0L);
+}
+
+static void
+FloatFromFixedReference(const void *a, const void *b, void *result)
+{
+	(void)b;
+	*(float *)result = (float)(*(const Fixed *)a / 65536.0L);
+}
+
+static void
+DoubleFromFractReference(const void *a, const void *b, void *result)
+{
+	(void)b;
+	*(double *)result = (double)(*(const Fract *)a / 1073741824.0L);
+}
+
+static void
+FloatFromFractReference(const void *a, const void *b, void *result)
+{
+	(void)b;
+	*(float *)result = (float)(*(const Fract *)a / 1073741824.0L);
+}
+
+static void
+DoubleFromUnsignedFixedReference(const void *a, const void *b, void *result)
+{
+	(void)b;
+	*(double *)result = (double)(*(const UnsignedFixed *)a / 65536.0L);
+}
+
+static void
+FixedFromDoubleReference(const void *a, const void *b, void *result)
+{
+	(void)b;
+	*(Fixed *)result = (Fixed)ReferenceFromFloating(*(const double *)a, 65536.0L, INT32_MIN, INT32_MAX);
+}
+
+static void
+FixedFromFloatReference(const void *a, const void *b, void *result)
+{
+	(void)b;
+	*(Fixed *)result = (Fixed)ReferenceFromFloating(*(const float *)a, 65536.0L, INT32_MIN, INT32_MAX);
+}
+
+static void
+FractFromDoubleReference(const void *a, const void *b, void *result)
+{
+	(void)b;
+	*(Fract *)result = (Fract)ReferenceFromFloating(*(const double *)a, 1073741824.0L, INT32_MIN, INT32_MAX);
+}
+
+static void
+UnsignedFixedFromDoubleReference(const void *a, const void *b, void *result)
+{
+	(void)b;
+	*(UnsignedFixed *)result = (UnsignedFixed)ReferenceFromFloating(*(const double *)a, 65536.0L, 0, UINT32_MAX);
+}
+
+#define MACTYPES_FIXED_BENCH_ENTRY(function, isBinary, from, to, argument, array) \
+	{ #function, isBinary, sizeof(from), sizeof(to), argument, function##Scalar, function##Reference, \
+	  function##Loop, array }
+
+static const struct MacTypesFixedBenchEntry gMacTypesFixedBenchEntries[] = {
+	MACTYPES_FIXED_BENCH_ENTRY(FixedMultiply, 1, Fixed, Fixed, IntegerArgument, FixedMultiplyArrayWrapper),
+	MACTYPES_FIXED_BENCH_ENTRY(FractMultiply, 1, Fract, Fract, IntegerArgument, FractMultiplyArrayWrapper),
+	MACTYPES_FIXED_BENCH_ENTRY(FixedDivide, 1, Fixed, Fixed, IntegerArgument, FixedDivideArrayWrapper),
+	MACTYPES_FIXED_BENCH_ENTRY(FractDivide, 1, Fract, Fract, IntegerArgument, FractDivideArrayWrapper),
+	MACTYPES_FIXED_BENCH_ENTRY(FixedRatio, 1, short, Fixed, ShortArgument, NULL),
+	MACTYPES_FIXED_BENCH_ENTRY(FixedAdd, 1, Fixed, Fixed, IntegerArgument, FixedAddArrayWrapper),
+	MACTYPES_FIXED_BENCH_ENTRY(FixedSubtract, 1, Fixed, Fixed, IntegerArgument, FixedSubtractArrayWrapper),
+	MACTYPES_FIXED_BENCH_ENTRY(FractFromFixed, 0, Fixed, Fract, IntegerArgument, NULL),
+	MACTYPES_FIXED_BENCH_ENTRY(FixedFromFract, 0, Fract, Fixed, IntegerArgument, NULL),
+	MACTYPES_FIXED_BENCH_ENTRY(ShortFixedFromFixed, 0, Fixed, ShortFixed, IntegerArgument, NULL),
+	MACTYPES_FIXED_BENCH_ENTRY(FixedFromShortFixed, 0, ShortFixed, Fixed, ShortArgument, NULL),
+	MACTYPES_FIXED_BENCH_ENTRY(DoubleFromFixed, 0, Fixed, double, IntegerArgument, DoubleFromFixedArrayWrapper),
+	MACTYPES_FIXED_BENCH_ENTRY(FixedFromDouble, 0, double, Fixed, DoubleArgument, FixedFromDoubleArrayWrapper),
+	MACTYPES_FIXED_BENCH_ENTRY(FloatFromFixed, 0, Fixed, float, IntegerArgument, FloatFromFixedArrayWrapper),
+	MACTYPES_FIXED_BENCH_ENTRY(FixedFromFloat, 0, float, Fixed, FloatArgument, FixedFromFloatArrayWrapper),
+	MACTYPES_FIXED_BENCH_ENTRY(DoubleFromFract, 0, Fract, double, IntegerArgument, DoubleFromFractArrayWrapper),
+	MACTYPES_FIXED_BENCH_ENTRY(FractFromDouble, 0, double, Fract, DoubleArgument, FractFromDoubleArrayWrapper),
+	MACTYPES_FIXED_BENCH_ENTRY(FloatFromFract, 0, Fract, float, IntegerArgument, NULL),
+	MACTYPES_FIXED_BENCH_ENTRY(DoubleFromUnsignedFixed, 0, UnsignedFixed, double, IntegerArgument, NULL),
+	MACTYPES_FIXED_BENCH_ENTRY(UnsignedFixedFromDouble, 0, double, UnsignedFixed, DoubleArgument, NULL),
+};
+
+/* Buffers of up to count elements of any of the types, with room for an alignment. */
+static double   gA[MACTYPES_FIXED_BENCH_COUNT + kMacTypesFixedBenchAlignments];
+static double   gB[MACTYPES_FIXED_BENCH_COUNT + kMacTypesFixedBenchAlignments];
+static double   gExpected[MACTYPES_FIXED_BENCH_COUNT + kMacTypesFixedBenchAlignments];
+static double   gResult[MACTYPES_FIXED_BENCH_COUNT + kMacTypesFixedBenchAlignments];
+
+static double
+MacTypesFixedBenchNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static uint64_t
+MacTypesFixedBenchRandom(uint64_t *state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 7;
+	*state ^= *state << 17;
+	return *state;
+}
+
+static void
+MacTypesFixedBenchFill(const struct MacTypesFixedBenchEntry *entry, uint64_t *state, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i < count; ++i )
+	{
+		entry->argument(MacTypesFixedBenchRandom(state), (unsigned char *)gA + i * entry->argumentSize);
+		entry->argument(MacTypesFixedBenchRandom(state), (unsigned char *)gB + i * entry->argumentSize);
+	}
+}
+
+static void
+MacTypesFixedBenchPrintBytes(const char *label, const void *value, size_t size)
+{
+	size_t j;
+
+	printf(" %s=0x", label);
+	for ( j = size; j-- > 0; )
+		printf("%02x", ((const unsigned char *)value)[j]);
+}
+
+static void
+MacTypesFixedBenchPrint(const struct MacTypesFixedBenchEntry *entry, const char *what, const void *a, const void *b,
+						const void *expected, const void *result)
+{
+	printf("#   %s %s:", entry->name, what);
+	MacTypesFixedBenchPrintBytes("a", a, entry->argumentSize);
+	if ( entry->isBinary )
+		MacTypesFixedBenchPrintBytes("b", b, entry->argumentSize);
+	MacTypesFixedBenchPrintBytes("expected", expected, entry->resultSize);
+	MacTypesFixedBenchPrintBytes("got", result, entry->resultSize);
+	printf("\n");
+}
+
+/* Checks count arguments against the reference; returns the number of wrong results. */
+static size_t
+MacTypesFixedBenchCheckScalar(const struct MacTypesFixedBenchEntry *entry, size_t count, size_t *reported)
+{
+	unsigned char   expected[sizeof(double)];
+	unsigned char   result[sizeof(double)];
+	size_t          wrong = 0;
+	size_t          i;
+
+	for ( i = 0; i < count; ++i )
+	{
+		const unsigned char *a = (const unsigned char *)gA + i * entry->argumentSize;
+		const unsigned char *b = (const unsigned char *)gB + i * entry->argumentSize;
+
+		entry->reference(a, b, expected);
+		entry->scalar(a, b, result);
+		if ( memcmp(expected, result, entry->resultSize) != 0 )
+		{
+			if ( (*reported)++ < 4 )
+				MacTypesFixedBenchPrint(entry, "wrong", a, b, expected, result);
+			++wrong;
+		}
+	}
+	return wrong;
+}
+
+/*
+ *  Runs the array function on count elements from alignment, into gResult or, with
+ *  inPlace 1 or 2, into a copy of gA or gB passed as that argument too, and compares
+ *  every element with the scalar function.  The bytes around the elements must keep
+ *  the sentinel.  Returns the number of mismatches.
+ */
+static size_t
+MacTypesFixedBenchCheckArray(const struct MacTypesFixedBenchEntry *entry, size_t alignment, size_t count,
+							 int inPlace, size_t *reported)
+{
+	unsigned char   *a = (unsigned char *)gA + alignment * entry->argumentSize;
+	unsigned char   *b = (unsigned char *)gB + alignment * entry->argumentSize;
+	unsigned char   *expected = (unsigned char *)gExpected;
+	unsigned char   *result = (unsigned char *)gResult;
+	size_t          mismatches = 0;
+	size_t          i;
+
+	memset(result, kMacTypesFixedBenchSentinel, sizeof(gResult));
+	if ( inPlace )
+		memcpy(result + alignment * entry->resultSize, inPlace == 1 ? a : b, count * entry->argumentSize);
+	entry->loop(a, b, expected, count);
+	entry->array(inPlace == 1 ? result + alignment * entry->resultSize : a,
+				 inPlace == 2 ? result + alignment * entry->resultSize : b,
+				 result + alignment * entry->resultSize, count);
+
+	for ( i = 0; i < sizeof(gResult); ++i )
+	{
+		size_t  element = i / entry->resultSize;
+		int     inside = element >= alignment && element < alignment + count;
+
+		if ( inside ? result[i] != expected[(element - alignment) * entry->resultSize + i % entry->resultSize]
+					: result[i] != kMacTypesFixedBenchSentinel )
+		{
+			if ( (*reported)++ < 4 )
+			{
+				printf("#   %s count %zu, alignment %zu%s: byte %zu %s\n", entry->name, count, alignment,
+					   inPlace == 1 ? ", in place of a" : inPlace == 2 ? ", in place of b" : "", i,
+					   inside ? "differs" : "written outside the result");
+				if ( inside && !inPlace )
+					MacTypesFixedBenchPrint(entry, "mismatch", a + (element - alignment) * entry->argumentSize,
+											b + (element - alignment) * entry->argumentSize,
+											expected + (element - alignment) * entry->resultSize,
+											result + element * entry->resultSize);
+			}
+			++mismatches;
+			i = (element + 1) * entry->resultSize - 1;      /* once per element */
+		}
+	}
+	return mismatches;
+}
+
+static double
+MacTypesFixedBenchTime(void (*kernel)(const void *a, const void *b, void *result, size_t count))
+{
+	double  best = 0;
+	int     t;
+	int     r;
+
+	kernel(gA, gB, gResult, MACTYPES_FIXED_BENCH_COUNT);
+	for ( t = 0; t < MACTYPES_FIXED_BENCH_TRIALS; ++t )
+	{
+		double  start = MacTypesFixedBenchNow();
+		double  elapsed;
+
+		for ( r = 0; r < MACTYPES_FIXED_BENCH_REPEAT; ++r )
+			kernel(gA, gB, gResult, MACTYPES_FIXED_BENCH_COUNT);
+		elapsed = MacTypesFixedBenchNow() - start;
+		if ( t == 0 || elapsed < best )
+			best = elapsed;
+	}
+	return best / ((double)MACTYPES_FIXED_BENCH_COUNT * MACTYPES_FIXED_BENCH_REPEAT);
+}
+
+int
+main(void)
+{
+	static const size_t longCounts[] = { 63, 64, 65, 255, 1000, MACTYPES_FIXED_BENCH_COUNT };
+	size_t  failures = 0;
+	size_t  e;
+
+	printf("# %d arguments checked against the reference per function\n", MACTYPES_FIXED_BENCH_REFERENCE);
+	printf("%-24s %10s %10s %10s %10s\n", "function", "wrong", "mismatch", "scalar", "array");
+
+	for ( e = 0; e < sizeof(gMacTypesFixedBenchEntries) / sizeof(gMacTypesFixedBenchEntries[0]); ++e )
+	{
+		const struct MacTypesFixedBenchEntry *entry = &gMacTypesFixedBenchEntries[e];
+		uint64_t    state = 0x9E3779B97F4A7C15ULL;
+		size_t      reported = 0;
+		size_t      wrong = 0;
+		size_t      mismatches = 0;
+		size_t      checked;
+		size_t      count;
+		size_t      alignment;
+		size_t      c;
+		int         inPlace;
+		double      scalarTime;
+
+		for ( checked = 0; checked < MACTYPES_FIXED_BENCH_REFERENCE; checked += MACTYPES_FIXED_BENCH_COUNT )
+		{
+			MacTypesFixedBenchFill(entry, &state, MACTYPES_FIXED_BENCH_COUNT);
+			wrong += MacTypesFixedBenchCheckScalar(entry, MACTYPES_FIXED_BENCH_COUNT, &reported);
+		}
+
+		if ( entry->array != NULL )
+		{
+			/* In place only where the result has the type of the arguments. */
+			for ( inPlace = 0; inPlace <= (entry->argumentSize == entry->resultSize ? 1 + entry->isBinary : 0); ++inPlace )
+			{
+				for ( count = 0; count <= kMacTypesFixedBenchShortCount; ++count )
+					for ( alignment = 0; alignment < kMacTypesFixedBenchAlignments; ++alignment )
+					{
+						MacTypesFixedBenchFill(entry, &state, count + kMacTypesFixedBenchAlignments);
+						mismatches += MacTypesFixedBenchCheckArray(entry, alignment, count, inPlace, &reported);
+					}
+				for ( c = 0; c < sizeof(longCounts) / sizeof(longCounts[0]); ++c )
+				{
+					count = longCounts[c];
+					alignment = c % kMacTypesFixedBenchAlignments;
+					MacTypesFixedBenchFill(entry, &state, count + alignment);
+					mismatches += MacTypesFixedBenchCheckArray(entry, alignment, count, inPlace, &reported);
+				}
+			}
+		}
+
+		MacTypesFixedBenchFill(entry, &state, MACTYPES_FIXED_BENCH_COUNT);
+		scalarTime = MacTypesFixedBenchTime(entry->loop);
+		if ( entry->array != NULL )
+			printf("%-24s %10zu %10zu %10.3f %10.3f\n", entry->name, wrong, mismatches, scalarTime,
+				   MacTypesFixedBenchTime(entry->array));
+		else
+			printf("%-24s %10zu %10s %10.3f %10s\n", entry->name, wrong, "-", scalarTime, "-");
+		failures += wrong + mismatches;
+	}
+	return failures != 0;
+}
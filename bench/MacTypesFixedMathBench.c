@@ -0,0 +1,279 @@
+/*
+     File:       MacTypesFixedMathBench.c
+
+     Contains:   Precision and throughput benchmark for MacTypesFixedMath.h.
+
+                 For each function, a fixed pseudo-random set of arguments is run
+                 through the scalar function, the array function and the usual path
+                 through the C library in double (FractFromDouble(sin(DoubleFromFixed(x)))
+                 and so on).  Precision is measured against the long double C library:
+                 the largest error in units of the last place of the result, and the
+                 share of results that are the exact result correctly rounded.  The
+                 array results are also checked against the scalar ones, which must
+                 agree bit for bit.  Throughput is the fastest of several trials, in
+                 nanoseconds per element.  See the bench_fixed_math target in the
+                 Makefile.
+
+*/
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "MacTypesFixed.h"
+#include "MacTypesFixedMath.h"
+
+#ifndef MACTYPES_FIXED_MATH_BENCH_COUNT
+	#define MACTYPES_FIXED_MATH_BENCH_COUNT     4096
+#endif
+
+#ifndef MACTYPES_FIXED_MATH_BENCH_REPEAT
+	#define MACTYPES_FIXED_MATH_BENCH_REPEAT    200
+#endif
+
+#ifndef MACTYPES_FIXED_MATH_BENCH_TRIALS
+	#define MACTYPES_FIXED_MATH_BENCH_TRIALS    5
+#endif
+
+/* Arguments checked for precision, beyond those timed. */
+#ifndef MACTYPES_FIXED_MATH_BENCH_PRECISION
+	#define MACTYPES_FIXED_MATH_BENCH_PRECISION (1 << 22)
+#endif
+
+/*
+ *  Every function is wrapped to take two arguments (the second is ignored but by
+ *  FixedATan2) and return the bits of its result.  exact() returns the exact result
+ *  multiplied by the scale of the result type.
+ */
+struct MacTypesFixedMathBenchEntry
+{
+	const char      *name;
+	int             isUnsigned;
+	SInt32          (*argument)(uint64_t random);
+	SInt32          (*scalar)(SInt32 x, SInt32 y);
+	void            (*array)(const SInt32 *x, const SInt32 *y, SInt32 *result, size_t count);
+	SInt32          (*library)(SInt32 x, SInt32 y);
+	long double     (*exact)(SInt32 x, SInt32 y);
+};
+
+static SInt32 AnyArgument(uint64_t random)      { return (SInt32)(uint32_t)random; }
+static SInt32 ExpArgument(uint64_t random)      { return (SInt32)(random % (23 * 65536)) - 12 * 65536 - 32768; }
+
+static SInt32 SqrtScalar(SInt32 x, SInt32 y)    { (void)y; return FractSqrt(x); }
+static SInt32 SinScalar(SInt32 x, SInt32 y)     { (void)y; return FractSin(x); }
+static SInt32 CosScalar(SInt32 x, SInt32 y)     { (void)y; return FractCos(x); }
+static SInt32 ATan2Scalar(SInt32 x, SInt32 y)   { return FixedATan2(x, y); }
+static SInt32 ExpScalar(SInt32 x, SInt32 y)     { (void)y; return FixedExp(x); }
+
+static void
+SqrtArray(const SInt32 *x, const SInt32 *y, SInt32 *result, size_t count)
+{
+	(void)y;
+	FractSqrtArray(x, result, count);
+}
+
+static void
+SinArray(const SInt32 *x, const SInt32 *y, SInt32 *result, size_t count)
+{
+	(void)y;
+	FractSinArray(x, result, count);
+}
+
+static void
+CosArray(const SInt32 *x, const SInt32 *y, SInt32 *result, size_t count)
+{
+	(void)y;
+	FractCosArray(x, result, count);
+}
+
+static void
+ExpArray(const SInt32 *x, const SInt32 *y, SInt32 *result, size_t count)
+{
+	(void)y;
+	FixedExpArray(x, result, count);
+}
+
+static SInt32
+SqrtLibrary(SInt32 x, SInt32 y)
+{
+	(void)y;
+	return (SInt32)(uint32_t)(sqrt((double)(uint32_t)x / 1073741824.0) * 1073741824.0 + 0.5);
+}
+
+static SInt32 SinLibrary(SInt32 x, SInt32 y)    { (void)y; return FractFromDouble(sin(DoubleFromFixed(x))); }
+static SInt32 CosLibrary(SInt32 x, SInt32 y)    { (void)y; return FractFromDouble(cos(DoubleFromFixed(x))); }
+static SInt32 ATan2Library(SInt32 x, SInt32 y)  { return FixedFromDouble(atan2((double)y, (double)x)); }
+static SInt32 ExpLibrary(SInt32 x, SInt32 y)    { (void)y; return FixedFromDouble(exp(DoubleFromFixed(x))); }
+
+static long double
+SqrtExact(SInt32 x, SInt32 y)
+{
+	(void)y;
+	return sqrtl((long double)(uint32_t)x * 1073741824.0L);
+}
+
+static long double SinExact(SInt32 x, SInt32 y)     { (void)y; return sinl(x / 65536.0L) * 1073741824.0L; }
+static long double CosExact(SInt32 x, SInt32 y)     { (void)y; return cosl(x / 65536.0L) * 1073741824.0L; }
+static long double ATan2Exact(SInt32 x, SInt32 y)   { return (x | y) ? atan2l(y, x) * 65536.0L : 0; }
+static long double ExpExact(SInt32 x, SInt32 y)     { (void)y; return expl(x / 65536.0L) * 65536.0L; }
+
+static const struct MacTypesFixedMathBenchEntry gMacTypesFixedMathBenchEntries[] = {
+	{ "FractSqrt",  1, AnyArgument, SqrtScalar,  SqrtArray,       SqrtLibrary,  SqrtExact },
+	{ "FractSin",   0, AnyArgument, SinScalar,   SinArray,        SinLibrary,   SinExact },
+	{ "FractCos",   0, AnyArgument, CosScalar,   CosArray,        CosLibrary,   CosExact },
+	{ "FixedATan2", 0, AnyArgument, ATan2Scalar, FixedATan2Array, ATan2Library, ATan2Exact },
+	{ "FixedExp",   0, ExpArgument, ExpScalar,   ExpArray,        ExpLibrary,   ExpExact },
+};
+
+static double
+MacTypesFixedMathBenchNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static uint64_t
+MacTypesFixedMathBenchRandom(uint64_t *state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 7;
+	*state ^= *state << 17;
+	return *state;
+}
+
+/* Precision of one way of computing a function. */
+struct MacTypesFixedMathBenchPrecision
+{
+	long double     maximumError;
+	size_t          correct;
+};
+
+static void
+MacTypesFixedMathBenchMeasure(const struct MacTypesFixedMathBenchEntry *entry, SInt32 x, SInt32 y, SInt32 result,
+							  struct MacTypesFixedMathBenchPrecision *precision)
+{
+	long double     minimum = entry->isUnsigned ? 0 : (long double)INT32_MIN;
+	long double     maximum = entry->isUnsigned ? (long double)UINT32_MAX : (long double)INT32_MAX;
+	long double     exact = entry->exact(x, y);
+	long double     value = entry->isUnsigned ? (long double)(uint32_t)result : (long double)result;
+	long double     error;
+
+	exact = exact < minimum ? minimum : exact > maximum ? maximum : exact;
+	error = fabsl(value - exact);
+	if ( error > precision->maximumError )
+		precision->maximumError = error;
+	if ( value == floorl(exact + 0.5L) )
+		++precision->correct;
+}
+
+typedef void (*MacTypesFixedMathBenchKernel)(const struct MacTypesFixedMathBenchEntry *entry,
+											 const SInt32 *x, const SInt32 *y, SInt32 *result, size_t count);
+
+static void
+ScalarKernel(const struct MacTypesFixedMathBenchEntry *entry, const SInt32 *x, const SInt32 *y, SInt32 *result,
+			 size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i < count; ++i )
+		result[i] = entry->scalar(x[i], y[i]);
+}
+
+static void
+ArrayKernel(const struct MacTypesFixedMathBenchEntry *entry, const SInt32 *x, const SInt32 *y, SInt32 *result,
+			size_t count)
+{
+	entry->array(x, y, result, count);
+}
+
+static void
+LibraryKernel(const struct MacTypesFixedMathBenchEntry *entry, const SInt32 *x, const SInt32 *y, SInt32 *result,
+			  size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i < count; ++i )
+		result[i] = entry->library(x[i], y[i]);
+}
+
+static double
+MacTypesFixedMathBenchTime(const struct MacTypesFixedMathBenchEntry *entry, MacTypesFixedMathBenchKernel kernel,
+						   const SInt32 *x, const SInt32 *y, SInt32 *result)
+{
+	double  best = 0;
+	int     t;
+	int     r;
+
+	kernel(entry, x, y, result, MACTYPES_FIXED_MATH_BENCH_COUNT);
+	for ( t = 0; t < MACTYPES_FIXED_MATH_BENCH_TRIALS; ++t )
+	{
+		double  start = MacTypesFixedMathBenchNow();
+		double  elapsed;
+
+		for ( r = 0; r < MACTYPES_FIXED_MATH_BENCH_REPEAT; ++r )
+			kernel(entry, x, y, result, MACTYPES_FIXED_MATH_BENCH_COUNT);
+		elapsed = MacTypesFixedMathBenchNow() - start;
+		if ( t == 0 || elapsed < best )
+			best = elapsed;
+	}
+	return best / ((double)MACTYPES_FIXED_MATH_BENCH_COUNT * MACTYPES_FIXED_MATH_BENCH_REPEAT);
+}
+
+int
+main(void)
+{
+	static SInt32   x[MACTYPES_FIXED_MATH_BENCH_COUNT];
+	static SInt32   y[MACTYPES_FIXED_MATH_BENCH_COUNT];
+	static SInt32   scalar[MACTYPES_FIXED_MATH_BENCH_COUNT];
+	static SInt32   array[MACTYPES_FIXED_MATH_BENCH_COUNT];
+	size_t          e;
+	size_t          i;
+
+	printf("# %d arguments checked per function; error in units of the last place\n",
+		   MACTYPES_FIXED_MATH_BENCH_PRECISION);
+	printf("%-12s %12s %10s %12s %10s %10s %10s %10s %10s\n", "function", "max error", "correct",
+		   "libm error", "libm ok", "mismatch", "scalar", "array", "libm");
+
+	for ( e = 0; e < sizeof(gMacTypesFixedMathBenchEntries) / sizeof(gMacTypesFixedMathBenchEntries[0]); ++e )
+	{
+		const struct MacTypesFixedMathBenchEntry *entry = &gMacTypesFixedMathBenchEntries[e];
+		struct MacTypesFixedMathBenchPrecision  precision = { 0, 0 };
+		struct MacTypesFixedMathBenchPrecision  library = { 0, 0 };
+		uint64_t    state = 0x9E3779B97F4A7C15ULL;
+		size_t      mismatches = 0;
+		size_t      checked;
+		double      scalarTime;
+		double      arrayTime;
+		double      libraryTime;
+
+		for ( checked = 0; checked < MACTYPES_FIXED_MATH_BENCH_PRECISION; checked += MACTYPES_FIXED_MATH_BENCH_COUNT )
+		{
+			for ( i = 0; i < MACTYPES_FIXED_MATH_BENCH_COUNT; ++i )
+			{
+				x[i] = entry->argument(MacTypesFixedMathBenchRandom(&state));
+				y[i] = entry->argument(MacTypesFixedMathBenchRandom(&state));
+			}
+			ScalarKernel(entry, x, y, scalar, MACTYPES_FIXED_MATH_BENCH_COUNT);
+			ArrayKernel(entry, x, y, array, MACTYPES_FIXED_MATH_BENCH_COUNT);
+			for ( i = 0; i < MACTYPES_FIXED_MATH_BENCH_COUNT; ++i )
+			{
+				mismatches += scalar[i] != array[i];
+				MacTypesFixedMathBenchMeasure(entry, x[i], y[i], scalar[i], &precision);
+				MacTypesFixedMathBenchMeasure(entry, x[i], y[i], entry->library(x[i], y[i]), &library);
+			}
+		}
+
+		scalarTime = MacTypesFixedMathBenchTime(entry, ScalarKernel, x, y, scalar);
+		arrayTime = MacTypesFixedMathBenchTime(entry, ArrayKernel, x, y, array);
+		libraryTime = MacTypesFixedMathBenchTime(entry, LibraryKernel, x, y, scalar);
+
+		printf("%-12s %12.6Lf %9.5f%% %12.6Lf %9.5f%% %10zu %10.3f %10.3f %10.3f\n", entry->name,
+			   precision.maximumError, 100.0 * precision.correct / checked,
+			   library.maximumError, 100.0 * library.correct / checked,
+			   mismatches, scalarTime, arrayTime, libraryTime);
+	}
+	return 0;
+}
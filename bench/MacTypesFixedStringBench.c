@@ -0,0 +1,457 @@
+/*
+     File:       MacTypesFixedStringBench.c
+
+     Contains:   Exactness check and throughput benchmark for MacTypesFixedString.h.
+
+                 For each type, the exactness check fuzzes the conversions with
+                 pseudo-random values and decimals, and counts the failures, which must
+                 be 0:
+
+                   - Every value written reads back as itself.  No decimal in range
+                     with fewer decimals does (the C library's correctly rounded "%.*Lf"
+                     gives the one to try), and none with as many is nearer.
+
+                   - Decimals at, just above and just below the midpoint of two values
+                     round to the right one, written plainly, with an exponent, and
+                     with more digits than are kept.
+
+                   - Other decimals, away from midpoints, read as the long double C
+                     library reads them.
+
+                 ShortFixed values are all checked.  Throughput is then timed against
+                 the C library path, snprintf("%.17g") and strtod() through double, in
+                 nanoseconds per conversion, the fastest of several trials.  See the
+                 bench_fixed_string target in the Makefile.
+
+*/
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "MacTypesFixed.h"
+#include "MacTypesFixedString.h"
+
+#ifndef MACTYPES_FIXED_STRING_BENCH_COUNT
+	#define MACTYPES_FIXED_STRING_BENCH_COUNT       4096
+#endif
+
+#ifndef MACTYPES_FIXED_STRING_BENCH_REPEAT
+	#define MACTYPES_FIXED_STRING_BENCH_REPEAT      100
+#endif
+
+#ifndef MACTYPES_FIXED_STRING_BENCH_TRIALS
+	#define MACTYPES_FIXED_STRING_BENCH_TRIALS      5
+#endif
+
+/* Pseudo-random values and decimals checked per type. */
+#ifndef MACTYPES_FIXED_STRING_BENCH_FUZZ
+	#define MACTYPES_FIXED_STRING_BENCH_FUZZ        (1 << 20)
+#endif
+
+/* Each type, wrapped to hold its values in an int64_t. */
+struct MacTypesFixedStringBenchType
+{
+	const char  *name;
+	unsigned    fractionBits;
+	int64_t     minimum;
+	int64_t     maximum;
+	size_t      (*format)(int64_t value, char *buffer, size_t bufferSize);
+	size_t      (*parse)(const char *string, size_t length, int64_t *value);
+};
+
+static size_t
+FormatFixed(int64_t value, char *buffer, size_t bufferSize)
+{
+	return StringFromFixed((Fixed)value, buffer, bufferSize);
+}
+
+static size_t
+FormatUnsignedFixed(int64_t value, char *buffer, size_t bufferSize)
+{
+	return StringFromUnsignedFixed((UnsignedFixed)value, buffer, bufferSize);
+}
+
+static size_t
+FormatFract(int64_t value, char *buffer, size_t bufferSize)
+{
+	return StringFromFract((Fract)value, buffer, bufferSize);
+}
+
+static size_t
+FormatShortFixed(int64_t value, char *buffer, size_t bufferSize)
+{
+	return StringFromShortFixed((ShortFixed)value, buffer, bufferSize);
+}
+
+static size_t
+ParseFixed(const char *string, size_t length, int64_t *value)
+{
+	Fixed   result = 0;
+	size_t  read = FixedFromString(string, length, &result);
+
+	*value = result;
+	return read;
+}
+
+static size_t
+ParseUnsignedFixed(const char *string, size_t length, int64_t *value)
+{
+	UnsignedFixed   result = 0;
+	size_t          read = UnsignedFixedFromString(string, length, &result);
+
+	*value = result;
+	return read;
+}
+
+static size_t
+ParseFract(const char *string, size_t length, int64_t *value)
+{
+	Fract   result = 0;
+	size_t  read = FractFromString(string, length, &result);
+
+	*value = result;
+	return read;
+}
+
+static size_t
+ParseShortFixed(const char *string, size_t length, int64_t *value)
+{
+	ShortFixed  result = 0;
+	size_t      read = ShortFixedFromString(string, length, &result);
+
+	*value = result;
+	return read;
+}
+
+static const struct MacTypesFixedStringBenchType gMacTypesFixedStringBenchTypes[] = {
+	{ "Fixed",         16, INT32_MIN, INT32_MAX,  FormatFixed,         ParseFixed },
+	{ "UnsignedFixed", 16, 0,         UINT32_MAX, FormatUnsignedFixed, ParseUnsignedFixed },
+	{ "Fract",         30, INT32_MIN, INT32_MAX,  FormatFract,         ParseFract },
+	{ "ShortFixed",    8,  INT16_MIN, INT16_MAX,  FormatShortFixed,    ParseShortFixed },
+};
+
+/* Decimals read as Fixed: the characters given, or all if 0, read, and the value. */
+static const struct
+{
+	const char  *string;
+	size_t      length;
+	size_t      read;
+	Fixed       value;
+} gMacTypesFixedStringBenchSyntax[] = {
+	{ "",                           0,  0,  0x7777 },
+	{ "-",                          0,  0,  0x7777 },
+	{ ".",                          0,  0,  0x7777 },
+	{ "-.e1",                       0,  0,  0x7777 },
+	{ "e5",                         0,  0,  0x7777 },
+	{ " 1",                         0,  0,  0x7777 },
+	{ "inf",                        0,  0,  0x7777 },
+	{ "12345678",                   3,  3,  0x7B0000 },
+	{ "+.5",                        0,  3,  0x8000 },
+	{ "5.",                         0,  2,  0x50000 },
+	{ "-1234567.",                  0,  9,  INT32_MIN },
+	{ "12345678.5",                 0,  10, 0x7FFFFFFF },
+	{ "1.5,2",                      0,  3,  0x18000 },
+	{ "0x10",                       0,  1,  0 },
+	{ "1e",                         0,  1,  0x10000 },
+	{ "1e+",                        0,  1,  0x10000 },
+	{ "1e+1x",                      0,  4,  0xA0000 },
+	{ "1.5E-1",                     0,  6,  0x2666 },
+	{ "0.00000762939453125",        0,  19, 1 },
+	{ "-0.00000762939453125",       0,  20, 0 },
+	{ "-0.00000763",                0,  11, -1 },
+	{ "-0.000001",                  0,  9,  0 },
+	{ "000000000032767.9999923706", 0,  26, 0x7FFFFFFF },
+	{ "32767.99999237060546875",    0,  23, 0x7FFFFFFF },
+	{ "99999999999999999999999",    0,  23, 0x7FFFFFFF },
+	{ "-1e100000000",               0,  12, INT32_MIN },
+	{ "1e-100000000",               0,  12, 0 },
+	{ "0.000000000000000000000000000000000000000000000000001e50", 0, 56, 0x199A },
+};
+
+static double
+MacTypesFixedStringBenchNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static uint64_t
+MacTypesFixedStringBenchRandom(uint64_t *state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 7;
+	*state ^= *state << 17;
+	return *state;
+}
+
+static int64_t
+MacTypesFixedStringBenchValue(const struct MacTypesFixedStringBenchType *type, uint64_t *state)
+{
+	uint64_t span = (uint64_t)(type->maximum - type->minimum) + 1;
+
+	return type->minimum + (int64_t)(MacTypesFixedStringBenchRandom(state) % span);
+}
+
+/* Whether value, written, reads back, is shortest, and is nearest; 0 if so. */
+static int
+MacTypesFixedStringBenchCheckValue(const struct MacTypesFixedStringBenchType *type, int64_t value)
+{
+	char        written[kMacTypesFixedStringSize];
+	char        other[64];
+	long double exact = ldexpl((long double)value, -(int)type->fractionBits);
+	size_t      length = type->format(value, written, sizeof(written));
+	const char  *point = strchr(written, '.');
+	int         decimals = point ? (int)strlen(point + 1) : 0;
+	int64_t     read = 0;
+	int         k;
+
+	if ( length != strlen(written) || type->parse(written, length, &read) != length || read != value )
+		return 1;
+	for ( k = 0; k < decimals; ++k )
+	{
+		long double scaled;
+
+		/* Past the range, a shorter decimal saturates to value; it does not count. */
+		snprintf(other, sizeof(other), "%.*Lf", k, exact);
+		scaled = ldexpl(strtold(other, NULL), (int)type->fractionBits);
+		if ( scaled >= type->minimum && scaled <= type->maximum
+			 && type->parse(other, strlen(other), &read) != 0 && read == value )
+			return 1;
+	}
+	snprintf(other, sizeof(other), "%.*Lf", decimals, exact);
+	if ( strcmp(other, written) != 0 )
+	{
+		/* Only a tie, which the C library breaks to even, may differ. */
+		long double ours = fabsl(strtold(written, NULL) - exact);
+		long double theirs = fabsl(strtold(other, NULL) - exact);
+
+		if ( fabsl(ours - theirs) > 1e-15L * fabsl(exact) + 1e-30L )
+			return 1;
+	}
+	return 0;
+}
+
+/*
+ *  Writes the magnitude of the midpoint above value, exactly, and checks it and its
+ *  neighbours.  Returns the number of failures.
+ */
+static int
+MacTypesFixedStringBenchCheckMidpoint(const struct MacTypesFixedStringBenchType *type, int64_t value)
+{
+	char        text[160];
+	char        variant[200];
+	int         negative = value < 0;
+	uint64_t    twice = negative ? (uint64_t)(-2 * value - 1) : (uint64_t)(2 * value + 1);
+	unsigned    bits = type->fractionBits + 1;
+	uint64_t    mask = ((uint64_t)1 << bits) - 1;
+	uint64_t    fraction = twice & mask;
+	int         length = snprintf(text, sizeof(text), "%s%llu.", negative ? "-" : "", (unsigned long long)(twice >> bits));
+	int         failures = 0;
+	int64_t     read = 0;
+	size_t      size;
+	char        *dot;
+
+	/* An odd multiple of 2^-bits has exactly bits decimals, the last a 5. */
+	while ( fraction != 0 )
+	{
+		fraction *= 10;
+		text[length++] = (char)('0' + (fraction >> bits));
+		fraction &= mask;
+	}
+	text[length] = '\0';
+
+	/* The midpoint rounds up; more magnitude moves away from zero. */
+	failures += type->parse(text, (size_t)length, &read) != (size_t)length || read != value + 1;
+
+	size = (size_t)snprintf(variant, sizeof(variant), "%s0000000000000000000000000000000000000001", text);
+	failures += type->parse(variant, size, &read) != size || read != (negative ? value : value + 1);
+
+	memcpy(variant, text, (size_t)length);
+	variant[length - 1] = '4';
+	size = (size_t)length + (size_t)snprintf(variant + length, sizeof(variant) - (size_t)length,
+											 "9999999999999999999999999999999999999999");
+	failures += type->parse(variant, size, &read) != size || read != (negative ? value + 1 : value);
+
+	/* The same digits with the point moved into an exponent. */
+	dot = strchr(text, '.');
+	memcpy(variant, text, (size_t)(dot - text));
+	size = (size_t)(dot - text);
+	size += (size_t)snprintf(variant + size, sizeof(variant) - size, "%se-%d", dot + 1, (int)strlen(dot + 1));
+	failures += type->parse(variant, size, &read) != size || read != value + 1;
+	return failures;
+}
+
+/* Checks a random decimal, unless it lies too near a midpoint for long double to settle. */
+static int
+MacTypesFixedStringBenchCheckDecimal(const struct MacTypesFixedStringBenchType *type, uint64_t *state)
+{
+	char        text[64];
+	int         digits = 1 + (int)(MacTypesFixedStringBenchRandom(state) % 18);
+	int         point = (int)(MacTypesFixedStringBenchRandom(state) % (uint64_t)(digits + 1));
+	int         exponent = (int)(MacTypesFixedStringBenchRandom(state) % 9) - 4;
+	int         length = 0;
+	long double scaled;
+	long double expected;
+	int64_t     read = 0;
+	int         i;
+
+	if ( MacTypesFixedStringBenchRandom(state) & 1 )
+		text[length++] = '-';
+	for ( i = 0; i < digits; ++i )
+	{
+		if ( i == point )
+			text[length++] = '.';
+		text[length++] = (char)('0' + MacTypesFixedStringBenchRandom(state) % 10);
+	}
+	if ( exponent != 0 )
+		length += snprintf(text + length, sizeof(text) - (size_t)length, "e%d", exponent);
+	text[length] = '\0';
+
+	scaled = ldexpl(strtold(text, NULL), (int)type->fractionBits);
+	if ( fabsl(scaled - floorl(scaled) - 0.5L) < 1e-6L )
+		return 0;
+	expected = floorl(scaled + 0.5L);
+	expected = expected < type->minimum ? type->minimum : expected > type->maximum ? type->maximum : expected;
+	return type->parse(text, (size_t)length, &read) != (size_t)length || (long double)read != expected;
+}
+
+static Fixed    gValues[MACTYPES_FIXED_STRING_BENCH_COUNT];
+static char     gStrings[MACTYPES_FIXED_STRING_BENCH_COUNT][32];
+static size_t   gLengths[MACTYPES_FIXED_STRING_BENCH_COUNT];
+
+/*
+ *  Each way to convert the values or strings.  They are not inlined, so that the
+ *  compiler cannot hoist them out of the timing loop.
+ */
+static __attribute__((noinline)) void
+FormatLoop(void)
+{
+	size_t i;
+
+	for ( i = 0; i < MACTYPES_FIXED_STRING_BENCH_COUNT; ++i )
+		gLengths[i] = StringFromFixed(gValues[i], gStrings[i], sizeof(gStrings[i]));
+}
+
+static __attribute__((noinline)) void
+PrintfLoop(void)
+{
+	size_t i;
+
+	for ( i = 0; i < MACTYPES_FIXED_STRING_BENCH_COUNT; ++i )
+		gLengths[i] = (size_t)snprintf(gStrings[i], sizeof(gStrings[i]), "%.17g", DoubleFromFixed(gValues[i]));
+}
+
+static __attribute__((noinline)) void
+ParseLoop(void)
+{
+	size_t i;
+
+	for ( i = 0; i < MACTYPES_FIXED_STRING_BENCH_COUNT; ++i )
+		FixedFromString(gStrings[i], gLengths[i], &gValues[i]);
+}
+
+static __attribute__((noinline)) void
+StrtodLoop(void)
+{
+	size_t i;
+
+	for ( i = 0; i < MACTYPES_FIXED_STRING_BENCH_COUNT; ++i )
+		gValues[i] = FixedFromDouble(strtod(gStrings[i], NULL));
+}
+
+#define MACTYPES_FIXED_STRING_BENCH_TIME(best, call) \
+	do { \
+		int t; \
+		int r; \
+		\
+		call; \
+		for ( t = 0; t < MACTYPES_FIXED_STRING_BENCH_TRIALS; ++t ) \
+		{ \
+			double start = MacTypesFixedStringBenchNow(); \
+			double elapsed; \
+			\
+			for ( r = 0; r < MACTYPES_FIXED_STRING_BENCH_REPEAT; ++r ) \
+				call; \
+			elapsed = MacTypesFixedStringBenchNow() - start; \
+			if ( t == 0 || elapsed < best ) \
+				best = elapsed; \
+		} \
+		best /= (double)MACTYPES_FIXED_STRING_BENCH_COUNT * MACTYPES_FIXED_STRING_BENCH_REPEAT; \
+	} while ( 0 )
+
+int
+main(void)
+{
+	uint64_t    state = 0x9E3779B97F4A7C15ULL;
+	int         failures = 0;
+	double      format = 0;
+	double      printfLoop = 0;
+	double      parse = 0;
+	double      strtodLoop = 0;
+	size_t      e;
+	size_t      i;
+
+	for ( i = 0; i < sizeof(gMacTypesFixedStringBenchSyntax) / sizeof(gMacTypesFixedStringBenchSyntax[0]); ++i )
+	{
+		const char  *string = gMacTypesFixedStringBenchSyntax[i].string;
+		size_t      length = gMacTypesFixedStringBenchSyntax[i].length ? gMacTypesFixedStringBenchSyntax[i].length : strlen(string);
+		Fixed       value = 0x7777;
+
+		if ( FixedFromString(string, length, &value) != gMacTypesFixedStringBenchSyntax[i].read
+			 || value != gMacTypesFixedStringBenchSyntax[i].value )
+		{
+			printf("# \"%s\" misread\n", string);
+			++failures;
+		}
+	}
+
+	printf("# %d values and decimals fuzzed per type\n", MACTYPES_FIXED_STRING_BENCH_FUZZ);
+	printf("%-14s %10s %10s %10s\n", "type", "values", "midpoints", "decimals");
+	for ( e = 0; e < sizeof(gMacTypesFixedStringBenchTypes) / sizeof(gMacTypesFixedStringBenchTypes[0]); ++e )
+	{
+		const struct MacTypesFixedStringBenchType *type = &gMacTypesFixedStringBenchTypes[e];
+		int64_t     edges[] = { type->minimum, type->minimum + 1, -1, 0, 1, type->maximum - 1, type->maximum };
+		int64_t     span = type->maximum - type->minimum + 1;
+		int         exhaustive = span <= MACTYPES_FIXED_STRING_BENCH_FUZZ;
+		int64_t     count = exhaustive ? span : MACTYPES_FIXED_STRING_BENCH_FUZZ;
+		int         valueFailures = 0;
+		int         midpointFailures = 0;
+		int         decimalFailures = 0;
+		int64_t     n;
+
+		for ( i = 0; i < sizeof(edges) / sizeof(edges[0]); ++i )
+			if ( edges[i] >= type->minimum && edges[i] <= type->maximum )
+				valueFailures += MacTypesFixedStringBenchCheckValue(type, edges[i]);
+		for ( n = 0; n < count; ++n )
+		{
+			int64_t value = exhaustive ? type->minimum + n : MacTypesFixedStringBenchValue(type, &state);
+
+			valueFailures += MacTypesFixedStringBenchCheckValue(type, value);
+			if ( value < type->maximum )
+				midpointFailures += MacTypesFixedStringBenchCheckMidpoint(type, value);
+			decimalFailures += MacTypesFixedStringBenchCheckDecimal(type, &state);
+		}
+		printf("%-14s %10d %10d %10d\n", type->name, valueFailures, midpointFailures, decimalFailures);
+		failures += valueFailures + midpointFailures + decimalFailures;
+	}
+
+	for ( i = 0; i < MACTYPES_FIXED_STRING_BENCH_COUNT; ++i )
+		gValues[i] = (Fixed)MacTypesFixedStringBenchRandom(&state);
+
+	/* Both readers read the strings StringFromFixed() wrote. */
+	MACTYPES_FIXED_STRING_BENCH_TIME(format, FormatLoop());
+	MACTYPES_FIXED_STRING_BENCH_TIME(parse, ParseLoop());
+	MACTYPES_FIXED_STRING_BENCH_TIME(strtodLoop, StrtodLoop());
+	MACTYPES_FIXED_STRING_BENCH_TIME(printfLoop, PrintfLoop());
+
+	printf("# Fixed, ns per conversion\n");
+	printf("%-14s %10s %10s %8s\n", "conversion", "ours", "libc", "speedup");
+	printf("%-14s %10.3f %10.3f %7.1fx\n", "format", format, printfLoop, printfLoop / format);
+	printf("%-14s %10.3f %10.3f %7.1fx\n", "parse", parse, strtodLoop, strtodLoop / parse);
+	return failures != 0;
+}
@@ -0,0 +1,217 @@
+/*
+     File:       MacTypesTransformBench.c
+
+     Contains:   Throughput benchmark for the MacTypesTransform.h array functions.
+
+                 Each array function is timed against the loop a caller would otherwise
+                 write, over the same points or rectangles and a matrix that rotates,
+                 scales and translates them.  The array results are first checked
+                 against the scalar functions over random arguments and matrices,
+                 extreme ones included, and the number that differ is reported; it must
+                 be 0.  Times are the fastest of several trials, in nanoseconds per
+                 element.  See the bench_transform target in the Makefile.
+
+*/
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "MacTypesTransform.h"
+
+#ifndef MACTYPES_TRANSFORM_BENCH_COUNT
+	#define MACTYPES_TRANSFORM_BENCH_COUNT      4096
+#endif
+
+#ifndef MACTYPES_TRANSFORM_BENCH_REPEAT
+	#define MACTYPES_TRANSFORM_BENCH_REPEAT     400
+#endif
+
+#ifndef MACTYPES_TRANSFORM_BENCH_TRIALS
+	#define MACTYPES_TRANSFORM_BENCH_TRIALS     5
+#endif
+
+/* Random matrices checked, each over the points and rectangles. */
+#ifndef MACTYPES_TRANSFORM_BENCH_MATRICES
+	#define MACTYPES_TRANSFORM_BENCH_MATRICES   256
+#endif
+
+static FixedPoint   gPoints[MACTYPES_TRANSFORM_BENCH_COUNT];
+static FixedPoint   gPointResults[MACTYPES_TRANSFORM_BENCH_COUNT];
+static FixedRect    gRects[MACTYPES_TRANSFORM_BENCH_COUNT];
+static FixedRect    gRectResults[MACTYPES_TRANSFORM_BENCH_COUNT];
+static Float32Point gFloatPoints[MACTYPES_TRANSFORM_BENCH_COUNT];
+static Float32Point gFloatResults[MACTYPES_TRANSFORM_BENCH_COUNT];
+
+static double
+MacTypesTransformBenchNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static uint64_t
+MacTypesTransformBenchRandom(uint64_t *state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 7;
+	*state ^= *state << 17;
+	return *state;
+}
+
+/* A Fixed of any value when wide, or of magnitude below 2^(bits - 16) otherwise. */
+static Fixed
+MacTypesTransformBenchFixed(uint64_t *state, int bits)
+{
+	int64_t value = (int64_t)(MacTypesTransformBenchRandom(state) >> 32) - 0x80000000LL;
+
+	return bits >= 32 ? (Fixed)value : (Fixed)(value >> (32 - bits));
+}
+
+static void
+MacTypesTransformBenchFill(uint64_t *state, int bits)
+{
+	size_t i;
+
+	for ( i = 0; i < MACTYPES_TRANSFORM_BENCH_COUNT; ++i )
+	{
+		gPoints[i].x = MacTypesTransformBenchFixed(state, bits);
+		gPoints[i].y = MacTypesTransformBenchFixed(state, bits);
+		gRects[i].left = MacTypesTransformBenchFixed(state, bits);
+		gRects[i].top = MacTypesTransformBenchFixed(state, bits);
+		gRects[i].right = MacTypesTransformBenchFixed(state, bits);
+		gRects[i].bottom = MacTypesTransformBenchFixed(state, bits);
+		gFloatPoints[i].x = (Float32)gPoints[i].x / 65536.0f;
+		gFloatPoints[i].y = (Float32)gPoints[i].y / 65536.0f;
+	}
+}
+
+static size_t
+MacTypesTransformBenchCheck(const FixedMatrix *matrix, const Float32Matrix *floatMatrix)
+{
+	size_t  mismatches = 0;
+	size_t  i;
+
+	FixedMatrixTransformPoints(matrix, gPoints, gPointResults, MACTYPES_TRANSFORM_BENCH_COUNT);
+	FixedMatrixTransformRects(matrix, gRects, gRectResults, MACTYPES_TRANSFORM_BENCH_COUNT);
+	Float32MatrixTransformPoints(floatMatrix, gFloatPoints, gFloatResults, MACTYPES_TRANSFORM_BENCH_COUNT);
+	for ( i = 0; i < MACTYPES_TRANSFORM_BENCH_COUNT; ++i )
+	{
+		FixedPoint      point = FixedMatrixTransformPoint(matrix, gPoints[i]);
+		FixedRect       rect = FixedMatrixTransformRect(matrix, gRects[i]);
+		Float32Point    floatPoint = Float32MatrixTransformPoint(floatMatrix, gFloatPoints[i]);
+
+		mismatches += memcmp(&point, &gPointResults[i], sizeof(point)) != 0;
+		mismatches += memcmp(&rect, &gRectResults[i], sizeof(rect)) != 0;
+		mismatches += memcmp(&floatPoint, &gFloatResults[i], sizeof(floatPoint)) != 0;
+	}
+	return mismatches;
+}
+
+/*
+ *  The loops a caller would write.  They are not inlined, so that the compiler
+ *  cannot hoist them out of the timing loop.
+ */
+static __attribute__((noinline)) void
+FixedPointsLoop(const FixedMatrix *matrix, const FixedPoint *source, FixedPoint *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i < count; ++i )
+		result[i] = FixedMatrixTransformPoint(matrix, source[i]);
+}
+
+static __attribute__((noinline)) void
+FixedRectsLoop(const FixedMatrix *matrix, const FixedRect *source, FixedRect *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i < count; ++i )
+		result[i] = FixedMatrixTransformRect(matrix, source[i]);
+}
+
+static __attribute__((noinline)) void
+Float32PointsLoop(const Float32Matrix *matrix, const Float32Point *source, Float32Point *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i < count; ++i )
+	{
+		result[i].x = source[i].x * matrix->matrix[0][0] + source[i].y * matrix->matrix[1][0] + matrix->matrix[2][0];
+		result[i].y = source[i].x * matrix->matrix[0][1] + source[i].y * matrix->matrix[1][1] + matrix->matrix[2][1];
+	}
+}
+
+#define MACTYPES_TRANSFORM_BENCH_TIME(best, call) \
+	do { \
+		int t; \
+		int r; \
+		\
+		call; \
+		for ( t = 0; t < MACTYPES_TRANSFORM_BENCH_TRIALS; ++t ) \
+		{ \
+			double start = MacTypesTransformBenchNow(); \
+			double elapsed; \
+			\
+			for ( r = 0; r < MACTYPES_TRANSFORM_BENCH_REPEAT; ++r ) \
+				call; \
+			elapsed = MacTypesTransformBenchNow() - start; \
+			if ( t == 0 || elapsed < best ) \
+				best = elapsed; \
+		} \
+		best /= (double)MACTYPES_TRANSFORM_BENCH_COUNT * MACTYPES_TRANSFORM_BENCH_REPEAT; \
+	} while ( 0 )
+
+int
+main(void)
+{
+	/* 30 degrees, scaled by 1.5, then moved by (100.25, -42.5). */
+	static const FixedMatrix    matrix = { { { 0x14C8E, 0xC000, 0 }, { -0xC000, 0x14C8E, 0 }, { 0x644000, -0x2A8000, 0x40000000 } } };
+	static const Float32Matrix  floatMatrix = { { { 1.2990381f, 0.75f, 0 }, { -0.75f, 1.2990381f, 0 }, { 100.25f, -42.5f, 1 } } };
+	uint64_t    state = 0x9E3779B97F4A7C15ULL;
+	size_t      mismatches = 0;
+	size_t      m;
+	double      pointsLoop = 0;
+	double      points = 0;
+	double      rectsLoop = 0;
+	double      rects = 0;
+	double      floatsLoop = 0;
+	double      floats = 0;
+
+	for ( m = 0; m < MACTYPES_TRANSFORM_BENCH_MATRICES; ++m )
+	{
+		int             bits = m % 2 ? 32 : 20 + (int)(m % 12);
+		FixedMatrix     random;
+		Float32Matrix   randomFloat;
+		int             row;
+		int             column;
+
+		for ( row = 0; row < 3; ++row )
+			for ( column = 0; column < 3; ++column )
+			{
+				random.matrix[row][column] = MacTypesTransformBenchFixed(&state, bits);
+				randomFloat.matrix[row][column] = (Float32)random.matrix[row][column] / 256.0f;
+			}
+		MacTypesTransformBenchFill(&state, bits);
+		mismatches += MacTypesTransformBenchCheck(&random, &randomFloat);
+	}
+
+	MacTypesTransformBenchFill(&state, 28);
+	mismatches += MacTypesTransformBenchCheck(&matrix, &floatMatrix);
+
+	MACTYPES_TRANSFORM_BENCH_TIME(pointsLoop, FixedPointsLoop(&matrix, gPoints, gPointResults, MACTYPES_TRANSFORM_BENCH_COUNT));
+	MACTYPES_TRANSFORM_BENCH_TIME(points, FixedMatrixTransformPoints(&matrix, gPoints, gPointResults, MACTYPES_TRANSFORM_BENCH_COUNT));
+	MACTYPES_TRANSFORM_BENCH_TIME(rectsLoop, FixedRectsLoop(&matrix, gRects, gRectResults, MACTYPES_TRANSFORM_BENCH_COUNT));
+	MACTYPES_TRANSFORM_BENCH_TIME(rects, FixedMatrixTransformRects(&matrix, gRects, gRectResults, MACTYPES_TRANSFORM_BENCH_COUNT));
+	MACTYPES_TRANSFORM_BENCH_TIME(floatsLoop, Float32PointsLoop(&floatMatrix, gFloatPoints, gFloatResults, MACTYPES_TRANSFORM_BENCH_COUNT));
+	MACTYPES_TRANSFORM_BENCH_TIME(floats, Float32MatrixTransformPoints(&floatMatrix, gFloatPoints, gFloatResults, MACTYPES_TRANSFORM_BENCH_COUNT));
+
+	printf("# %d elements, %zu results differing from the scalar functions\n", MACTYPES_TRANSFORM_BENCH_COUNT, mismatches);
+	printf("%-30s %10s %10s %8s\n", "function", "loop", "array", "speedup");
+	printf("%-30s %10.3f %10.3f %7.2fx\n", "FixedMatrixTransformPoints", pointsLoop, points, pointsLoop / points);
+	printf("%-30s %10.3f %10.3f %7.2fx\n", "FixedMatrixTransformRects", rectsLoop, rects, rectsLoop / rects);
+	printf("%-30s %10.3f %10.3f %7.2fx\n", "Float32MatrixTransformPoints", floatsLoop, floats, floatsLoop / floats);
+	return mismatches != 0;
+}
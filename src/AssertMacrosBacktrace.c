@@ -0,0 +1,193 @@
+/*
+     File:       AssertMacrosBacktrace.c
+
+     Contains:   Lazy, deduplicated backtrace capture for AssertMacros.h failure paths.
+
+                 Traces live in a fixed-size open-addressed table keyed by the hash of
+                 their return addresses.  Slots are claimed with a compare-and-swap on the
+                 hash and published with a release store, so recording never takes a lock
+                 and never allocates.
+
+*/
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE     /* dladdr */
+#endif
+
+#include <dlfcn.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "AssertMacrosBacktrace.h"
+
+#ifndef DEBUG_ASSERT_BACKTRACE_TABLE_SIZE
+	#define DEBUG_ASSERT_BACKTRACE_TABLE_SIZE   256     /* must be a power of two */
+#endif
+
+/* A frame larger than this ends the walk; it almost certainly is not a frame. */
+#define kDebugAssertBacktraceMaxFrameSize       (1024 * 1024)
+
+struct DebugAssertBacktraceSlot {
+	uint64_t                    hash;       /* 0 while free, claimed by CAS */
+	uint32_t                    ready;      /* set with release once record is filled in */
+	DebugAssertBacktraceRecord  record;
+};
+
+static struct DebugAssertBacktraceSlot  gDebugAssertBacktraceTable[DEBUG_ASSERT_BACKTRACE_TABLE_SIZE];
+static uint32_t                         gDebugAssertBacktraceDropped;
+
+/*
+ *  Walks the frame-pointer chain starting at the caller of the function this is
+ *  inlined into.  Each frame is { previous frame pointer, return address } on every
+ *  architecture we support (x86, x86_64, arm, arm64).
+ */
+static inline __attribute__((always_inline)) uint32_t
+DebugAssertWalkFrames(void **frames, uint32_t maxFrames)
+{
+	uintptr_t * fp = (uintptr_t *)__builtin_frame_address(0);
+	uint32_t    count = 0;
+
+	while ( fp != NULL && count < maxFrames )
+	{
+		uintptr_t * next = (uintptr_t *)fp[0];
+		uintptr_t   pc = fp[1];
+
+		if ( pc == 0 )
+			break;
+		frames[count++] = (void *)pc;
+
+		if ( next <= fp ||
+			 (uintptr_t)next - (uintptr_t)fp > kDebugAssertBacktraceMaxFrameSize ||
+			 ((uintptr_t)next & (sizeof(uintptr_t) - 1)) != 0 )
+			break;
+		fp = next;
+	}
+	return count;
+}
+
+/* FNV-1a over the return addresses; 0 is reserved for free slots. */
+static uint64_t
+DebugAssertHashFrames(void * const *frames, uint32_t count)
+{
+	uint64_t    hash = 0xcbf29ce484222325ULL;
+	uint32_t    i;
+
+	for ( i = 0; i < count; ++i )
+	{
+		hash ^= (uint64_t)(uintptr_t)frames[i];
+		hash *= 0x100000001b3ULL;
+	}
+	return hash != 0 ? hash : 1;
+}
+
+__attribute__((noinline)) void
+DebugAssertRecordBacktrace(DebugAssertBacktraceSite *site, uint32_t sampleInterval, const char *file, long line)
+{
+	void *      frames[kDebugAssertBacktraceMaxFrames];
+	uint32_t    failures;
+	uint32_t    count;
+	uint64_t    hash;
+	uint32_t    probe;
+
+	failures = __atomic_add_fetch(&site->failures, 1, __ATOMIC_RELAXED);
+	if ( failures != 1 && (sampleInterval == 0 || (failures % sampleInterval) != 0) )
+		return;
+
+	count = DebugAssertWalkFrames(frames, kDebugAssertBacktraceMaxFrames);
+	hash = DebugAssertHashFrames(frames, count);
+
+	for ( probe = 0; probe < DEBUG_ASSERT_BACKTRACE_TABLE_SIZE; ++probe )
+	{
+		struct DebugAssertBacktraceSlot *slot =
+			&gDebugAssertBacktraceTable[(hash + probe) & (DEBUG_ASSERT_BACKTRACE_TABLE_SIZE - 1)];
+		uint64_t    expected = 0;
+
+		if ( __atomic_load_n(&slot->hash, __ATOMIC_RELAXED) == hash )
+		{
+			__atomic_add_fetch(&slot->record.count, 1, __ATOMIC_RELAXED);
+			return;
+		}
+
+		if ( __atomic_compare_exchange_n(&slot->hash, &expected, hash, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) )
+		{
+			uint32_t    i;
+
+			slot->record.hash = hash;
+			slot->record.frameCount = count;
+			slot->record.file = file;
+			slot->record.line = line;
+			for ( i = 0; i < count; ++i )
+				slot->record.frames[i] = frames[i];
+			__atomic_add_fetch(&slot->record.count, 1, __ATOMIC_RELAXED);
+			__atomic_store_n(&slot->ready, 1, __ATOMIC_RELEASE);
+			return;
+		}
+
+		/* Lost the race to an identical stack: count it there. */
+		if ( expected == hash )
+		{
+			__atomic_add_fetch(&slot->record.count, 1, __ATOMIC_RELAXED);
+			return;
+		}
+	}
+
+	__atomic_add_fetch(&gDebugAssertBacktraceDropped, 1, __ATOMIC_RELAXED);
+}
+
+void
+DebugAssertBacktraceForEach(DebugAssertBacktraceProcPtr proc, void *refCon)
+{
+	uint32_t    i;
+
+	for ( i = 0; i < DEBUG_ASSERT_BACKTRACE_TABLE_SIZE; ++i )
+	{
+		struct DebugAssertBacktraceSlot *slot = &gDebugAssertBacktraceTable[i];
+		DebugAssertBacktraceRecord      record;
+
+		if ( __atomic_load_n(&slot->ready, __ATOMIC_ACQUIRE) == 0 )
+			continue;
+
+		record = slot->record;
+		record.count = __atomic_load_n(&slot->record.count, __ATOMIC_RELAXED);
+		proc(&record, refCon);
+	}
+}
+
+static void
+DebugAssertBacktraceDumpRecord(const DebugAssertBacktraceRecord *record, void *refCon)
+{
+	FILE *      stream = (FILE *)refCon;
+	uint32_t    i;
+
+	fprintf(stream, "backtrace %016llx count %u first %s:%ld\n",
+			(unsigned long long)record->hash, record->count,
+			record->file != NULL ? record->file : "?", record->line);
+
+	for ( i = 0; i < record->frameCount; ++i )
+	{
+		Dl_info     info;
+
+		if ( dladdr(record->frames[i], &info) != 0 && info.dli_fname != NULL )
+			fprintf(stream, "    %2u %p %s load %p\n", i, record->frames[i], info.dli_fname, info.dli_fbase);
+		else
+			fprintf(stream, "    %2u %p\n", i, record->frames[i]);
+	}
+}
+
+void
+DebugAssertBacktraceDump(FILE *stream)
+{
+	uint32_t    dropped;
+
+	DebugAssertBacktraceForEach(DebugAssertBacktraceDumpRecord, stream);
+
+	dropped = DebugAssertBacktraceDropped();
+	if ( dropped != 0 )
+		fprintf(stream, "backtrace table full: %u captures dropped\n", dropped);
+}
+
+uint32_t
+DebugAssertBacktraceDropped(void)
+{
+	return __atomic_load_n(&gDebugAssertBacktraceDropped, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,129 @@
+/*
+     File:       AssertMacrosBranchProfile.c
+
+     Contains:   Per-site pass/fail counting for the branch hints in AssertMacros.h.
+
+                 Sites are claimed with a compare-and-swap on their registered flag and
+                 pushed onto a lock-free list, so counting never takes a lock.  A site can
+                 count a few outcomes before it is on the list; they are not lost, since the
+                 counters live in the site itself.
+
+*/
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "AssertMacrosBranchProfile.h"
+
+/* Sites which ran fewer times than this are not judged by the report written at exit. */
+#ifndef DEBUG_ASSERT_BRANCH_PROFILE_MIN_SAMPLES
+	#define DEBUG_ASSERT_BRANCH_PROFILE_MIN_SAMPLES     100
+#endif
+
+static DebugAssertBranchSite *  gDebugAssertBranchSites;
+static uint32_t                 gDebugAssertBranchProfileExitClaimed;
+
+static void
+DebugAssertBranchProfileAtExit(void)
+{
+	const char *    path = getenv("DEBUG_ASSERT_BRANCH_PROFILE_REPORT");
+	FILE *          stream;
+
+	if ( path == NULL || *path == '\0' )
+		return;
+	if ( path[0] == '-' && path[1] == '\0' )
+	{
+		DebugAssertBranchProfileReport(stderr, DEBUG_ASSERT_BRANCH_PROFILE_MIN_SAMPLES, 0);
+		return;
+	}
+	stream = fopen(path, "w");
+	if ( stream != NULL )
+	{
+		DebugAssertBranchProfileReport(stream, DEBUG_ASSERT_BRANCH_PROFILE_MIN_SAMPLES, 0);
+		fclose(stream);
+	}
+}
+
+void
+DebugAssertRegisterBranchSite(DebugAssertBranchSite *site)
+{
+	uint32_t                unregistered = 0;
+	DebugAssertBranchSite * head;
+
+	if ( !__atomic_compare_exchange_n(&site->registered, &unregistered, 1, 0,
+									  __ATOMIC_RELAXED, __ATOMIC_RELAXED) )
+		return;
+
+	head = __atomic_load_n(&gDebugAssertBranchSites, __ATOMIC_RELAXED);
+	do
+	{
+		site->next = head;
+	} while ( !__atomic_compare_exchange_n(&gDebugAssertBranchSites, &head, site, 1,
+										   __ATOMIC_RELEASE, __ATOMIC_RELAXED) );
+
+	unregistered = 0;
+	if ( __atomic_compare_exchange_n(&gDebugAssertBranchProfileExitClaimed, &unregistered, 1, 0,
+									 __ATOMIC_RELAXED, __ATOMIC_RELAXED) &&
+		 getenv("DEBUG_ASSERT_BRANCH_PROFILE_REPORT") != NULL )
+		atexit(DebugAssertBranchProfileAtExit);
+}
+
+void
+DebugAssertBranchProfileForEach(DebugAssertBranchProfileProcPtr proc, void *refCon)
+{
+	const DebugAssertBranchSite *site;
+
+	for ( site = __atomic_load_n(&gDebugAssertBranchSites, __ATOMIC_ACQUIRE); site != NULL; site = site->next )
+		(*proc)(site, refCon);
+}
+
+struct DebugAssertBranchReportState {
+	FILE *      stream;
+	uint64_t    minimumSamples;
+	int         allSites;
+	unsigned    contradicted;
+};
+
+/*
+ *  A hint of 0 says the test fails less often than it passes, and 1 says the opposite;
+ *  that is all __builtin_expect tells the compiler, so that is what is judged.
+ */
+static void
+DebugAssertBranchReportSite(const DebugAssertBranchSite *site, void *refCon)
+{
+	struct DebugAssertBranchReportState *   state = (struct DebugAssertBranchReportState *)refCon;
+	uint64_t                                passes = __atomic_load_n(&site->passes, __ATOMIC_RELAXED);
+	uint64_t                                failures = __atomic_load_n(&site->failures, __ATOMIC_RELAXED);
+	uint64_t                                total = passes + failures;
+	int                                     observed = failures > passes;
+	int                                     contradicted = total >= state->minimumSamples &&
+														   total != 0 && observed != (site->expected != 0);
+
+	if ( contradicted )
+		++state->contradicted;
+	if ( !contradicted && !state->allSites )
+		return;
+
+	fprintf(state->stream, "%s:%ld: %s: %" PRIu64 " passes, %" PRIu64 " failures (%.1f%% failed), hint %d",
+			site->file, site->line, site->condition, passes, failures,
+			total != 0 ? 100.0 * (double)failures / (double)total : 0.0, site->expected);
+	if ( contradicted )
+		fprintf(state->stream, ", contradicted: use DEBUG_ASSERT_FAILURE_EXPECTED %d\n", observed);
+	else
+		fputc('\n', state->stream);
+}
+
+void
+DebugAssertBranchProfileReport(FILE *stream, uint64_t minimumSamples, int allSites)
+{
+	struct DebugAssertBranchReportState state;
+
+	state.stream = stream;
+	state.minimumSamples = minimumSamples;
+	state.allSites = allSites;
+	state.contradicted = 0;
+
+	fprintf(stream, "# AssertMacros branch profile: sites whose failure rate contradicts their hint\n");
+	DebugAssertBranchProfileForEach(DebugAssertBranchReportSite, &state);
+	fprintf(stream, "# %u contradicted sites\n", state.contradicted);
+}
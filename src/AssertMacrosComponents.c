@@ -0,0 +1,188 @@
+/*
+     File:       AssertMacrosComponents.c
+
+     Contains:   Runtime enable masks for AssertMacros.h reporting, per component.
+
+                 Everything here runs on the slow path: the first failure of a translation
+                 unit, or an explicit control call.  It is serialized by one mutex; the
+                 failure path itself only ever reads DebugAssertComponent.state.
+
+*/
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "AssertMacrosComponents.h"
+
+#ifndef DEBUG_ASSERT_COMPONENT_RULES_MAX
+	#define DEBUG_ASSERT_COMPONENT_RULES_MAX    64
+#endif
+
+struct DebugAssertComponentRule {
+	char    name[kDebugAssertComponentNameMax];
+	int     enabled;
+};
+
+static pthread_mutex_t                  gDebugAssertComponentLock = PTHREAD_MUTEX_INITIALIZER;
+static DebugAssertComponent *           gDebugAssertComponents;
+static struct DebugAssertComponentRule  gDebugAssertComponentRules[DEBUG_ASSERT_COMPONENT_RULES_MAX];
+static unsigned                         gDebugAssertComponentRuleCount;
+static int                              gDebugAssertComponentDefault = 1;
+static int                              gDebugAssertComponentEnvironmentRead;
+
+static int
+DebugAssertComponentRuleMatches(const struct DebugAssertComponentRule *rule, const char *name)
+{
+	return strncmp(rule->name, name, kDebugAssertComponentNameMax - 1) == 0;
+}
+
+/* Called with the lock held.  The newest matching rule wins. */
+static int
+DebugAssertComponentLookup(const char *name)
+{
+	unsigned i = gDebugAssertComponentRuleCount;
+
+	while ( i-- > 0 )
+	{
+		if ( DebugAssertComponentRuleMatches(&gDebugAssertComponentRules[i], name) )
+			return gDebugAssertComponentRules[i].enabled;
+	}
+	return gDebugAssertComponentDefault;
+}
+
+/* Called with the lock held. */
+static void
+DebugAssertComponentAddRule(const char *name, size_t length, int enabled)
+{
+	DebugAssertComponent *  component;
+	unsigned                i;
+
+	if ( length == 1 && name[0] == '*' )
+	{
+		gDebugAssertComponentRuleCount = 0;
+		gDebugAssertComponentDefault = enabled;
+	}
+	else
+	{
+		struct DebugAssertComponentRule rule;
+
+		if ( length >= kDebugAssertComponentNameMax )
+			length = kDebugAssertComponentNameMax - 1;
+		memcpy(rule.name, name, length);
+		rule.name[length] = '\0';
+		rule.enabled = enabled;
+
+		/* Drop an older rule for the same name, then append; when full, forget the oldest. */
+		for ( i = 0; i < gDebugAssertComponentRuleCount; ++i )
+		{
+			if ( strcmp(gDebugAssertComponentRules[i].name, rule.name) == 0 )
+				break;
+		}
+		if ( i == gDebugAssertComponentRuleCount && i == DEBUG_ASSERT_COMPONENT_RULES_MAX )
+			i = 0;
+		if ( i < gDebugAssertComponentRuleCount )
+		{
+			memmove(&gDebugAssertComponentRules[i], &gDebugAssertComponentRules[i + 1],
+					(gDebugAssertComponentRuleCount - i - 1) * sizeof(rule));
+			--gDebugAssertComponentRuleCount;
+		}
+		gDebugAssertComponentRules[gDebugAssertComponentRuleCount++] = rule;
+	}
+
+	for ( component = gDebugAssertComponents; component != NULL; component = component->next )
+	{
+		__atomic_store_n(&component->state,
+						 DebugAssertComponentLookup(component->name) ? kDebugAssertComponentEnabled
+																	 : kDebugAssertComponentDisabled,
+						 __ATOMIC_RELAXED);
+	}
+}
+
+/* Called with the lock held. */
+static void
+DebugAssertComponentParseRules(const char *rules)
+{
+	while ( *rules != '\0' )
+	{
+		const char *    end;
+		int             enabled = 1;
+
+		while ( *rules == ',' || *rules == ' ' )
+			++rules;
+		if ( *rules == '-' || *rules == '+' )
+			enabled = (*rules++ == '+');
+
+		end = rules;
+		while ( *end != '\0' && *end != ',' )
+			++end;
+		if ( end != rules )
+			DebugAssertComponentAddRule(rules, (size_t)(end - rules), enabled);
+		rules = end;
+	}
+}
+
+/* Called with the lock held.  Environment rules come before any made through the API. */
+static void
+DebugAssertComponentReadEnvironment(void)
+{
+	const char *rules;
+
+	if ( gDebugAssertComponentEnvironmentRead )
+		return;
+	gDebugAssertComponentEnvironmentRead = 1;
+
+	rules = getenv("DEBUG_ASSERT_COMPONENTS");
+	if ( rules != NULL )
+		DebugAssertComponentParseRules(rules);
+}
+
+uint32_t
+DebugAssertResolveComponent(DebugAssertComponent *component)
+{
+	uint32_t state;
+
+	pthread_mutex_lock(&gDebugAssertComponentLock);
+	DebugAssertComponentReadEnvironment();
+
+	state = __atomic_load_n(&component->state, __ATOMIC_RELAXED);
+	if ( state == kDebugAssertComponentUnresolved )
+	{
+		component->next = gDebugAssertComponents;
+		gDebugAssertComponents = component;
+		state = DebugAssertComponentLookup(component->name) ? kDebugAssertComponentEnabled
+															: kDebugAssertComponentDisabled;
+		__atomic_store_n(&component->state, state, __ATOMIC_RELAXED);
+	}
+	pthread_mutex_unlock(&gDebugAssertComponentLock);
+	return state;
+}
+
+void
+DebugAssertSetComponentEnabled(const char *componentName, int enabled)
+{
+	pthread_mutex_lock(&gDebugAssertComponentLock);
+	DebugAssertComponentReadEnvironment();
+	DebugAssertComponentAddRule(componentName, strlen(componentName), enabled != 0);
+	pthread_mutex_unlock(&gDebugAssertComponentLock);
+}
+
+void
+DebugAssertApplyComponentRules(const char *rules)
+{
+	pthread_mutex_lock(&gDebugAssertComponentLock);
+	DebugAssertComponentReadEnvironment();
+	DebugAssertComponentParseRules(rules);
+	pthread_mutex_unlock(&gDebugAssertComponentLock);
+}
+
+int
+DebugAssertIsComponentEnabled(const char *componentName)
+{
+	int enabled;
+
+	pthread_mutex_lock(&gDebugAssertComponentLock);
+	DebugAssertComponentReadEnvironment();
+	enabled = DebugAssertComponentLookup(componentName);
+	pthread_mutex_unlock(&gDebugAssertComponentLock);
+	return enabled;
+}
@@ -0,0 +1,116 @@
+/*
+     File:       AssertMacrosWithin.c
+
+     Contains:   Tick calibration for the AssertMacros.h latency budget macros.
+
+                 The factor is computed once, under pthread_once(), by a constructor as
+                 the library is loaded, or by the first region if that comes first; it is
+                 then only ever read.  On x86 it comes from CPUID leaf 0x15 (the ratio of
+                 the time stamp counter to the core crystal clock) when the processor
+                 reports it, and is otherwise measured against CLOCK_MONOTONIC for
+                 DEBUG_ASSERT_WITHIN_CALIBRATION_MS milliseconds.
+
+*/
+#include <pthread.h>
+#include <stdint.h>
+#include <time.h>
+
+#if !defined(__APPLE__) && (defined(__x86_64__) || defined(__i386__))
+	#include <cpuid.h>
+#endif
+
+#include "AssertMacrosWithin.h"
+
+#ifndef DEBUG_ASSERT_WITHIN_CALIBRATION_MS
+	#define DEBUG_ASSERT_WITHIN_CALIBRATION_MS  10
+#endif
+
+uint64_t gDebugAssertNanosecondsPerTick;
+
+static pthread_once_t gDebugAssertCalibrationOnce = PTHREAD_ONCE_INIT;
+
+#if !defined(__APPLE__) && (defined(__x86_64__) || defined(__i386__))
+static uint64_t
+DebugAssertMonotonicNanoseconds(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/* The time stamp counter's frequency in Hz from CPUID leaf 0x15, or 0 if not reported. */
+static uint64_t
+DebugAssertTimeStampFrequency(void)
+{
+	unsigned int denominator;
+	unsigned int numerator;
+	unsigned int crystalHz;
+	unsigned int edx;
+
+	if ( __get_cpuid_max(0, NULL) < 0x15 )
+		return 0;
+	__cpuid(0x15, denominator, numerator, crystalHz, edx);
+	(void)edx;
+	if ( denominator == 0 || numerator == 0 || crystalHz == 0 )
+		return 0;
+	return (uint64_t)crystalHz * numerator / denominator;
+}
+#endif
+
+static void
+DebugAssertCalibrate(void)
+{
+	uint64_t scale;
+
+#if defined(__APPLE__)
+	mach_timebase_info_data_t timebase;
+
+	mach_timebase_info(&timebase);
+	scale = ((uint64_t)timebase.numer << 32) / timebase.denom;
+#elif defined(__x86_64__) || defined(__i386__)
+	uint64_t frequency = DebugAssertTimeStampFrequency();
+
+	if ( frequency != 0 )
+		scale = ((uint64_t)1000000000u << 32) / frequency;
+	else
+	{
+		uint64_t startNanoseconds = DebugAssertMonotonicNanoseconds();
+		uint64_t startTicks = DebugAssertReadTicks();
+		uint64_t elapsedNanoseconds;
+		uint64_t elapsedTicks;
+
+		do
+		{
+			elapsedNanoseconds = DebugAssertMonotonicNanoseconds() - startNanoseconds;
+		} while ( elapsedNanoseconds < DEBUG_ASSERT_WITHIN_CALIBRATION_MS * 1000000u );
+		elapsedTicks = DebugAssertReadTicks() - startTicks;
+		scale = elapsedTicks != 0 ? (elapsedNanoseconds << 32) / elapsedTicks : (uint64_t)1 << 32;
+	}
+#elif defined(__aarch64__)
+	uint64_t frequency;
+
+	__asm__ __volatile__ ("mrs %0, cntfrq_el0" : "=r" (frequency));
+	scale = frequency != 0 ? ((uint64_t)1000000000u << 32) / frequency : (uint64_t)1 << 32;
+#else
+	scale = (uint64_t)1 << 32;      /* ticks are already nanoseconds */
+#endif
+
+	if ( scale == 0 )
+		scale = 1;
+	__atomic_store_n(&gDebugAssertNanosecondsPerTick, scale, __ATOMIC_RELAXED);
+}
+
+uint64_t
+DebugAssertCalibrateTicks(void)
+{
+	pthread_once(&gDebugAssertCalibrationOnce, DebugAssertCalibrate);
+	return __atomic_load_n(&gDebugAssertNanosecondsPerTick, __ATOMIC_RELAXED);
+}
+
+__attribute__((constructor))
+static void
+DebugAssertCalibrateAtLoad(void)
+{
+	(void)DebugAssertCalibrateTicks();
+}
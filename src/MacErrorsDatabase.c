@@ -0,0 +1,399 @@
+/*
+     File:       MacErrorsDatabase.c
+
+     Contains:   Reader for MacErrors.db, written by tools/MacErrorsTable.py --database.
+
+                 The file is a header of 32-bit words followed by 4-byte aligned sections,
+                 all little-endian, with offsets from the start of the file:
+
+                     codes           int32_t[codeCount], ascending
+                     codeNames       {uint16_t firstRef, refCount}[codeCount]
+                     nameRefs        {uint16_t name, comment}[nameRefCount], grouped by code
+                     nameBlocks      uint32_t[(nameCount + nameBlockSize - 1) / nameBlockSize],
+                                     offsets of each block of names within names
+                     names           the names in ascending order, each a byte giving the
+                                     length it shares with the previous name (0 for the
+                                     first of a block) and then the rest of it, ASCII,
+                                     with the top bit of its last byte set
+                     commentOffsets  uint32_t[commentCount + 1] into commentData; comment 0
+                                     is the empty comment
+                     commentData     the comments; a byte below 0x80 is itself, otherwise
+                                     it and the next byte are a big-endian word index with
+                                     the top bit set; index 0x7FFF is followed by a literal
+                     wordOffsets     uint32_t[wordCount + 1] into wordData
+                     wordData        the words, each with the spaces that followed it
+
+                 The header and section bounds are checked when the file is opened, and
+                 every index read from it is checked before it is used, so a damaged
+                 file yields no names rather than a crash.
+
+*/
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "MacErrorsDatabase.h"
+
+#ifndef EFTYPE
+	#define EFTYPE EINVAL           /* "inappropriate file type or format" is Darwin's own */
+#endif
+
+enum
+{
+	kMacErrorsDatabaseMagic         = 0x4244454D,   /* 'MEDB' */
+	kMacErrorsDatabaseVersion       = 1,
+	kMacErrorsDatabaseWordEscape    = 0x7FFF,
+	kMacErrorsDatabaseMaxName       = 511
+};
+
+struct MacErrorsDatabaseHeader
+{
+	uint32_t    magic;
+	uint32_t    version;
+	uint32_t    size;
+	uint32_t    nameBlockSize;
+	uint32_t    codeCount;
+	uint32_t    codes;
+	uint32_t    codeNames;
+	uint32_t    nameRefCount;
+	uint32_t    nameRefs;
+	uint32_t    nameCount;
+	uint32_t    nameBlocks;
+	uint32_t    names;
+	uint32_t    commentCount;
+	uint32_t    commentOffsets;
+	uint32_t    commentData;
+	uint32_t    wordCount;
+	uint32_t    wordOffsets;
+	uint32_t    wordData;
+};
+
+struct OpaqueMacErrorsDatabase
+{
+	const uint8_t *                     base;
+	size_t                              size;
+	struct MacErrorsDatabaseHeader      header;
+};
+
+/* Where copied text goes: as much as fits, always terminated, with the full length kept. */
+struct MacErrorsDatabaseOutput
+{
+	char *      buffer;
+	size_t      size;
+	size_t      length;
+};
+
+static inline uint32_t
+MacErrorsDatabaseRead32(const uint8_t *p)
+{
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline uint16_t
+MacErrorsDatabaseRead16(const uint8_t *p)
+{
+	return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+/* True if count elements of elementSize bytes at offset are aligned and end by limit. */
+static int
+MacErrorsDatabaseFits(uint32_t offset, uint32_t count, uint32_t elementSize, uint32_t limit)
+{
+	return (offset % 4) == 0 && offset <= limit &&
+		(uint64_t)count * elementSize <= (uint64_t)(limit - offset);
+}
+
+static int
+MacErrorsDatabaseCheckHeader(const struct MacErrorsDatabaseHeader *h, size_t size)
+{
+	uint32_t blockCount;
+
+	if ( h->magic != kMacErrorsDatabaseMagic || h->version != kMacErrorsDatabaseVersion ||
+		 h->size != size || h->nameBlockSize == 0 || h->commentCount == 0 )
+		return 0;
+	blockCount = h->nameCount / h->nameBlockSize + (h->nameCount % h->nameBlockSize != 0);
+	return h->codes >= sizeof(*h) &&
+		MacErrorsDatabaseFits(h->codes, h->codeCount, 4, h->codeNames) &&
+		MacErrorsDatabaseFits(h->codeNames, h->codeCount, 4, h->nameRefs) &&
+		MacErrorsDatabaseFits(h->nameRefs, h->nameRefCount, 4, h->nameBlocks) &&
+		MacErrorsDatabaseFits(h->nameBlocks, blockCount, 4, h->names) &&
+		h->names <= h->commentOffsets &&
+		MacErrorsDatabaseFits(h->commentOffsets, h->commentCount + 1, 4, h->commentData) &&
+		h->commentData <= h->wordOffsets &&
+		MacErrorsDatabaseFits(h->wordOffsets, h->wordCount + 1, 4, h->wordData) &&
+		h->wordData <= h->size;
+}
+
+MacErrorsDatabaseRef
+MacErrorsDatabaseOpen(const char *path)
+{
+	MacErrorsDatabaseRef    database;
+	struct stat             info;
+	void *                  base;
+	uint32_t                words[sizeof(struct MacErrorsDatabaseHeader) / 4];
+	uint32_t                i;
+	int                     fd;
+
+	if ( path == NULL )
+	{
+		path = getenv("MACERRORS_DATABASE");
+		if ( path == NULL || *path == '\0' )
+			path = kMacErrorsDatabasePath;
+	}
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+	if ( fd < 0 )
+		return NULL;
+	if ( fstat(fd, &info) != 0 )
+	{
+		close(fd);
+		return NULL;
+	}
+	if ( info.st_size < (off_t)sizeof(struct MacErrorsDatabaseHeader) || info.st_size > (off_t)UINT32_MAX )
+	{
+		close(fd);
+		errno = EFTYPE;
+		return NULL;
+	}
+	base = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if ( base == MAP_FAILED )
+		return NULL;
+
+	database = (MacErrorsDatabaseRef)malloc(sizeof(*database));
+	if ( database == NULL )
+	{
+		munmap(base, (size_t)info.st_size);
+		errno = ENOMEM;
+		return NULL;
+	}
+	database->base = (const uint8_t *)base;
+	database->size = (size_t)info.st_size;
+	for ( i = 0; i < sizeof(words) / 4; ++i )
+		words[i] = MacErrorsDatabaseRead32(database->base + 4 * i);
+	memcpy(&database->header, words, sizeof(database->header));
+	if ( !MacErrorsDatabaseCheckHeader(&database->header, database->size) )
+	{
+		MacErrorsDatabaseClose(database);
+		errno = EFTYPE;
+		return NULL;
+	}
+	return database;
+}
+
+void
+MacErrorsDatabaseClose(MacErrorsDatabaseRef database)
+{
+	if ( database == NULL )
+		return;
+	munmap((void *)database->base, database->size);
+	free(database);
+}
+
+/* Returns the position of status in codes, or -1. */
+static int32_t
+MacErrorsDatabaseFindCode(MacErrorsDatabaseRef database, int32_t status)
+{
+	const uint8_t *     codes = database->base + database->header.codes;
+	uint32_t            low = 0;
+	uint32_t            high = database->header.codeCount;
+
+	while ( low < high )
+	{
+		uint32_t middle = low + (high - low) / 2;
+
+		if ( (int32_t)MacErrorsDatabaseRead32(codes + 4 * middle) < status )
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	if ( low < database->header.codeCount && (int32_t)MacErrorsDatabaseRead32(codes + 4 * low) == status )
+		return (int32_t)low;
+	return -1;
+}
+
+/* Returns the first name reference of status and stores how many there are, or -1. */
+static int32_t
+MacErrorsDatabaseFindRefs(MacErrorsDatabaseRef database, int32_t status, uint32_t *count)
+{
+	int32_t             code = MacErrorsDatabaseFindCode(database, status);
+	const uint8_t *     entry;
+	uint32_t            first;
+
+	*count = 0;
+	if ( code < 0 )
+		return -1;
+	entry = database->base + database->header.codeNames + 4 * (uint32_t)code;
+	first = MacErrorsDatabaseRead16(entry);
+	*count = MacErrorsDatabaseRead16(entry + 2);
+	if ( (uint64_t)first + *count > database->header.nameRefCount )
+	{
+		*count = 0;
+		return -1;
+	}
+	return (int32_t)first;
+}
+
+static void
+MacErrorsDatabaseEmit(struct MacErrorsDatabaseOutput *output, const uint8_t *text, size_t length)
+{
+	if ( output->length < output->size )
+	{
+		size_t room = output->size - 1 - output->length;
+
+		memcpy(output->buffer + output->length, text, length < room ? length : room);
+	}
+	output->length += length;
+}
+
+static size_t
+MacErrorsDatabaseFinish(struct MacErrorsDatabaseOutput *output)
+{
+	if ( output->size != 0 )
+		output->buffer[output->length < output->size ? output->length : output->size - 1] = '\0';
+	return output->length;
+}
+
+static size_t
+MacErrorsDatabaseCopyNameID(MacErrorsDatabaseRef database, uint32_t nameID, char *buffer, size_t bufferSize)
+{
+	const struct MacErrorsDatabaseHeader *  h = &database->header;
+	const uint8_t *                         p;
+	const uint8_t *                         end = database->base + h->commentOffsets;
+	struct MacErrorsDatabaseOutput          output = { buffer, bufferSize, 0 };
+	uint8_t                                 name[kMacErrorsDatabaseMaxName];
+	uint32_t                                length = 0;
+	uint32_t                                i;
+	uint32_t                                blockOffset;
+
+	if ( nameID >= h->nameCount )
+		return 0;
+	blockOffset = MacErrorsDatabaseRead32(database->base + h->nameBlocks + 4 * (nameID / h->nameBlockSize));
+	if ( blockOffset >= h->commentOffsets - h->names )
+		return 0;
+	p = database->base + h->names + blockOffset;
+	for ( i = nameID - nameID % h->nameBlockSize; i <= nameID; ++i )
+	{
+		uint32_t shared;
+
+		if ( p >= end || (shared = *p++) > length )
+			return 0;
+		length = shared;
+		do
+		{
+			if ( p >= end || length >= sizeof(name) )
+				return 0;
+			name[length++] = *p & 0x7F;
+		} while ( (*p++ & 0x80) == 0 );
+	}
+	MacErrorsDatabaseEmit(&output, name, length);
+	return MacErrorsDatabaseFinish(&output);
+}
+
+static size_t
+MacErrorsDatabaseCopyCommentID(MacErrorsDatabaseRef database, uint32_t commentID, char *buffer, size_t bufferSize)
+{
+	const struct MacErrorsDatabaseHeader *  h = &database->header;
+	const uint8_t *                         offsets = database->base + h->commentOffsets;
+	const uint8_t *                         words = database->base + h->wordOffsets;
+	const uint8_t *                         data = database->base + h->commentData;
+	uint32_t                                dataSize = h->wordOffsets - h->commentData;
+	uint32_t                                wordDataSize = h->size - h->wordData;
+	struct MacErrorsDatabaseOutput          output = { buffer, bufferSize, 0 };
+	uint32_t                                position;
+	uint32_t                                end;
+
+	if ( commentID >= h->commentCount )
+		return 0;
+	position = MacErrorsDatabaseRead32(offsets + 4 * commentID);
+	end = MacErrorsDatabaseRead32(offsets + 4 * (commentID + 1));
+	if ( position > end || end > dataSize )
+		return 0;
+	while ( position < end )
+	{
+		uint8_t     byte = data[position++];
+		uint32_t    word;
+		uint32_t    wordStart;
+		uint32_t    wordEnd;
+
+		if ( byte < 0x80 )
+		{
+			MacErrorsDatabaseEmit(&output, &byte, 1);
+			continue;
+		}
+		if ( position >= end )
+			break;
+		word = ((uint32_t)(byte & 0x7F) << 8) | data[position++];
+		if ( word == kMacErrorsDatabaseWordEscape )
+		{
+			if ( position >= end )
+				break;
+			MacErrorsDatabaseEmit(&output, &data[position++], 1);
+			continue;
+		}
+		if ( word >= h->wordCount )
+			break;
+		wordStart = MacErrorsDatabaseRead32(words + 4 * word);
+		wordEnd = MacErrorsDatabaseRead32(words + 4 * (word + 1));
+		if ( wordStart > wordEnd || wordEnd > wordDataSize )
+			break;
+		MacErrorsDatabaseEmit(&output, database->base + h->wordData + wordStart, wordEnd - wordStart);
+	}
+	return MacErrorsDatabaseFinish(&output);
+}
+
+uint32_t
+MacErrorsDatabaseCountNames(MacErrorsDatabaseRef database, int32_t status)
+{
+	uint32_t count;
+
+	if ( database == NULL )
+		return 0;
+	(void)MacErrorsDatabaseFindRefs(database, status, &count);
+	return count;
+}
+
+size_t
+MacErrorsDatabaseCopyName(MacErrorsDatabaseRef database, int32_t status, uint32_t index,
+						  char *buffer, size_t bufferSize)
+{
+	uint32_t    count;
+	int32_t     first;
+
+	if ( bufferSize != 0 )
+		buffer[0] = '\0';
+	if ( database == NULL )
+		return 0;
+	first = MacErrorsDatabaseFindRefs(database, status, &count);
+	if ( first < 0 || index >= count )
+		return 0;
+	return MacErrorsDatabaseCopyNameID(database,
+		MacErrorsDatabaseRead16(database->base + database->header.nameRefs + 4 * ((uint32_t)first + index)),
+		buffer, bufferSize);
+}
+
+size_t
+MacErrorsDatabaseCopyComment(MacErrorsDatabaseRef database, int32_t status,
+							 char *buffer, size_t bufferSize)
+{
+	uint32_t    count;
+	int32_t     first;
+	uint32_t    i;
+
+	if ( bufferSize != 0 )
+		buffer[0] = '\0';
+	if ( database == NULL )
+		return 0;
+	first = MacErrorsDatabaseFindRefs(database, status, &count);
+	for ( i = 0; first >= 0 && i < count; ++i )
+	{
+		uint32_t comment = MacErrorsDatabaseRead16(database->base + database->header.nameRefs + 4 * ((uint32_t)first + i) + 2);
+
+		if ( comment != 0 )
+			return MacErrorsDatabaseCopyCommentID(database, comment, buffer, bufferSize);
+	}
+	return 0;
+}
@@ -0,0 +1,152 @@
+/*
+     File:       MacErrorsErrno.c
+
+     Contains:   Translation between OSStatus values and errno.
+
+                 MacErrorsErrnoTable.h is generated into OBJROOT by
+                 tools/MacErrorsTable.py --errno.  A code becomes an index into one byte
+                 table: classic codes by their negation, kPOSIXError codes after them.
+                 Both ranges are tested with unsigned comparisons and the index chosen
+                 with a conditional move, so the scalar path has no data-dependent branch.
+
+                 On x86 the batch functions translate eight values at a time with AVX2
+                 gathers when the processor has them, chosen once per call with
+                 __builtin_cpu_supports().  Other processors, and other targets, use
+                 the scalar path in a loop the compiler is free to unroll.
+
+*/
+#include <stddef.h>
+#include <stdint.h>
+#include <errno.h>
+
+#include "MacErrorsLookup.h"
+#include "MacErrorsErrnoTable.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+	#include <immintrin.h>
+	#define MACERRORS_ERRNO_AVX2 1
+#else
+	#define MACERRORS_ERRNO_AVX2 0
+#endif
+
+/* Returns the index of status in gMacErrorsErrnos, or an entry holding 0 if it has none. */
+static inline uint32_t
+MacErrorsErrnoIndex(int32_t status)
+{
+	uint32_t    classic = 0u - (uint32_t)status;
+	uint32_t    posix = (uint32_t)status - kMacErrorsErrnoPOSIXBase;
+	uint32_t    index = kMacErrorsErrnoClassicSpan - 1;     /* -8191 is not mapped */
+
+	index = (classic < kMacErrorsErrnoClassicSpan) ? classic : index;
+	index = (posix < kMacErrorsErrnoPOSIXSpan) ? kMacErrorsErrnoClassicSpan + posix : index;
+	return index;
+}
+
+int
+MacErrorToErrno(int32_t status, int unknownErrno)
+{
+	int errnum = gMacErrorsErrnos[MacErrorsErrnoIndex(status)];
+
+	return (errnum != 0 || status == 0) ? errnum : unknownErrno;
+}
+
+int32_t
+ErrnoToMacError(int errnum, int32_t unknownStatus)
+{
+	int32_t status = ((unsigned)errnum < kMacErrorsErrnoLimit) ? gMacErrorsErrnoStatuses[errnum] : 0;
+
+	return (status != 0 || errnum == 0) ? status : unknownStatus;
+}
+
+#if MACERRORS_ERRNO_AVX2
+
+__attribute__((target("avx2")))
+static void
+MacErrorsToErrnosAVX2(const int32_t *statuses, int *errnos, size_t count, int unknownErrno)
+{
+	const __m256i   classicLimit = _mm256_set1_epi32(kMacErrorsErrnoClassicSpan - 1);
+	const __m256i   posixBase = _mm256_set1_epi32(kMacErrorsErrnoPOSIXBase);
+	const __m256i   posixLimit = _mm256_set1_epi32(kMacErrorsErrnoPOSIXSpan - 1);
+	const __m256i   posixStart = _mm256_set1_epi32(kMacErrorsErrnoClassicSpan);
+	const __m256i   byteMask = _mm256_set1_epi32(0xFF);
+	const __m256i   unknown = _mm256_set1_epi32(unknownErrno);
+	const __m256i   zero = _mm256_setzero_si256();
+	size_t          i = 0;
+
+	for ( ; i + 8 <= count; i += 8 )
+	{
+		__m256i status = _mm256_loadu_si256((const __m256i *)(statuses + i));
+		__m256i classic = _mm256_sub_epi32(zero, status);
+		__m256i posix = _mm256_sub_epi32(status, posixBase);
+		__m256i inClassic = _mm256_cmpeq_epi32(_mm256_min_epu32(classic, classicLimit), classic);
+		__m256i inPOSIX = _mm256_cmpeq_epi32(_mm256_min_epu32(posix, posixLimit), posix);
+		__m256i index = _mm256_blendv_epi8(classicLimit, classic, inClassic);
+		__m256i errnum;
+
+		index = _mm256_blendv_epi8(index, _mm256_add_epi32(posix, posixStart), inPOSIX);
+		errnum = _mm256_and_si256(_mm256_i32gather_epi32((const int *)gMacErrorsErrnos, index, 1), byteMask);
+		errnum = _mm256_blendv_epi8(errnum, unknown,
+				_mm256_andnot_si256(_mm256_cmpeq_epi32(status, zero), _mm256_cmpeq_epi32(errnum, zero)));
+		_mm256_storeu_si256((__m256i *)(errnos + i), errnum);
+	}
+	for ( ; i < count; ++i )
+		errnos[i] = MacErrorToErrno(statuses[i], unknownErrno);
+}
+
+__attribute__((target("avx2")))
+static void
+ErrnosToMacErrorsAVX2(const int *errnos, int32_t *statuses, size_t count, int32_t unknownStatus)
+{
+	const __m256i   limit = _mm256_set1_epi32(kMacErrorsErrnoLimit - 1);
+	const __m256i   unknown = _mm256_set1_epi32(unknownStatus);
+	const __m256i   zero = _mm256_setzero_si256();
+	size_t          i = 0;
+
+	for ( ; i + 8 <= count; i += 8 )
+	{
+		__m256i errnum = _mm256_loadu_si256((const __m256i *)(errnos + i));
+		__m256i inside = _mm256_cmpeq_epi32(_mm256_min_epu32(errnum, limit), errnum);
+		__m256i status = _mm256_mask_i32gather_epi32(zero, (const int *)gMacErrorsErrnoStatuses,
+				_mm256_and_si256(errnum, inside), inside, 4);
+
+		status = _mm256_blendv_epi8(status, unknown,
+				_mm256_andnot_si256(_mm256_cmpeq_epi32(errnum, zero), _mm256_cmpeq_epi32(status, zero)));
+		_mm256_storeu_si256((__m256i *)(statuses + i), status);
+	}
+	for ( ; i < count; ++i )
+		statuses[i] = ErrnoToMacError(errnos[i], unknownStatus);
+}
+
+#endif /* MACERRORS_ERRNO_AVX2 */
+
+void
+MacErrorsToErrnos(const int32_t *statuses, int *errnos, size_t count, int unknownErrno)
+{
+	size_t i;
+
+#if MACERRORS_ERRNO_AVX2
+	if ( count >= 8 && __builtin_cpu_supports("avx2") )
+	{
+		MacErrorsToErrnosAVX2(statuses, errnos, count, unknownErrno);
+		return;
+	}
+#endif
+	for ( i = 0; i < count; ++i )
+		errnos[i] = MacErrorToErrno(statuses[i], unknownErrno);
+}
+
+void
+ErrnosToMacErrors(const int *errnos, int32_t *statuses, size_t count, int32_t unknownStatus)
+{
+	size_t i;
+
+#if MACERRORS_ERRNO_AVX2
+	if ( count >= 8 && __builtin_cpu_supports("avx2") )
+	{
+		ErrnosToMacErrorsAVX2(errnos, statuses, count, unknownStatus);
+		return;
+	}
+#endif
+	for ( i = 0; i < count; ++i )
+		statuses[i] = ErrnoToMacError(errnos[i], unknownStatus);
+}
@@ -0,0 +1,298 @@
+/*
+     File:       MacErrorsHistogram.c
+
+     Contains:   A process-wide count of the OSStatus values a program returns.
+
+                 The counters form one array per shard, each the same bins: one per value
+                 MacErrors.h defines, in index order, then one per subsystem (0 first) for
+                 values it does not.  There are at least as many shards as processors,
+                 rounded up to a power of two, and each padded to a cache line.  Linux
+                 threads count into the shard of the processor they run on; elsewhere a
+                 thread keeps the shard it was given when it first recorded.  Either way
+                 a thread that moves can share a shard for a moment, so the counters are
+                 still incremented atomically, just without contention.
+
+                 The shards are allocated together on first use and published with a
+                 compare-and-swap; they are never freed.
+
+*/
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE     /* sched_getcpu */
+#endif
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#if defined(__linux__)
+	#include <sched.h>
+#endif
+
+#include "MacErrorsHistogram.h"
+#include "MacErrorsLookup.h"
+
+#ifndef MACERRORS_HISTOGRAM_MAX_SHARDS
+	#define MACERRORS_HISTOGRAM_MAX_SHARDS      256
+#endif
+
+#define kMacErrorsHistogramLineCounters         (64 / sizeof(uint64_t))
+
+struct MacErrorsHistogram {
+	uint32_t    codeCount;          /* bins before the subsystem bins */
+	uint32_t    binCount;
+	uint32_t    shardMask;
+	uint32_t    shardStride;        /* counters per shard, a whole number of lines */
+	uint64_t *  counts;
+};
+
+static struct MacErrorsHistogram *  gMacErrorsHistogram;
+static uint32_t                     gMacErrorsHistogramExitClaimed;
+
+static void
+MacErrorsHistogramAtExit(void)
+{
+	const char *    path = getenv("MACERRORS_HISTOGRAM_REPORT");
+	FILE *          stream;
+
+	if ( path == NULL || *path == '\0' )
+		return;
+	if ( path[0] == '-' && path[1] == '\0' )
+	{
+		MacErrorsHistogramReport(stderr, 0);
+		return;
+	}
+	stream = fopen(path, "w");
+	if ( stream != NULL )
+	{
+		MacErrorsHistogramReport(stream, 0);
+		fclose(stream);
+	}
+}
+
+static struct MacErrorsHistogram *
+MacErrorsHistogramCreate(void)
+{
+	struct MacErrorsHistogram * histogram;
+	struct MacErrorsHistogram * existing = NULL;
+	long                        processors = sysconf(_SC_NPROCESSORS_CONF);
+	uint32_t                    shardCount = 1;
+	uint32_t                    unclaimed = 0;
+	size_t                      i;
+
+	while ( (long)shardCount < processors && shardCount < MACERRORS_HISTOGRAM_MAX_SHARDS )
+		shardCount *= 2;
+
+	histogram = (struct MacErrorsHistogram *)malloc(sizeof(*histogram));
+	if ( histogram == NULL )
+		return NULL;
+	histogram->codeCount = CountMacErrors();
+	histogram->binCount = histogram->codeCount + CountMacErrorSubsystems() + 1;
+	histogram->shardMask = shardCount - 1;
+	histogram->shardStride = (histogram->binCount + kMacErrorsHistogramLineCounters - 1) &
+							 ~(uint32_t)(kMacErrorsHistogramLineCounters - 1);
+	if ( posix_memalign((void **)&histogram->counts, 64,
+						(size_t)shardCount * histogram->shardStride * sizeof(uint64_t)) != 0 )
+	{
+		free(histogram);
+		return NULL;
+	}
+	for ( i = 0; i < (size_t)shardCount * histogram->shardStride; ++i )
+		histogram->counts[i] = 0;
+
+	if ( !__atomic_compare_exchange_n(&gMacErrorsHistogram, &existing, histogram, 0,
+									  __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) )
+	{
+		free(histogram->counts);
+		free(histogram);
+		return existing;
+	}
+
+	if ( __atomic_compare_exchange_n(&gMacErrorsHistogramExitClaimed, &unclaimed, 1, 0,
+									 __ATOMIC_RELAXED, __ATOMIC_RELAXED) &&
+		 getenv("MACERRORS_HISTOGRAM_REPORT") != NULL )
+		atexit(MacErrorsHistogramAtExit);
+	return histogram;
+}
+
+static inline uint32_t
+MacErrorsHistogramShard(void)
+{
+#if defined(__linux__)
+	int cpu = sched_getcpu();
+
+	return cpu >= 0 ? (uint32_t)cpu : 0;
+#else
+	static uint32_t             gNextShard;
+	static __thread uint32_t    tShard;             /* 1 + the shard, or 0 before the first record */
+
+	if ( tShard == 0 )
+		tShard = __atomic_add_fetch(&gNextShard, 1, __ATOMIC_RELAXED);
+	return tShard - 1;
+#endif
+}
+
+void
+MacErrorsHistogramRecord(int32_t status)
+{
+	struct MacErrorsHistogram * histogram = __atomic_load_n(&gMacErrorsHistogram, __ATOMIC_ACQUIRE);
+	uint32_t                    index = GetMacErrorIndex(status);
+	uint32_t                    bin;
+
+	if ( histogram == NULL && (histogram = MacErrorsHistogramCreate()) == NULL )
+		return;
+	bin = index != 0 ? index - 1 : histogram->codeCount + GetMacErrorSubsystem(status);
+	__atomic_fetch_add(&histogram->counts[(size_t)(MacErrorsHistogramShard() & histogram->shardMask) *
+										  histogram->shardStride + bin], 1, __ATOMIC_RELAXED);
+}
+
+/* Returns the merged counts, one per bin, or NULL if nothing was recorded or memory ran out. */
+static uint64_t *
+MacErrorsHistogramMerge(const struct MacErrorsHistogram *histogram)
+{
+	uint64_t *  totals;
+	uint32_t    shard;
+	uint32_t    bin;
+
+	if ( histogram == NULL )
+		return NULL;
+	totals = (uint64_t *)calloc(histogram->binCount, sizeof(uint64_t));
+	if ( totals == NULL )
+		return NULL;
+	for ( shard = 0; shard <= histogram->shardMask; ++shard )
+	{
+		const uint64_t *counts = &histogram->counts[(size_t)shard * histogram->shardStride];
+
+		for ( bin = 0; bin < histogram->binCount; ++bin )
+			totals[bin] += __atomic_load_n(&counts[bin], __ATOMIC_RELAXED);
+	}
+	return totals;
+}
+
+static int
+MacErrorsHistogramCompareEntries(const void *left, const void *right)
+{
+	const MacErrorsHistogramEntry * a = (const MacErrorsHistogramEntry *)left;
+	const MacErrorsHistogramEntry * b = (const MacErrorsHistogramEntry *)right;
+
+	if ( a->count != b->count )
+		return a->count > b->count ? -1 : 1;
+	if ( (a->name == NULL) != (b->name == NULL) )
+		return a->name == NULL ? 1 : -1;
+	if ( a->status != b->status )
+		return a->status < b->status ? -1 : 1;
+	return a->subsystem < b->subsystem ? -1 : (a->subsystem > b->subsystem);
+}
+
+/* Returns every non-zero count, sorted, in memory the caller frees, or NULL if there are none. */
+static MacErrorsHistogramEntry *
+MacErrorsHistogramCopyAll(size_t *count)
+{
+	const struct MacErrorsHistogram *   histogram = __atomic_load_n(&gMacErrorsHistogram, __ATOMIC_ACQUIRE);
+	uint64_t *                          totals = MacErrorsHistogramMerge(histogram);
+	MacErrorsHistogramEntry *           entries;
+	size_t                              used = 0;
+	uint32_t                            bin;
+
+	*count = 0;
+	if ( totals == NULL )
+		return NULL;
+	entries = (MacErrorsHistogramEntry *)malloc(histogram->binCount * sizeof(MacErrorsHistogramEntry));
+	if ( entries == NULL )
+	{
+		free(totals);
+		return NULL;
+	}
+	for ( bin = 0; bin < histogram->binCount; ++bin )
+	{
+		MacErrorsHistogramEntry *entry = &entries[used];
+
+		if ( totals[bin] == 0 )
+			continue;
+		if ( bin < histogram->codeCount )
+		{
+			entry->status = GetIndMacError(bin + 1);
+			entry->name = GetMacErrorName(entry->status);
+			entry->subsystem = GetMacErrorSubsystem(entry->status);
+		}
+		else
+		{
+			entry->status = 0;
+			entry->name = NULL;
+			entry->subsystem = bin - histogram->codeCount;
+		}
+		entry->subsystemName = GetMacErrorSubsystemName(entry->subsystem);
+		entry->count = totals[bin];
+		++used;
+	}
+	free(totals);
+	qsort(entries, used, sizeof(MacErrorsHistogramEntry), MacErrorsHistogramCompareEntries);
+	*count = used;
+	return entries;
+}
+
+size_t
+MacErrorsHistogramSnapshot(MacErrorsHistogramEntry *entries, size_t capacity)
+{
+	size_t                      count;
+	MacErrorsHistogramEntry *   all = MacErrorsHistogramCopyAll(&count);
+	size_t                      i;
+
+	for ( i = 0; i < count && i < capacity; ++i )
+		entries[i] = all[i];
+	free(all);
+	return count;
+}
+
+void
+MacErrorsHistogramReset(void)
+{
+	struct MacErrorsHistogram * histogram = __atomic_load_n(&gMacErrorsHistogram, __ATOMIC_ACQUIRE);
+	size_t                      i;
+
+	if ( histogram == NULL )
+		return;
+	for ( i = 0; i < (size_t)(histogram->shardMask + 1) * histogram->shardStride; ++i )
+		__atomic_store_n(&histogram->counts[i], 0, __ATOMIC_RELAXED);
+}
+
+void
+MacErrorsHistogramReport(FILE *stream, size_t limit)
+{
+	size_t                      count;
+	MacErrorsHistogramEntry *   entries = MacErrorsHistogramCopyAll(&count);
+	uint32_t                    subsystemCount = CountMacErrorSubsystems();
+	uint64_t *                  subsystemTotals = (uint64_t *)calloc(subsystemCount + 1, sizeof(uint64_t));
+	uint64_t                    total = 0;
+	size_t                      i;
+	uint32_t                    subsystem;
+
+	for ( i = 0; i < count; ++i )
+		total += entries[i].count;
+	fprintf(stream, "# MacErrors histogram: %" PRIu64 " errors, %zu distinct\n", total, count);
+	for ( i = 0; i < count && (limit == 0 || i < limit); ++i )
+	{
+		const MacErrorsHistogramEntry *entry = &entries[i];
+
+		if ( entry->name != NULL )
+			fprintf(stream, "%12" PRIu64 "  %11" PRId32 "  %s", entry->count, entry->status, entry->name);
+		else
+			fprintf(stream, "%12" PRIu64 "  %11s  (undefined)", entry->count, "");
+		fprintf(stream, "  [%s]\n", entry->subsystemName != NULL ? entry->subsystemName : "unclassified");
+	}
+	if ( subsystemTotals != NULL )
+	{
+		for ( i = 0; i < count; ++i )
+			subsystemTotals[entries[i].subsystem] += entries[i].count;
+		fprintf(stream, "# by subsystem\n");
+		for ( subsystem = 0; subsystem <= subsystemCount; ++subsystem )
+		{
+			const char *name = GetMacErrorSubsystemName(subsystem);
+
+			if ( subsystemTotals[subsystem] != 0 )
+				fprintf(stream, "%12" PRIu64 "  %s\n", subsystemTotals[subsystem],
+						name != NULL ? name : "unclassified");
+		}
+		free(subsystemTotals);
+	}
+	free(entries);
+}
@@ -0,0 +1,187 @@
+/*
+     File:       MacErrorsLookup.c
+
+     Contains:   Names and descriptions of the OSStatus values defined in MacErrors.h.
+
+                 MacErrorsTable.h is generated into OBJROOT by tools/MacErrorsTable.py.
+                 Codes are placed by hash-and-displace: the first hash picks a bucket,
+                 whose displacement seeds the second hash, which gives the only slot the
+                 code can be in.  The slot gives the code's index, its position among
+                 all codes in order, which also locates its names.
+
+                 Subsystems are found in a sorted table of disjoint ranges.  An OSErr
+                 value indexes a bucket table giving the range to start from and then
+                 counts, with independent comparisons, how many of the next
+                 kMacErrorsRangeScan ranges start at or below it.  Other values take a
+                 binary search whose steps compile to conditional moves.  Neither path
+                 has a data-dependent branch.
+
+*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include "MacErrorsLookup.h"
+
+struct MacErrorsName {
+	uint32_t    name;               /* offsets into gMacErrorsStrings */
+	uint32_t    comment;
+};
+
+struct MacErrorsSlot {
+	int32_t     code;
+	uint16_t    index;              /* into gMacErrorsCodes and gMacErrorsFirstNames */
+	uint16_t    nameCount;          /* 0 for an empty slot */
+};
+
+#include "MacErrorsTable.h"
+
+/* Must match mix() in tools/MacErrorsTable.py. */
+static inline uint32_t
+MacErrorsMix(uint32_t value, uint32_t seed)
+{
+	uint32_t x = value ^ seed;
+
+	x *= 0x9E3779B1u;
+	x ^= x >> 15;
+	x *= 0x85EBCA77u;
+	x ^= x >> 13;
+	return x;
+}
+
+static const struct MacErrorsSlot *
+MacErrorsFindSlot(int32_t status)
+{
+	uint32_t                        key = (uint32_t)status;
+	uint32_t                        displacement = gMacErrorsDisplacements[MacErrorsMix(key, 0) & kMacErrorsTableBucketMask];
+	const struct MacErrorsSlot *    slot = &gMacErrorsSlots[MacErrorsMix(key, displacement) & kMacErrorsTableSlotMask];
+
+	return (slot->nameCount != 0 && slot->code == status) ? slot : NULL;
+}
+
+static inline const char *
+MacErrorsString(uint32_t offset)
+{
+	return gMacErrorsStrings[offset] != '\0' ? &gMacErrorsStrings[offset] : NULL;
+}
+
+const char *
+GetMacErrorName(int32_t status)
+{
+	const struct MacErrorsSlot *slot = MacErrorsFindSlot(status);
+
+	return slot != NULL ? MacErrorsString(gMacErrorsNames[gMacErrorsFirstNames[slot->index]].name) : NULL;
+}
+
+const char *
+GetMacErrorComment(int32_t status)
+{
+	const struct MacErrorsSlot *    slot = MacErrorsFindSlot(status);
+	uint32_t                        i;
+
+	if ( slot == NULL )
+		return NULL;
+	for ( i = 0; i < slot->nameCount; ++i )
+	{
+		const char *comment = MacErrorsString(gMacErrorsNames[gMacErrorsFirstNames[slot->index] + i].comment);
+
+		if ( comment != NULL )
+			return comment;
+	}
+	return NULL;
+}
+
+uint32_t
+CountMacErrorNames(int32_t status)
+{
+	const struct MacErrorsSlot *slot = MacErrorsFindSlot(status);
+
+	return slot != NULL ? slot->nameCount : 0;
+}
+
+const char *
+GetIndMacErrorName(int32_t status, uint32_t index, const char **comment)
+{
+	const struct MacErrorsSlot *    slot = MacErrorsFindSlot(status);
+	const struct MacErrorsName *    name;
+
+	if ( slot == NULL || index >= slot->nameCount )
+	{
+		if ( comment != NULL )
+			*comment = NULL;
+		return NULL;
+	}
+	name = &gMacErrorsNames[gMacErrorsFirstNames[slot->index] + index];
+	if ( comment != NULL )
+		*comment = MacErrorsString(name->comment);
+	return MacErrorsString(name->name);
+}
+
+uint32_t
+GetMacErrorIndex(int32_t status)
+{
+	const struct MacErrorsSlot *slot = MacErrorsFindSlot(status);
+
+	return slot != NULL ? slot->index + 1u : 0;
+}
+
+int32_t
+GetIndMacError(uint32_t index)
+{
+	return (index != 0 && index <= kMacErrorsTableCodeCount) ? gMacErrorsCodes[index - 1] : 0;
+}
+
+uint32_t
+CountMacErrors(void)
+{
+	return kMacErrorsTableCodeCount;
+}
+
+/* Returns the index of the last range starting at or below status, or 0 if there is none. */
+static inline uint32_t
+MacErrorsFindRange(int32_t status)
+{
+	uint32_t            offset = (uint32_t)status + 32768u;
+	const int32_t *     base = gMacErrorsRangeLows;
+	uint32_t            count = kMacErrorsRangeCount;
+
+	if ( offset < 65536u )
+	{
+		uint32_t    index = gMacErrorsRangeBuckets[offset >> kMacErrorsRangeBucketShift];
+		uint32_t    later = 0;
+		uint32_t    i;
+
+		for ( i = 1; i <= kMacErrorsRangeScan; ++i )
+			later += (gMacErrorsRangeLows[index + i] <= status);
+		return index + later;
+	}
+	while ( count > 1 )
+	{
+		uint32_t half = count / 2;
+
+		base = (base[half] <= status) ? base + half : base;
+		count -= half;
+	}
+	return (uint32_t)(base - gMacErrorsRangeLows);
+}
+
+uint32_t
+GetMacErrorSubsystem(int32_t status)
+{
+	uint32_t    index = MacErrorsFindRange(status);
+	uint32_t    inside = (gMacErrorsRangeLows[index] <= status) & (status <= gMacErrorsRangeHighs[index]);
+
+	return gMacErrorsRangeSubsystems[index] & (0u - inside);
+}
+
+const char *
+GetMacErrorSubsystemName(uint32_t subsystem)
+{
+	return (subsystem != 0 && subsystem <= kMacErrorsSubsystemCount) ?
+		&gMacErrorsStrings[gMacErrorsSubsystemNames[subsystem]] : NULL;
+}
+
+uint32_t
+CountMacErrorSubsystems(void)
+{
+	return kMacErrorsSubsystemCount;
+}
@@ -0,0 +1,527 @@
+/*
+     File:       MacTypesFixed.c
+
+     Contains:   The MacTypesFixed.h array functions.
+
+                 Each has a scalar loop over the inline functions, and a vector version
+                 that gives the same results bit for bit and finishes with the scalar loop:
+
+                   - Products are formed in 64 bits (vpmuldq on the even and odd lanes,
+                     vmull_s32 on arm64), rounded, shifted and saturated.
+
+                   - Quotients are computed in double, which is rounded up to a unit away
+                     from the exact one, then corrected with two remainders computed by
+                     fused multiply-add.  Those are small, so exact, whenever the quotient
+                     is in range.
+
+                   - Conversions from floating point floor the scaled value and add 1 if
+                     the part floored away is at least a half; both steps are exact.
+
+*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include "MacTypesFixed.h"
+#include "TargetCPUFeatures.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+	#include <immintrin.h>
+
+	#define MACTYPESFIXED_AVX2      1
+	#define MACTYPESFIXED_TARGET    __attribute__((target("avx2,fma")))
+#elif defined(__aarch64__)
+	#include <arm_neon.h>
+
+	#define MACTYPESFIXED_NEON      1
+#endif
+
+#if MACTYPESFIXED_AVX2
+	#define kMacTypesFixedAVX2Features      (kTargetCPUFeatureAVX2 | kTargetCPUFeatureFMA)
+
+	#define MACTYPESFIXED_ARRAY(name, parameters, arguments) \
+		TARGET_CPU_DISPATCH(void, name, parameters, arguments, \
+			(features & kMacTypesFixedAVX2Features) == kMacTypesFixedAVX2Features ? name##AVX2 : name##Scalar)
+#elif MACTYPESFIXED_NEON
+	#define MACTYPESFIXED_ARRAY(name, parameters, arguments) \
+		void name parameters { name##NEON arguments; }
+#else
+	#define MACTYPESFIXED_ARRAY(name, parameters, arguments) \
+		void name parameters { name##Scalar arguments; }
+#endif
+
+/*
+ *  Scalar loops, used as they are where there is no vector version, and for the
+ *  elements left over by the vector versions.
+ */
+#define MACTYPESFIXED_SCALAR_BINARY(name, type, function) \
+	static void \
+	name##Scalar(const type *a, const type *b, type *result, size_t count) \
+	{ \
+		size_t i; \
+		\
+		for ( i = 0; i < count; ++i ) \
+			result[i] = function(a[i], b[i]); \
+	}
+
+#define MACTYPESFIXED_SCALAR_UNARY(name, from, to, function) \
+	static void \
+	name##Scalar(const from *a, to *result, size_t count) \
+	{ \
+		size_t i; \
+		\
+		for ( i = 0; i < count; ++i ) \
+			result[i] = function(a[i]); \
+	}
+
+MACTYPESFIXED_SCALAR_BINARY(FixedMultiplyArray, Fixed, FixedMultiply)
+MACTYPESFIXED_SCALAR_BINARY(FractMultiplyArray, Fract, FractMultiply)
+MACTYPESFIXED_SCALAR_BINARY(FixedDivideArray, Fixed, FixedDivide)
+MACTYPESFIXED_SCALAR_BINARY(FractDivideArray, Fract, FractDivide)
+MACTYPESFIXED_SCALAR_BINARY(FixedAddArray, Fixed, FixedAdd)
+MACTYPESFIXED_SCALAR_BINARY(FixedSubtractArray, Fixed, FixedSubtract)
+MACTYPESFIXED_SCALAR_UNARY(DoubleFromFixedArray, Fixed, double, DoubleFromFixed)
+MACTYPESFIXED_SCALAR_UNARY(FixedFromDoubleArray, double, Fixed, FixedFromDouble)
+MACTYPESFIXED_SCALAR_UNARY(FloatFromFixedArray, Fixed, float, FloatFromFixed)
+MACTYPESFIXED_SCALAR_UNARY(FixedFromFloatArray, float, Fixed, FixedFromFloat)
+MACTYPESFIXED_SCALAR_UNARY(DoubleFromFractArray, Fract, double, DoubleFromFract)
+MACTYPESFIXED_SCALAR_UNARY(FractFromDoubleArray, double, Fract, FractFromDouble)
+
+#if MACTYPESFIXED_AVX2
+
+/* Returns (a * b + 2^(shift - 1)) >> shift for eight pairs, saturated. */
+MACTYPESFIXED_TARGET static inline __m256i
+MacTypesFixedMultiply8(__m256i a, __m256i b, int shift)
+{
+	__m128i round = _mm_cvtsi32_si128(shift);
+	__m256i half = _mm256_set1_epi64x((int64_t)1 << (shift - 1));
+	__m256i even = _mm256_add_epi64(_mm256_mul_epi32(a, b), half);
+	__m256i odd = _mm256_add_epi64(_mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32)), half);
+	__m256i product = _mm256_blend_epi32(_mm256_srl_epi64(even, round),
+										 _mm256_slli_epi64(_mm256_srl_epi64(odd, round), 32), 0xAA);
+	__m256i high = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+
+	/* The product fits if its bits from 31 + shift up are all the same. */
+	__m256i fits = _mm256_cmpeq_epi32(_mm256_sra_epi32(high, _mm_cvtsi32_si128(shift - 1)),
+									  _mm256_srai_epi32(product, 31));
+	__m256i saturated = _mm256_xor_si256(_mm256_set1_epi32(INT32_MAX), _mm256_srai_epi32(high, 31));
+
+	return _mm256_blendv_epi8(saturated, product, fits);
+}
+
+/* Returns floor((a * scale) / b + 1/2) for four pairs, saturated, as FixedDivide() does. */
+MACTYPESFIXED_TARGET static inline __m128i
+MacTypesFixedDivide4(__m128i a, __m128i b, double scale)
+{
+	__m256d zero = _mm256_setzero_pd();
+	__m256d one = _mm256_set1_pd(1.0);
+	__m256d divisor = _mm256_cvtepi32_pd(b);
+	__m256d sign = _mm256_and_pd(_mm256_cmp_pd(divisor, zero, _CMP_LT_OQ), _mm256_set1_pd(-0.0));
+	__m256d twiceDividend = _mm256_xor_pd(_mm256_mul_pd(_mm256_cvtepi32_pd(a), _mm256_set1_pd(2.0 * scale)), sign);
+	__m256d twiceQuotient;
+	__m256d quotient;
+	__m256d below;
+	__m256d above;
+	__m128i result;
+
+	divisor = _mm256_xor_pd(divisor, sign);
+	twiceQuotient = _mm256_div_pd(twiceDividend, divisor);
+	quotient = _mm256_floor_pd(_mm256_mul_pd(_mm256_add_pd(twiceQuotient, one), _mm256_set1_pd(0.5)));
+
+	/* quotient is right if (2q - 1) d <= 2n < (2q + 1) d. */
+	below = _mm256_fnmadd_pd(_mm256_fmsub_pd(quotient, _mm256_set1_pd(2.0), one), divisor, twiceDividend);
+	above = _mm256_fnmadd_pd(_mm256_fmadd_pd(quotient, _mm256_set1_pd(2.0), one), divisor, twiceDividend);
+	quotient = _mm256_sub_pd(quotient, _mm256_and_pd(_mm256_cmp_pd(below, zero, _CMP_LT_OQ), one));
+	quotient = _mm256_add_pd(quotient, _mm256_and_pd(_mm256_cmp_pd(above, zero, _CMP_GE_OQ), one));
+	quotient = _mm256_min_pd(_mm256_max_pd(quotient, _mm256_set1_pd(INT32_MIN)), _mm256_set1_pd(INT32_MAX));
+	result = _mm256_cvttpd_epi32(quotient);
+
+	return _mm_blendv_epi8(result, _mm_xor_si128(_mm_set1_epi32(INT32_MAX), _mm_srai_epi32(a, 31)),
+						   _mm_cmpeq_epi32(b, _mm_setzero_si128()));
+}
+
+/* Rounds four scaled values half up, saturated, as FixedFromDouble() does. */
+MACTYPESFIXED_TARGET static inline __m128i
+MacTypesFixedRound4(__m256d value)
+{
+	__m256d floored;
+	__m256d rounded;
+
+	value = _mm256_and_pd(value, _mm256_cmp_pd(value, value, _CMP_ORD_Q));     /* NaN gives 0 */
+	floored = _mm256_floor_pd(value);
+	rounded = _mm256_add_pd(floored, _mm256_and_pd(_mm256_cmp_pd(_mm256_sub_pd(value, floored), _mm256_set1_pd(0.5),
+															   _CMP_GE_OQ), _mm256_set1_pd(1.0)));
+	rounded = _mm256_min_pd(_mm256_max_pd(rounded, _mm256_set1_pd(INT32_MIN)), _mm256_set1_pd(INT32_MAX));
+	return _mm256_cvttpd_epi32(rounded);
+}
+
+/* Rounds eight scaled values half up, saturated, as FixedFromFloat() does. */
+MACTYPESFIXED_TARGET static inline __m256i
+MacTypesFixedRound8(__m256 value)
+{
+	__m256 floored;
+	__m256 rounded;
+
+	value = _mm256_and_ps(value, _mm256_cmp_ps(value, value, _CMP_ORD_Q));
+	floored = _mm256_floor_ps(value);
+	rounded = _mm256_add_ps(floored, _mm256_and_ps(_mm256_cmp_ps(_mm256_sub_ps(value, floored), _mm256_set1_ps(0.5f),
+															   _CMP_GE_OQ), _mm256_set1_ps(1.0f)));
+
+	/* cvttps gives INT32_MIN for anything out of range, which is only right below it. */
+	return _mm256_blendv_epi8(_mm256_cvttps_epi32(rounded), _mm256_set1_epi32(INT32_MAX),
+							  _mm256_castps_si256(_mm256_cmp_ps(rounded, _mm256_set1_ps(2147483648.0f), _CMP_GE_OQ)));
+}
+
+/* Returns value, or the end of the range towards sign where overflow is negative. */
+MACTYPESFIXED_TARGET static inline __m256i
+MacTypesFixedSaturate8(__m256i value, __m256i sign, __m256i overflow)
+{
+	return _mm256_blendv_epi8(value, _mm256_xor_si256(_mm256_set1_epi32(INT32_MAX), _mm256_srai_epi32(sign, 31)),
+							  _mm256_srai_epi32(overflow, 31));
+}
+
+MACTYPESFIXED_TARGET static void
+FixedMultiplyArrayAVX2(const Fixed *a, const Fixed *b, Fixed *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 8 <= count; i += 8 )
+		_mm256_storeu_si256((__m256i *)&result[i],
+							MacTypesFixedMultiply8(_mm256_loadu_si256((const __m256i *)&a[i]),
+												   _mm256_loadu_si256((const __m256i *)&b[i]), 16));
+	FixedMultiplyArrayScalar(&a[i], &b[i], &result[i], count - i);
+}
+
+MACTYPESFIXED_TARGET static void
+FractMultiplyArrayAVX2(const Fract *a, const Fract *b, Fract *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 8 <= count; i += 8 )
+		_mm256_storeu_si256((__m256i *)&result[i],
+							MacTypesFixedMultiply8(_mm256_loadu_si256((const __m256i *)&a[i]),
+												   _mm256_loadu_si256((const __m256i *)&b[i]), 30));
+	FractMultiplyArrayScalar(&a[i], &b[i], &result[i], count - i);
+}
+
+MACTYPESFIXED_TARGET static void
+FixedDivideArrayAVX2(const Fixed *a, const Fixed *b, Fixed *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 4 <= count; i += 4 )
+		_mm_storeu_si128((__m128i *)&result[i],
+						 MacTypesFixedDivide4(_mm_loadu_si128((const __m128i *)&a[i]),
+											  _mm_loadu_si128((const __m128i *)&b[i]), 65536.0));
+	FixedDivideArrayScalar(&a[i], &b[i], &result[i], count - i);
+}
+
+MACTYPESFIXED_TARGET static void
+FractDivideArrayAVX2(const Fract *a, const Fract *b, Fract *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 4 <= count; i += 4 )
+		_mm_storeu_si128((__m128i *)&result[i],
+						 MacTypesFixedDivide4(_mm_loadu_si128((const __m128i *)&a[i]),
+											  _mm_loadu_si128((const __m128i *)&b[i]), 1073741824.0));
+	FractDivideArrayScalar(&a[i], &b[i], &result[i], count - i);
+}
+
+MACTYPESFIXED_TARGET static void
+FixedAddArrayAVX2(const Fixed *a, const Fixed *b, Fixed *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 8 <= count; i += 8 )
+	{
+		__m256i x = _mm256_loadu_si256((const __m256i *)&a[i]);
+		__m256i y = _mm256_loadu_si256((const __m256i *)&b[i]);
+		__m256i sum = _mm256_add_epi32(x, y);
+
+		_mm256_storeu_si256((__m256i *)&result[i],
+							MacTypesFixedSaturate8(sum, x, _mm256_and_si256(_mm256_xor_si256(x, sum),
+																			_mm256_xor_si256(y, sum))));
+	}
+	FixedAddArrayScalar(&a[i], &b[i], &result[i], count - i);
+}
+
+MACTYPESFIXED_TARGET static void
+FixedSubtractArrayAVX2(const Fixed *a, const Fixed *b, Fixed *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 8 <= count; i += 8 )
+	{
+		__m256i x = _mm256_loadu_si256((const __m256i *)&a[i]);
+		__m256i y = _mm256_loadu_si256((const __m256i *)&b[i]);
+		__m256i difference = _mm256_sub_epi32(x, y);
+
+		_mm256_storeu_si256((__m256i *)&result[i],
+							MacTypesFixedSaturate8(difference, x, _mm256_and_si256(_mm256_xor_si256(x, y),
+																				   _mm256_xor_si256(x, difference))));
+	}
+	FixedSubtractArrayScalar(&a[i], &b[i], &result[i], count - i);
+}
+
+MACTYPESFIXED_TARGET static void
+DoubleFromFixedArrayAVX2(const Fixed *a, double *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 4 <= count; i += 4 )
+		_mm256_storeu_pd(&result[i], _mm256_mul_pd(_mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i *)&a[i])),
+												   _mm256_set1_pd(1.0 / 65536.0)));
+	DoubleFromFixedArrayScalar(&a[i], &result[i], count - i);
+}
+
+MACTYPESFIXED_TARGET static void
+FixedFromDoubleArrayAVX2(const double *a, Fixed *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 4 <= count; i += 4 )
+		_mm_storeu_si128((__m128i *)&result[i],
+						 MacTypesFixedRound4(_mm256_mul_pd(_mm256_loadu_pd(&a[i]), _mm256_set1_pd(65536.0))));
+	FixedFromDoubleArrayScalar(&a[i], &result[i], count - i);
+}
+
+MACTYPESFIXED_TARGET static void
+FloatFromFixedArrayAVX2(const Fixed *a, float *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 8 <= count; i += 8 )
+		_mm256_storeu_ps(&result[i], _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i *)&a[i])),
+												   _mm256_set1_ps(1.0f / 65536.0f)));
+	FloatFromFixedArrayScalar(&a[i], &result[i], count - i);
+}
+
+MACTYPESFIXED_TARGET static void
+FixedFromFloatArrayAVX2(const float *a, Fixed *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 8 <= count; i += 8 )
+		_mm256_storeu_si256((__m256i *)&result[i],
+							MacTypesFixedRound8(_mm256_mul_ps(_mm256_loadu_ps(&a[i]), _mm256_set1_ps(65536.0f))));
+	FixedFromFloatArrayScalar(&a[i], &result[i], count - i);
+}
+
+MACTYPESFIXED_TARGET static void
+DoubleFromFractArrayAVX2(const Fract *a, double *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 4 <= count; i += 4 )
+		_mm256_storeu_pd(&result[i], _mm256_mul_pd(_mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i *)&a[i])),
+												   _mm256_set1_pd(1.0 / 1073741824.0)));
+	DoubleFromFractArrayScalar(&a[i], &result[i], count - i);
+}
+
+MACTYPESFIXED_TARGET static void
+FractFromDoubleArrayAVX2(const double *a, Fract *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 4 <= count; i += 4 )
+		_mm_storeu_si128((__m128i *)&result[i],
+						 MacTypesFixedRound4(_mm256_mul_pd(_mm256_loadu_pd(&a[i]), _mm256_set1_pd(1073741824.0))));
+	FractFromDoubleArrayScalar(&a[i], &result[i], count - i);
+}
+
+#endif /* MACTYPESFIXED_AVX2 */
+
+#if MACTYPESFIXED_NEON
+
+/* Returns floor((a * scale) / b + 1/2) for two pairs, saturated, as FixedDivide() does. */
+static inline int32x2_t
+MacTypesFixedDivide2(int32x2_t a, int32x2_t b, double scale)
+{
+	float64x2_t one = vdupq_n_f64(1.0);
+	float64x2_t divisor = vcvtq_f64_s64(vmovl_s32(b));
+	float64x2_t twiceDividend = vmulq_n_f64(vcvtq_f64_s64(vmovl_s32(a)), 2.0 * scale);
+	uint64x2_t  negative = vcltzq_f64(divisor);
+	float64x2_t quotient;
+	float64x2_t below;
+	float64x2_t above;
+	int32x2_t   result;
+
+	twiceDividend = vbslq_f64(negative, vnegq_f64(twiceDividend), twiceDividend);
+	divisor = vabsq_f64(divisor);
+	quotient = vrndmq_f64(vaddq_f64(vdivq_f64(twiceDividend, vaddq_f64(divisor, divisor)), vdupq_n_f64(0.5)));
+
+	/* quotient is right if (2q - 1) d <= 2n < (2q + 1) d. */
+	below = vfmsq_f64(twiceDividend, vsubq_f64(vaddq_f64(quotient, quotient), one), divisor);
+	above = vfmsq_f64(twiceDividend, vaddq_f64(vaddq_f64(quotient, quotient), one), divisor);
+	quotient = vsubq_f64(quotient, vreinterpretq_f64_u64(vandq_u64(vcltzq_f64(below), vreinterpretq_u64_f64(one))));
+	quotient = vaddq_f64(quotient, vreinterpretq_f64_u64(vandq_u64(vcgezq_f64(above), vreinterpretq_u64_f64(one))));
+	result = vqmovn_s64(vcvtq_s64_f64(quotient));
+
+	return vbsl_s32(vceqz_s32(b), veor_s32(vdup_n_s32(INT32_MAX), vshr_n_s32(a, 31)), result);
+}
+
+/* Rounds two scaled values half up, saturated, as FixedFromDouble() does. */
+static inline int32x2_t
+MacTypesFixedRound2(float64x2_t value)
+{
+	float64x2_t floored = vrndmq_f64(value);
+	uint64x2_t  up = vcgeq_f64(vsubq_f64(value, floored), vdupq_n_f64(0.5));
+
+	/* The conversions saturate, and give 0 for NaN. */
+	return vqmovn_s64(vcvtq_s64_f64(vaddq_f64(floored, vreinterpretq_f64_u64(vandq_u64(up,
+										vreinterpretq_u64_f64(vdupq_n_f64(1.0))))))));
+}
+
+static void
+FixedMultiplyArrayNEON(const Fixed *a, const Fixed *b, Fixed *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 4 <= count; i += 4 )
+	{
+		int32x4_t x = vld1q_s32(&a[i]);
+		int32x4_t y = vld1q_s32(&b[i]);
+
+		vst1q_s32(&result[i], vcombine_s32(vqrshrn_n_s64(vmull_s32(vget_low_s32(x), vget_low_s32(y)), 16),
+										   vqrshrn_n_s64(vmull_high_s32(x, y), 16)));
+	}
+	FixedMultiplyArrayScalar(&a[i], &b[i], &result[i], count - i);
+}
+
+static void
+FractMultiplyArrayNEON(const Fract *a, const Fract *b, Fract *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 4 <= count; i += 4 )
+	{
+		int32x4_t x = vld1q_s32(&a[i]);
+		int32x4_t y = vld1q_s32(&b[i]);
+
+		vst1q_s32(&result[i], vcombine_s32(vqrshrn_n_s64(vmull_s32(vget_low_s32(x), vget_low_s32(y)), 30),
+										   vqrshrn_n_s64(vmull_high_s32(x, y), 30)));
+	}
+	FractMultiplyArrayScalar(&a[i], &b[i], &result[i], count - i);
+}
+
+static void
+FixedDivideArrayNEON(const Fixed *a, const Fixed *b, Fixed *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 2 <= count; i += 2 )
+		vst1_s32(&result[i], MacTypesFixedDivide2(vld1_s32(&a[i]), vld1_s32(&b[i]), 65536.0));
+	FixedDivideArrayScalar(&a[i], &b[i], &result[i], count - i);
+}
+
+static void
+FractDivideArrayNEON(const Fract *a, const Fract *b, Fract *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 2 <= count; i += 2 )
+		vst1_s32(&result[i], MacTypesFixedDivide2(vld1_s32(&a[i]), vld1_s32(&b[i]), 1073741824.0));
+	FractDivideArrayScalar(&a[i], &b[i], &result[i], count - i);
+}
+
+static void
+FixedAddArrayNEON(const Fixed *a, const Fixed *b, Fixed *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 4 <= count; i += 4 )
+		vst1q_s32(&result[i], vqaddq_s32(vld1q_s32(&a[i]), vld1q_s32(&b[i])));
+	FixedAddArrayScalar(&a[i], &b[i], &result[i], count - i);
+}
+
+static void
+FixedSubtractArrayNEON(const Fixed *a, const Fixed *b, Fixed *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 4 <= count; i += 4 )
+		vst1q_s32(&result[i], vqsubq_s32(vld1q_s32(&a[i]), vld1q_s32(&b[i])));
+	FixedSubtractArrayScalar(&a[i], &b[i], &result[i], count - i);
+}
+
+static void
+DoubleFromFixedArrayNEON(const Fixed *a, double *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 2 <= count; i += 2 )
+		vst1q_f64(&result[i], vmulq_n_f64(vcvtq_f64_s64(vmovl_s32(vld1_s32(&a[i]))), 1.0 / 65536.0));
+	DoubleFromFixedArrayScalar(&a[i], &result[i], count - i);
+}
+
+static void
+FixedFromDoubleArrayNEON(const double *a, Fixed *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 2 <= count; i += 2 )
+		vst1_s32(&result[i], MacTypesFixedRound2(vmulq_n_f64(vld1q_f64(&a[i]), 65536.0)));
+	FixedFromDoubleArrayScalar(&a[i], &result[i], count - i);
+}
+
+static void
+FloatFromFixedArrayNEON(const Fixed *a, float *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 4 <= count; i += 4 )
+		vst1q_f32(&result[i], vmulq_n_f32(vcvtq_f32_s32(vld1q_s32(&a[i])), 1.0f / 65536.0f));
+	FloatFromFixedArrayScalar(&a[i], &result[i], count - i);
+}
+
+static void
+FixedFromFloatArrayNEON(const float *a, Fixed *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 4 <= count; i += 4 )
+	{
+		float32x4_t value = vmulq_n_f32(vld1q_f32(&a[i]), 65536.0f);
+		float32x4_t floored = vrndmq_f32(value);
+		uint32x4_t  up = vcgeq_f32(vsubq_f32(value, floored), vdupq_n_f32(0.5f));
+
+		vst1q_s32(&result[i], vcvtq_s32_f32(vaddq_f32(floored, vreinterpretq_f32_u32(vandq_u32(up,
+												vreinterpretq_u32_f32(vdupq_n_f32(1.0f)))))));
+	}
+	FixedFromFloatArrayScalar(&a[i], &result[i], count - i);
+}
+
+static void
+DoubleFromFractArrayNEON(const Fract *a, double *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 2 <= count; i += 2 )
+		vst1q_f64(&result[i], vmulq_n_f64(vcvtq_f64_s64(vmovl_s32(vld1_s32(&a[i]))), 1.0 / 1073741824.0));
+	DoubleFromFractArrayScalar(&a[i], &result[i], count - i);
+}
+
+static void
+FractFromDoubleArrayNEON(const double *a, Fract *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 2 <= count; i += 2 )
+		vst1_s32(&result[i], MacTypesFixedRound2(vmulq_n_f64(vld1q_f64(&a[i]), 1073741824.0)));
+	FractFromDoubleArrayScalar(&a[i], &result[i], count - i);
+}
+
+#endif /* MACTYPESFIXED_NEON */
+
+MACTYPESFIXED_ARRAY(FixedMultiplyArray, (const Fixed *a, const Fixed *b, Fixed *result, size_t count), (a, b, result, count))
+MACTYPESFIXED_ARRAY(FractMultiplyArray, (const Fract *a, const Fract *b, Fract *result, size_t count), (a, b, result, count))
+MACTYPESFIXED_ARRAY(FixedDivideArray, (const Fixed *a, const Fixed *b, Fixed *result, size_t count), (a, b, result, count))
+MACTYPESFIXED_ARRAY(FractDivideArray, (const Fract *a, const Fract *b, Fract *result, size_t count), (a, b, result, count))
+MACTYPESFIXED_ARRAY(FixedAddArray, (const Fixed *a, const Fixed *b, Fixed *result, size_t count), (a, b, result, count))
+MACTYPESFIXED_ARRAY(FixedSubtractArray, (const Fixed *a, const Fixed *b, Fixed *result, size_t count), (a, b, result, count))
+MACTYPESFIXED_ARRAY(DoubleFromFixedArray, (const Fixed *a, double *result, size_t count), (a, result, count))
+MACTYPESFIXED_ARRAY(FixedFromDoubleArray, (const double *a, Fixed *result, size_t count), (a, result, count))
+MACTYPESFIXED_ARRAY(FloatFromFixedArray, (const Fixed *a, float *result, size_t count), (a, result, count))
+MACTYPESFIXED_ARRAY(FixedFromFloatArray, (const float *a, Fixed *result, size_t count), (a, result, count))
+MACTYPESFIXED_ARRAY(DoubleFromFractArray, (const Fract *a, double *result, size_t count), (a, result, count))
+MACTYPESFIXED_ARRAY(FractFromDoubleArray, (const double *a, Fract *result, size_t count), (a, result, count))
@@ -0,0 +1,438 @@
+/*
+     File:       MacTypesFixedMath.c
+
+     Contains:   Square root, sine, cosine, arctangent and exponential on the MacTypes.h
+                 fixed point types.
+
+                 Sine and cosine reduce x / 65536 radians by the nearest multiple k of
+                 pi / 2, with pi / 2 split in three so that the first two products are
+                 exact, then by the nearest multiple i of pi / 256, to d of at most pi / 512.
+                 sin and cos of i pi / 256 come from the tables, and those of d from
+                 their Taylor polynomials to d^5 and d^4; the quadrant, k & 3, picks and
+                 negates one of the two.
+
+                 Arctangent divides the smaller of |x| and |y| by the larger, takes the
+                 nearest multiple c of 1/64 to the quotient t, and adds atan(c) from the
+                 table to atan((t - c) / (1 + tc)), whose argument is at most 1/128, by
+                 its polynomial to z^5; the octant is then restored.
+
+                 Exponential clamps x to the range where e^x neither rounds to 0 nor
+                 saturates, and splits it in integer arithmetic into i / 64 + r, with |r|
+                 at most 1 / 128 and exact; it multiplies e^(i / 64), from the table, by
+                 the polynomial of e^r to r^5, and rounds the positive result by adding
+                 a half and truncating.
+
+                 Square root is exact in integer arithmetic: the double square root,
+                 truncated, is the integer square root or one more (it is correctly
+                 rounded, so never below an integer below the exact root), which is
+                 corrected and then rounded by comparing the remainder, without branches.
+
+                 Exponential and square root have no branches but the clamp, and the
+                 rounding of a result known to be positive, or an integer, needs none
+                 of FixedFromDouble()'s.  Sine, cosine and arctangent are no faster
+                 than the C library (see MacTypesFixedMath.h): each is one long chain
+                 of dependent double operations, ending in FixedFromDouble().
+
+                 The vector versions perform the same double operations in the same
+                 order; this file must be compiled with -ffp-contract=off (see the
+                 Makefile) so that the compiler does not fuse any of them differently.
+                 The tables are generated by tools/MacTypesFixedMathTables.py.
+
+*/
+#ifdef __clang__
+#pragma STDC FP_CONTRACT OFF
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "MacTypesFixed.h"
+#include "MacTypesFixedMath.h"
+#include "TargetCPUFeatures.h"
+#include "MacTypesFixedMathTables.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+	#include <immintrin.h>
+
+	#define MACTYPESFIXEDMATH_AVX2      1
+	#define MACTYPESFIXEDMATH_TARGET    __attribute__((target("avx2")))
+
+	#define MACTYPESFIXEDMATH_ARRAY(name, parameters, arguments) \
+		TARGET_CPU_DISPATCH(void, name, parameters, arguments, \
+			(features & kTargetCPUFeatureAVX2) ? name##AVX2 : name##Scalar)
+#else
+	#define MACTYPESFIXEDMATH_ARRAY(name, parameters, arguments) \
+		void name parameters { name##Scalar arguments; }
+#endif
+
+/* The polynomial coefficients. */
+static const double kMacTypesFixedSin3 = -1.0 / 6.0;
+static const double kMacTypesFixedSin5 = 1.0 / 120.0;
+static const double kMacTypesFixedCos2 = -1.0 / 2.0;
+static const double kMacTypesFixedCos4 = 1.0 / 24.0;
+static const double kMacTypesFixedATan3 = -1.0 / 3.0;
+static const double kMacTypesFixedATan5 = 1.0 / 5.0;
+static const double kMacTypesFixedExp2 = 1.0 / 2.0;
+static const double kMacTypesFixedExp3 = 1.0 / 6.0;
+static const double kMacTypesFixedExp4 = 1.0 / 24.0;
+static const double kMacTypesFixedExp5 = 1.0 / 120.0;
+
+/* Below -12, e^x rounds to 0; above 10.5, it saturates.  gMacTypesFixedExpTable[0] is e^-12. */
+#define kMacTypesFixedExpMinimum    (-12 * 65536)
+#define kMacTypesFixedExpMaximum    (21 * 32768)
+#define kMacTypesFixedExpTableFirst (-12 * 64)
+
+/* Returns value rounded to the nearest integer, halves away from zero. */
+static inline int32_t
+MacTypesFixedNearest(double value)
+{
+	return (int32_t)(value + __builtin_copysign(0.5, value));
+}
+
+/* Returns x / 65536 radians less the nearest multiple of pi / 2, and sets quadrant. */
+static inline double
+MacTypesFixedReduce(Fixed x, int32_t *quadrant)
+{
+	double  radians = (double)x * (1.0 / 65536.0);
+	int32_t k = MacTypesFixedNearest(radians * kMacTypesFixedTwoOverPi);
+	double  multiple = (double)k;
+
+	*quadrant = k & 3;
+	return ((radians - multiple * kMacTypesFixedHalfPi1) - multiple * kMacTypesFixedHalfPi2) -
+		   multiple * kMacTypesFixedHalfPi3;
+}
+
+/* Sets sine and cosine to those of r, from -pi / 4 to pi / 4 or a little beyond. */
+static inline void
+MacTypesFixedSinCos(double r, double *sine, double *cosine)
+{
+	int32_t i = MacTypesFixedNearest(r * kMacTypesFixedTableStepsPerRadian);
+	double  step = (double)i;
+	double  d = (r - step * kMacTypesFixedTableStep1) - step * kMacTypesFixedTableStep2;
+	double  d2 = d * d;
+	double  sinD = d + d * d2 * (kMacTypesFixedSin3 + d2 * kMacTypesFixedSin5);
+	double  cosDLessOne = d2 * (kMacTypesFixedCos2 + d2 * kMacTypesFixedCos4);
+	double  s = gMacTypesFixedSinTable[i + 64];
+	double  c = gMacTypesFixedCosTable[i + 64];
+
+	*sine = s + (s * cosDLessOne + c * sinD);
+	*cosine = c + (c * cosDLessOne - s * sinD);
+}
+
+Fract
+FractSin(Fixed x)
+{
+	int32_t quadrant;
+	double  sine;
+	double  cosine;
+	double  value;
+
+	MacTypesFixedSinCos(MacTypesFixedReduce(x, &quadrant), &sine, &cosine);
+	value = (quadrant & 1) ? cosine : sine;
+	if ( quadrant & 2 )
+		value = -value;
+	return FractFromDouble(value);
+}
+
+Fract
+FractCos(Fixed x)
+{
+	int32_t quadrant;
+	double  sine;
+	double  cosine;
+	double  value;
+
+	MacTypesFixedSinCos(MacTypesFixedReduce(x, &quadrant), &sine, &cosine);
+	value = (quadrant & 1) ? sine : cosine;
+	if ( (quadrant + 1) & 2 )
+		value = -value;
+	return FractFromDouble(value);
+}
+
+Fixed
+FixedATan2(SInt32 x, SInt32 y)
+{
+	double  absoluteX = x < 0 ? -(double)x : (double)x;
+	double  absoluteY = y < 0 ? -(double)y : (double)y;
+	int     steep = absoluteY > absoluteX;
+	double  numerator = steep ? absoluteX : absoluteY;
+	double  denominator = steep ? absoluteY : absoluteX;
+	double  t;
+	double  c;
+	double  z;
+	double  z2;
+	double  angle;
+	int32_t i;
+
+	if ( denominator == 0 )
+		return 0;
+	t = numerator / denominator;
+	i = (int32_t)(t * 64.0 + 0.5);
+	c = (double)i * (1.0 / 64.0);
+	z = (t - c) / (1.0 + t * c);
+	z2 = z * z;
+	angle = gMacTypesFixedATanTable[i] + (z + z * z2 * (kMacTypesFixedATan3 + z2 * kMacTypesFixedATan5));
+	if ( steep )
+		angle = kMacTypesFixedHalfPi - angle;
+	if ( x < 0 )
+		angle = kMacTypesFixedPi - angle;
+	if ( y < 0 )
+		angle = -angle;
+	return FixedFromDouble(angle);
+}
+
+Fixed
+FixedExp(Fixed x)
+{
+	int32_t clamped = x < kMacTypesFixedExpMinimum ? kMacTypesFixedExpMinimum :
+					  x > kMacTypesFixedExpMaximum ? kMacTypesFixedExpMaximum : x;
+	int32_t i = (clamped + 512) >> 10;
+	double  r = (double)(clamped - i * 1024) * (1.0 / 65536.0);
+	double  p = r + r * r * (kMacTypesFixedExp2 + r * (kMacTypesFixedExp3 + r * (kMacTypesFixedExp4 + r * kMacTypesFixedExp5)));
+	double  power = gMacTypesFixedExpTable[i - kMacTypesFixedExpTableFirst];
+	double  rounded = (power + power * p) * 65536.0 + 0.5;
+
+	/* rounded is positive, and exact since it is below 2^52. */
+	return (Fixed)(rounded < (double)INT32_MAX ? rounded : (double)INT32_MAX);
+}
+
+Fract
+FractSqrt(Fract x)
+{
+	uint64_t    square = (uint64_t)(uint32_t)x << 30;
+	uint64_t    root = (uint64_t)(int64_t)__builtin_sqrt((double)(uint32_t)x * 1073741824.0);
+
+	root -= root * root > square;
+	root += square - root * root > root;
+	return (Fract)(uint32_t)root;
+}
+
+#define MACTYPESFIXEDMATH_SCALAR_UNARY(name, from, to, function) \
+	static void \
+	name##Scalar(const from *x, to *result, size_t count) \
+	{ \
+		size_t i; \
+		\
+		for ( i = 0; i < count; ++i ) \
+			result[i] = function(x[i]); \
+	}
+
+MACTYPESFIXEDMATH_SCALAR_UNARY(FractSqrtArray, Fract, Fract, FractSqrt)
+MACTYPESFIXEDMATH_SCALAR_UNARY(FractSinArray, Fixed, Fract, FractSin)
+MACTYPESFIXEDMATH_SCALAR_UNARY(FractCosArray, Fixed, Fract, FractCos)
+MACTYPESFIXEDMATH_SCALAR_UNARY(FixedExpArray, Fixed, Fixed, FixedExp)
+
+static void
+FixedATan2ArrayScalar(const SInt32 *x, const SInt32 *y, Fixed *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i < count; ++i )
+		result[i] = FixedATan2(x[i], y[i]);
+}
+
+#if MACTYPESFIXEDMATH_AVX2
+
+/* MacTypesFixedNearest() of four values. */
+MACTYPESFIXEDMATH_TARGET static inline __m128i
+MacTypesFixedNearest4(__m256d value)
+{
+	__m256d half = _mm256_or_pd(_mm256_and_pd(value, _mm256_set1_pd(-0.0)), _mm256_set1_pd(0.5));
+
+	return _mm256_cvttpd_epi32(_mm256_add_pd(value, half));
+}
+
+/* FixedFromDouble() of four values already multiplied by their scale. */
+MACTYPESFIXEDMATH_TARGET static inline __m128i
+MacTypesFixedRound4(__m256d value)
+{
+	__m256d floored;
+	__m256d rounded;
+
+	value = _mm256_and_pd(value, _mm256_cmp_pd(value, value, _CMP_ORD_Q));
+	floored = _mm256_floor_pd(value);
+	rounded = _mm256_add_pd(floored, _mm256_and_pd(_mm256_cmp_pd(_mm256_sub_pd(value, floored), _mm256_set1_pd(0.5),
+																 _CMP_GE_OQ), _mm256_set1_pd(1.0)));
+	rounded = _mm256_min_pd(_mm256_max_pd(rounded, _mm256_set1_pd(INT32_MIN)), _mm256_set1_pd(INT32_MAX));
+	return _mm256_cvttpd_epi32(rounded);
+}
+
+/* A mask of 32 bit lanes widened to the 64 bit lanes of a double vector. */
+MACTYPESFIXEDMATH_TARGET static inline __m256d
+MacTypesFixedWiden4(__m128i mask)
+{
+	return _mm256_castsi256_pd(_mm256_cvtepi32_epi64(mask));
+}
+
+/* MacTypesFixedReduce() and MacTypesFixedSinCos() of four values. */
+MACTYPESFIXEDMATH_TARGET static inline void
+MacTypesFixedSinCos4(__m128i x, __m256d *sine, __m256d *cosine, __m128i *quadrant)
+{
+	__m256d radians = _mm256_mul_pd(_mm256_cvtepi32_pd(x), _mm256_set1_pd(1.0 / 65536.0));
+	__m128i k = MacTypesFixedNearest4(_mm256_mul_pd(radians, _mm256_set1_pd(kMacTypesFixedTwoOverPi)));
+	__m256d multiple = _mm256_cvtepi32_pd(k);
+	__m256d r = _mm256_sub_pd(_mm256_sub_pd(_mm256_sub_pd(radians, _mm256_mul_pd(multiple, _mm256_set1_pd(kMacTypesFixedHalfPi1))),
+											_mm256_mul_pd(multiple, _mm256_set1_pd(kMacTypesFixedHalfPi2))),
+							  _mm256_mul_pd(multiple, _mm256_set1_pd(kMacTypesFixedHalfPi3)));
+	__m128i i = MacTypesFixedNearest4(_mm256_mul_pd(r, _mm256_set1_pd(kMacTypesFixedTableStepsPerRadian)));
+	__m256d step = _mm256_cvtepi32_pd(i);
+	__m256d d = _mm256_sub_pd(_mm256_sub_pd(r, _mm256_mul_pd(step, _mm256_set1_pd(kMacTypesFixedTableStep1))),
+							  _mm256_mul_pd(step, _mm256_set1_pd(kMacTypesFixedTableStep2)));
+	__m256d d2 = _mm256_mul_pd(d, d);
+	__m256d sinD = _mm256_add_pd(d, _mm256_mul_pd(_mm256_mul_pd(d, d2),
+												  _mm256_add_pd(_mm256_set1_pd(kMacTypesFixedSin3),
+																_mm256_mul_pd(d2, _mm256_set1_pd(kMacTypesFixedSin5)))));
+	__m256d cosDLessOne = _mm256_mul_pd(d2, _mm256_add_pd(_mm256_set1_pd(kMacTypesFixedCos2),
+														  _mm256_mul_pd(d2, _mm256_set1_pd(kMacTypesFixedCos4))));
+	__m256d s = _mm256_i32gather_pd(&gMacTypesFixedSinTable[64], i, 8);
+	__m256d c = _mm256_i32gather_pd(&gMacTypesFixedCosTable[64], i, 8);
+
+	*sine = _mm256_add_pd(s, _mm256_add_pd(_mm256_mul_pd(s, cosDLessOne), _mm256_mul_pd(c, sinD)));
+	*cosine = _mm256_add_pd(c, _mm256_sub_pd(_mm256_mul_pd(c, cosDLessOne), _mm256_mul_pd(s, sinD)));
+	*quadrant = _mm_and_si128(k, _mm_set1_epi32(3));
+}
+
+MACTYPESFIXEDMATH_TARGET static void
+FractSinArrayAVX2(const Fixed *x, Fract *result, size_t count)
+{
+	__m256d sign = _mm256_set1_pd(-0.0);
+	size_t  i;
+
+	for ( i = 0; i + 4 <= count; i += 4 )
+	{
+		__m256d sine;
+		__m256d cosine;
+		__m128i quadrant;
+		__m256d value;
+
+		MacTypesFixedSinCos4(_mm_loadu_si128((const __m128i *)&x[i]), &sine, &cosine, &quadrant);
+		value = _mm256_blendv_pd(sine, cosine, MacTypesFixedWiden4(_mm_slli_epi32(quadrant, 31)));
+		value = _mm256_xor_pd(value, _mm256_and_pd(sign, MacTypesFixedWiden4(_mm_slli_epi32(quadrant, 30))));
+		_mm_storeu_si128((__m128i *)&result[i], MacTypesFixedRound4(_mm256_mul_pd(value, _mm256_set1_pd(1073741824.0))));
+	}
+	FractSinArrayScalar(&x[i], &result[i], count - i);
+}
+
+MACTYPESFIXEDMATH_TARGET static void
+FractCosArrayAVX2(const Fixed *x, Fract *result, size_t count)
+{
+	__m256d sign = _mm256_set1_pd(-0.0);
+	size_t  i;
+
+	for ( i = 0; i + 4 <= count; i += 4 )
+	{
+		__m256d sine;
+		__m256d cosine;
+		__m128i quadrant;
+		__m256d value;
+
+		MacTypesFixedSinCos4(_mm_loadu_si128((const __m128i *)&x[i]), &sine, &cosine, &quadrant);
+		value = _mm256_blendv_pd(cosine, sine, MacTypesFixedWiden4(_mm_slli_epi32(quadrant, 31)));
+		quadrant = _mm_add_epi32(quadrant, _mm_set1_epi32(1));
+		value = _mm256_xor_pd(value, _mm256_and_pd(sign, MacTypesFixedWiden4(_mm_slli_epi32(quadrant, 30))));
+		_mm_storeu_si128((__m128i *)&result[i], MacTypesFixedRound4(_mm256_mul_pd(value, _mm256_set1_pd(1073741824.0))));
+	}
+	FractCosArrayScalar(&x[i], &result[i], count - i);
+}
+
+MACTYPESFIXEDMATH_TARGET static void
+FixedATan2ArrayAVX2(const SInt32 *x, const SInt32 *y, Fixed *result, size_t count)
+{
+	__m256d sign = _mm256_set1_pd(-0.0);
+	size_t  i;
+
+	for ( i = 0; i + 4 <= count; i += 4 )
+	{
+		__m128i xs = _mm_loadu_si128((const __m128i *)&x[i]);
+		__m128i ys = _mm_loadu_si128((const __m128i *)&y[i]);
+		__m256d absoluteX = _mm256_andnot_pd(sign, _mm256_cvtepi32_pd(xs));
+		__m256d absoluteY = _mm256_andnot_pd(sign, _mm256_cvtepi32_pd(ys));
+		__m256d steep = _mm256_cmp_pd(absoluteY, absoluteX, _CMP_GT_OQ);
+		__m256d numerator = _mm256_blendv_pd(absoluteY, absoluteX, steep);
+		__m256d denominator = _mm256_blendv_pd(absoluteX, absoluteY, steep);
+		__m256d t;
+		__m128i index;
+		__m256d c;
+		__m256d z;
+		__m256d z2;
+		__m256d angle;
+
+		/* (0, 0) takes the path of (1, 0), to 0, rather than dividing by 0. */
+		denominator = _mm256_max_pd(denominator, _mm256_set1_pd(1.0));
+		t = _mm256_div_pd(numerator, denominator);
+		index = _mm256_cvttpd_epi32(_mm256_add_pd(_mm256_mul_pd(t, _mm256_set1_pd(64.0)), _mm256_set1_pd(0.5)));
+		c = _mm256_mul_pd(_mm256_cvtepi32_pd(index), _mm256_set1_pd(1.0 / 64.0));
+		z = _mm256_div_pd(_mm256_sub_pd(t, c), _mm256_add_pd(_mm256_set1_pd(1.0), _mm256_mul_pd(t, c)));
+		z2 = _mm256_mul_pd(z, z);
+		angle = _mm256_add_pd(_mm256_i32gather_pd(gMacTypesFixedATanTable, index, 8),
+							  _mm256_add_pd(z, _mm256_mul_pd(_mm256_mul_pd(z, z2),
+															 _mm256_add_pd(_mm256_set1_pd(kMacTypesFixedATan3),
+																		   _mm256_mul_pd(z2, _mm256_set1_pd(kMacTypesFixedATan5))))));
+		angle = _mm256_blendv_pd(angle, _mm256_sub_pd(_mm256_set1_pd(kMacTypesFixedHalfPi), angle), steep);
+		angle = _mm256_blendv_pd(angle, _mm256_sub_pd(_mm256_set1_pd(kMacTypesFixedPi), angle), MacTypesFixedWiden4(xs));
+		angle = _mm256_xor_pd(angle, _mm256_and_pd(sign, MacTypesFixedWiden4(ys)));
+		_mm_storeu_si128((__m128i *)&result[i], MacTypesFixedRound4(_mm256_mul_pd(angle, _mm256_set1_pd(65536.0))));
+	}
+	FixedATan2ArrayScalar(&x[i], &y[i], &result[i], count - i);
+}
+
+MACTYPESFIXEDMATH_TARGET static void
+FixedExpArrayAVX2(const Fixed *x, Fixed *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 4 <= count; i += 4 )
+	{
+		__m128i xs = _mm_loadu_si128((const __m128i *)&x[i]);
+		__m128i clamped = _mm_min_epi32(_mm_max_epi32(xs, _mm_set1_epi32(kMacTypesFixedExpMinimum)),
+										_mm_set1_epi32(kMacTypesFixedExpMaximum));
+		__m128i n = _mm_srai_epi32(_mm_add_epi32(clamped, _mm_set1_epi32(512)), 10);
+		__m256d r = _mm256_mul_pd(_mm256_cvtepi32_pd(_mm_sub_epi32(clamped, _mm_slli_epi32(n, 10))),
+								  _mm256_set1_pd(1.0 / 65536.0));
+		__m256d p = _mm256_add_pd(_mm256_mul_pd(r, _mm256_set1_pd(kMacTypesFixedExp5)), _mm256_set1_pd(kMacTypesFixedExp4));
+		__m256d power;
+		__m256d rounded;
+
+		p = _mm256_add_pd(_mm256_set1_pd(kMacTypesFixedExp3), _mm256_mul_pd(r, p));
+		p = _mm256_add_pd(_mm256_set1_pd(kMacTypesFixedExp2), _mm256_mul_pd(r, p));
+		p = _mm256_add_pd(r, _mm256_mul_pd(_mm256_mul_pd(r, r), p));
+		power = _mm256_i32gather_pd(gMacTypesFixedExpTable, _mm_sub_epi32(n, _mm_set1_epi32(kMacTypesFixedExpTableFirst)), 8);
+		rounded = _mm256_add_pd(_mm256_mul_pd(_mm256_add_pd(power, _mm256_mul_pd(power, p)), _mm256_set1_pd(65536.0)),
+								_mm256_set1_pd(0.5));
+		_mm_storeu_si128((__m128i *)&result[i],
+						 _mm256_cvttpd_epi32(_mm256_min_pd(rounded, _mm256_set1_pd((double)INT32_MAX))));
+	}
+	FixedExpArrayScalar(&x[i], &result[i], count - i);
+}
+
+MACTYPESFIXEDMATH_TARGET static void
+FractSqrtArrayAVX2(const Fract *x, Fract *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i + 4 <= count; i += 4 )
+	{
+		__m128i xs = _mm_loadu_si128((const __m128i *)&x[i]);
+		__m256d value = _mm256_add_pd(_mm256_cvtepi32_pd(_mm_xor_si128(xs, _mm_set1_epi32(INT32_MIN))),
+									  _mm256_set1_pd(2147483648.0));
+		__m256i square = _mm256_slli_epi64(_mm256_cvtepu32_epi64(xs), 30);
+		__m256i root = _mm256_cvtepu32_epi64(_mm256_cvttpd_epi32(_mm256_sqrt_pd(_mm256_mul_pd(value,
+																							   _mm256_set1_pd(1073741824.0)))));
+
+		/* The squares are below 2^63, so the signed comparisons serve. */
+		root = _mm256_add_epi64(root, _mm256_cmpgt_epi64(_mm256_mul_epu32(root, root), square));
+		root = _mm256_sub_epi64(root, _mm256_cmpgt_epi64(_mm256_sub_epi64(square, _mm256_mul_epu32(root, root)), root));
+		_mm_storeu_si128((__m128i *)&result[i],
+						 _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(root, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6))));
+	}
+	FractSqrtArrayScalar(&x[i], &result[i], count - i);
+}
+
+#endif /* MACTYPESFIXEDMATH_AVX2 */
+
+MACTYPESFIXEDMATH_ARRAY(FractSqrtArray, (const Fract *x, Fract *result, size_t count), (x, result, count))
+MACTYPESFIXEDMATH_ARRAY(FractSinArray, (const Fixed *x, Fract *result, size_t count), (x, result, count))
+MACTYPESFIXEDMATH_ARRAY(FractCosArray, (const Fixed *x, Fract *result, size_t count), (x, result, count))
+MACTYPESFIXEDMATH_ARRAY(FixedATan2Array, (const SInt32 *x, const SInt32 *y, Fixed *result, size_t count),
+						(x, y, result, count))
+MACTYPESFIXEDMATH_ARRAY(FixedExpArray, (const Fixed *x, Fixed *result, size_t count), (x, result, count))
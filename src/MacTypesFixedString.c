@@ -0,0 +1,497 @@
+/*
+     File:       MacTypesFixedString.c
+
+     Contains:   Decimal strings of the MacTypes.h fixed point types.
+
+                 A value with f fraction bits is written with at most d decimals, the
+                 least d with 10^d > 2^f: 5 for Fixed, 10 for Fract, 3 for ShortFixed.
+                 In units of 10^-d, the magnitude m is then m 5^d / 2^(f - d), and the
+                 decimals that read back as it lie strictly within 10^d / 2^(f + 1) of
+                 that, a range wider than 1; its ends are never reached, since they need
+                 f + 1 decimals.  The nearest multiple of 10, 100... in the range, tried
+                 until there is none, is the shortest decimal.  Everything stays below
+                 2^56, so it is exact in 64 bits.
+
+                 Reading keeps the integer part, up to a bound past which every type
+                 saturates, and the first 36 decimals of the fraction in four limbs of 9
+                 digits, base 10^9.  Multiplying the limbs by 2^(f + 1) carries the
+                 fraction's first f + 1 bits out of the top one, and leaves the rest in
+                 them: enough to round half up exactly.  A decimal beyond the 36th can
+                 only make what is left nonzero, never change a bit carried out, since a
+                 fraction of 36 decimals times 2^(f + 1) falls short of the next integer
+                 by at least 2^(f + 1) / 10^36.  A decimal of at most 19 digits and 13
+                 decimals (f + 1 for ShortFixed), the common case, is read instead into
+                 one integer, eight digits at a time, and its fraction divided exactly
+                 by a constant.  The usual decimal, a whole string of at most 7 digits
+                 and 7 decimals, is read first: the integer from its first eight
+                 characters and the fraction from its last eight, apart, with no loop;
+                 any other falls back to the general reading.
+
+*/
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "MacTypesFixedString.h"
+
+#define kMacTypesFixedLimbs         4
+#define kMacTypesFixedLimbDigits    9
+#define kMacTypesFixedLimbBase      1000000000
+#define kMacTypesFixedShortDigits   19
+#define kMacTypesFixedShortDecimals 13
+
+static const uint64_t gMacTypesFixedPowersOfTen[] = {
+	1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+	1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL
+};
+
+/* Writes count digits of value, or more if it has them, backwards from end; returns the first. */
+static inline char *
+MacTypesFixedWriteDigits(char *end, uint64_t value, int count)
+{
+	do
+	{
+		*--end = (char)('0' + value % 10);
+		value /= 10;
+	} while ( --count > 0 || value != 0 );
+	return end;
+}
+
+/* Writes magnitude / 2^fractionBits, negated if negative, with at most decimals decimals. */
+static size_t
+MacTypesFixedFormat(int negative, uint64_t magnitude, unsigned fractionBits, unsigned decimals,
+					char *buffer, size_t bufferSize)
+{
+	char        text[kMacTypesFixedStringSize];
+	char        *end = text + sizeof(text);
+	char        *start = end;
+	uint64_t    five = gMacTypesFixedPowersOfTen[decimals] >> decimals;
+	unsigned    shift = fractionBits - decimals;
+	uint64_t    twiceExact = 2 * magnitude * five;
+	uint64_t    nearest = 0;
+	unsigned    dropped = decimals;
+	size_t      length;
+
+	if ( magnitude != 0 )
+	{
+		uint64_t    low = (((2 * magnitude - 1) * five) >> (shift + 1)) + 1;
+		uint64_t    high = ((2 * magnitude + 1) * five) >> (shift + 1);
+
+		nearest = (twiceExact + ((uint64_t)1 << shift)) >> (shift + 1);
+		for ( dropped = 0; dropped < decimals; ++dropped )
+		{
+			uint64_t    unit = gMacTypesFixedPowersOfTen[dropped + 1];
+			uint64_t    candidate = (twiceExact + (unit << shift)) / (unit << (shift + 1)) * unit;
+
+			if ( candidate < low || candidate > high )
+				break;
+			nearest = candidate;
+		}
+	}
+
+	if ( dropped < decimals )
+	{
+		uint64_t fraction = nearest % gMacTypesFixedPowersOfTen[decimals] / gMacTypesFixedPowersOfTen[dropped];
+
+		start = MacTypesFixedWriteDigits(start, fraction, (int)(decimals - dropped));
+		*--start = '.';
+	}
+	start = MacTypesFixedWriteDigits(start, nearest / gMacTypesFixedPowersOfTen[decimals], 1);
+	if ( negative && nearest != 0 )
+		*--start = '-';
+
+	length = (size_t)(end - start);
+	if ( bufferSize != 0 )
+	{
+		size_t copied = length < bufferSize ? length : bufferSize - 1;
+
+		memcpy(buffer, start, copied);
+		buffer[copied] = '\0';
+	}
+	return length;
+}
+
+/*
+ *  The eight characters at string + i, the first in the low byte, zeros past length;
+ *  i is below length.  Nothing past the string is read, and, little-endian, no loop.
+ */
+static inline uint64_t
+MacTypesFixedLoad(const char *string, size_t i, size_t length)
+{
+	uint64_t    word = 0;
+	size_t      k;
+
+#if TARGET_RT_LITTLE_ENDIAN
+	size_t      n = length - i;
+	uint32_t    low;
+	uint32_t    high;
+
+	if ( i + 8 <= length )
+	{
+		memcpy(&word, string + i, 8);
+		return word;
+	}
+	if ( length >= 8 )
+	{
+		memcpy(&word, string + length - 8, 8);
+		return word >> 8 * (8 - n);
+	}
+	if ( n >= 4 )
+	{
+		memcpy(&low, string + i, 4);
+		memcpy(&high, string + length - 4, 4);
+		return low | (uint64_t)high << 8 * (n - 4);
+	}
+	return (uint64_t)(unsigned char)string[i] | (uint64_t)(unsigned char)string[i + n / 2] << 8 * (n / 2)
+		   | (uint64_t)(unsigned char)string[length - 1] << 8 * (n - 1);
+#endif
+	for ( k = 0; k < 8 && i + k < length; ++k )
+		word |= (uint64_t)(unsigned char)string[i + k] << 8 * k;
+	return word;
+}
+
+/* The high bit of each byte of word, less '0' in each byte, that is not a digit. */
+static inline uint64_t
+MacTypesFixedNonDigits(uint64_t word)
+{
+	return (((word & 0x7F7F7F7F7F7F7F7FULL) + 0x7676767676767676ULL) | word) & 0x8080808080808080ULL;
+}
+
+/* The number of digits that word, less '0' in each byte, starts with. */
+static inline unsigned
+MacTypesFixedDigitCount(uint64_t word)
+{
+	uint64_t other = MacTypesFixedNonDigits(word);
+
+	return other != 0 ? (unsigned)__builtin_ctzll(other) / 8 : 8;
+}
+
+/* The value of the first count digits of word, less '0' in each byte; count is 1 to 8. */
+static inline uint64_t
+MacTypesFixedDigitsValue(uint64_t word, unsigned count)
+{
+	/* The digits, leading zeros in place of the rest, combined pairwise. */
+	word <<= 8 * (8 - count);
+	word = word * 10 + (word >> 8);
+	return (((word & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32)))
+			+ (((word >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+}
+
+/*
+ *  Reads the digits at string + i, eight at a time, into significand, which is
+ *  meaningless past 19 of them; adds their number to digits and returns where they end.
+ */
+static inline size_t
+MacTypesFixedScanDigits(const char *string, size_t i, size_t length, uint64_t *significand, long *digits)
+{
+	while ( i < length )
+	{
+		uint64_t    word = MacTypesFixedLoad(string, i, length) ^ 0x3030303030303030ULL;
+		unsigned    count = MacTypesFixedDigitCount(word);
+
+		if ( count == 0 )
+			break;
+
+		*significand = *significand * gMacTypesFixedPowersOfTen[count] + MacTypesFixedDigitsValue(word, count);
+		*digits += (long)count;
+		i += count;
+		if ( count < 8 )
+			break;
+	}
+	return i;
+}
+
+/*
+ *  Returns magnitude, negated if negative, clamped; minimum is at most 0 and maximum at
+ *  least 0.  The magnitude is clamped first, and negated without a branch on the sign.
+ */
+static inline int64_t
+MacTypesFixedClamp(int negative, uint64_t magnitude, int64_t minimum, int64_t maximum)
+{
+	uint64_t limit = negative ? 0 - (uint64_t)minimum : (uint64_t)maximum;
+
+	if ( magnitude > limit )
+		magnitude = limit;
+	return (int64_t)(magnitude ^ (0 - (uint64_t)negative)) + negative;
+}
+
+/*
+ *  Reads a decimal as a multiple of 2^-fractionBits, rounded half up and clamped.  It
+ *  is inlined into each caller, for its constant fractionBits to divide by.
+ */
+static inline __attribute__((always_inline)) size_t
+MacTypesFixedParse(const char *string, size_t length, unsigned fractionBits, int64_t minimum, int64_t maximum,
+				   int64_t *value)
+{
+	uint32_t    limbs[kMacTypesFixedLimbs] = { 0, 0, 0, 0 };
+	uint64_t    significand = 0;
+	uint64_t    whole = 0;
+	uint64_t    integer = 0;
+	uint64_t    bound = (uint64_t)1 << (40 - fractionBits);
+	uint64_t    carry = 0;
+	uint64_t    magnitude;
+	size_t      i = 0;
+	size_t      mantissa;
+	size_t      end;
+	long        digits = 0;
+	long        integerDigits = -1;
+	long        exponent = 0;
+	long        decimals;
+	long        shortDecimals = fractionBits + 1 < kMacTypesFixedShortDecimals ? fractionBits + 1 : kMacTypesFixedShortDecimals;
+	long        k;
+	int         negative = 0;
+	int         inexact = 0;
+
+	if ( i < length && (string[i] == '+' || string[i] == '-') )
+		negative = string[i++] == '-';
+	mantissa = i;
+	i = MacTypesFixedScanDigits(string, i, length, &significand, &digits);
+	if ( i < length && string[i] == '.' )
+	{
+		integerDigits = digits;
+		whole = significand;
+		i = MacTypesFixedScanDigits(string, i + 1, length, &significand, &digits);
+	}
+	if ( digits == 0 )
+		return 0;
+	end = i;
+	if ( integerDigits < 0 )
+	{
+		integerDigits = digits;
+		whole = significand;
+	}
+
+	if ( i + 1 < length && (string[i] == 'e' || string[i] == 'E') )
+	{
+		size_t  j = i + 1;
+		int     exponentNegative = 0;
+
+		if ( string[j] == '+' || string[j] == '-' )
+			exponentNegative = string[j++] == '-';
+		if ( j < length && (unsigned char)(string[j] - '0') < 10 )
+		{
+			for ( ; j < length && (unsigned char)(string[j] - '0') < 10; ++j )
+				if ( exponent < 100000 )
+					exponent = exponent * 10 + (string[j] - '0');
+			integerDigits += exponentNegative ? -exponent : exponent;
+			i = j;
+		}
+	}
+
+	decimals = digits - integerDigits;
+	if ( digits <= kMacTypesFixedShortDigits && decimals >= 0 && decimals <= shortDecimals )
+	{
+		/*
+		 *  All the digits fit in significand.  The fraction, widened to shortDecimals
+		 *  decimals, is divided by 10^shortDecimals = 2^shortDecimals 5^shortDecimals,
+		 *  a constant.
+		 */
+		uint64_t    scale = gMacTypesFixedPowersOfTen[decimals];
+		uint64_t    five = gMacTypesFixedPowersOfTen[shortDecimals] >> shortDecimals;
+		uint64_t    fraction;
+
+		if ( exponent == 0 )
+		{
+			integer = whole;
+			fraction = significand - whole * scale;
+		}
+		else
+		{
+			integer = significand / scale;
+			fraction = significand % scale;
+		}
+		if ( integer > bound )
+			integer = bound;
+		fraction = fraction * gMacTypesFixedPowersOfTen[shortDecimals - decimals] << (fractionBits + 1 - shortDecimals);
+		carry = fraction / five;
+		inexact = fraction % five != 0;
+	}
+	else
+	{
+		/* The integer part, until it is past saturating, then the fraction's limbs. */
+		for ( k = 0; mantissa < end; ++mantissa )
+		{
+			unsigned    digit = (unsigned)(string[mantissa] - '0');
+			long        place = k - integerDigits;
+
+			if ( string[mantissa] == '.' )
+				continue;
+			++k;
+			if ( place < 0 )
+			{
+				if ( integer < bound )
+					integer = integer * 10 + digit;
+			}
+			else if ( place < kMacTypesFixedLimbs * kMacTypesFixedLimbDigits )
+				limbs[place / kMacTypesFixedLimbDigits] +=
+					digit * (uint32_t)gMacTypesFixedPowersOfTen[kMacTypesFixedLimbDigits - 1 - place % kMacTypesFixedLimbDigits];
+			else
+				inexact |= digit != 0;
+		}
+		for ( ; k < integerDigits && integer != 0 && integer < bound; ++k )
+			integer *= 10;
+
+		for ( k = kMacTypesFixedLimbs - 1; k >= 0; --k )
+		{
+			uint64_t product = ((uint64_t)limbs[k] << (fractionBits + 1)) + carry;
+
+			limbs[k] = (uint32_t)(product % kMacTypesFixedLimbBase);
+			carry = product / kMacTypesFixedLimbBase;
+			inexact |= limbs[k] != 0;
+		}
+	}
+
+	/* carry is floor(2^(fractionBits + 1) fraction); halves round towards +infinity. */
+	magnitude = (integer << fractionBits) + (negative ? (carry + (uint64_t)inexact) >> 1 : (carry + 1) >> 1);
+	*value = MacTypesFixedClamp(negative, magnitude, minimum, maximum);
+	return i;
+}
+
+/*
+ *  MacTypesFixedParse() of the usual decimal, the whole string: an optional sign, up to
+ *  7 digits, and a point and up to 7 more.  Returns 0 for any other, to be read by
+ *  MacTypesFixedParse().  The integer is read from the first eight characters and the
+ *  fraction from the last eight, so that neither waits for the other; parses of
+ *  successive strings then overlap.  The shape is checked with branches, which are
+ *  predicted, and the value is computed without any.
+ */
+static inline __attribute__((always_inline)) size_t
+MacTypesFixedParseShort(const char *string, size_t length, unsigned fractionBits, int64_t minimum, int64_t maximum,
+						int64_t *value)
+{
+	uint64_t    five = gMacTypesFixedPowersOfTen[8] >> 8;
+	uint64_t    head;
+	uint64_t    tail;
+	uint64_t    headOther;
+	uint64_t    tailOther;
+	uint64_t    integer;
+	uint64_t    fraction;
+	unsigned    first;
+	unsigned    last;
+	unsigned    count;
+	unsigned    fractionCount;
+	size_t      i;
+	size_t      end;
+	int         negative;
+
+	if ( length == 0 )
+		return 0;
+	head = MacTypesFixedLoad(string, 0, length);
+	tail = length >= 8 ? MacTypesFixedLoad(string, length - 8, length) : head << 8 * (8 - length);
+	negative = (head & 0xFF) == '-';
+	i = (size_t)(negative | ((head & 0xFF) == '+'));
+	head = (head >> 8 * i) ^ 0x3030303030303030ULL;
+	tail ^= 0x3030303030303030ULL;
+
+	/* The high bits of the first non-digit of head and the last of tail; 8 digits are too many. */
+	headOther = MacTypesFixedNonDigits(head);
+	tailOther = MacTypesFixedNonDigits(tail);
+	if ( headOther == 0 || tailOther == 0 )
+		return 0;
+	first = (unsigned)__builtin_ctzll(headOther);
+	last = 63 - (unsigned)__builtin_clzll(tailOther);
+	count = first / 8;
+	fractionCount = 7 - last / 8;
+	end = i + count;
+	if ( end == length )
+		last = 63;
+	else if ( string[end] != '.' || end + 1 + fractionCount != length )
+		return 0;
+	if ( count + fractionCount == 0 )
+		return 0;
+
+	/*
+	 *  The integer's digits are shifted to the top of head, and the fraction's to the
+	 *  bottom of tail, as 8 decimals.  In units of 2^-(fractionBits + 1) the fraction is
+	 *  then fraction / five, with five = 5^8; halves round up, or down if negative, with
+	 *  one division by 2 five.
+	 */
+	integer = MacTypesFixedDigitsValue(head << 8 << (63 - first), 8);
+	fraction = MacTypesFixedDigitsValue(tail >> last >> 1, 8) << (fractionBits + 1 - 8);
+	*value = MacTypesFixedClamp(negative, (integer << fractionBits) + (fraction + five - (uint64_t)negative) / (2 * five),
+								minimum, maximum);
+	return length;
+}
+
+size_t
+StringFromFixed(Fixed value, char *buffer, size_t bufferSize)
+{
+	return MacTypesFixedFormat(value < 0, value < 0 ? (uint64_t)-(int64_t)value : (uint64_t)value, 16, 5,
+							   buffer, bufferSize);
+}
+
+size_t
+StringFromUnsignedFixed(UnsignedFixed value, char *buffer, size_t bufferSize)
+{
+	return MacTypesFixedFormat(0, value, 16, 5, buffer, bufferSize);
+}
+
+size_t
+StringFromFract(Fract value, char *buffer, size_t bufferSize)
+{
+	return MacTypesFixedFormat(value < 0, value < 0 ? (uint64_t)-(int64_t)value : (uint64_t)value, 30, 10,
+							   buffer, bufferSize);
+}
+
+size_t
+StringFromShortFixed(ShortFixed value, char *buffer, size_t bufferSize)
+{
+	return MacTypesFixedFormat(value < 0, value < 0 ? (uint64_t)-(int64_t)value : (uint64_t)value, 8, 3,
+							   buffer, bufferSize);
+}
+
+size_t
+FixedFromString(const char *string, size_t length, Fixed *value)
+{
+	int64_t result = 0;
+	size_t  read = MacTypesFixedParseShort(string, length, 16, INT32_MIN, INT32_MAX, &result);
+
+	if ( __builtin_expect(read == 0, 0) )
+		read = MacTypesFixedParse(string, length, 16, INT32_MIN, INT32_MAX, &result);
+
+	if ( read != 0 )
+		*value = (Fixed)result;
+	return read;
+}
+
+size_t
+UnsignedFixedFromString(const char *string, size_t length, UnsignedFixed *value)
+{
+	int64_t result = 0;
+	size_t  read = MacTypesFixedParseShort(string, length, 16, 0, UINT32_MAX, &result);
+
+	if ( __builtin_expect(read == 0, 0) )
+		read = MacTypesFixedParse(string, length, 16, 0, UINT32_MAX, &result);
+
+	if ( read != 0 )
+		*value = (UnsignedFixed)result;
+	return read;
+}
+
+size_t
+FractFromString(const char *string, size_t length, Fract *value)
+{
+	int64_t result = 0;
+	size_t  read = MacTypesFixedParseShort(string, length, 30, INT32_MIN, INT32_MAX, &result);
+
+	if ( __builtin_expect(read == 0, 0) )
+		read = MacTypesFixedParse(string, length, 30, INT32_MIN, INT32_MAX, &result);
+
+	if ( read != 0 )
+		*value = (Fract)result;
+	return read;
+}
+
+size_t
+ShortFixedFromString(const char *string, size_t length, ShortFixed *value)
+{
+	int64_t result = 0;
+	size_t  read = MacTypesFixedParseShort(string, length, 8, INT16_MIN, INT16_MAX, &result);
+
+	if ( __builtin_expect(read == 0, 0) )
+		read = MacTypesFixedParse(string, length, 8, INT16_MIN, INT16_MAX, &result);
+
+	if ( read != 0 )
+		*value = (ShortFixed)result;
+	return read;
+}
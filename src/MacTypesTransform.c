@@ -0,0 +1,237 @@
+/*
+     File:       MacTypesTransform.c
+
+     Contains:   The MacTypesTransform.h array functions, and Float32MatrixTransformPoint().
+
+                 Each has a scalar loop and an AVX2 version that gives the same results
+                 bit for bit and finishes with the scalar loop.  The vector versions
+                 never deinterleave their arguments:
+
+                   - Four FixedPoints fill a vector as four 64 bit lanes of (x, y).
+                     vpmuldq multiplies the low halves, the x, and after a 32 bit
+                     shift the y; each lane then holds x' and y' in 64 bits, which are
+                     merged back into one lane.  A block of points where some result
+                     saturates is done again by the scalar loop.
+
+                   - Two FixedRects are two pairs of lanes, (left, top) and (right,
+                     bottom).  Each pair is ordered, then each coefficient multiplies
+                     it, or it swapped where the coefficient is negative, so that the
+                     first lane of the pair gets the least product and the second the
+                     greatest: they become (left', top') and (right', bottom').
+
+                   - Four Float32Points are multiplied, lane by lane, by (a, b, a, b...)
+                     with each x duplicated into its y lane, and by (c, d, c, d...) with
+                     each y duplicated into its x lane.
+
+                 The float operations must not be fused, so this file is compiled with
+                 -ffp-contract=off (see the Makefile).
+
+*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include "MacTypesFixed.h"
+#include "MacTypesTransform.h"
+#include "TargetCPUFeatures.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+	#include <immintrin.h>
+
+	#define MACTYPESTRANSFORM_AVX2      1
+	#define MACTYPESTRANSFORM_TARGET    __attribute__((target("avx2")))
+
+	#define MACTYPESTRANSFORM_ARRAY(name, parameters, arguments) \
+		TARGET_CPU_DISPATCH(void, name, parameters, arguments, \
+			(features & kTargetCPUFeatureAVX2) ? name##AVX2 : name##Scalar)
+#else
+	#define MACTYPESTRANSFORM_ARRAY(name, parameters, arguments) \
+		void name parameters { name##Scalar arguments; }
+#endif
+
+Float32Point
+Float32MatrixTransformPoint(const Float32Matrix *matrix, Float32Point point)
+{
+	Float32Point    result;
+
+	result.x = (point.x * matrix->matrix[0][0] + point.y * matrix->matrix[1][0]) + matrix->matrix[2][0];
+	result.y = (point.x * matrix->matrix[0][1] + point.y * matrix->matrix[1][1]) + matrix->matrix[2][1];
+	return result;
+}
+
+static void
+FixedMatrixTransformPointsScalar(const FixedMatrix *matrix, const FixedPoint *source, FixedPoint *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i < count; ++i )
+		result[i] = FixedMatrixTransformPoint(matrix, source[i]);
+}
+
+static void
+FixedMatrixTransformRectsScalar(const FixedMatrix *matrix, const FixedRect *source, FixedRect *result, size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i < count; ++i )
+		result[i] = FixedMatrixTransformRect(matrix, source[i]);
+}
+
+static void
+Float32MatrixTransformPointsScalar(const Float32Matrix *matrix, const Float32Point *source, Float32Point *result,
+								   size_t count)
+{
+	size_t i;
+
+	for ( i = 0; i < count; ++i )
+		result[i] = Float32MatrixTransformPoint(matrix, source[i]);
+}
+
+#if MACTYPESTRANSFORM_AVX2
+
+/*
+ *  2^15 times translation, plus 2^14, less 2^63: the rest of the halved sum formed by
+ *  MacTypesTransformHalfSum().
+ */
+MACTYPESTRANSFORM_TARGET static inline __m256i
+MacTypesTransformBias(Fixed translation)
+{
+	return _mm256_set1_epi64x((int64_t)((uint64_t)(int64_t)translation * 0x8000 + 0x4000 - 0x8000000000000000ULL));
+}
+
+/*
+ *  The halved sum of __FixedMatrixRound() in each lane.  AVX2 has no arithmetic
+ *  shift of 64 bit lanes, but (p ^ 2^63) shifted logically is p >> 1 plus 2^62; bias
+ *  takes the two 2^62 off again, modulo 2^64.
+ */
+MACTYPESTRANSFORM_TARGET static inline __m256i
+MacTypesTransformHalfSum(__m256i first, __m256i second, __m256i bias)
+{
+	__m256i sign = _mm256_set1_epi64x(INT64_MIN);
+	__m256i half = _mm256_add_epi64(_mm256_srli_epi64(_mm256_xor_si256(first, sign), 1),
+									_mm256_srli_epi64(_mm256_xor_si256(second, sign), 1));
+
+	half = _mm256_add_epi64(half, _mm256_and_si256(_mm256_and_si256(first, second), _mm256_set1_epi64x(1)));
+	return _mm256_add_epi64(half, bias);
+}
+
+/*
+ *  Stores lanes of (x, y) rounded from halved sums, unless one would saturate, which
+ *  is rare enough to be left to the scalar functions; returns whether it stored them.
+ *  A halved sum rounds into range when it is from -2^46 to 2^46 - 1.
+ */
+MACTYPESTRANSFORM_TARGET static inline int
+MacTypesTransformStore(void *result, __m256i x, __m256i y)
+{
+	__m256i offset = _mm256_set1_epi64x(1LL << 46);
+	__m256i biased = _mm256_or_si256(_mm256_add_epi64(x, offset), _mm256_add_epi64(y, offset));
+
+	if ( !_mm256_testz_si256(biased, _mm256_set1_epi64x(-(1LL << 47))) )
+		return 0;
+	_mm256_storeu_si256((__m256i *)result, _mm256_blend_epi32(_mm256_srli_epi64(x, 15), _mm256_slli_epi64(y, 17), 0xAA));
+	return 1;
+}
+
+MACTYPESTRANSFORM_TARGET static void
+FixedMatrixTransformPointsAVX2(const FixedMatrix *matrix, const FixedPoint *source, FixedPoint *result, size_t count)
+{
+	__m256i a = _mm256_set1_epi64x(matrix->matrix[0][0]);
+	__m256i b = _mm256_set1_epi64x(matrix->matrix[0][1]);
+	__m256i c = _mm256_set1_epi64x(matrix->matrix[1][0]);
+	__m256i d = _mm256_set1_epi64x(matrix->matrix[1][1]);
+	__m256i tx = MacTypesTransformBias(matrix->matrix[2][0]);
+	__m256i ty = MacTypesTransformBias(matrix->matrix[2][1]);
+	size_t  i;
+
+	for ( i = 0; i + 4 <= count; i += 4 )
+	{
+		__m256i points = _mm256_loadu_si256((const __m256i *)&source[i]);
+		__m256i ys = _mm256_srli_epi64(points, 32);
+		__m256i x = MacTypesTransformHalfSum(_mm256_mul_epi32(points, a), _mm256_mul_epi32(ys, c), tx);
+		__m256i y = MacTypesTransformHalfSum(_mm256_mul_epi32(points, b), _mm256_mul_epi32(ys, d), ty);
+
+		if ( !MacTypesTransformStore(&result[i], x, y) )
+			FixedMatrixTransformPointsScalar(matrix, &source[i], &result[i], 4);
+	}
+	FixedMatrixTransformPointsScalar(matrix, &source[i], &result[i], count - i);
+}
+
+/* A mask of all ones when coefficient is negative, to reverse the sides it multiplies. */
+MACTYPESTRANSFORM_TARGET static inline __m256i
+MacTypesTransformReverse(Fixed coefficient)
+{
+	return _mm256_set1_epi64x(coefficient < 0 ? -1 : 0);
+}
+
+MACTYPESTRANSFORM_TARGET static void
+FixedMatrixTransformRectsAVX2(const FixedMatrix *matrix, const FixedRect *source, FixedRect *result, size_t count)
+{
+	__m256i a = _mm256_set1_epi64x(matrix->matrix[0][0]);
+	__m256i b = _mm256_set1_epi64x(matrix->matrix[0][1]);
+	__m256i c = _mm256_set1_epi64x(matrix->matrix[1][0]);
+	__m256i d = _mm256_set1_epi64x(matrix->matrix[1][1]);
+	__m256i reverseA = MacTypesTransformReverse(matrix->matrix[0][0]);
+	__m256i reverseB = MacTypesTransformReverse(matrix->matrix[0][1]);
+	__m256i reverseC = MacTypesTransformReverse(matrix->matrix[1][0]);
+	__m256i reverseD = MacTypesTransformReverse(matrix->matrix[1][1]);
+	__m256i tx = MacTypesTransformBias(matrix->matrix[2][0]);
+	__m256i ty = MacTypesTransformBias(matrix->matrix[2][1]);
+	size_t  i;
+
+	for ( i = 0; i + 2 <= count; i += 2 )
+	{
+		/*
+		 *  Each rect is a lane of (left, top) and one of (right, bottom).  Ordered, they
+		 *  are (min x, min y) and (max x, max y); a coefficient's product is least with
+		 *  the least side when it is positive, and with the greatest when it is negative.
+		 */
+		__m256i rects = _mm256_loadu_si256((const __m256i *)&source[i]);
+		__m256i swapped = _mm256_shuffle_epi32(rects, _MM_SHUFFLE(1, 0, 3, 2));
+		__m256i ordered = _mm256_blend_epi32(_mm256_min_epi32(rects, swapped), _mm256_max_epi32(rects, swapped), 0xCC);
+		__m256i reversed = _mm256_shuffle_epi32(ordered, _MM_SHUFFLE(1, 0, 3, 2));
+		__m256i ys = _mm256_srli_epi64(ordered, 32);
+		__m256i reversedYs = _mm256_srli_epi64(reversed, 32);
+		__m256i x = MacTypesTransformHalfSum(_mm256_mul_epi32(_mm256_blendv_epi8(ordered, reversed, reverseA), a),
+											 _mm256_mul_epi32(_mm256_blendv_epi8(ys, reversedYs, reverseC), c), tx);
+		__m256i y = MacTypesTransformHalfSum(_mm256_mul_epi32(_mm256_blendv_epi8(ordered, reversed, reverseB), b),
+											 _mm256_mul_epi32(_mm256_blendv_epi8(ys, reversedYs, reverseD), d), ty);
+
+		if ( !MacTypesTransformStore(&result[i], x, y) )
+			FixedMatrixTransformRectsScalar(matrix, &source[i], &result[i], 2);
+	}
+	FixedMatrixTransformRectsScalar(matrix, &source[i], &result[i], count - i);
+}
+
+MACTYPESTRANSFORM_TARGET static void
+Float32MatrixTransformPointsAVX2(const Float32Matrix *matrix, const Float32Point *source, Float32Point *result,
+								 size_t count)
+{
+	__m256  ab = _mm256_setr_ps(matrix->matrix[0][0], matrix->matrix[0][1], matrix->matrix[0][0], matrix->matrix[0][1],
+								matrix->matrix[0][0], matrix->matrix[0][1], matrix->matrix[0][0], matrix->matrix[0][1]);
+	__m256  cd = _mm256_setr_ps(matrix->matrix[1][0], matrix->matrix[1][1], matrix->matrix[1][0], matrix->matrix[1][1],
+								matrix->matrix[1][0], matrix->matrix[1][1], matrix->matrix[1][0], matrix->matrix[1][1]);
+	__m256  t = _mm256_setr_ps(matrix->matrix[2][0], matrix->matrix[2][1], matrix->matrix[2][0], matrix->matrix[2][1],
+							   matrix->matrix[2][0], matrix->matrix[2][1], matrix->matrix[2][0], matrix->matrix[2][1]);
+	size_t  i;
+
+	for ( i = 0; i + 4 <= count; i += 4 )
+	{
+		__m256  points = _mm256_loadu_ps(&source[i].x);
+		__m256  products = _mm256_add_ps(_mm256_mul_ps(_mm256_moveldup_ps(points), ab),
+										 _mm256_mul_ps(_mm256_movehdup_ps(points), cd));
+
+		_mm256_storeu_ps(&result[i].x, _mm256_add_ps(products, t));
+	}
+	Float32MatrixTransformPointsScalar(matrix, &source[i], &result[i], count - i);
+}
+
+#endif /* MACTYPESTRANSFORM_AVX2 */
+
+MACTYPESTRANSFORM_ARRAY(FixedMatrixTransformPoints,
+						(const FixedMatrix *matrix, const FixedPoint *source, FixedPoint *result, size_t count),
+						(matrix, source, result, count))
+MACTYPESTRANSFORM_ARRAY(FixedMatrixTransformRects,
+						(const FixedMatrix *matrix, const FixedRect *source, FixedRect *result, size_t count),
+						(matrix, source, result, count))
+MACTYPESTRANSFORM_ARRAY(Float32MatrixTransformPoints,
+						(const Float32Matrix *matrix, const Float32Point *source, Float32Point *result, size_t count),
+						(matrix, source, result, count))
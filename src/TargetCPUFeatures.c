@@ -0,0 +1,221 @@
+/*
+     File:       TargetCPUFeatures.c
+
+     Contains:   Probing of the instruction set extensions of the running processor.
+
+                 An extension counts only if the operating system supports it too: on x86
+                 the AVX and AVX-512 registers must be enabled in XCR0 (Darwin enables the
+                 AVX-512 ones on first use, so there hw.optional.avx512f is asked instead),
+                 and on ARM the kernel reports what it supports in the auxiliary vector or
+                 in sysctl.
+
+                 The probe is run by a constructor as the library is loaded, and by
+                 GetTargetCPUFeatures() if that is called first, under pthread_once().
+
+*/
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+	#include <cpuid.h>
+#endif
+#if defined(__APPLE__)
+	#include <sys/sysctl.h>
+#elif defined(__linux__) && (defined(__aarch64__) || defined(__arm__))
+	#include <sys/auxv.h>
+#endif
+
+#include "TargetCPUFeatures.h"
+
+static TargetCPUFeatures    gTargetCPUFeatures;
+static pthread_once_t       gTargetCPUFeaturesOnce = PTHREAD_ONCE_INIT;
+
+static const char * const   kTargetCPUFeatureNames[] = {
+	"aes", "clmul", "sha2",
+	"sse2", "sse3", "ssse3", "sse4.1", "sse4.2", "popcnt", "lzcnt", "movbe", "avx", "f16c", "fma",
+	"bmi1", "bmi2", "avx2", "avx512f", "avx512dq", "avx512bw", "avx512vl", "avx512vnni",
+	"neon", "crc32", "lse", "fp16", "dotprod", "i8mm", "bf16", "sve", "sve2"
+};
+
+#if defined(__APPLE__)
+/* Returns 1 if a hw.optional sysctl exists and is non-zero. */
+static int
+TargetCPUSysctl(const char *name)
+{
+	int     value = 0;
+	size_t  size = sizeof(value);
+
+	return sysctlbyname(name, &value, &size, NULL, 0) == 0 && value != 0;
+}
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+static uint32_t
+TargetCPUFeaturesProbeX86(void)
+{
+	unsigned int    eax, ebx, ecx, edx;
+	unsigned int    maxLeaf;
+	uint32_t        features = 0;
+	uint64_t        xcr0 = 0;
+
+	if ( __get_cpuid(0, &maxLeaf, &ebx, &ecx, &edx) == 0 )
+		return 0;
+	__cpuid(1, eax, ebx, ecx, edx);
+	if ( edx & (1u << 26) )     features |= kTargetCPUFeatureSSE2;
+	if ( ecx & (1u << 0) )      features |= kTargetCPUFeatureSSE3;
+	if ( ecx & (1u << 1) )      features |= kTargetCPUFeatureCLMUL;
+	if ( ecx & (1u << 9) )      features |= kTargetCPUFeatureSSSE3;
+	if ( ecx & (1u << 19) )     features |= kTargetCPUFeatureSSE41;
+	if ( ecx & (1u << 20) )     features |= kTargetCPUFeatureSSE42;
+	if ( ecx & (1u << 22) )     features |= kTargetCPUFeatureMOVBE;
+	if ( ecx & (1u << 23) )     features |= kTargetCPUFeaturePOPCNT;
+	if ( ecx & (1u << 25) )     features |= kTargetCPUFeatureAES;
+
+	/* AVX and its descendants need the OS to save the YMM (and ZMM) registers. */
+	if ( ecx & (1u << 27) )
+	{
+		unsigned int low, high;
+
+		__asm__ __volatile__ ("xgetbv" : "=a" (low), "=d" (high) : "c" (0));
+		xcr0 = ((uint64_t)high << 32) | low;
+	}
+	if ( (xcr0 & 0x6) == 0x6 )
+	{
+		if ( ecx & (1u << 28) ) features |= kTargetCPUFeatureAVX;
+		if ( ecx & (1u << 29) ) features |= kTargetCPUFeatureF16C;
+		if ( ecx & (1u << 12) ) features |= kTargetCPUFeatureFMA;
+	}
+
+	if ( maxLeaf >= 7 )
+	{
+		int avx512State = (xcr0 & 0xE6) == 0xE6;
+
+#if defined(__APPLE__)
+		if ( !avx512State )
+			avx512State = (xcr0 & 0x6) == 0x6 && TargetCPUSysctl("hw.optional.avx512f");
+#endif
+		__cpuid_count(7, 0, eax, ebx, ecx, edx);
+		if ( ebx & (1u << 3) )  features |= kTargetCPUFeatureBMI1;
+		if ( ebx & (1u << 8) )  features |= kTargetCPUFeatureBMI2;
+		if ( ebx & (1u << 29) ) features |= kTargetCPUFeatureSHA2;
+		if ( (features & kTargetCPUFeatureAVX) && (ebx & (1u << 5)) )
+			features |= kTargetCPUFeatureAVX2;
+		if ( avx512State && (ebx & (1u << 16)) )
+		{
+			features |= kTargetCPUFeatureAVX512F;
+			if ( ebx & (1u << 17) ) features |= kTargetCPUFeatureAVX512DQ;
+			if ( ebx & (1u << 30) ) features |= kTargetCPUFeatureAVX512BW;
+			if ( ebx & (1u << 31) ) features |= kTargetCPUFeatureAVX512VL;
+			if ( ecx & (1u << 11) ) features |= kTargetCPUFeatureAVX512VNNI;
+		}
+	}
+
+	if ( __get_cpuid(0x80000001, &eax, &ebx, &ecx, &edx) && (ecx & (1u << 5)) )
+		features |= kTargetCPUFeatureLZCNT;
+	return features;
+}
+#endif
+
+#if defined(__aarch64__) || defined(__arm__)
+static uint32_t
+TargetCPUFeaturesProbeARM(void)
+{
+	uint32_t features = 0;
+
+#if defined(__APPLE__)
+	features |= kTargetCPUFeatureNEON;
+	if ( TargetCPUSysctl("hw.optional.arm.FEAT_AES") )      features |= kTargetCPUFeatureAES;
+	if ( TargetCPUSysctl("hw.optional.arm.FEAT_PMULL") )    features |= kTargetCPUFeatureCLMUL;
+	if ( TargetCPUSysctl("hw.optional.arm.FEAT_SHA256") )   features |= kTargetCPUFeatureSHA2;
+	if ( TargetCPUSysctl("hw.optional.armv8_crc32") )       features |= kTargetCPUFeatureCRC32;
+	if ( TargetCPUSysctl("hw.optional.arm.FEAT_LSE") )      features |= kTargetCPUFeatureLSE;
+	if ( TargetCPUSysctl("hw.optional.arm.FEAT_FP16") )     features |= kTargetCPUFeatureFP16;
+	if ( TargetCPUSysctl("hw.optional.arm.FEAT_DotProd") )  features |= kTargetCPUFeatureDotProd;
+	if ( TargetCPUSysctl("hw.optional.arm.FEAT_I8MM") )     features |= kTargetCPUFeatureI8MM;
+	if ( TargetCPUSysctl("hw.optional.arm.FEAT_BF16") )     features |= kTargetCPUFeatureBF16;
+#elif defined(__linux__) && defined(__aarch64__)
+	/* The bits of <asm/hwcap.h>, which older headers may not all have. */
+	unsigned long hwcap = getauxval(AT_HWCAP);
+	unsigned long hwcap2 = getauxval(AT_HWCAP2);
+
+	if ( hwcap & (1ul << 1) )   features |= kTargetCPUFeatureNEON;          /* HWCAP_ASIMD */
+	if ( hwcap & (1ul << 3) )   features |= kTargetCPUFeatureAES;           /* HWCAP_AES */
+	if ( hwcap & (1ul << 4) )   features |= kTargetCPUFeatureCLMUL;         /* HWCAP_PMULL */
+	if ( hwcap & (1ul << 6) )   features |= kTargetCPUFeatureSHA2;          /* HWCAP_SHA2 */
+	if ( hwcap & (1ul << 7) )   features |= kTargetCPUFeatureCRC32;         /* HWCAP_CRC32 */
+	if ( hwcap & (1ul << 8) )   features |= kTargetCPUFeatureLSE;           /* HWCAP_ATOMICS */
+	if ( hwcap & (1ul << 10) )  features |= kTargetCPUFeatureFP16;          /* HWCAP_ASIMDHP */
+	if ( hwcap & (1ul << 20) )  features |= kTargetCPUFeatureDotProd;       /* HWCAP_ASIMDDP */
+	if ( hwcap & (1ul << 22) )  features |= kTargetCPUFeatureSVE;           /* HWCAP_SVE */
+	if ( hwcap2 & (1ul << 1) )  features |= kTargetCPUFeatureSVE2;          /* HWCAP2_SVE2 */
+	if ( hwcap2 & (1ul << 13) ) features |= kTargetCPUFeatureI8MM;          /* HWCAP2_I8MM */
+	if ( hwcap2 & (1ul << 14) ) features |= kTargetCPUFeatureBF16;          /* HWCAP2_BF16 */
+#elif defined(__linux__)
+	unsigned long hwcap = getauxval(AT_HWCAP);
+	unsigned long hwcap2 = getauxval(AT_HWCAP2);
+
+	if ( hwcap & (1ul << 12) )  features |= kTargetCPUFeatureNEON;          /* HWCAP_NEON */
+	if ( hwcap2 & (1ul << 0) )  features |= kTargetCPUFeatureAES;           /* HWCAP2_AES */
+	if ( hwcap2 & (1ul << 1) )  features |= kTargetCPUFeatureCLMUL;         /* HWCAP2_PMULL */
+	if ( hwcap2 & (1ul << 3) )  features |= kTargetCPUFeatureSHA2;          /* HWCAP2_SHA2 */
+	if ( hwcap2 & (1ul << 4) )  features |= kTargetCPUFeatureCRC32;         /* HWCAP2_CRC32 */
+#elif defined(__aarch64__)
+	features |= kTargetCPUFeatureNEON;
+#endif
+	return features;
+}
+#endif
+
+uint32_t
+TargetCPUFeaturesProbe(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return TargetCPUFeaturesProbeX86();
+#elif defined(__aarch64__) || defined(__arm__)
+	return TargetCPUFeaturesProbeARM();
+#else
+	return 0;
+#endif
+}
+
+static void
+TargetCPUFeaturesInitialize(void)
+{
+	uint32_t features = TargetCPUFeaturesProbe();
+
+	gTargetCPUFeatures.features = features;
+	if ( features & kTargetCPUFeatureAVX512F )
+		gTargetCPUFeatures.vectorBytes = 64;
+	else if ( features & kTargetCPUFeatureAVX )
+		gTargetCPUFeatures.vectorBytes = 32;
+	else if ( features & (kTargetCPUFeatureSSE2 | kTargetCPUFeatureNEON) )
+		gTargetCPUFeatures.vectorBytes = 16;
+	else
+		gTargetCPUFeatures.vectorBytes = 0;
+}
+
+const TargetCPUFeatures *
+GetTargetCPUFeatures(void)
+{
+	pthread_once(&gTargetCPUFeaturesOnce, TargetCPUFeaturesInitialize);
+	return &gTargetCPUFeatures;
+}
+
+__attribute__((constructor))
+static void
+TargetCPUFeaturesAtLoad(void)
+{
+	(void)GetTargetCPUFeatures();
+}
+
+const char *
+GetTargetCPUFeatureName(uint32_t feature)
+{
+	size_t bit;
+
+	if ( feature == 0 || (feature & (feature - 1)) != 0 )
+		return NULL;
+	bit = (size_t)__builtin_ctz(feature);
+	return bit < sizeof(kTargetCPUFeatureNames) / sizeof(kTargetCPUFeatureNames[0]) ? kTargetCPUFeatureNames[bit] : NULL;
+}
@@ -0,0 +1,559 @@
+/*
+     File:       AssertMacrosUpdate.cpp
+
+     Contains:   Parallel replacement for the AssertMacrosUpdate.tops script.
+
+                 Renames uses of the old AssertMacros.h names (check, require_noerr, ...)
+                 to their double-underscore forms (__Check, __Require_noErr, ...).  The
+                 mapping is read from the same AssertMacrosUpdate.tops table the tops
+                 script uses.
+
+                 Unlike tops, calls are recognized lexically: string and character
+                 literals (including raw strings) and comments are skipped, a name is only
+                 renamed when it is a whole identifier which is not a member access or
+                 scope-qualified (Foo::check), is not being declared (bool check(int),
+                 Foo &verify(...)), and is followed by a balanced argument list, and the
+                 name being defined by a #define is left alone.  Arguments are scanned too, so nested uses such as
+                 require(check_noerr(err), bail) are both renamed.
+
+                 Files are mapped with mmap and processed by one worker per core.  By
+                 default a zero-context unified diff is written to stdout; -w rewrites the
+                 files in place instead.
+
+                     AssertMacrosUpdate [-w] [-q] [-j jobs] [-t table] path...
+
+*/
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifndef ASSERT_MACROS_UPDATE_TABLE
+	#define ASSERT_MACROS_UPDATE_TABLE  "AssertMacrosUpdate.tops"
+#endif
+
+namespace {
+
+typedef std::unordered_map<std::string_view, std::string>   RenameTable;
+
+struct Options {
+	bool                        write = false;
+	bool                        quiet = false;
+	unsigned                    jobs = 0;
+	std::string                 table = ASSERT_MACROS_UPDATE_TABLE;
+	std::vector<std::string>    paths;
+};
+
+struct Replacement {
+	size_t                      offset;     /* of the old identifier */
+	size_t                      length;
+	const std::string *         newName;
+};
+
+struct FileResult {
+	std::string                 diff;
+	size_t                      replacements = 0;
+	bool                        failed = false;
+};
+
+/*
+ *  Parses lines of the form
+ *      replace "check(<b args>)" with "__Check(<args>)"
+ *  into old name -> new name.  The keys point into storage, which must outlive the table.
+ */
+bool
+ReadRenameTable(const std::string &path, std::vector<std::string> &storage, RenameTable &table)
+{
+	std::ifstream   in(path);
+	std::string     line;
+
+	if ( !in )
+		return false;
+
+	std::vector<std::pair<std::string, std::string>> pairs;
+	while ( std::getline(in, line) )
+	{
+		size_t oldStart = line.find("replace \"");
+		size_t with = line.find("\" with \"");
+		if ( oldStart == std::string::npos || with == std::string::npos )
+			continue;
+		oldStart += strlen("replace \"");
+		size_t newStart = with + strlen("\" with \"");
+		size_t oldParen = line.find('(', oldStart);
+		size_t newParen = line.find('(', newStart);
+		if ( oldParen == std::string::npos || oldParen > with || newParen == std::string::npos )
+			continue;
+		pairs.emplace_back(line.substr(oldStart, oldParen - oldStart), line.substr(newStart, newParen - newStart));
+	}
+
+	storage.reserve(pairs.size());
+	for ( auto &pair : pairs )
+	{
+		storage.push_back(pair.first);
+		table.emplace(storage.back(), pair.second);
+	}
+	return !table.empty();
+}
+
+inline bool IsIdentifierStart(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_'; }
+inline bool IsIdentifierChar(char c)  { return IsIdentifierStart(c) || (c >= '0' && c <= '9'); }
+inline bool IsSpace(char c)           { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v'; }
+
+/*
+ *  If text[i] starts a comment or a string, character or raw string literal, returns
+ *  the offset just past it; otherwise returns i.
+ */
+size_t
+SkipCommentOrLiteral(std::string_view text, size_t i)
+{
+	size_t n = text.size();
+
+	if ( text[i] == '/' && i + 1 < n && text[i + 1] == '/' )
+	{
+		while ( i < n && text[i] != '\n' )
+			i += (text[i] == '\\' && i + 1 < n) ? 2 : 1;
+		return i;
+	}
+	if ( text[i] == '/' && i + 1 < n && text[i + 1] == '*' )
+	{
+		size_t end = text.find("*/", i + 2);
+		return end == std::string_view::npos ? n : end + 2;
+	}
+	if ( text[i] == 'R' && i + 1 < n && text[i + 1] == '"' && (i == 0 || !IsIdentifierChar(text[i - 1]) ||
+		 text[i - 1] == 'u' || text[i - 1] == 'U' || text[i - 1] == 'L' || text[i - 1] == '8') )
+	{
+		size_t open = text.find('(', i + 2);
+		if ( open != std::string_view::npos && open - (i + 2) <= 16 )
+		{
+			std::string closing = ")" + std::string(text.substr(i + 2, open - (i + 2))) + "\"";
+			size_t end = text.find(closing, open + 1);
+			return end == std::string_view::npos ? n : end + closing.size();
+		}
+	}
+	if ( text[i] == '"' || text[i] == '\'' )
+	{
+		char quote = text[i++];
+		while ( i < n && text[i] != quote && text[i] != '\n' )
+			i += (text[i] == '\\' && i + 1 < n) ? 2 : 1;
+		return i < n ? i + 1 : n;
+	}
+	return i;
+}
+
+/* Returns the offset just past the ')' matching the '(' at text[open], or npos. */
+size_t
+FindBalancedClose(std::string_view text, size_t open)
+{
+	size_t  depth = 0;
+	size_t  i = open;
+
+	while ( i < text.size() )
+	{
+		size_t skipped = SkipCommentOrLiteral(text, i);
+		if ( skipped != i )
+		{
+			i = skipped;
+			continue;
+		}
+		if ( text[i] == '(' )
+			++depth;
+		else if ( text[i] == ')' && --depth == 0 )
+			return i + 1;
+		++i;
+	}
+	return std::string_view::npos;
+}
+
+/* True if the identifier at text[start] is the name in "#define name". */
+bool
+IsDefinedName(std::string_view text, size_t start)
+{
+	size_t i = start;
+
+	while ( i > 0 && (text[i - 1] == ' ' || text[i - 1] == '\t') )
+		--i;
+	if ( i < 6 || text.substr(i - 6, 6) != "define" )
+		return false;
+	i -= 6;
+	while ( i > 0 && (text[i - 1] == ' ' || text[i - 1] == '\t') )
+		--i;
+	return i > 0 && text[i - 1] == '#';
+}
+
+/* True if the identifier at text[start] is preceded by ".", "->" or "::". */
+bool
+IsMemberAccess(std::string_view text, size_t start)
+{
+	size_t i = start;
+
+	while ( i > 0 && IsSpace(text[i - 1]) )
+		--i;
+	return i > 0 && (text[i - 1] == '.' || (text[i - 1] == '>' && i > 1 && text[i - 2] == '-') ||
+					 (text[i - 1] == ':' && i > 1 && text[i - 2] == ':'));
+}
+
+/* Keywords after which a name starts an expression rather than being declared. */
+bool
+IsStatementKeyword(std::string_view word)
+{
+	static const char * const keywords[] = {
+		"return", "else", "do", "case", "throw", "sizeof", "co_return", "co_yield", "co_await",
+		"not", "and", "or"
+	};
+
+	for ( const char *keyword : keywords )
+		if ( word == keyword )
+			return true;
+	return false;
+}
+
+/*
+ *  True if the identifier at text[start] is being declared: it follows a type, an
+ *  identifier or a template's closing ">", possibly through "*" and "&" declarators,
+ *  as in "bool check(int x)", "static Foo &verify()" or "std::vector<int> require()".
+ */
+bool
+IsDeclaredName(std::string_view text, size_t start)
+{
+	size_t i = start;
+
+	while ( i > 0 && (IsSpace(text[i - 1]) || text[i - 1] == '*' || text[i - 1] == '&') )
+		--i;
+	if ( i == 0 )
+		return false;
+	if ( text[i - 1] == '>' )
+		return i < 2 || (text[i - 2] != '-' && text[i - 2] != '>');
+	if ( !IsIdentifierChar(text[i - 1]) )
+		return false;
+
+	size_t end = i;
+	while ( i > 0 && IsIdentifierChar(text[i - 1]) )
+		--i;
+	return IsIdentifierStart(text[i]) && !IsStatementKeyword(text.substr(i, end - i));
+}
+
+std::vector<Replacement>
+FindReplacements(std::string_view text, const RenameTable &table)
+{
+	std::vector<Replacement>    replacements;
+	size_t                      i = 0;
+
+	while ( i < text.size() )
+	{
+		size_t skipped = SkipCommentOrLiteral(text, i);
+		if ( skipped != i )
+		{
+			i = skipped;
+			continue;
+		}
+		if ( !IsIdentifierStart(text[i]) )
+		{
+			/*
+			 *  Skip numbers whole so that suffixes such as 1e5f never look like
+			 *  identifiers, and digit separators as in 1'000 never open a character
+			 *  literal.
+			 */
+			if ( text[i] >= '0' && text[i] <= '9' )
+				while ( i < text.size() && (IsIdentifierChar(text[i]) || text[i] == '.' ||
+						(text[i] == '\'' && i + 1 < text.size() && IsIdentifierChar(text[i + 1]))) )
+					++i;
+			else
+				++i;
+			continue;
+		}
+
+		size_t start = i;
+		while ( i < text.size() && IsIdentifierChar(text[i]) )
+			++i;
+
+		auto entry = table.find(text.substr(start, i - start));
+		if ( entry == table.end() )
+			continue;
+
+		size_t open = i;
+		while ( open < text.size() && IsSpace(text[open]) )
+			++open;
+		if ( open >= text.size() || text[open] != '(' )
+			continue;
+		if ( IsDefinedName(text, start) || IsMemberAccess(text, start) || IsDeclaredName(text, start) )
+			continue;
+		if ( FindBalancedClose(text, open) == std::string_view::npos )
+			continue;
+
+		/* Arguments are scanned on the next iterations, which handles nested uses. */
+		replacements.push_back({ start, i - start, &entry->second });
+	}
+	return replacements;
+}
+
+std::string
+ApplyReplacements(std::string_view text, const std::vector<Replacement> &replacements)
+{
+	std::string result;
+	size_t      last = 0;
+
+	result.reserve(text.size() + replacements.size() * 4);
+	for ( const Replacement &r : replacements )
+	{
+		result.append(text.substr(last, r.offset - last));
+		result.append(*r.newName);
+		last = r.offset + r.length;
+	}
+	result.append(text.substr(last));
+	return result;
+}
+
+/* One zero-context hunk per changed line; identifiers never span lines. */
+std::string
+MakeDiff(const std::string &path, std::string_view text, const std::vector<Replacement> &replacements)
+{
+	size_t      name = path.find_first_not_of('/');
+	std::string label = path.substr(name == std::string::npos ? 0 : name);
+	std::string diff = "--- a/" + label + "\n+++ b/" + label + "\n";
+	size_t      line = 1;
+	size_t      scanned = 0;
+	size_t      r = 0;
+
+	while ( r < replacements.size() )
+	{
+		line += std::count(text.begin() + scanned, text.begin() + replacements[r].offset, '\n');
+		size_t lineStart = text.rfind('\n', replacements[r].offset);
+		lineStart = (lineStart == std::string_view::npos) ? 0 : lineStart + 1;
+		size_t lineEnd = text.find('\n', replacements[r].offset);
+		lineEnd = (lineEnd == std::string_view::npos) ? text.size() : lineEnd;
+		scanned = replacements[r].offset;
+
+		std::vector<Replacement> onLine;
+		while ( r < replacements.size() && replacements[r].offset < lineEnd )
+		{
+			Replacement shifted = replacements[r++];
+			shifted.offset -= lineStart;
+			onLine.push_back(shifted);
+		}
+
+		std::string_view oldLine = text.substr(lineStart, lineEnd - lineStart);
+		diff += "@@ -" + std::to_string(line) + ",1 +" + std::to_string(line) + ",1 @@\n";
+		diff += "-" + std::string(oldLine) + "\n";
+		diff += "+" + ApplyReplacements(oldLine, onLine) + "\n";
+	}
+	return diff;
+}
+
+bool
+WriteFileAtomically(const std::string &path, const std::string &contents, mode_t mode)
+{
+	std::string temporary = path + ".AssertMacrosUpdate";
+	int         fd = open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, mode & 07777);
+
+	if ( fd < 0 )
+		return false;
+
+	const char *    p = contents.data();
+	size_t          remaining = contents.size();
+	while ( remaining > 0 )
+	{
+		ssize_t written = write(fd, p, remaining);
+		if ( written <= 0 )
+		{
+			close(fd);
+			unlink(temporary.c_str());
+			return false;
+		}
+		p += written;
+		remaining -= (size_t)written;
+	}
+	if ( close(fd) != 0 || rename(temporary.c_str(), path.c_str()) != 0 )
+	{
+		unlink(temporary.c_str());
+		return false;
+	}
+	return true;
+}
+
+FileResult
+ProcessFile(const std::string &path, const RenameTable &table, const Options &options)
+{
+	FileResult  result;
+	struct stat info;
+	int         fd = open(path.c_str(), O_RDONLY);
+
+	if ( fd < 0 || fstat(fd, &info) != 0 )
+	{
+		if ( fd >= 0 )
+			close(fd);
+		result.failed = true;
+		return result;
+	}
+	if ( info.st_size == 0 )
+	{
+		close(fd);
+		return result;
+	}
+
+	void *mapping = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if ( mapping == MAP_FAILED )
+	{
+		result.failed = true;
+		return result;
+	}
+
+	std::string_view            text(static_cast<const char *>(mapping), (size_t)info.st_size);
+	std::vector<Replacement>    replacements = FindReplacements(text, table);
+
+	result.replacements = replacements.size();
+	if ( !replacements.empty() )
+	{
+		if ( options.write )
+			result.failed = !WriteFileAtomically(path, ApplyReplacements(text, replacements), info.st_mode);
+		else
+			result.diff = MakeDiff(path, text, replacements);
+	}
+
+	munmap(mapping, (size_t)info.st_size);
+	return result;
+}
+
+bool
+IsSourceFile(const std::filesystem::path &path)
+{
+	static const char * const kExtensions[] = { ".c", ".cc", ".cp", ".cpp", ".cxx", ".m", ".mm", ".h", ".hh", ".hpp" };
+	std::string extension = path.extension().string();
+
+	for ( const char *candidate : kExtensions )
+	{
+		if ( extension == candidate )
+			return true;
+	}
+	return false;
+}
+
+void
+CollectFiles(const std::string &root, std::vector<std::string> &files)
+{
+	std::error_code error;
+
+	if ( !std::filesystem::is_directory(root, error) )
+	{
+		files.push_back(root);
+		return;
+	}
+
+	auto options = std::filesystem::directory_options::skip_permission_denied;
+	for ( auto it = std::filesystem::recursive_directory_iterator(root, options, error);
+		  it != std::filesystem::recursive_directory_iterator(); it.increment(error) )
+	{
+		if ( error )
+			break;
+		if ( it->is_regular_file(error) && IsSourceFile(it->path()) )
+			files.push_back(it->path().string());
+	}
+}
+
+void
+Usage(const char *tool)
+{
+	fprintf(stderr, "usage: %s [-w] [-q] [-j jobs] [-t table] path...\n"
+					"    -w        rewrite files in place instead of printing a diff\n"
+					"    -q        do not print the summary\n"
+					"    -j jobs   number of worker threads (default: one per core)\n"
+					"    -t table  rename table in tops syntax (default: %s)\n",
+			tool, ASSERT_MACROS_UPDATE_TABLE);
+}
+
+} /* namespace */
+
+int
+main(int argc, char **argv)
+{
+	Options options;
+	int     ch;
+
+	while ( (ch = getopt(argc, argv, "wqj:t:")) != -1 )
+	{
+		switch ( ch )
+		{
+			case 'w':   options.write = true;                                   break;
+			case 'q':   options.quiet = true;                                   break;
+			case 'j':   options.jobs = (unsigned)strtoul(optarg, NULL, 10);     break;
+			case 't':   options.table = optarg;                                 break;
+			default:    Usage(argv[0]);                                         return 2;
+		}
+	}
+	for ( int i = optind; i < argc; ++i )
+		options.paths.push_back(argv[i]);
+	if ( options.paths.empty() )
+	{
+		Usage(argv[0]);
+		return 2;
+	}
+
+	std::vector<std::string>    tableStorage;
+	RenameTable                 table;
+	if ( !ReadRenameTable(options.table, tableStorage, table) )
+	{
+		fprintf(stderr, "%s: cannot read rename table %s\n", argv[0], options.table.c_str());
+		return 1;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+
+	std::vector<std::string> files;
+	for ( const std::string &path : options.paths )
+		CollectFiles(path, files);
+
+	unsigned jobs = options.jobs != 0 ? options.jobs : std::max(1u, std::thread::hardware_concurrency());
+	jobs = std::min<unsigned>(jobs, std::max<size_t>(files.size(), 1));
+
+	std::vector<FileResult>     results(files.size());
+	std::atomic<size_t>         next(0);
+	std::vector<std::thread>    workers;
+
+	for ( unsigned j = 0; j < jobs; ++j )
+	{
+		workers.emplace_back([&] {
+			for ( size_t i = next++; i < files.size(); i = next++ )
+				results[i] = ProcessFile(files[i], table, options);
+		});
+	}
+	for ( std::thread &worker : workers )
+		worker.join();
+
+	size_t  changedFiles = 0;
+	size_t  replacements = 0;
+	int     status = 0;
+	for ( size_t i = 0; i < files.size(); ++i )
+	{
+		if ( results[i].failed )
+		{
+			fprintf(stderr, "%s: cannot %s %s\n", argv[0], options.write ? "rewrite" : "read", files[i].c_str());
+			status = 1;
+		}
+		if ( results[i].replacements != 0 )
+			++changedFiles;
+		replacements += results[i].replacements;
+		fputs(results[i].diff.c_str(), stdout);
+	}
+
+	if ( !options.quiet )
+	{
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		fprintf(stderr, "%zu files scanned, %zu changed, %zu replacements, %u jobs, %.3f s\n",
+				files.size(), changedFiles, replacements, jobs, seconds);
+	}
+	return status;
+}
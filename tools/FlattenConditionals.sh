@@ -0,0 +1,100 @@
+#!/bin/sh
+#
+# FlattenConditionals.sh -- resolves TargetConditionals.h or ConditionalMacros.h for one target.
+#
+# Usage: FlattenConditionals.sh <include directory> <header>
+#
+# Writes to stdout a header equivalent to <include directory>/<header> for the target
+# CFLAGS select (one architecture): its license comment, the headers it includes, and
+# each macro it defines, as the compiler's -dM output gives it, in place of the nested
+# compiler and target tests.  A macro the original tests with #ifndef anywhere keeps
+# that test, so it can still be set on the command line.  Macros that differ between C and
+# C++ (TYPE_BOOL) are emitted under #ifdef __cplusplus.  The result is only correct for
+# that target; CC and CFLAGS are passed to the compiler.
+#
+
+CC=${CC:-cc}
+
+if [ $# -ne 2 ]; then
+	echo "usage: $0 <include directory> <header>" >&2
+	exit 1
+fi
+DIR=$1
+HEADER=$2
+if [ ! -f "$DIR/$HEADER" ]; then
+	echo "$0: no $HEADER in $DIR" >&2
+	exit 1
+fi
+
+WORK=$(mktemp -d "${TMPDIR:-/tmp}/FlattenConditionals.XXXXXX") || exit 1
+trap 'rm -rf "$WORK"' EXIT
+
+GUARD=__$(echo "${HEADER%.h}" | tr '[:lower:]' '[:upper:]')__
+sed -n 's/^[ 	]*#[ 	]*include[ 	]*<\([^>]*\)>.*/\1/p' "$DIR/$HEADER" > "$WORK/includes"
+sed -n 's/^[ 	]*#[ 	]*ifndef[ 	]*\([A-Za-z_][A-Za-z0-9_]*\).*/\1/p' "$DIR/$HEADER" > "$WORK/overridable"
+
+# The macros a file of #includes defines, one per line, sorted.
+macros() {
+	$CC $CFLAGS -I"$DIR" -x "$1" -E -dM - < "$2" | LC_ALL=C sort
+}
+
+sed 's/.*/#include <&>/' "$WORK/includes" > "$WORK/before.h"
+cp "$WORK/before.h" "$WORK/after.h"
+echo "#include <$HEADER>" >> "$WORK/after.h"
+for language in c c++; do
+	macros $language "$WORK/before.h" > "$WORK/before.$language" || exit 1
+	macros $language "$WORK/after.h" > "$WORK/after.$language" || exit 1
+	LC_ALL=C comm -13 "$WORK/before.$language" "$WORK/after.$language" |
+		grep -v "^#define $GUARD\( \|\$\)" > "$WORK/own.$language"
+done
+
+# Prints each #define of a list, inside #ifndef if the original tests it that way.
+emit() {
+	awk -v indent="$2" '
+		FILENAME == ARGV[1] { overridable[$0] = 1; next }
+		{
+			name = $2
+			sub(/\(.*/, "", name)
+			if ( name in overridable )
+				printf("%s#ifndef %s\n%s    %s\n%s#endif\n", indent, name, indent, $0, indent)
+			else
+				printf("%s%s\n", indent, $0)
+		}' "$WORK/overridable" "$1"
+}
+
+awk '{ print } /\*\// { exit }' "$DIR/$HEADER"
+cat <<EOF
+
+/*
+     File:       $HEADER
+
+     Contains:   $HEADER flattened by tools/FlattenConditionals.sh for
+
+                     $CFLAGS
+
+                 Every target and compiler test is already resolved, so this copy is
+                 only correct when building for that target.
+
+*/
+#ifndef $GUARD
+#define $GUARD
+
+EOF
+if [ -s "$WORK/includes" ]; then
+	cat "$WORK/before.h"
+	echo
+fi
+LC_ALL=C comm -12 "$WORK/own.c" "$WORK/own.c++" > "$WORK/common"
+LC_ALL=C comm -23 "$WORK/own.c" "$WORK/own.c++" > "$WORK/c"
+LC_ALL=C comm -13 "$WORK/own.c" "$WORK/own.c++" > "$WORK/c++"
+emit "$WORK/common" ""
+if [ -s "$WORK/c" ] || [ -s "$WORK/c++" ]; then
+	echo
+	echo "#ifdef __cplusplus"
+	emit "$WORK/c++" "    "
+	echo "#else"
+	emit "$WORK/c" "    "
+	echo "#endif"
+fi
+echo
+echo "#endif /* $GUARD */"
@@ -0,0 +1,295 @@
+#!/usr/bin/env python3
+#
+# MacErrorsSplit.py -- splits a monolithic MacErrors.h into one header per group of managers.
+#
+# Usage: MacErrorsSplit.py <MacErrors.h> <output directory>
+#
+# MacErrors.h as CarbonCore ships it is one file of some 150 enum blocks.  This tool
+# assigns each block to a header by its subsystem (the SUBSYSTEMS table of
+# MacErrorsTable.py, keyed by the block's first enumerator, mapped to a header by
+# GROUPS below) and writes the headers, then rewrites MacErrors.h as an umbrella that
+# includes them all and keeps only its preamble and SysError().  The blocks keep their
+# comments, their text and their order within each header.  A block defined in terms
+# of another header's enumerators (errOSACantCoerce = errAECoercionFail) makes its
+# header include that one; the includes must not form a cycle.
+#
+# The split headers are the source of truth afterwards, and MacErrorsTable.py follows
+# the umbrella's includes, so this only needs running again to take a new monolithic
+# MacErrors.h from CarbonCore ("make split_mac_errors").  It refuses a MacErrors.h that
+# has already been split.
+#
+
+import os
+import re
+import sys
+
+from MacErrorsTable import ENTRY, ENUM_END, ENUM_START, SUBSYSTEMS, Enumerator, evaluate, group_by_code, parse
+
+# (header, what it contains, subsystems), in the order MacErrors.h includes them.  Every
+# subsystem in SUBSYSTEMS must appear exactly once.
+#
+# Where names from different headers share a value, MacErrorsTable.py makes the first
+# one it reads the value's name, and gives the value that name's subsystem.  The order
+# below reads them as the monolithic file did (Text before Networking, so -7100 stays
+# dcmParamErr rather than kRAInvalidParameter; the ds... codes last, so 2 stays
+# siInitVBLQsErr), and main() fails if any value's first name changes.  A value's other
+# names can still come in a new order: no order of the headers keeps them all, since
+# Networking shares values with Devices both ways round.
+GROUPS = [
+	('MacErrorsCore.h', 'general errors and those of the system software core: processes, '
+			'threads, code fragments and the kernel', [
+		'General', 'Kernel', 'Debugging Library', 'C++ Exceptions', 'Core Foundation',
+		'Core Endian', 'Gestalt Manager', 'Code Fragment Manager', 'Mixed Mode Manager',
+		'Thread Manager', 'Multiprocessing Services', 'Process Manager', 'Task Manager',
+		'Notification Manager']),
+	('MacErrorsMemory.h', 'Memory Manager and virtual memory errors', [
+		'Memory Manager', 'Memory Dispatch', 'Virtual Memory']),
+	('MacErrorsFiles.h', 'core I/O errors: the File Manager, disk drivers, resources and '
+			'file services', [
+		'File Manager', 'File System Manager', 'File Mapping', 'Folder Manager', 'Disk Driver',
+		'AppleShare', 'Resource Manager', 'Find By Content']),
+	('MacErrorsComponents.h', 'Component Manager errors', [
+		'Component Manager']),
+	('MacErrorsQuickTime.h', 'QuickTime errors', [
+		'QuickTime', 'QuickTime VR', 'QuickTime Streaming', 'QuickTime Streaming Server']),
+	('MacErrorsPOSIX.h', 'the kPOSIXError codes, errno values as OSStatus', [
+		'POSIX']),
+	('MacErrorsScripting.h', 'Apple Event Manager and Open Scripting Architecture errors', [
+		'Apple Event Manager', 'Apple Event Registry', 'Open Scripting Architecture']),
+	('MacErrorsServices.h', 'keychain, data access, collection and other application '
+			'service errors', [
+		'Keychain Manager', 'Data Access Manager', 'Collection Manager', 'Settings Manager',
+		'UTC Utilities']),
+	('MacErrorsText.h', 'text, Unicode and international errors', [
+		'Text Utilities', 'Text Services Manager', 'Text Parser', 'Text Engines',
+		'Text Encoding Conversion', 'Unicode Utilities', 'ATSUI', 'Multilingual Text Engine',
+		'TextEdit', 'Locales', 'Language Analysis', 'Dictionary Manager', 'Number Formatting',
+		'Information Access']),
+	('MacErrorsNetworking.h', 'AppleTalk, Open Transport and other networking errors', [
+		'AppleTalk', 'Open Transport', 'PPC Toolbox', 'Apple Remote Access',
+		'Network Services Location', 'NetSprocket', 'URL Access', 'Telephone Manager']),
+	('MacErrorsGraphics.h', 'QuickDraw, ColorSync, font, display and printing errors', [
+		'QuickDraw', 'ColorSync', 'Color Picker', 'Display Manager', 'Icon Services',
+		'Font Manager', 'FontSync', 'DrawSprocket', 'Printing Manager', 'Desktop Printing']),
+	('MacErrorsToolbox.h', 'Human Interface Toolbox errors: windows, menus, controls, '
+			'dialogs, events and the services built on them', [
+		'Window Manager', 'Menu Manager', 'Control Manager', 'Dialog Manager', 'Event Manager',
+		'Drag Manager', 'Appearance Manager', 'Help Manager', 'Navigation Services',
+		'Scrap Manager', 'Edition Manager', 'Translation Manager', 'HTML Rendering']),
+	('MacErrorsSound.h', 'Sound Manager, speech and MIDI errors', [
+		'Sound Manager', 'Sound Input Manager', 'SoundSprocket', 'Speech Manager',
+		'MIDI Manager']),
+	('MacErrorsDevices.h', 'device and expansion bus errors: slots, PC Card, USB, HID and '
+			'power management', [
+		'Slot Manager', 'PC Card', 'USB', 'HID', 'Power Manager', 'Name Registry',
+		'InputSprocket']),
+	('MacErrorsSystem.h', 'the SysError() codes (dsBusError and the rest)', [
+		'System Error']),
+]
+
+IF_START = re.compile(r'^\s*#\s*if')
+IF_END = re.compile(r'^\s*#\s*endif')
+IDENTIFIER = re.compile(r'[A-Za-z_]\w*')
+CPLUSPLUS = re.compile(r'^\s*#\s*ifdef\s+__cplusplus')
+CONDITIONAL_MACROS = re.compile(r'^\s*#\s*if\s+(?!defined)[A-Z]')
+FILE_NAME = re.compile(r'^(\s*File:\s*)MacErrors\.h')
+CONTAINS = re.compile(r'^(\s*Contains:\s*)')
+
+
+class Block(object):
+	def __init__(self, lines):
+		self.lines = lines
+		self.names = []
+		self.references = set()
+		for line in lines:
+			match = ENTRY.match(line)
+			if match is not None:
+				self.names.append(match.group(1))
+				self.references.update(IDENTIFIER.findall(re.sub(r'^\([A-Za-z]\w*\)', '', match.group(2).strip())))
+		if not self.names:
+			raise ValueError('enum block without enumerators:\n' + ''.join(lines))
+		if self.names[0] not in SUBSYSTEMS:
+			raise ValueError('enum block %s has no subsystem in MacErrorsTable.SUBSYSTEMS' % self.names[0])
+		self.subsystem = SUBSYSTEMS[self.names[0]]
+		self.conditional = any(CONDITIONAL_MACROS.match(line) for line in lines)
+
+
+def split(lines):
+	"""Returns the preamble, the lines opening extern "C", the enum blocks, and the lines
+	after the last block.
+
+	Each block takes the blank lines and comments before it; a block inside #if takes
+	the whole conditional."""
+	start = next((i for i, line in enumerate(lines) if CPLUSPLUS.match(line)), None)
+	if start is None:
+		raise ValueError('no extern "C" block')
+	end = start + next(i for i, line in enumerate(lines[start:]) if IF_END.match(line)) + 1
+	preamble, opening, body = lines[:start], lines[start:end], lines[end:]
+	if not any(ENUM_START.match(line) for line in body):
+		raise ValueError('no enum blocks; has MacErrors.h already been split?')
+
+	blocks = []
+	current = []
+	depth = 0
+	closed = False
+	for line in body:
+		current.append(line)
+		if IF_START.match(line):
+			depth += 1
+		elif IF_END.match(line):
+			depth -= 1
+		closed = closed or bool(ENUM_END.match(line))
+		if closed and depth == 0 and (ENUM_END.match(line) or IF_END.match(line)):
+			blocks.append(Block(current))
+			current = []
+			closed = False
+	tail = current
+	while tail and tail[0].strip() == '':
+		tail.pop(0)
+	return preamble, opening, blocks, tail
+
+
+def assign(blocks):
+	"""Returns the headers that have blocks, in GROUPS order, each with its blocks and
+	includes."""
+	headerOf = {}
+	for header, _, subsystems in GROUPS:
+		for subsystem in subsystems:
+			if subsystem in headerOf:
+				raise ValueError('subsystem %s is in both %s and %s' % (subsystem, headerOf[subsystem], header))
+			headerOf[subsystem] = header
+	unassigned = set(SUBSYSTEMS.values()) - set(headerOf)
+	if unassigned:
+		raise ValueError('subsystems in no group: %s' % ', '.join(sorted(unassigned)))
+
+	headers = {}
+	definedIn = {}
+	for block in blocks:
+		header = headerOf[block.subsystem]
+		if header not in headers:
+			headers[header] = {'blocks': [], 'includes': [], 'conditional': False}
+		headers[header]['blocks'].append(block)
+		headers[header]['conditional'] = headers[header]['conditional'] or block.conditional
+		for name in block.names:
+			definedIn[name] = header
+	order = [header for header, _, _ in GROUPS if header in headers]
+	for header in order:
+		for block in headers[header]['blocks']:
+			for name in sorted(block.references):
+				other = definedIn.get(name)
+				if other is not None and other != header and other not in headers[header]['includes']:
+					headers[header]['includes'].append(other)
+
+	def visit(header, path):
+		if header in path:
+			raise ValueError('headers include each other: %s' % ' -> '.join(path + [header]))
+		for other in headers[header]['includes']:
+			visit(other, path + [header])
+	for header in order:
+		visit(header, [])
+	return order, headers
+
+
+def guard(header):
+	return '__%s__' % header[:-2].upper()
+
+
+def license_and_banner(preamble):
+	"""Returns the license comment and the File/Contains comment that open MacErrors.h."""
+	text = ''.join(preamble)
+	first = text.index('*/') + 2
+	second = text.index('/*', first)
+	return text[:first] + '\n', text[second:text.index('*/', second) + 2] + '\n'
+
+
+def banner_for(banner, header, contains, extra):
+	"""Returns the File/Contains comment of MacErrors.h renamed to header, with contains
+	(if not None) in place of its Contains text and the lines of extra after it."""
+	lines = []
+	for line in banner.splitlines(True):
+		match = CONTAINS.match(line)
+		if FILE_NAME.match(line):
+			line = FILE_NAME.sub(lambda m: m.group(1) + header, line)
+		elif match is not None:
+			if contains is not None:
+				line = match.group(1) + contains + '\n'
+			for text in extra:
+				line += (' ' * len(match.group(1)) + text + '\n') if text else ' \n'
+		lines.append(line)
+	return ''.join(lines)
+
+
+def write(path, text):
+	with open(path, 'w', encoding='mac_roman', newline='') as output:
+		output.write(text)
+
+
+def emit_header(directory, license, banner, header, contains, entry):
+	text = license + ' \n'
+	text += banner_for(banner, header, 'OSErr codes: %s.' % contains, [
+		'',
+		'MacErrors.h includes this header; include it alone to define only',
+		'these codes.  Split from MacErrors.h by tools/MacErrorsSplit.py.'])
+	text += '#ifndef %s\n#define %s\n\n' % (guard(header), guard(header))
+	if entry['conditional']:
+		text += '#ifndef __CONDITIONALMACROS__\n#include <ConditionalMacros.h>\n#endif\n\n'
+	for other in entry['includes']:
+		text += '#ifndef %s\n#include <%s>\n#endif\n\n' % (guard(other), other)
+	body = ''.join(''.join(block.lines) for block in entry['blocks'])
+	text += body.lstrip('\n') + '\n'
+	text += '#endif /* %s */\n\n' % guard(header)
+	write(os.path.join(directory, header), text)
+
+
+def emit_umbrella(directory, preamble, banner, order, opening, tail):
+	text = ''.join(preamble).replace(banner, banner_for(banner, 'MacErrors.h', None, [
+		'',
+		'The codes are defined by the headers included below, one for each',
+		'group of managers, which may also be included alone.']), 1)
+	text = text.rstrip('\n') + '\n\n'
+	for header in order:
+		text += '#ifndef %s\n#include <%s>\n#endif\n\n' % (guard(header), header)
+	text += ''.join(opening) + '\n' + ''.join(tail)
+	write(os.path.join(directory, 'MacErrors.h'), text)
+
+
+def first_names(path):
+	enumerators = parse(path)
+	enumerators.insert(0, Enumerator('noErr', '0', '', -1))
+	evaluate(enumerators)
+	return dict((code, entries[0].name) for code, entries in group_by_code(enumerators).items())
+
+
+def main(argv):
+	if len(argv) != 3:
+		sys.stderr.write('usage: %s <MacErrors.h> <output directory>\n' % argv[0])
+		return 1
+	with open(argv[1], encoding='mac_roman', newline='') as source:
+		lines = source.readlines()
+	try:
+		preamble, opening, blocks, tail = split(lines)
+		order, headers = assign(blocks)
+	except ValueError as error:
+		sys.stderr.write('%s: %s\n' % (argv[0], error))
+		return 1
+	before = first_names(argv[1])
+	license, banner = license_and_banner(preamble)
+	contains = dict((header, text) for header, text, _ in GROUPS)
+	for header in order:
+		emit_header(argv[2], license, banner, header, contains[header], headers[header])
+	emit_umbrella(argv[2], preamble, banner, order, opening, tail)
+	after = first_names(os.path.join(argv[2], 'MacErrors.h'))
+	changed = sorted(code for code in before if before[code] != after.get(code))
+	for code in changed:
+		sys.stderr.write('%s: %d is now %s rather than %s; reorder GROUPS\n' % (argv[0], code, after.get(code), before[code]))
+	if changed:
+		return 1
+	for header in order:
+		entry = headers[header]
+		sys.stdout.write('%-24s %3d blocks%s\n' % (header, len(entry['blocks']),
+				''.join(' ' + other for other in entry['includes'])))
+	return 0
+
+
+if __name__ == '__main__':
+	sys.exit(main(sys.argv))
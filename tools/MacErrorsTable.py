@@ -0,0 +1,1359 @@
+#!/usr/bin/env python3
+#
+# MacErrorsTable.py -- generates the OSStatus name table used by src/MacErrorsLookup.c.
+#
+# Usage: MacErrorsTable.py [--constexpr | --codes | --database | --errno | --subsystems] <MacErrors.h> <output>
+#
+# Parses every enumerator of MacErrors.h and of the headers it includes for each group
+# of managers (MacErrorsCore.h, MacErrorsFiles.h...), with its trailing comment,
+# resolving values given as other enumerators (errOSACantCoerce = errAECoercionFail)
+# and casts ((long)0x80008001).  All values are taken as OSStatus, so they wrap to 32
+# bits.
+#
+# Names sharing a value are kept in the order the compiler reads them, except that a
+# name defined through another enumerator, or one that only marks the bounds of a range
+# (firstDskErr, cfragLastErrCode, kPOSIXErrorBase), never comes before a name defined
+# directly.
+# The first name is the one GetMacErrorName() returns; the rest are its aliases.
+# noErr, which MacTypes.h defines, is added as the first name of 0.
+#
+# The output is a header of static tables: one string pool, one name list grouped by
+# code, and an open-addressed hash table of codes placed by hash-and-displace so that
+# every code is found with exactly one probe.
+#
+# Each code is also classified by the subsystem that defines it, from the enum block of
+# its first name (SUBSYSTEMS below, keyed by the first enumerator of each block).  Codes
+# sorted by value are merged into runs of one subsystem, and the runs, widened into the
+# ranges MacErrors.h reserves for some subsystems (SUBSYSTEM_RANGES), become a sorted
+# interval table; values between runs of different subsystems are left unclassified.
+# Values in the 16-bit OSErr space start their search from a table of the range at the
+# bottom of each RANGE_BUCKET_WIDTH values, leaving a few independent comparisons.
+#
+# With --constexpr, the output is instead MacErrorsNames.h: the codes and first names
+# as sorted C++17 inline constexpr arrays, searched at compile time by
+# MacErrors::ErrorName<code>().  That header is installed, so it is checked in and
+# regenerated with "make generated_headers" whenever MacErrors.h changes.
+#
+# With --codes, the output is MacErrorsCodes.h, checked in the same way: every name,
+# aliases included, mapped to its value by a minimal perfect hash, for
+# MacErrors::ErrorCodeOf("fnfErr").  Names are hashed 8 bytes at a time (key_hash());
+# the high half of the hash picks a bucket, whose displacement, found here, sends every
+# name in it to a distinct slot of a table with exactly one slot per name.
+#
+# With --database, the output is MacErrors.db, the file src/MacErrorsDatabase.c maps:
+# the same codes and names with the names front-coded in blocks of DATABASE_NAME_BLOCK
+# and the comments encoded against a dictionary of their common words.  Its layout is
+# described in src/MacErrorsDatabase.c.
+#
+# With --errno, the output is MacErrorsErrnoTable.h, the errno translation tables used
+# by src/MacErrorsErrno.c.  Every kPOSIXError code maps to its errno, the Open Transport
+# kE...Err codes map to theirs, and the classic codes in ERRNO_CLASSIC map as listed.
+# Mapping back, an errno gives its first code in ERRNO_CLASSIC, if any, and otherwise
+# its kPOSIXError code.  errno values differ between systems, so the tables name them
+# and are sized and filled by the compiler, each entry guarded by #ifdef.
+#
+# With --subsystems, the output is MacErrorsSubsystemCheck.h, which bench/
+# MacErrorsSubsystemBench.c checks GetMacErrorSubsystem() against: every code but noErr
+# with the subsystem of its first name, straight from SUBSYSTEMS, and SUBSYSTEM_RANGES,
+# with none of the runs, merging or buckets of the lookup table.
+#
+
+import bisect
+import collections
+import os
+import re
+import struct
+import sys
+
+INCLUDE = re.compile(r'^\s*#\s*include\s*[<"](MacErrors\w+\.h)[>"]')
+ENUM_START = re.compile(r'^\s*enum\s*\{')
+ENUM_END = re.compile(r'^\s*\}\s*;')
+ENTRY = re.compile(r'^\s*([A-Za-z_]\w*)\s*=\s*([^,/]+?)\s*(,)?\s*(/\*.*)?$')
+RANGE_MARKER = re.compile(r'^(first|last)|(Base|First|Last|FirstErr|LastErr|FirstErrCode|LastErrCode|ErrorBase)$')
+
+TABLE_LOAD = 0.85
+BUCKET_SIZE = 4
+RANGE_BUCKET_SHIFT = 6
+
+# Classic codes and the errno each stands for.  The first code listed for an errno is
+# the one it translates back to, so keep the most general code first.
+ERRNO_CLASSIC = [
+	('fnfErr', 'ENOENT'),
+	('dirNFErr', 'ENOENT'),
+	('afpObjectNotFound', 'ENOENT'),
+	('memFullErr', 'ENOMEM'),
+	('mFulErr', 'ENOMEM'),
+	('notEnoughMemoryErr', 'ENOMEM'),
+	('permErr', 'EACCES'),
+	('wrPermErr', 'EACCES'),
+	('afpAccessDenied', 'EACCES'),
+	('paramErr', 'EINVAL'),
+	('bdNamErr', 'EINVAL'),
+	('posErr', 'EINVAL'),
+	('badMovErr', 'EINVAL'),
+	('ioErr', 'EIO'),
+	('dskFulErr', 'ENOSPC'),
+	('errFSNotEnoughSpaceForOperation', 'ENOSPC'),
+	('afpDiskFull', 'ENOSPC'),
+	('dupFNErr', 'EEXIST'),
+	('afpObjectExists', 'EEXIST'),
+	('fBsyErr', 'EBUSY'),
+	('opWrErr', 'EBUSY'),
+	('afpFileBusy', 'EBUSY'),
+	('rfNumErr', 'EBADF'),
+	('fnOpnErr', 'EBADF'),
+	('wPrErr', 'EROFS'),
+	('vLckdErr', 'EROFS'),
+	('fLckdErr', 'EPERM'),
+	('tmfoErr', 'EMFILE'),
+	('nsvErr', 'ENODEV'),
+	('nsDrvErr', 'ENXIO'),
+	('volOffLinErr', 'ENXIO'),
+	('notAFileErr', 'EISDIR'),
+	('errFSNotAFolder', 'ENOTDIR'),
+	('diffVolErr', 'EXDEV'),
+	('fsDataTooBigErr', 'EFBIG'),
+	('errFSNameTooLong', 'ENAMETOOLONG'),
+	('errFSQuotaExceeded', 'EDQUOT'),
+	('errFSOperationNotSupported', 'ENOTSUP'),
+	('wrgVolTypErr', 'ENOTSUP'),
+	('errFSBadBuffer', 'EFAULT'),
+	('unimpErr', 'ENOSYS'),
+	('userCanceledErr', 'ECANCELED'),
+	('kernelTimeoutErr', 'ETIMEDOUT'),
+]
+
+# errno names some systems define as another errno, which would otherwise fill the same
+# entry of the table indexed by errno twice.
+ERRNO_ALIASES = {
+	'EWOULDBLOCK': 'EAGAIN',
+	'EDEADLOCK': 'EDEADLK',
+	'EOPNOTSUPP': 'ENOTSUP',
+}
+
+ERRNO_POSIX_BASE = 100000
+ERRNO_POSIX_SPAN = 256
+ERRNO_LIMIT = 256
+
+CODES_BUCKET_SIZE = 4
+MASK64 = 0xFFFFFFFFFFFFFFFF
+
+DATABASE_MAGIC = 0x4244454D         # 'MEDB'
+DATABASE_VERSION = 1
+DATABASE_NAME_BLOCK = 16
+DATABASE_WORD_ESCAPE = 0x7FFF       # word index reserved for a literal byte >= 0x80
+
+# The subsystem of each enum block in MacErrors.h, by its first enumerator.  A block
+# missing from this list stops the build, so new blocks are classified when added.
+SUBSYSTEMS = {
+	'paramErr': 'General',
+	'abortErr': 'File Manager',
+	'vLckdErr': 'File Manager',
+	'fidNotFound': 'File Manager',
+	'noAdrMkErr': 'Disk Driver',
+	'noScrapErr': 'Scrap Manager',
+	'eLenErr': 'AppleTalk',
+	'ddpSktErr': 'AppleTalk',
+	'memROZWarn': 'Memory Manager',
+	'iMemFullErr': 'Printing Manager',
+	'resourceInMemory': 'Resource Manager',
+	'evtNotEnb': 'Event Manager',
+	'cMatchErr': 'QuickDraw',
+	'cmProfileError': 'ColorSync',
+	'noHardware': 'Sound Manager',
+	'noSynthFound': 'Speech Manager',
+	'midiNoClientErr': 'MIDI Manager',
+	'nmTypErr': 'Notification Manager',
+	'siInitSDTblErr': 'Sound Input Manager',
+	'smSDMInitErr': 'Slot Manager',
+	'smResrvErr': 'Slot Manager',
+	'smCPUErr': 'Slot Manager',
+	'notBTree': 'Dictionary Manager',
+	'fsmFFSNotFoundErr': 'File System Manager',
+	'editionMgrInitErr': 'Edition Manager',
+	'teScrapSizeErr': 'TextEdit',
+	'procNotFound': 'Process Manager',
+	'wrongApplicationPlatform': 'Process Manager',
+	'threadTooManyReqsErr': 'Thread Manager',
+	'threadBadAppContextErr': 'Thread Manager',
+	'notEnoughMemoryErr': 'Memory Dispatch',
+	'vmMorePhysicalThanVirtualErr': 'Virtual Memory',
+	'vmInvalidBackingFileIDErr': 'File Mapping',
+	'rcDBNull': 'Data Access Manager',
+	'hmHelpDisabled': 'Help Manager',
+	'notInitErr': 'PPC Toolbox',
+	'kFMIterationCompleted': 'Font Manager',
+	'noMaskFoundErr': 'QuickDraw',
+	'nbpBuffOvr': 'AppleTalk',
+	'aspBadVersNum': 'AppleTalk',
+	'reqFailed': 'AppleTalk',
+	'errRefNum': 'AppleTalk',
+	'errAECoercionFail': 'Apple Event Manager',
+	'errOSASystemError': 'Open Scripting Architecture',
+	'errOffsetInvalid': 'Apple Event Manager',
+	'badDragRefErr': 'Drag Manager',
+	'couldNotResolveDataRef': 'QuickTime',
+	'internalComponentErr': 'QuickTime',
+	'componentDllLoadErr': 'QuickTime',
+	'cannotFindAtomErr': 'QuickTime',
+	'digiUnimpErr': 'QuickTime',
+	'kernelIncompleteErr': 'Kernel',
+	'tsmComponentNoErr': 'Text Services Manager',
+	'mmInternalError': 'Mixed Mode Manager',
+	'nrLockedErr': 'Name Registry',
+	'invalidIconRefErr': 'Icon Services',
+	'errOSACantCoerce': 'Open Scripting Architecture',
+	'errOSATypeError': 'Open Scripting Architecture',
+	'errASCantConsiderAndIgnore': 'Open Scripting Architecture',
+	'cfragFirstErrCode': 'Code Fragment Manager',
+	'cfragFirstReservedCode': 'Code Fragment Manager',
+	'fragContextNotFound': 'Code Fragment Manager',
+	'invalidComponentID': 'Component Manager',
+	'invalidTranslationPathErr': 'Translation Manager',
+	'buf2SmallErr': 'AppleTalk',
+	'kOTNoError': 'Open Transport',
+	'kQDNoPalette': 'QuickDraw',
+	'firstPickerError': 'Color Picker',
+	'kNSL68kContextNotSupported': 'Network Services Location',
+	'kDTPHoldJobErr': 'Desktop Printing',
+	'cmElementTagNotFound': 'ColorSync',
+	'badFolderDescErr': 'Folder Manager',
+	'coreFoundationUnknownErr': 'Core Foundation',
+	'errCoreEndianDataTooShortForFormat': 'Core Endian',
+	'internalScrapErr': 'Scrap Manager',
+	'afpAccessDenied': 'AppleShare',
+	'afpBadDirIDType': 'AppleShare',
+	'numberFormattingNotANumberErr': 'Number Formatting',
+	'textParserBadParamErr': 'Text Parser',
+	'errUnknownAttributeTag': 'Text Engines',
+	'hrHTMLRenderingLibNotInstalledErr': 'HTML Rendering',
+	'errIANoErr': 'Information Access',
+	'qtsBadSelectorErr': 'QuickTime Streaming',
+	'gestaltUnknownErr': 'Gestalt Manager',
+	'menuPropertyInvalidErr': 'Menu Manager',
+	'errInvalidWindowPtr': 'Window Manager',
+	'dialogNoTimeoutErr': 'Dialog Manager',
+	'kNavWrongDialogStateErr': 'Navigation Services',
+	'collectionItemLockedErr': 'Collection Manager',
+	'kQTSSUnknownErr': 'QuickTime Streaming Server',
+	'kDMGenErr': 'Display Manager',
+	'laTooSmallBufferErr': 'Language Analysis',
+	'kUSBNoErr': 'USB',
+	'kUSBNotSent2Err': 'USB',
+	'kUSBQueueFull': 'USB',
+	'kUSBInternalReserved10': 'USB',
+	'kUSBPortDisabled': 'USB',
+	'dcmParamErr': 'Dictionary Manager',
+	'kRAInvalidParameter': 'Apple Remote Access',
+	'kATSUInvalidTextLayoutErr': 'ATSUI',
+	'kTextUnsupportedEncodingErr': 'Text Encoding Conversion',
+	'kUTCUnderflowErr': 'UTC Utilities',
+	'kATSUInvalidFontFallbacksErr': 'ATSUI',
+	'codecErr': 'QuickTime',
+	'kBadAdapterErr': 'PC Card',
+	'noDeviceForChannel': 'QuickTime',
+	'errAEBadKeyForm': 'Apple Event Registry',
+	'telGenericError': 'Telephone Manager',
+	'errTaskNotFound': 'Task Manager',
+	'pmBusyErr': 'Power Manager',
+	'kPowerHandlerExistsForDeviceErr': 'Power Manager',
+	'debuggingExecutionContextErr': 'Debugging Library',
+	'kHIDVersionIncompatibleErr': 'HID',
+	'kHIDSuccess': 'HID',
+	'kModemOutOfMemory': 'Open Transport',
+	'kTXNEndIterationErr': 'Multilingual Text Engine',
+	'printerStatusOpCodeNotSupportedErr': 'Printing Manager',
+	'errKCNotAvailable': 'Keychain Manager',
+	'kUCOutputBufferTooSmall': 'Unicode Utilities',
+	'kUCTSNoKeysAddedToObjectErr': 'Unicode Utilities',
+	'kUCTokenizerIterationFinished': 'Unicode Utilities',
+	'kMPIterationEndErr': 'Multiprocessing Services',
+	'kMPNanokernelNeedsMemoryErr': 'Multiprocessing Services',
+	'kCollateAttributesNotFoundErr': 'Text Utilities',
+	'kFNSInvalidReferenceErr': 'FontSync',
+	'kLocalesBufferTooSmallErr': 'Locales',
+	'kALMInternalErr': 'Settings Manager',
+	'kALMLocationNotFoundErr': 'Settings Manager',
+	'kSSpInternalErr': 'SoundSprocket',
+	'kNSpInitializationFailedErr': 'NetSprocket',
+	'kISpInternalErr': 'InputSprocket',
+	'kDSpNotInitializedErr': 'DrawSprocket',
+	'kFBCvTwinExceptionErr': 'Find By Content',
+	'notAQTVRMovieErr': 'QuickTime VR',
+	'themeInvalidBrushErr': 'Appearance Manager',
+	'errMessageNotSupported': 'Control Manager',
+	'kURLInvalidURLReferenceError': 'URL Access',
+	'errCppGeneral': 'C++ Exceptions',
+	'badComponentInstance': 'Component Manager',
+	'dsBusError': 'System Error',
+	'dsNoPk3': 'System Error',
+	'dsNoFPU': 'System Error',
+	'dsNoExtsMacsBug': 'System Error',
+	'CDEFNFnd': 'System Error',
+	'dsBadLibrary': 'System Error',
+	'kPOSIXErrorBase': 'POSIX',
+}
+
+# Ranges MacErrors.h reserves for a subsystem, as its comments state them.  Values in a
+# range that no other subsystem's run covers are classified with it.
+SUBSYSTEM_RANGES = [
+	(-874, -850, 'Help Manager'),
+	(-2739, -2720, 'Open Scripting Architecture'),
+	(-2799, -2760, 'Open Scripting Architecture'),
+	(-2899, -2800, 'Code Fragment Manager'),
+	(-3999, -3950, 'QuickDraw'),
+	(-6269, -6220, 'Display Manager'),
+	(-6960, -6951, 'USB'),
+	(-30539, -30500, 'Find By Content'),
+	(100000, 100999, 'POSIX'),
+]
+
+
+class Enumerator(object):
+	def __init__(self, name, expression, comment, order):
+		self.name = name
+		self.expression = expression
+		self.comment = comment
+		self.order = order
+		self.value = None
+		self.isReference = False
+		self.block = None           # first enumerator of the enclosing enum block
+
+
+def clean_comment(text):
+	text = text.strip()
+	if text.startswith('/*'):
+		text = text[2:]
+	if text.endswith('*/'):
+		text = text[:-2]
+	return ' '.join(text.split())
+
+
+def parse(path, enumerators=None, visited=None):
+	"""Returns the enumerators of path, and of the MacErrors headers it includes that
+	sit beside it, in the order the compiler sees them."""
+	enumerators = [] if enumerators is None else enumerators
+	visited = set() if visited is None else visited
+	inEnum = False
+	block = None
+	pending = None  # enumerator whose comment continues on the next line
+
+	visited.add(os.path.abspath(path))
+	with open(path, encoding='mac_roman') as source:
+		for line in source:
+			if pending is not None:
+				pending.comment += ' ' + line
+				if '*/' in line:
+					pending.comment = clean_comment(pending.comment)
+					pending = None
+				continue
+			if not inEnum:
+				included = INCLUDE.match(line)
+				if included is not None:
+					other = os.path.abspath(os.path.join(os.path.dirname(path), included.group(1)))
+					if other not in visited and os.path.exists(other):
+						parse(other, enumerators, visited)
+					continue
+				inEnum = bool(ENUM_START.match(line))
+				block = None
+				continue
+			if ENUM_END.match(line):
+				inEnum = False
+				continue
+			match = ENTRY.match(line)
+			if match is None:
+				continue
+			name, expression, _, comment = match.groups()
+			entry = Enumerator(name, expression.strip(), comment or '', len(enumerators))
+			entry.block = block = block or name
+			enumerators.append(entry)
+			if comment and '*/' not in comment:
+				pending = entry
+			else:
+				entry.comment = clean_comment(entry.comment)
+	return enumerators
+
+
+def to_status(value):
+	value &= 0xFFFFFFFF
+	return value - 0x100000000 if value & 0x80000000 else value
+
+
+def evaluate(enumerators):
+	byName = dict((e.name, e) for e in enumerators)
+
+	def value_of(entry, depth=0):
+		if entry.value is not None:
+			return entry.value
+		if depth > 16:
+			raise ValueError('circular definition of %s' % entry.name)
+		text = re.sub(r'^\((?:long|int|SInt32|OSStatus|OSErr|short)\)\s*', '', entry.expression)
+		if text in byName:
+			entry.isReference = True
+			entry.value = value_of(byName[text], depth + 1)
+		else:
+			number = re.match(r'^([-+]?)\s*(0[xX][0-9A-Fa-f]+|\d+)[uUlL]*$', text)
+			if number is None:
+				raise ValueError('cannot evaluate %s = %s' % (entry.name, entry.expression))
+			entry.value = to_status(int(number.group(1) + number.group(2), 0))
+		return entry.value
+
+	for entry in enumerators:
+		value_of(entry)
+
+
+def group_by_code(enumerators):
+	codes = {}
+	for entry in enumerators:
+		codes.setdefault(entry.value, []).append(entry)
+	for names in codes.values():
+		names.sort(key=lambda e: (e.isReference or bool(RANGE_MARKER.search(e.name)), e.order))
+	return codes
+
+
+def classify(codes):
+	"""Sorted, disjoint (low, high, subsystem) intervals covering the runs of codes."""
+	runs = []
+	for code in sorted(codes):
+		entry = codes[code][0]
+		if entry.block is None:
+			continue                # noErr
+		if entry.block not in SUBSYSTEMS:
+			raise ValueError('no subsystem for the enum block starting with %s' % entry.block)
+		subsystem = SUBSYSTEMS[entry.block]
+		if runs and runs[-1][2] == subsystem:
+			runs[-1][1] = code
+		else:
+			runs.append([code, code, subsystem])
+
+	intervals = [tuple(run) for run in runs]
+	for low, high, subsystem in SUBSYSTEM_RANGES:
+		cursor = low
+		for runLow, runHigh, _ in runs:
+			if runHigh < cursor or runLow > high:
+				continue
+			if runLow > cursor:
+				intervals.append((cursor, runLow - 1, subsystem))
+			cursor = runHigh + 1
+		if cursor <= high:
+			intervals.append((cursor, high, subsystem))
+
+	merged = []
+	for interval in sorted(intervals):
+		if merged and merged[-1][2] == interval[2] and merged[-1][1] + 1 >= interval[0]:
+			merged[-1] = (merged[-1][0], max(merged[-1][1], interval[1]), interval[2])
+		else:
+			merged.append(interval)
+	return merged
+
+
+def bucket_ranges(intervals):
+	"""The first range to search for each bucket of OSErr values, and the most ranges
+	that start later within one bucket."""
+	lows = [low for low, _, _ in intervals]
+	width = 1 << RANGE_BUCKET_SHIFT
+	starts = []
+	scan = 0
+	for bucket in range(-32768, 32768, width):
+		first = max(bisect.bisect_right(lows, bucket) - 1, 0)
+		starts.append(first)
+		scan = max(scan, bisect.bisect_right(lows, bucket + width - 1) - 1 - first)
+	if len(intervals) > 255:
+		raise ValueError('%d ranges do not fit the uint8_t range tables' % len(intervals))
+	return starts, scan
+
+
+def mix(value, seed):
+	x = (value ^ seed) & 0xFFFFFFFF
+	x = (x * 0x9E3779B1) & 0xFFFFFFFF
+	x ^= x >> 15
+	x = (x * 0x85EBCA77) & 0xFFFFFFFF
+	x ^= x >> 13
+	return x
+
+
+def place(codes):
+	slotCount = 1
+	while slotCount * TABLE_LOAD < len(codes):
+		slotCount *= 2
+	bucketCount = 1
+	while bucketCount * BUCKET_SIZE < len(codes):
+		bucketCount *= 2
+
+	buckets = [[] for _ in range(bucketCount)]
+	for code in codes:
+		buckets[mix(code & 0xFFFFFFFF, 0) & (bucketCount - 1)].append(code)
+
+	slots = [None] * slotCount
+	displacements = [0] * bucketCount
+	for index in sorted(range(bucketCount), key=lambda b: -len(buckets[b])):
+		members = buckets[index]
+		if not members:
+			continue
+		seed = 1
+		while True:
+			targets = [mix(code & 0xFFFFFFFF, seed) & (slotCount - 1) for code in members]
+			if len(set(targets)) == len(targets) and all(slots[t] is None for t in targets):
+				break
+			seed += 1
+		displacements[index] = seed
+		for code, target in zip(members, targets):
+			slots[target] = code
+	return slots, displacements
+
+
+def c_string(text):
+	"""A C literal for text, NUL-terminated, in UTF-8 with everything non-ASCII escaped."""
+	escaped = []
+	for byte in bytearray(text.encode('utf-8')):
+		char = chr(byte)
+		if char in '\\"':
+			escaped.append('\\' + char)
+		elif 0x20 <= byte < 0x7F and char != '?':   # '?' could start a trigraph
+			escaped.append(char)
+		else:
+			escaped.append('\\%03o' % byte)
+	return '"' + ''.join(escaped) + '\\0"'
+
+
+def emit(path, source, codes, slots, displacements, intervals):
+	pool = []
+	offsets = {}
+	poolSize = [0]
+
+	def intern(text):
+		if text not in offsets:
+			offsets[text] = poolSize[0]
+			poolSize[0] += len(text.encode('utf-8')) + 1
+			pool.append(text)
+		return offsets[text]
+
+	intern('')
+	nameRecords = []
+	firstNames = []
+	ordered = sorted(codes)
+	index = dict((code, position) for position, code in enumerate(ordered))
+	for code in ordered:
+		firstNames.append(len(nameRecords))
+		for entry in codes[code]:
+			nameRecords.append((intern(entry.name), intern(entry.comment)))
+	subsystems = sorted(set(subsystem for _, _, subsystem in intervals))
+	subsystemIDs = dict((subsystem, index + 1) for index, subsystem in enumerate(subsystems))
+	subsystemNames = [0] + [intern(subsystem) for subsystem in subsystems]
+	rangeBuckets, rangeScan = bucket_ranges(intervals)
+
+	out = []
+	out.append('/*')
+	out.append('     File:       MacErrorsTable.h')
+	out.append('')
+	out.append('     Contains:   Generated by tools/MacErrorsTable.py from %s; do not edit.' % source)
+	out.append('')
+	out.append('                 %d names, %d distinct codes, %d slots.' % (len(nameRecords), len(codes), len(slots)))
+	out.append('                 %d subsystems, %d ranges.' % (len(subsystems), len(intervals)))
+	out.append('')
+	out.append('*/')
+	out.append('')
+	out.append('#define kMacErrorsTableSlotMask         0x%Xu' % (len(slots) - 1))
+	out.append('#define kMacErrorsTableBucketMask       0x%Xu' % (len(displacements) - 1))
+	out.append('#define kMacErrorsTableNameCount        %d' % len(nameRecords))
+	out.append('#define kMacErrorsTableCodeCount        %d' % len(ordered))
+	out.append('#define kMacErrorsSubsystemCount        %d' % len(subsystems))
+	out.append('#define kMacErrorsRangeCount            %d' % len(intervals))
+	out.append('#define kMacErrorsRangeBucketShift      %d' % RANGE_BUCKET_SHIFT)
+	out.append('#define kMacErrorsRangeScan             %d' % rangeScan)
+	out.append('')
+	out.append('static const char gMacErrorsStrings[] =')
+	for text in pool:
+		out.append('\t' + c_string(text))
+	out.append('\t;')
+	out.append('')
+	out.append('static const struct MacErrorsName gMacErrorsNames[%d] = {' % len(nameRecords))
+	for name, comment in nameRecords:
+		out.append('\t{ %6d, %6d },' % (name, comment))
+	out.append('};')
+	out.append('')
+	out.append('/* Every code, in order; a code\'s position here is its index. */')
+	out.append('static const int32_t gMacErrorsCodes[%d] = {' % len(ordered))
+	for row in range(0, len(ordered), 8):
+		out.append('\t' + ' '.join('%11d,' % code for code in ordered[row:row + 8]))
+	out.append('};')
+	out.append('')
+	out.append('/* The first entry in gMacErrorsNames of each code, by index. */')
+	out.append('static const uint16_t gMacErrorsFirstNames[%d] = {' % len(firstNames))
+	for row in range(0, len(firstNames), 12):
+		out.append('\t' + ' '.join('%4d,' % first for first in firstNames[row:row + 12]))
+	out.append('};')
+	out.append('')
+	out.append('static const uint32_t gMacErrorsDisplacements[%d] = {' % len(displacements))
+	for row in range(0, len(displacements), 8):
+		out.append('\t' + ' '.join('%5d,' % d for d in displacements[row:row + 8]))
+	out.append('};')
+	out.append('')
+	out.append('/* Subsystem IDs are 1-based and assigned in order of name; 0 is unclassified. */')
+	out.append('static const uint32_t gMacErrorsSubsystemNames[%d] = {' % len(subsystemNames))
+	for row in range(0, len(subsystemNames), 8):
+		out.append('\t' + ' '.join('%6d,' % offset for offset in subsystemNames[row:row + 8]))
+	out.append('};')
+	out.append('')
+	out.append('/* Followed by kMacErrorsRangeScan sentinels, so a scan never leaves the table. */')
+	lows = [low for low, _, _ in intervals] + [0x7FFFFFFF] * rangeScan
+	out.append('static const int32_t gMacErrorsRangeLows[%d] = {' % len(lows))
+	for row in range(0, len(lows), 8):
+		out.append('\t' + ' '.join('%11d,' % low for low in lows[row:row + 8]))
+	out.append('};')
+	out.append('')
+	out.append('static const int32_t gMacErrorsRangeHighs[%d] = {' % len(intervals))
+	for row in range(0, len(intervals), 8):
+		out.append('\t' + ' '.join('%11d,' % high for _, high, _ in intervals[row:row + 8]))
+	out.append('};')
+	out.append('')
+	out.append('/* The first range to search for OSErr values, by (value + 32768) >> kMacErrorsRangeBucketShift. */')
+	out.append('static const uint8_t gMacErrorsRangeBuckets[%d] = {' % len(rangeBuckets))
+	for row in range(0, len(rangeBuckets), 16):
+		out.append('\t' + ' '.join('%3d,' % index for index in rangeBuckets[row:row + 16]))
+	out.append('};')
+	out.append('')
+	out.append('static const uint8_t gMacErrorsRangeSubsystems[%d] = {' % len(intervals))
+	for row in range(0, len(intervals), 16):
+		out.append('\t' + ' '.join('%3d,' % subsystemIDs[subsystem] for _, _, subsystem in intervals[row:row + 16]))
+	out.append('};')
+	out.append('')
+	out.append('static const struct MacErrorsSlot gMacErrorsSlots[%d] = {' % len(slots))
+	for code in slots:
+		if code is None:
+			out.append('\t{           0,    0, 0 },')
+		else:
+			out.append('\t{ %11d, %4d, %d },' % (code, index[code], len(codes[code])))
+	out.append('};')
+	out.append('')
+
+	with open(path, 'w') as header:
+		header.write('\n'.join(out))
+
+
+CONSTEXPR_PROLOGUE = """/*
+     File:       MacErrorsNames.h
+
+     Contains:   Compile-time names of the OSStatus values defined in MacErrors.h.
+
+                 Generated by tools/MacErrorsTable.py --constexpr from MacErrors.h; do
+                 not edit.  Run "make generated_headers" after changing MacErrors.h.
+
+                 MacErrors::ErrorName<fnfErr>() is the string literal "fnfErr", found while
+                 compiling; a code MacErrors.h does not define fails to compile.  An alias
+                 yields the name GetMacErrorName() would return for its value, so
+                 ErrorName<iIOAbortErr>() is "abortErr".  MacErrors::ErrorNameOf(status) is
+                 the same search as a constexpr function returning NULL for an unknown
+                 code; called at run time it links the tables below into the caller, so
+                 use GetMacErrorName() from MacErrorsLookup.h there instead.
+
+                 Values are taken as OSStatus, so enumerators wider than 32 bits, such as
+                 badComponentInstance ((long)0x80008001), name the value they wrap to.
+
+                 Requires C++17.  Including this header from C does nothing.
+
+                 %(names)d codes.
+
+*/
+#ifndef __MACERRORSNAMES__
+#define __MACERRORSNAMES__
+
+#if defined(__cplusplus) && (__cplusplus >= 201703L)
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace MacErrors {
+
+namespace Private {
+
+	inline constexpr int32_t kCodes[%(names)d] = {
+"""
+
+CONSTEXPR_EPILOGUE = """	};
+
+	inline constexpr size_t kCodeCount = sizeof(kCodes) / sizeof(kCodes[0]);
+
+	constexpr int32_t
+	ToStatus(long long status) noexcept
+	{
+		return (int32_t)(uint32_t)(unsigned long long)status;
+	}
+
+} /* namespace Private */
+
+/*
+ *  ErrorNameOf()
+ *
+ *  Summary:
+ *    Returns the name of an OSStatus value, or NULL if MacErrors.h does not define it.
+ *    Usable in constant expressions.
+ */
+constexpr const char *
+ErrorNameOf(long long status) noexcept
+{
+	int32_t     code = Private::ToStatus(status);
+	size_t      low = 0;
+	size_t      high = Private::kCodeCount;
+
+	while ( low < high )
+	{
+		size_t middle = low + (high - low) / 2;
+
+		if ( Private::kCodes[middle] < code )
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	return ( low < Private::kCodeCount && Private::kCodes[low] == code ) ? Private::kNames[low] : NULL;
+}
+
+/*
+ *  ErrorName()
+ *
+ *  Summary:
+ *    The name of an OSStatus constant, always computed at compile time.
+ *
+ *  Examples:
+ *     fprintf(stderr, "open failed: %s\\n", MacErrors::ErrorName<fnfErr>());
+ *     static_assert(MacErrors::ErrorName<-43>()[0] == 'f', "");
+ */
+template <long long status>
+constexpr const char *
+ErrorName() noexcept
+{
+	constexpr const char *name = ErrorNameOf(status);
+
+	static_assert(name != NULL, "not an OSStatus defined in MacErrors.h");
+	return name;
+}
+
+} /* namespace MacErrors */
+
+#endif /* defined(__cplusplus) && (__cplusplus >= 201703L) */
+
+#endif /* __MACERRORSNAMES__ */
+"""
+
+
+def emit_constexpr(path, codes):
+	ordered = sorted(codes)
+	out = [CONSTEXPR_PROLOGUE % {'names': len(ordered)}]
+	for row in range(0, len(ordered), 8):
+		out.append('\t\t' + ' '.join('%d,' % code for code in ordered[row:row + 8]) + '\n')
+	out.append('\t};\n\n')
+	out.append('\tinline constexpr const char *kNames[%d] = {\n' % len(ordered))
+	for code in ordered:
+		out.append('\t\t"%s",\n' % codes[code][0].name)
+	out.append(CONSTEXPR_EPILOGUE)
+	with open(path, 'w') as header:
+		header.write(''.join(out))
+
+
+CODES_PROLOGUE = """/*
+     File:       MacErrorsCodes.h
+
+     Contains:   The values of the names defined in MacErrors.h, looked up by name.
+
+                 Generated by tools/MacErrorsTable.py --codes from MacErrors.h; do not
+                 edit.  Run "make generated_headers" after changing MacErrors.h.
+
+                 MacErrors::ErrorCodeOf("fnfErr") is -43, and an alias yields the value it
+                 stands for, so ErrorCodeOf("iIOAbortErr") is abortErr.  A name that is
+                 not defined yields std::nullopt.  Every name hashes to the only slot it
+                 can be in, so a lookup is one hash of the name, 8 bytes at a time, and
+                 one comparison, 16 bytes at a time with SSE2 or NEON where available.
+                 Nothing is allocated, nothing past the end of the name is read (it need
+                 not be terminated), and the same function works in constant expressions:
+
+                     static_assert(*MacErrors::ErrorCodeOf("fnfErr") == -43, "");
+
+                 Values are taken as OSStatus, as in MacErrorsNames.h.
+
+                 Requires C++17.  Including this header from C does nothing.
+
+                 %(count)d names.
+
+*/
+#ifndef __MACERRORSCODES__
+#define __MACERRORSCODES__
+
+#if defined(__cplusplus) && (__cplusplus >= 201703L)
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <optional>
+#include <string_view>
+
+/* Outside constant expressions, names are read with word and vector loads. */
+#if defined(__clang__) || (defined(__GNUC__) && (__GNUC__ >= 9))
+	#define __MACERRORSCODES_LOADS__ 1
+	#if defined(__SSE2__)
+		#include <emmintrin.h>
+		#define __MACERRORSCODES_SSE2__ 1
+	#elif defined(__ARM_NEON) && defined(__aarch64__)
+		#include <arm_neon.h>
+		#define __MACERRORSCODES_NEON__ 1
+	#endif
+#endif
+
+namespace MacErrors {
+
+namespace Private {
+
+	struct NameKey {
+		uint16_t    offset;             /* into kNamePool */
+		uint8_t     length;
+		int32_t     status;
+	};
+
+	inline constexpr size_t kNameCount = %(count)d;
+	inline constexpr size_t kNameBucketCount = %(buckets)d;
+	inline constexpr size_t kNameLengthMax = %(longest)d;
+
+	/* Every name, unterminated, in slot order. */
+	inline constexpr char kNamePool[] =
+"""
+
+CODES_EPILOGUE = """
+#if defined(__MACERRORSCODES_LOADS__)
+	inline uint64_t
+	NameLoad64(const char *bytes) noexcept
+	{
+		uint64_t word;
+
+		__builtin_memcpy(&word, bytes, sizeof(word));
+	#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+		word = __builtin_bswap64(word);
+	#endif
+		return word;
+	}
+
+	inline uint64_t
+	NameLoad32(const char *bytes) noexcept
+	{
+		uint32_t word;
+
+		__builtin_memcpy(&word, bytes, sizeof(word));
+	#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+		word = __builtin_bswap32(word);
+	#endif
+		return word;
+	}
+
+	/* The first count (1 to 7) bytes, zero-extended, read with at most two overlapping loads. */
+	inline uint64_t
+	NameLoadShort(const char *bytes, size_t count) noexcept
+	{
+		if ( count >= 4 )
+			return NameLoad32(bytes) | NameLoad32(bytes + count - 4) << (8 * (count - 4));
+		return (uint64_t)(unsigned char)bytes[0] |
+			   (uint64_t)(unsigned char)bytes[count / 2] << (8 * (count / 2)) |
+			   (uint64_t)(unsigned char)bytes[count - 1] << (8 * (count - 1));
+	}
+#endif
+
+	/* The index-th 8 bytes of name, little-endian and zero-padded. */
+	constexpr uint64_t
+	NameWord(std::string_view name, size_t index) noexcept
+	{
+		uint64_t word = 0;
+
+#if defined(__MACERRORSCODES_LOADS__)
+		if ( !__builtin_is_constant_evaluated() )
+		{
+			size_t end = 8 * index + 8;
+
+			if ( end <= name.size() )
+				return NameLoad64(name.data() + end - 8);
+			if ( name.size() >= 8 )
+				return NameLoad64(name.data() + name.size() - 8) >> (8 * (end - name.size()));
+			return NameLoadShort(name.data(), name.size());
+		}
+#endif
+		for ( size_t i = 8 * index; i < name.size() && i < 8 * index + 8; ++i )
+			word |= (uint64_t)(unsigned char)name[i] << (8 * (i % 8));
+		return word;
+	}
+
+	/* Must match key_hash() in tools/MacErrorsTable.py. */
+	constexpr uint64_t
+	NameHash(std::string_view name) noexcept
+	{
+		uint64_t hash = name.size() * 0x9E3779B97F4A7C15ull;
+
+		for ( size_t i = 0; i < (name.size() + 7) / 8; ++i )
+		{
+			hash = (hash ^ NameWord(name, i)) * 0xFF51AFD7ED558CCDull;
+			hash ^= hash >> 29;
+		}
+		return hash;
+	}
+
+	/* Must match key_slot() in tools/MacErrorsTable.py. */
+	constexpr size_t
+	NameSlot(uint64_t hash) noexcept
+	{
+		uint64_t    seed = kNameDisplacements[((hash >> 32) * kNameBucketCount) >> 32];
+		uint64_t    x = hash ^ (seed * 0x9E3779B97F4A7C15ull);
+
+		x ^= x >> 33;
+		x *= 0xC4CEB9FE1A85EC53ull;
+		x ^= x >> 33;
+		return (size_t)(((x & 0xFFFFFFFFu) * kNameCount) >> 32);
+	}
+
+#if defined(__MACERRORSCODES_LOADS__)
+	/* Compares length (at least 1) bytes; the last block of each overlaps the one before. */
+	inline bool
+	NameEquals(const char *name, const char *candidate, size_t length) noexcept
+	{
+	#if defined(__MACERRORSCODES_SSE2__) || defined(__MACERRORSCODES_NEON__)
+		if ( length >= 16 )
+		{
+			for ( size_t i = 0; ; i += 16 )
+			{
+				size_t at = (i + 16 < length) ? i : length - 16;
+		#if defined(__MACERRORSCODES_SSE2__)
+				int same = _mm_movemask_epi8(_mm_cmpeq_epi8(
+						   _mm_loadu_si128((const __m128i *)(const void *)(name + at)),
+						   _mm_loadu_si128((const __m128i *)(const void *)(candidate + at))));
+
+				if ( same != 0xFFFF )
+					return false;
+		#else
+				if ( vminvq_u8(vceqq_u8(vld1q_u8((const uint8_t *)(name + at)),
+										vld1q_u8((const uint8_t *)(candidate + at)))) != 0xFF )
+					return false;
+		#endif
+				if ( at + 16 == length )
+					return true;
+			}
+		}
+	#endif
+		if ( length >= 8 )
+		{
+			for ( size_t i = 0; i + 8 < length; i += 8 )
+			{
+				if ( NameLoad64(name + i) != NameLoad64(candidate + i) )
+					return false;
+			}
+			return NameLoad64(name + length - 8) == NameLoad64(candidate + length - 8);
+		}
+		return NameLoadShort(name, length) == NameLoadShort(candidate, length);
+	}
+#endif
+
+} /* namespace Private */
+
+/*
+ *  ErrorCodeOf()
+ *
+ *  Summary:
+ *    Returns the value of a name MacErrors.h defines ("fnfErr", "handlerNotFoundErr",
+ *    or an alias such as "iIOAbortErr"), or std::nullopt if it defines no such name.
+ *    Names are case-sensitive and must match exactly.  Usable in constant expressions.
+ */
+constexpr std::optional<int32_t>
+ErrorCodeOf(std::string_view name) noexcept
+{
+	if ( name.size() > Private::kNameLengthMax )
+		return std::nullopt;
+
+	const Private::NameKey &key = Private::kNameKeys[Private::NameSlot(Private::NameHash(name))];
+
+	if ( key.length != name.size() )
+		return std::nullopt;
+#if defined(__MACERRORSCODES_LOADS__)
+	if ( !__builtin_is_constant_evaluated() )
+		return Private::NameEquals(name.data(), &Private::kNamePool[key.offset], key.length) ?
+			std::optional<int32_t>(key.status) : std::nullopt;
+#endif
+	for ( size_t i = 0; i < key.length; ++i )
+	{
+		if ( name[i] != Private::kNamePool[key.offset + i] )
+			return std::nullopt;
+	}
+	return key.status;
+}
+
+} /* namespace MacErrors */
+
+#endif /* defined(__cplusplus) && (__cplusplus >= 201703L) */
+
+#endif /* __MACERRORSCODES__ */
+"""
+
+
+def key_hash(name):
+	data = name.encode('ascii')
+	data += b'\0' * (-len(data) % 8)
+	value = (len(name) * 0x9E3779B97F4A7C15) & MASK64
+	for i in range(0, len(data), 8):
+		value = ((value ^ struct.unpack('<Q', data[i:i + 8])[0]) * 0xFF51AFD7ED558CCD) & MASK64
+		value ^= value >> 29
+	return value
+
+
+def key_slot(value, seed, count):
+	x = value ^ ((seed * 0x9E3779B97F4A7C15) & MASK64)
+	x ^= x >> 33
+	x = (x * 0xC4CEB9FE1A85EC53) & MASK64
+	x ^= x >> 33
+	return ((x & 0xFFFFFFFF) * count) >> 32
+
+
+def place_names(names):
+	"""Displacements giving each name its own slot among len(names), and the slot order."""
+	count = len(names)
+	bucketCount = max(1, count // CODES_BUCKET_SIZE)
+	hashes = [key_hash(name) for name in names]
+	if len(set(hashes)) != count:
+		raise ValueError('two names share a hash')
+	buckets = [[] for _ in range(bucketCount)]
+	for name, value in zip(names, hashes):
+		buckets[((value >> 32) * bucketCount) >> 32].append((name, value))
+
+	slots = [None] * count
+	displacements = [0] * bucketCount
+	for index in sorted(range(bucketCount), key=lambda b: -len(buckets[b])):
+		members = buckets[index]
+		if not members:
+			continue
+		seed = 0
+		while True:
+			targets = [key_slot(value, seed, count) for _, value in members]
+			if len(set(targets)) == len(targets) and all(slots[t] is None for t in targets):
+				break
+			seed += 1
+			if seed > 0xFFFF:
+				raise ValueError('no displacement for bucket %d' % index)
+		displacements[index] = seed
+		for (name, _), target in zip(members, targets):
+			slots[target] = name
+	return slots, displacements
+
+
+def emit_codes(path, codes):
+	values = dict((entry.name, code) for code in codes for entry in codes[code])
+	names = sorted(values)
+	longest = max(len(name) for name in names)
+	slots, displacements = place_names(names)
+
+	pool = []
+	offsets = {}
+	poolSize = 0
+	for name in slots:
+		offsets[name] = poolSize
+		pool.append(name)
+		poolSize += len(name)
+	if poolSize > 0xFFFF or longest > 0xFF:
+		raise ValueError('names do not fit the NameKey fields')
+
+	out = [CODES_PROLOGUE % {'count': len(names), 'buckets': len(displacements), 'longest': longest}]
+	line = ''
+	for name in pool:
+		if len(line) + len(name) > 88:
+			out.append('\t\t"%s"\n' % line)
+			line = ''
+		line += name
+	out.append('\t\t"%s";\n\n' % line)
+	out.append('\tinline constexpr NameKey kNameKeys[kNameCount] = {\n')
+	for row in range(0, len(slots), 4):
+		out.append('\t\t' + ' '.join('{ %5d, %2d, %11d },' % (offsets[name], len(name), values[name])
+									 for name in slots[row:row + 4]) + '\n')
+	out.append('\t};\n\n')
+	out.append('\tinline constexpr uint16_t kNameDisplacements[kNameBucketCount] = {\n')
+	for row in range(0, len(displacements), 12):
+		out.append('\t\t' + ' '.join('%5d,' % seed for seed in displacements[row:row + 12]) + '\n')
+	out.append('\t};\n')
+	out.append(CODES_EPILOGUE)
+	with open(path, 'w') as header:
+		header.write(''.join(out))
+
+
+def front_code(names):
+	"""Front-codes sorted names: each is a byte giving the length it shares with the one
+	before, then the rest of it with the top bit of its last byte set.  The first name
+	of each block is stored whole, so a lookup decodes one block at most."""
+	blocks = []
+	data = bytearray()
+	previous = b''
+	for index, name in enumerate(names):
+		name = name.encode('ascii')
+		shared = 0
+		if index % DATABASE_NAME_BLOCK == 0:
+			blocks.append(len(data))
+		else:
+			limit = min(len(previous), len(name) - 1, 255)
+			while shared < limit and previous[shared] == name[shared]:
+				shared += 1
+		suffix = bytearray(name[shared:])
+		suffix[-1] |= 0x80
+		data.append(shared)
+		data += suffix
+		previous = name
+	return blocks, data
+
+
+def split_words(text):
+	"""Splits text into words, each keeping the spaces that follow it."""
+	return re.findall(r'\S+\s*|\s+', text)
+
+
+def encode_comments(comments):
+	"""Encodes comments against a dictionary of the words that save space by being in it.
+	A byte below 0x80 is itself; otherwise it and the next byte are a big-endian word
+	index with the top bit set, DATABASE_WORD_ESCAPE being followed by a literal byte."""
+	counts = collections.Counter()
+	for comment in comments:
+		counts.update(split_words(comment))
+	words = [word for word, count in counts.most_common()
+		if len(word.encode('utf-8')) > 2 and count * (len(word.encode('utf-8')) - 2) > len(word.encode('utf-8')) + 4]
+	words = words[:DATABASE_WORD_ESCAPE]
+	index = dict((word, position) for position, word in enumerate(words))
+
+	encoded = []
+	for comment in comments:
+		data = bytearray()
+		for word in split_words(comment):
+			if word in index:
+				data += struct.pack('>H', 0x8000 | index[word])
+				continue
+			for byte in bytearray(word.encode('utf-8')):
+				if byte >= 0x80:
+					data += struct.pack('>H', 0x8000 | DATABASE_WORD_ESCAPE)
+				data.append(byte)
+		encoded.append(bytes(data))
+	return [word.encode('utf-8') for word in words], encoded
+
+
+def string_table(strings):
+	"""uint32 offsets of each string and of the end, and the strings laid end to end."""
+	offsets = []
+	data = bytearray()
+	for text in strings:
+		offsets.append(len(data))
+		data += text
+	offsets.append(len(data))
+	return offsets, data
+
+
+def emit_database(path, codes):
+	ordered = sorted(codes)
+	names = sorted(set(entry.name for code in ordered for entry in codes[code]))
+	nameIDs = dict((name, position) for position, name in enumerate(names))
+	comments = [''] + sorted(set(entry.comment for code in ordered for entry in codes[code]) - set(['']))
+	commentIDs = dict((comment, position) for position, comment in enumerate(comments))
+
+	codeNames = []
+	nameRefs = []
+	for code in ordered:
+		codeNames.append((len(nameRefs), len(codes[code])))
+		for entry in codes[code]:
+			nameRefs.append((nameIDs[entry.name], commentIDs[entry.comment]))
+
+	nameBlocks, nameData = front_code(names)
+	words, encoded = encode_comments(comments)
+	wordOffsets, wordData = string_table(words)
+	commentOffsets, commentData = string_table(encoded)
+
+	sections = [
+		struct.pack('<%di' % len(ordered), *ordered),
+		b''.join(struct.pack('<HH', first, count) for first, count in codeNames),
+		b''.join(struct.pack('<HH', name, comment) for name, comment in nameRefs),
+		struct.pack('<%dI' % len(nameBlocks), *nameBlocks),
+		bytes(nameData),
+		struct.pack('<%dI' % len(commentOffsets), *commentOffsets),
+		bytes(commentData),
+		struct.pack('<%dI' % len(wordOffsets), *wordOffsets),
+		bytes(wordData),
+	]
+	headerFormat = '<18I'
+	offsets = []
+	body = bytearray()
+	position = struct.calcsize(headerFormat)
+	for section in sections:
+		padding = (-position) % 4
+		body += b'\0' * padding
+		position += padding
+		offsets.append(position)
+		body += section
+		position += len(section)
+
+	header = struct.pack(headerFormat,
+		DATABASE_MAGIC, DATABASE_VERSION, position, DATABASE_NAME_BLOCK,
+		len(ordered), offsets[0], offsets[1],
+		len(nameRefs), offsets[2],
+		len(names), offsets[3], offsets[4],
+		len(comments), offsets[5], offsets[6],
+		len(words), offsets[7], offsets[8])
+	with open(path, 'wb') as database:
+		database.write(header + bytes(body))
+
+
+def errno_mappings(codes):
+	"""(code, errno name) pairs from OSStatus to errno, and the pairs from errno back."""
+	byName = dict((entry.name, code) for code in codes for entry in codes[code])
+	forward = []
+	backward = []
+	seen = set()
+	for name, errno in ERRNO_CLASSIC:
+		if name not in byName:
+			raise ValueError('%s is not defined in MacErrors.h' % name)
+		forward.append((byName[name], errno))
+		if errno not in seen:
+			backward.append((errno, byName[name]))
+			seen.add(errno)
+	for name, code in sorted(byName.items(), key=lambda item: item[1]):
+		match = re.match(r'^kPOSIXError(E[A-Z0-9]+)$', name)
+		if match:
+			forward.append((code, match.group(1)))
+			if match.group(1) not in seen:
+				backward.append((match.group(1), code))
+				seen.add(match.group(1))
+	mapped = set(code for code, _ in forward)
+	for code in sorted(codes, reverse=True):
+		for entry in codes[code]:
+			match = re.match(r'^k(E[A-Z0-9]+)Err$', entry.name)
+			if match and code not in mapped:
+				forward.append((code, match.group(1)))
+				mapped.add(code)
+	return forward, backward
+
+
+def errno_guard(errno, indexed=False):
+	condition = 'defined(%s) && %s < kMacErrorsErrnoLimit' % (errno, errno)
+	if indexed and errno in ERRNO_ALIASES:
+		alias = ERRNO_ALIASES[errno]
+		condition += ' && (!defined(%s) || %s != %s)' % (alias, errno, alias)
+	return '#if ' + condition
+
+
+def emit_errno(path, codes):
+	forward, backward = errno_mappings(codes)
+	classicSpan = 1
+	for code, _ in forward:
+		if code < 0:
+			while classicSpan <= 1 - code:       # keep the last entry free for the runtime
+				classicSpan *= 2
+	if classicSpan > 16384:
+		raise ValueError('classic codes need a %d entry table' % classicSpan)
+
+	def status_index(code):
+		if -classicSpan < code <= 0:
+			return -code
+		if 0 <= code - ERRNO_POSIX_BASE < ERRNO_POSIX_SPAN:
+			return classicSpan + code - ERRNO_POSIX_BASE
+		raise ValueError('no table entry for %d' % code)
+
+	out = []
+	out.append('/*')
+	out.append('     File:       MacErrorsErrnoTable.h')
+	out.append('')
+	out.append('     Contains:   Generated by tools/MacErrorsTable.py --errno from MacErrors.h; do not edit.')
+	out.append('')
+	out.append('                 %d codes to errno, %d errno values back.' % (len(forward), len(backward)))
+	out.append('')
+	out.append('*/')
+	out.append('')
+	out.append('#define kMacErrorsErrnoClassicSpan      %d' % classicSpan)
+	out.append('#define kMacErrorsErrnoPOSIXBase        %d' % ERRNO_POSIX_BASE)
+	out.append('#define kMacErrorsErrnoPOSIXSpan        %d' % ERRNO_POSIX_SPAN)
+	out.append('#define kMacErrorsErrnoLimit            %d' % ERRNO_LIMIT)
+	out.append('')
+	out.append('/*')
+	out.append(' *  The errno of each code, 0 for none: the code negated for classic codes, then')
+	out.append(' *  kMacErrorsErrnoPOSIXSpan entries from kMacErrorsErrnoPOSIXBase.  Bytes, with four')
+	out.append(' *  to spare so 32-bit gathers can read any entry.')
+	out.append(' */')
+	out.append('static const uint8_t gMacErrorsErrnos[kMacErrorsErrnoClassicSpan + kMacErrorsErrnoPOSIXSpan + 4] = {')
+	for code, errno in forward:
+		out.append(errno_guard(errno))
+		out.append('\t[%d] = %s,%s' % (status_index(code), errno, '' if code > 0 else '\t\t/* %d */' % code))
+		out.append('#endif')
+	out.append('};')
+	out.append('')
+	out.append('/* The code each errno translates back to, 0 for none. */')
+	out.append('static const int32_t gMacErrorsErrnoStatuses[kMacErrorsErrnoLimit] = {')
+	for errno, code in backward:
+		out.append(errno_guard(errno, True))
+		out.append('\t[%s] = %d,' % (errno, code))
+		out.append('#endif')
+	out.append('};')
+	out.append('')
+	with open(path, 'w') as header:
+		header.write('\n'.join(out))
+
+
+def emit_subsystems(path, codes):
+	def literal(text):
+		return c_string(text)[:-3] + '"'
+
+	ordered = [code for code in sorted(codes) if codes[code][0].block is not None]
+
+	out = []
+	out.append('/*')
+	out.append('     File:       MacErrorsSubsystemCheck.h')
+	out.append('')
+	out.append('     Contains:   Generated by tools/MacErrorsTable.py --subsystems from MacErrors.h; do not edit.')
+	out.append('')
+	out.append('                 %d codes, %d reserved ranges.' % (len(ordered), len(SUBSYSTEM_RANGES)))
+	out.append('')
+	out.append('*/')
+	out.append('')
+	out.append('#define kMacErrorsSubsystemCheckCodeCount   %d' % len(ordered))
+	out.append('#define kMacErrorsSubsystemCheckRangeCount  %d' % len(SUBSYSTEM_RANGES))
+	out.append('')
+	out.append('/* Every code but noErr, in order, with the subsystem of its first name. */')
+	out.append('static const struct { int32_t code; const char *subsystem; } gMacErrorsSubsystemCheckCodes[] = {')
+	for code in ordered:
+		entry = codes[code][0]
+		out.append('\t{ %d, %s },\t\t/* %s */' % (code, literal(SUBSYSTEMS[entry.block]), entry.name))
+	out.append('};')
+	out.append('')
+	out.append('/* The ranges MacErrors.h reserves for a subsystem. */')
+	out.append('static const struct { int32_t low; int32_t high; const char *subsystem; } gMacErrorsSubsystemCheckRanges[] = {')
+	for low, high, subsystem in SUBSYSTEM_RANGES:
+		out.append('\t{ %d, %d, %s },' % (low, high, literal(subsystem)))
+	out.append('};')
+	out.append('')
+	with open(path, 'w') as header:
+		header.write('\n'.join(out))
+
+
+def main(argv):
+	mode = None
+	if len(argv) > 1 and argv[1] in ('--constexpr', '--codes', '--database', '--errno', '--subsystems'):
+		mode = argv[1]
+		argv = argv[:1] + argv[2:]
+	if len(argv) != 3:
+		sys.stderr.write('usage: %s [--constexpr | --codes | --database | --errno | --subsystems] <MacErrors.h> <output>\n' % argv[0])
+		return 1
+	enumerators = parse(argv[1])
+	enumerators.insert(0, Enumerator('noErr', '0', 'No error', -1))
+	evaluate(enumerators)
+	codes = group_by_code(enumerators)
+	if mode == '--constexpr':
+		emit_constexpr(argv[2], codes)
+		return 0
+	if mode == '--codes':
+		emit_codes(argv[2], codes)
+		return 0
+	if mode == '--database':
+		emit_database(argv[2], codes)
+		return 0
+	if mode == '--errno':
+		emit_errno(argv[2], codes)
+		return 0
+	if mode == '--subsystems':
+		emit_subsystems(argv[2], codes)
+		return 0
+	slots, displacements = place(codes)
+	emit(argv[2], 'MacErrors.h', codes, slots, displacements, classify(codes))
+	return 0
+
+
+if __name__ == '__main__':
+	sys.exit(main(sys.argv))
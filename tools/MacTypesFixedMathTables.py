@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+#
+# MacTypesFixedMathTables.py -- generates the tables used by src/MacTypesFixedMath.c.
+#
+# Usage: MacTypesFixedMathTables.py <output>
+#
+# Every value is computed with the decimal module to 60 digits and then rounded once to
+# the nearest double, written as a C99 hexadecimal constant so that no compiler rounds
+# it again:
+#
+#   gMacTypesFixedSinTable, gMacTypesFixedCosTable    sin and cos of i pi / 256, for i
+#                                                       from -64 to 64
+#   gMacTypesFixedATanTable                           atan(i / 64), for i from 0 to 64
+#   gMacTypesFixedExpTable                            e^(i / 64), for i from -768 to 672
+#
+# Constants used in argument reduction are split Cody-Waite fashion into a head with
+# few enough significant bits that its product with any quotient the reduction forms is
+# exact, and tails holding the rest.
+#
+
+import decimal
+import sys
+
+from decimal import Decimal
+
+decimal.getcontext().prec = 60
+
+
+def pi():
+	# The decimal module documentation's recipe.
+	with decimal.localcontext() as context:
+		context.prec += 2
+		three = Decimal(3)
+		lasts, t, s, n, na, d, da = 0, three, 3, 1, 0, 0, 24
+		while s != lasts:
+			lasts = s
+			n, na = n + na, na + 8
+			d, da = d + da, da + 32
+			t = (t * n) / d
+			s += t
+	return +s
+
+
+def sin(x):
+	with decimal.localcontext() as context:
+		context.prec += 2
+		i, lasts, s, fact, num, sign = 1, 0, x, 1, x, 1
+		while s != lasts:
+			lasts = s
+			i += 2
+			fact *= i * (i - 1)
+			num *= x * x
+			sign *= -1
+			s += num / fact * sign
+	return +s
+
+
+def cos(x):
+	with decimal.localcontext() as context:
+		context.prec += 2
+		i, lasts, s, fact, num, sign = 0, 0, 1, 1, 1, 1
+		while s != lasts:
+			lasts = s
+			i += 2
+			fact *= i * (i - 1)
+			num *= x * x
+			sign *= -1
+			s += num / fact * sign
+	return +s
+
+
+def atan(x):
+	# Halve the argument twice (atan x = 2 atan(x / (1 + sqrt(1 + x^2)))), then sum the series.
+	with decimal.localcontext() as context:
+		context.prec += 4
+		x = x / (1 + (1 + x * x).sqrt())
+		x = x / (1 + (1 + x * x).sqrt())
+		i, lasts, s, num, sign = 1, 0, x, x, 1
+		while s != lasts:
+			lasts = s
+			i += 2
+			num *= x * x
+			sign *= -1
+			s += num / i * sign
+		s *= 4
+	return +s
+
+
+def double(value):
+	return float(value)
+
+
+def head(value, bits):
+	"""The double nearest value, cut to its top bits significant bits."""
+	number = float(value)
+	scale = 0
+	while abs(number) >= 2.0 ** bits:
+		number /= 2
+		scale += 1
+	while abs(number) < 2.0 ** (bits - 1):
+		number *= 2
+		scale -= 1
+	return float(int(number)) * 2.0 ** scale
+
+
+def split(value, bits, parts):
+	"""value as parts doubles whose sum is value, all but the last cut to bits bits."""
+	pieces = []
+	rest = value
+	for _ in range(parts - 1):
+		piece = head(rest, bits)
+		pieces.append(piece)
+		rest = rest - Decimal(piece)
+	pieces.append(double(rest))
+	return pieces
+
+
+def constant(name, value, comment):
+	return 'static const double %-34s = %-24s /* %s */' % (name, value.hex() + ';', comment)
+
+
+def table(name, values, comment):
+	out = ['/* %s */' % comment, 'static const double %s[%d] = {' % (name, len(values))]
+	for row in range(0, len(values), 3):
+		out.append('\t' + ' '.join('%-24s' % (value.hex() + ',') for value in values[row:row + 3]).rstrip())
+	out.append('};')
+	return out
+
+
+def main(argv):
+	if len(argv) != 2:
+		sys.stderr.write('usage: %s <output>\n' % argv[0])
+		return 1
+	p = pi()
+	out = []
+
+	out.append(constant('kMacTypesFixedTwoOverPi', double(2 / p), '2 / pi'))
+	halfPi = split(p / 2, 32, 3)
+	out.append(constant('kMacTypesFixedHalfPi1', halfPi[0], 'pi / 2, 32 bits'))
+	out.append(constant('kMacTypesFixedHalfPi2', halfPi[1], 'the next 32 bits'))
+	out.append(constant('kMacTypesFixedHalfPi3', halfPi[2], 'the rest'))
+	out.append(constant('kMacTypesFixedTableStepsPerRadian', double(256 / p), '256 / pi'))
+	step = split(p / 256, 40, 2)
+	out.append(constant('kMacTypesFixedTableStep1', step[0], 'pi / 256, 40 bits'))
+	out.append(constant('kMacTypesFixedTableStep2', step[1], 'the rest'))
+	out.append(constant('kMacTypesFixedPi', double(p), 'pi'))
+	out.append(constant('kMacTypesFixedHalfPi', double(p / 2), 'pi / 2'))
+	out.append('')
+	out.extend(table('gMacTypesFixedSinTable', [double(sin(p * i / 256)) for i in range(-64, 65)],
+					 'sin(i pi / 256), i from -64 to 64'))
+	out.append('')
+	out.extend(table('gMacTypesFixedCosTable', [double(cos(p * i / 256)) for i in range(-64, 65)],
+					 'cos(i pi / 256), i from -64 to 64'))
+	out.append('')
+	out.extend(table('gMacTypesFixedATanTable', [double(atan(Decimal(i) / 64)) for i in range(0, 65)],
+					 'atan(i / 64), i from 0 to 64'))
+	out.append('')
+	out.extend(table('gMacTypesFixedExpTable', [double((Decimal(i) / 64).exp()) for i in range(-768, 673)],
+					 'e^(i / 64), i from -768 to 672'))
+	out.append('')
+
+	with open(argv[1], 'w') as header:
+		header.write('\n'.join(out))
+	return 0
+
+
+if __name__ == '__main__':
+	sys.exit(main(sys.argv))